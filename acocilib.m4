@@ -261,7 +261,7 @@ AC_DEFUN([OCILIB_ORACLE],
 
 	  #check for custom ld flags
 	  if test "$ac_ocilib_ld" = NO; then
-		ac_ocilib_ld="-ldl"
+		ac_ocilib_ld="-ldl -lpthread"
 	  fi
 
 	  AC_MSG_CHECKING([for loader linkage flag ])
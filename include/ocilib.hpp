@@ -210,6 +210,7 @@ namespace ocilib
 #include "ocilibcpp/detail/Enqueue.hpp"
 #include "ocilibcpp/detail/Dequeue.hpp"
 #include "ocilibcpp/detail/DirectPath.hpp"
+#include "ocilibcpp/detail/Batcher.hpp"
 #include "ocilibcpp/detail/Queue.hpp"
 #include "ocilibcpp/detail/QueueTable.hpp"
 
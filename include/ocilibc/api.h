@@ -1827,6 +1827,77 @@ OCI_EXPORT boolean OCI_API OCI_GetAutoCommit
     OCI_Connection *con
 );
 
+/**
+ * @brief
+ * Enable / disable commits performed by the execute calls in auto commit mode
+ *
+ * By default, in auto commit mode, OCILIB commits the current transaction with an
+ * extra server round trip after each successful execution.
+ * When this mode is enabled, the commit is requested within the execute call itself
+ * and no extra round trip is performed.
+ *
+ * @param con    - Connection handle
+ * @param enable - Enable (TRUE) or disable (FALSE)
+ *
+ * @warning
+ * For array DML executions, Oracle commits the rows successfully processed even if
+ * some rows are reported as batch errors whereas the default mode does not commit
+ * when batch errors are raised.
+ *
+ * @note
+ * This mode has no effect when auto commit mode is disabled
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetCommitOnExecute
+(
+    OCI_Connection *con,
+    boolean         enable
+);
+
+/**
+ * @brief
+ * Return TRUE if commits are performed by the execute calls in auto commit mode
+ *
+ * @param con - Connection handle
+ *
+ * @note
+ * Default value is FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetCommitOnExecute
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Return the number of server bound OCI calls performed by OCILIB for the given connection
+ *
+ * @param con - Connection handle
+ *
+ * @note
+ * The following calls are counted : session start, statement executions, fetches,
+ * commits, rollbacks, global transaction operations, pings, server version retrieval
+ * and type describes.
+ * LOB operations are not counted.
+ *
+ * @warning
+ * This is a count of OCI calls, not of network round trips. The Oracle client may serve
+ * a call without contacting the server (e.g. fetches served from the prefetch buffers)
+ * or perform several round trips within a single call.
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetServerCalls
+(
+    OCI_Connection *con
+);
+
 /**
  * @brief
  * Create a new global transaction or a serializable/read-only local transaction
@@ -2233,6 +2304,9 @@ OCI_EXPORT const otext * OCI_API OCI_GetSql
 * @note
 * The statement must be executed first
 *
+* @note
+* The value is retrieved on the first call following each execution
+*
 * @warning
 * Requires Oracle 12cR2 (both client and server side), otherwise it returns NULL
 * 
@@ -2540,6 +2614,57 @@ OCI_EXPORT boolean OCI_API OCI_IsRebindingAllowed
     OCI_Statement *stmt
 );
 
+/**
+ * @brief
+ * Enable or disable bind dirty tracking for the given statement
+ *
+ * @param stmt  - Statement handle
+ * @param value - Enable tracking
+ *
+ * @note
+ * Before each execution, OCILIB processes the input values of all binds
+ * (string conversions, numeric and date translations, length resets).
+ * When tracking is enabled, only the bind values modified since the previous
+ * execution are processed. This saves a lot of work when executing the same
+ * statement many times with few changes between executions.
+ *
+ * @note
+ * Values are marked as modified by the OCILIB bind setters (OCI_BindSetNull(),
+ * OCI_BindSetDataSize(), ...) and when the bind array size grows.
+ * OCILIB cannot detect direct writes to host variables: use OCI_BindSetDirty()
+ * or OCI_BindSetDirtyAtPos() after updating them.
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetBindDirtyTracking
+(
+    OCI_Statement *stmt,
+    boolean        value
+);
+
+/**
+ * @brief
+ * Indicate if bind dirty tracking is enabled for the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * See OCI_SetBindDirtyTracking() for more details
+ *
+ * @return
+ * TRUE if enabled otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetBindDirtyTracking
+(
+    OCI_Statement *stmt
+);
+
 /**
 * @brief
 * Bind a boolean variable (PL/SQL ONLY)
@@ -3271,6 +3396,133 @@ OCI_EXPORT boolean OCI_API OCI_BindArrayOfTimestamps
     unsigned int    nbelem
 );
 
+/**
+ * @brief
+ * Bind an array of epoch values
+ *
+ * @param stmt   - Statement handle
+ * @param name   - Variable name
+ * @param data   - Array of big integers holding times elapsed since 1970-01-01 00:00:00 UTC
+ * @param unit   - Epoch unit
+ * @param nbelem - Number of element in the array (PL/SQL table only)
+ *
+ * @warning
+ * Parameter 'nbelem' SHOULD ONLY be USED for PL/SQL tables.
+ * For regular DML array operations, pass the value 0.
+ *
+ * @note
+ * Possible values for parameter 'unit' :
+ * - OCI_DTM_EPOCH       : seconds, values are encoded in the Oracle DATE internal format
+ * - OCI_DTM_EPOCH_MILLI : milliseconds, values are bound as TIMESTAMP to keep fractional seconds
+ * - OCI_DTM_EPOCH_MICRO : microseconds, values are bound as TIMESTAMP to keep fractional seconds
+ * - OCI_DTM_EPOCH_NANO  : nanoseconds, values are bound as TIMESTAMP to keep fractional seconds
+ *
+ * @note
+ * Values are converted in place from the program array at execute time, without any
+ * OCI_Date or OCI_Timestamp handle. Values are not time zone adjusted.
+ * Valid values are between years 1 and 9999. Execution fails for any other value.
+ *
+ * @note
+ * Unless the bind direction is set to OCI_BDM_IN, values are decoded back into the
+ * program array after execution.
+ *
+ * @note
+ * parameter 'data' CANNOT be NULL resulting OCI_BAM_INTERNAL bind allocation mode being NOT supported
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindArrayOfEpochs
+(
+    OCI_Statement *stmt,
+    const otext *  name,
+    big_int *      data,
+    unsigned int   unit,
+    unsigned int   nbelem
+);
+
+/**
+ * @brief
+ * Bind an array of struct tm values
+ *
+ * @param stmt   - Statement handle
+ * @param name   - Variable name
+ * @param data   - Array of struct tm
+ * @param nbelem - Number of element in the array (PL/SQL table only)
+ *
+ * @warning
+ * Parameter 'nbelem' SHOULD ONLY be USED for PL/SQL tables.
+ * For regular DML array operations, pass the value 0.
+ *
+ * @note
+ * Values are encoded in the Oracle DATE internal format at execute time, without any
+ * OCI_Date handle. Fields tm_wday, tm_yday and tm_isdst are ignored.
+ *
+ * @note
+ * parameter 'data' CANNOT be NULL resulting OCI_BAM_INTERNAL bind allocation mode being NOT supported
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindArrayOfTms
+(
+    OCI_Statement *stmt,
+    const otext *  name,
+    struct tm *    data,
+    unsigned int   nbelem
+);
+
+/**
+ * @brief
+ * Bind the columns of an Arrow record batch as array binds
+ *
+ * @param stmt   - Statement handle
+ * @param schema - Arrow schema of the record batch (struct type)
+ * @param array  - Arrow record batch (struct array)
+ *
+ * @note
+ * The bind array size is set to the number of rows of the batch and each column is
+ * bound to the placeholder named ':' followed by the column name. When the statement
+ * binds by position (OCI_BIND_BY_POS), columns are bound by position instead.
+ *
+ * @note
+ * Supported Arrow formats and their binds:
+ * - int16, int32, int64 and their unsigned counterparts : integer array binds
+ * - float32 and float64 : float and double array binds
+ * - timestamp with any unit and time zone : epoch array binds (see OCI_BindArrayOfEpochs())
+ * - utf8 : string array binds
+ * - binary : raw array binds
+ *
+ * @note
+ * Numeric and timestamp buffers are bound in place, without any copy.
+ * Thus the record batch must not be released before the statement is executed.
+ * utf8 and binary values are copied into fixed size elements owned by the binds.
+ * The validity bitmaps are translated to the bind null indicators.
+ *
+ * @warning
+ * utf8 values are handed over as is in ANSI builds. The client character set
+ * (NLS_LANG) must be AL32UTF8 for non ASCII values. In Unicode builds, they are
+ * decoded to wide strings.
+ *
+ * @note
+ * The statement must be prepared. The columns are bound with the OCI_BAM_EXTERNAL
+ * bind allocation mode whatever the mode set with OCI_SetBindAllocation().
+ * The batch can be bound again to another record batch with the same schema if
+ * OCI_SetBindReuse() is enabled.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindArrowBatch
+(
+    OCI_Statement *           stmt,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray * array
+);
+
 /**
  * @brief
  * Bind an interval variable
@@ -3658,6 +3910,63 @@ OCI_EXPORT boolean OCI_API OCI_BindLong
     unsigned int   size
 );
 
+/**
+ * @brief
+ * Bind an input variable whose values are supplied by a producer callback at execute time
+ *
+ * @param stmt     - Statement handle
+ * @param name     - Variable name
+ * @param type     - Value type
+ * @param subtype  - Value subtype
+ * @param len      - Maximum value length (characters for strings, bytes for raws)
+ * @param producer - Callback returning the value of each DML iteration
+ * @param ctx      - User context pointer passed to the producer
+ *
+ * @note
+ * Supported types and subtypes are :
+ * - OCI_CDT_NUMERIC : any OCI_NUM_XXX subtype except OCI_NUM_NUMBER (pointer to the C scalar)
+ * - OCI_CDT_TEXT    : subtype ignored (pointer to an otext string)
+ * - OCI_CDT_RAW     : subtype ignored (pointer to a buffer)
+ * - OCI_CDT_DATETIME: subtype ignored (pointer to an OCI_Date handle)
+ *
+ * @note
+ * Values are not copied into OCILIB buffers : for each iteration of the execution, the producer
+ * is called and its value is passed to Oracle before the next call.
+ * Thus, the producer can reuse the same storage for all iterations.
+ * It allows array DML with a large number of iterations (see OCI_BindArraySetSize()) without
+ * having to allocate and fill full host arrays.
+ *
+ * @note
+ * For strings, if the size returned by the producer is 0, the string length is computed.
+ * Values longer than the given maximum length are truncated.
+ *
+ * @note
+ * Null values are given by the producer returning a NULL data pointer.
+ * As streaming binds do not hold host arrays, the calls operating on the values of a given
+ * position (OCI_BindSetNull(), OCI_BindSetNullAtPos(), OCI_BindSetNotNull(),
+ * OCI_BindSetNotNullAtPos(), OCI_BindIsNull(), OCI_BindIsNullAtPos(), OCI_BindSetDataSize(),
+ * OCI_BindSetDataSizeAtPos(), OCI_BindSetDataSizes(), OCI_BindSetNullBitmap(),
+ * OCI_BindSetIndicators(), OCI_BindGetIndicators() and OCI_BindSetIndicatorArray())
+ * fail with the error OCI_ERR_NOT_COMPATIBLE, and OCI_BindGetDataCount() returns 1.
+ *
+ * @warning
+ * Streaming binds cannot be rebound
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindStream
+(
+    OCI_Statement *    stmt,
+    const otext *      name,
+    unsigned int       type,
+    unsigned int       subtype,
+    unsigned int       len,
+    POCI_BIND_PRODUCER producer,
+    void *             ctx
+);
+
 /**
  * @brief
  * Returns the first or next error that occurred within a DML array statement execution
@@ -3892,6 +4201,14 @@ OCI_EXPORT unsigned int OCI_API OCI_BindGetType
  * - OCI_BLONG
  * - OCI_CLONG
  *
+ * For date binds created with OCI_BindArrayOfEpochs() or OCI_BindArrayOfTms(),
+ * the possible values are:
+ * - OCI_DTM_EPOCH
+ * - OCI_DTM_EPOCH_MILLI
+ * - OCI_DTM_EPOCH_MICRO
+ * - OCI_DTM_EPOCH_NANO
+ * - OCI_DTM_TM
+ *
  * For OCI_Lob type the possible values are:
  * - OCI_BLOB
  * - OCI_CLOB
@@ -4074,6 +4391,62 @@ OCI_EXPORT unsigned int OCI_API OCI_BindGetDataSizeAtPos
     unsigned int position
 );
 
+/**
+ * @brief
+ * Set the sizes of the first 'count' elements of the bind input array in one call
+ *
+ * @param bnd   - bind handle
+ * @param sizes - Array of data sizes
+ * @param count - Number of elements in the 'sizes' array
+ *
+ * @note
+ * See OCI_BindSetDataSize() for supported data types
+ *
+ * @note
+ * Unlike OCI_BindSetDataSizeAtPos(), a zero size is accepted and sends an empty
+ * value (which Oracle considers as NULL).
+ *
+ * @warning
+ * For binds of type OCI_CDT_TEXT (strings), sizes are expressed in number of characters.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindSetDataSizes
+(
+    OCI_Bind           *bnd,
+    const unsigned int *sizes,
+    unsigned int        count
+);
+
+/**
+ * @brief
+ * Retrieve the actual sizes of the first 'count' elements of the bind array in one call
+ *
+ * @param bnd   - bind handle
+ * @param sizes - Array receiving the data sizes
+ * @param count - Number of elements in the 'sizes' array
+ *
+ * @note
+ * See OCI_BindSetDataSize() for supported data types
+ *
+ * @warning
+ * For binds of type OCI_CDT_TEXT (strings), sizes are expressed in number of characters.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindGetDataSizes
+(
+    OCI_Bind     *bnd,
+    unsigned int *sizes,
+    unsigned int  count
+);
+
 /**
  * @brief
  * Set the bind variable to null
@@ -4198,61 +4571,213 @@ OCI_EXPORT boolean OCI_API OCI_BindIsNull
 
 /**
  * @brief
- * Check if the current entry value at the given index of the binded array
- * is marked as NULL
+ * Set the null status of the first 'count' elements of the bind array from a bitmap
  *
- * @param bnd      - Bind handle
- * @param position - Position in the array
+ * @param bnd    - Bind handle
+ * @param bitmap - Bitmap holding one bit per element
+ * @param count  - Number of elements described by the bitmap
  *
- * @warning
- * Position starts with 1
+ * @note
+ * Element i is set to null if bit (i % 8) of byte (i / 8) is set, otherwise it is set to not null.
+ * The bitmap must hold at least (count + 7) / 8 bytes.
+ *
+ * @note
+ * This call is equivalent to calling OCI_BindSetNullAtPos() or OCI_BindSetNotNullAtPos()
+ * for each element but performs a single call for the whole array
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_BindIsNullAtPos
+OCI_EXPORT boolean OCI_API OCI_BindSetNullBitmap
 (
-    OCI_Bind *   bnd,
-    unsigned int position
+    OCI_Bind            *bnd,
+    const unsigned char *bitmap,
+    unsigned int         count
 );
 
 /**
  * @brief
- * Set the charset form of the given character based bind variable
+ * Set the null status of the first 'count' elements of the bind array from an indicators array
  *
  * @param bnd   - Bind handle
- * @param csfrm - charset form
- *
- * @note
- * Possible values are :
- *
- * - OCI_CSF_DEFAULT : the column has default charset
- * - OCI_CSF_NATIONAL: the column has national charset
+ * @param inds  - Array of indicators
+ * @param count - Number of elements in the 'inds' array
  *
  * @note
- * This call has to be made after OCI_Prepare() but before OCI_Execute()
- *
- * @warning
- * This call does nothing :
- *  - if the csform is out of range
- *  - if the bind type is not OCI_CFT_TEXT or OCI_CDT_LONG
+ * Negative indicators (usually -1) set the matching element to null.
+ * Other values set it to not null.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-boolean OCI_API OCI_BindSetCharsetForm
+OCI_EXPORT boolean OCI_API OCI_BindSetIndicators
 (
-    OCI_Bind *   bnd,
-    unsigned int csfrm
+    OCI_Bind    *bnd,
+    const short *inds,
+    unsigned int count
 );
 
 /**
  * @brief
- * Get the allocation mode of a bind handle
+ * Retrieve the indicators of the first 'count' elements of the bind array in one call
+ *
+ * @param bnd   - Bind handle
+ * @param inds  - Array receiving the indicators
+ * @param count - Number of elements in the 'inds' array
+ *
+ * @note
+ * Null elements have a -1 indicator
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindGetIndicators
+(
+    OCI_Bind    *bnd,
+    short       *inds,
+    unsigned int count
+);
+
+/**
+ * @brief
+ * Make the bind use an indicators array owned by the program
+ *
+ * @param bnd  - Bind handle
+ * @param inds - Array of indicators or NULL to restore an internal array
+ *
+ * @note
+ * Once set, the program updates the null status of the bind elements directly in its
+ * own array (-1 for null, 0 for not null) without any further call.
+ * The array is read by Oracle at execute time and is never freed by OCILIB.
+ *
+ * @note
+ * The array must hold at least as many elements as the bind array size given at bind time.
+ * It must remain valid until the bind is freed or another array is set.
+ *
+ * @note
+ * Object binds, OCI_Long binds, streaming binds and register binds are not supported.
+ *
+ * @warning
+ * When dirty bind tracking is enabled (see OCI_SetBindDirtyTracking()), changes made directly
+ * in the array for handle based binds (dates, timestamps, LOBs, ...) must be reported with
+ * OCI_BindSetDirty() or OCI_BindSetDirtyAtPos()
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindSetIndicatorArray
+(
+    OCI_Bind *bnd,
+    short    *inds
+);
+
+/**
+ * @brief
+ * Mark the host variable of the given bind as modified
+ *
+ * @param bnd - Bind handle
+ *
+ * @note
+ * Only useful when bind dirty tracking is enabled (see OCI_SetBindDirtyTracking()).
+ * For array binds, all entries are marked as modified
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindSetDirty
+(
+    OCI_Bind *bnd
+);
+
+/**
+ * @brief
+ * Mark the given entry of the bind input array as modified
+ *
+ * @param bnd      - Bind handle
+ * @param position - Position in the array
+ *
+ * @note
+ * Only useful when bind dirty tracking is enabled (see OCI_SetBindDirtyTracking())
+ *
+ * @warning
+ * Position starts with 1
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindSetDirtyAtPos
+(
+    OCI_Bind *   bnd,
+    unsigned int position
+);
+
+/**
+ * @brief
+ * Check if the current entry value at the given index of the binded array
+ * is marked as NULL
+ *
+ * @param bnd      - Bind handle
+ * @param position - Position in the array
+ *
+ * @warning
+ * Position starts with 1
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_BindIsNullAtPos
+(
+    OCI_Bind *   bnd,
+    unsigned int position
+);
+
+/**
+ * @brief
+ * Set the charset form of the given character based bind variable
+ *
+ * @param bnd   - Bind handle
+ * @param csfrm - charset form
+ *
+ * @note
+ * Possible values are :
+ *
+ * - OCI_CSF_DEFAULT : the column has default charset
+ * - OCI_CSF_NATIONAL: the column has national charset
+ *
+ * @note
+ * This call has to be made after OCI_Prepare() but before OCI_Execute()
+ *
+ * @warning
+ * This call does nothing :
+ *  - if the csform is out of range
+ *  - if the bind type is not OCI_CFT_TEXT or OCI_CDT_LONG
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+boolean OCI_API OCI_BindSetCharsetForm
+(
+    OCI_Bind *   bnd,
+    unsigned int csfrm
+);
+
+/**
+ * @brief
+ * Get the allocation mode of a bind handle
  *
  * @param bnd - Bind handle
  *
@@ -5588,6 +6113,60 @@ OCI_EXPORT unsigned int OCI_API OCI_GetRaw2
     unsigned int   len
 );
 
+/**
+ * @brief
+ * Return a pointer to the internal buffer holding the current raw value of the column at the given index
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ * @param size  - Pointer to a variable that receives the size in bytes of the raw value
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @note
+ * Unlike OCI_GetRaw(), no copy is performed.
+ * The returned buffer is owned by the resultset and remains valid until the next fetch
+ *
+ * @return
+ * Pointer to the raw value on SUCCESS otherwise NULL if the column is NULL or not a RAW column
+ *
+ */
+
+OCI_EXPORT const void * OCI_API OCI_GetRawBuffer
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int  *size
+);
+
+/**
+ * @brief
+ * Return a pointer to the internal buffer holding the current raw value of the column from its name
+ *
+ * @param rs    - Resultset handle
+ * @param name  - Column name
+ * @param size  - Pointer to a variable that receives the size in bytes of the raw value
+ *
+ * @note
+ * The column name is case insensitive
+ *
+ * @note
+ * Unlike OCI_GetRaw2(), no copy is performed.
+ * The returned buffer is owned by the resultset and remains valid until the next fetch
+ *
+ * @return
+ * Pointer to the raw value on SUCCESS otherwise NULL if the column is NULL or not a RAW column
+ *
+ */
+
+OCI_EXPORT const void * OCI_API OCI_GetRawBuffer2
+(
+    OCI_Resultset *rs,
+    const otext *  name,
+    unsigned int  *size
+);
+
 /**
  * @brief
  * Return the current double value of the column at the given index in the resultset
@@ -5750,6 +6329,105 @@ OCI_EXPORT OCI_Timestamp * OCI_API OCI_GetTimestamp2
     const otext *  name
 );
 
+/**
+ * @brief
+ * Return the current date or timestamp value of the column at the given index
+ * in the resultset as an epoch value
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ * @param unit  - Epoch unit (OCI_DTM_EPOCH, OCI_DTM_EPOCH_MILLI, OCI_DTM_EPOCH_MICRO or OCI_DTM_EPOCH_NANO)
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @note
+ * The fetched buffer is decoded directly, no OCI_Date or OCI_Timestamp handle is created.
+ * Values of time zone aware columns are returned relative to UTC.
+ *
+ * @return
+ * The column current row value or 0 if the value is NULL or the column is not a date
+ * or timestamp column
+ *
+ */
+
+OCI_EXPORT big_int OCI_API OCI_GetEpoch
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int   unit
+);
+
+/**
+ * @brief
+ * Return the current date or timestamp value of the column from its name
+ * in the resultset as an epoch value
+ *
+ * @param rs    - Resultset handle
+ * @param name  - Column name
+ * @param unit  - Epoch unit (OCI_DTM_EPOCH, OCI_DTM_EPOCH_MILLI, OCI_DTM_EPOCH_MICRO or OCI_DTM_EPOCH_NANO)
+ *
+ * @return
+ * The column current row value or 0 if no column found with the given name
+ *
+ */
+
+OCI_EXPORT big_int OCI_API OCI_GetEpoch2
+(
+    OCI_Resultset *rs,
+    const otext *  name,
+    unsigned int   unit
+);
+
+/**
+ * @brief
+ * Fill a struct tm with the current date or timestamp value of the column at the
+ * given index in the resultset
+ *
+ * @param rs    - Resultset handle
+ * @param index - Column position
+ * @param value - struct tm to fill
+ *
+ * @note
+ * Column position starts at 1.
+ *
+ * @note
+ * The fetched buffer is decoded directly, no OCI_Date or OCI_Timestamp handle is created.
+ * Fractional seconds are discarded and time zone aware values are given in their own time zone.
+ *
+ * @return
+ * TRUE if a value has been retrieved otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetTm
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    struct tm *    value
+);
+
+/**
+ * @brief
+ * Fill a struct tm with the current date or timestamp value of the column from its
+ * name in the resultset
+ *
+ * @param rs    - Resultset handle
+ * @param name  - Column name
+ * @param value - struct tm to fill
+ *
+ * @return
+ * TRUE if a value has been retrieved otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetTm2
+(
+    OCI_Resultset *rs,
+    const otext *  name,
+    struct tm *    value
+);
+
 /**
  * @brief
  * Return the current interval value of the column at the given index in the resultset
@@ -8409,19 +9087,115 @@ OCI_EXPORT unsigned int OCI_API OCI_GetLongMode
 
 /**
  * @brief
- * Return the connection handle associated with a statement handle
+ * Set the LOB data type handling mode of a SQL statement
  *
  * @param stmt - Statement handle
+ * @param mode - lob mode value
+ *
+ * @note
+ * Possible values are :
+ *
+ * - OCI_LOB_LOCATOR : BLOBs, CLOBs and NCLOBs are fetched as locators handled by OCI_Lob type
+ * - OCI_LOB_INLINE  : BLOBs are fetched as raw values and CLOBs/NCLOBs as string values,
+ *   directly into the fetch array without allocating any locator
+ *
+ * @note
+ * Default value is OCI_LOB_LOCATOR
+ *
+ * @note
+ * With OCI_LOB_INLINE, LOB columns values are retrieved using OCI_GetString()
+ * or OCI_GetRaw() without any extra server round trip.
+ * Values are limited to the size given to OCI_SetLobInlineSize(). Larger values are
+ * truncated by OCI and OCI reports a warning for the fetch call. Retrieving such a
+ * value with OCI_GetString() or OCI_GetRaw() raises an OCI_ERR_MAX_VALUE error instead
+ * of returning the truncated data. Thus, the inline mode is meant for small LOB values
+ * and OCI_LOB_LOCATOR must be used for larger ones.
+ *
+ * @warning
+ * The mode must be set before executing the statement.
+ * It does not apply to LOB placeholders of returning into clauses
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Connection * OCI_API OCI_StatementGetConnection
+OCI_EXPORT boolean OCI_API OCI_SetLobMode
 (
-    OCI_Statement *stmt
+    OCI_Statement *stmt,
+    unsigned int   mode
 );
 
 /**
- * @} OcilibCApiStatementControl
+ * @brief
+ * Return the LOB data type handling mode of a SQL statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ *  See OCI_SetLobMode() for possible values
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetLobMode
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Set the maximum size of LOB values fetched in OCI_LOB_INLINE mode
+ *
+ * @param stmt - Statement handle
+ * @param size - maximum size in characters for CLOBs and in bytes for BLOBs
+ *
+ * @note
+ * The fetch buffers are sized accordingly for each row of the fetch array.
+ * The resulting buffer size in bytes, including the string terminator for CLOBs,
+ * must not exceed OCI_SIZE_LONG, otherwise an OCI_ERR_MAX_VALUE error is raised
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetLobInlineSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+);
+
+/**
+ * @brief
+ * Return the maximum size of LOB values fetched in OCI_LOB_INLINE mode
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Default value is set to constant OCI_SIZE_LOB_INLINE
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetLobInlineSize
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Return the connection handle associated with a statement handle
+ *
+ * @param stmt - Statement handle
+ *
+ */
+
+OCI_EXPORT OCI_Connection * OCI_API OCI_StatementGetConnection
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @} OcilibCApiStatementControl
  */
 
 /**
@@ -8749,6 +9523,194 @@ OCI_EXPORT boolean OCI_API OCI_LobWrite2
     unsigned int *byte_count
 );
 
+/**
+ * @brief
+ * Read a portion of several lobs into the given buffers in a single server round trip
+ *
+ * @param lobs        - Array of lob handles
+ * @param count       - Number of lobs
+ * @param buffers     - Array of pointers to buffers (one per lob)
+ * @param char_counts - [in/out] Array of maximum number of characters (one per lob)
+ * @param byte_counts - [in/out] Array of maximum number of bytes (one per lob)
+ *
+ * @note
+ * Each lob is read from its current offset as with OCI_LobRead2() and the
+ * counts of each lob follow the same rules
+ *
+ * @note
+ * All lobs must have the same type and belong to the same connection.
+ * The lobs can be, for example, the locators fetched from a lob column
+ * (OCI_GetLob() on each row of a fetch block) or an array created with
+ * OCI_LobArrayCreate()
+ *
+ * @note
+ * This call requires Oracle 10gR2 client and 64 bits lob support.
+ * Otherwise, OCI_LobRead2() is called for each lob
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobArrayRead
+(
+    OCI_Lob **    lobs,
+    unsigned int  count,
+    void **       buffers,
+    unsigned int *char_counts,
+    unsigned int *byte_counts
+);
+
+/**
+ * @brief
+ * Write buffers into several lobs in a single server round trip
+ *
+ * @param lobs        - Array of lob handles
+ * @param count       - Number of lobs
+ * @param buffers     - Array of pointers to buffers (one per lob)
+ * @param char_counts - [in/out] Array of maximum number of characters (one per lob)
+ * @param byte_counts - [in/out] Array of maximum number of bytes (one per lob)
+ *
+ * @note
+ * Each buffer is written at the current offset of its lob as with OCI_LobWrite2()
+ * and the counts of each lob follow the same rules
+ *
+ * @note
+ * All lobs must have the same type and belong to the same connection
+ *
+ * @note
+ * This call requires Oracle 10gR2 client and 64 bits lob support.
+ * Otherwise, OCI_LobWrite2() is called for each lob
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobArrayWrite
+(
+    OCI_Lob **    lobs,
+    unsigned int  count,
+    void **       buffers,
+    unsigned int *char_counts,
+    unsigned int *byte_counts
+);
+
+/**
+ * @brief
+ * Stream the content of a lob to a user sink
+ *
+ * @param lob  - Lob handle
+ * @param size - Maximum number of characters or bytes to read (0 to read up to the end of the lob)
+ * @param sink - Callback receiving the content by pieces
+ * @param ctx  - User context pointer passed to the sink
+ *
+ * @note
+ * The content is read from the current lob offset, that is moved past the data read.
+ *
+ * @note
+ * The pieces are read into a buffer allocated once for the whole call. Its size is a
+ * multiple of the lob chunk size (see OCI_LobGetChunkSize()).
+ * With Oracle 10g clients and 64 bits lob support, the lob is streamed by a single OCI
+ * call in callback mode. Otherwise, pieces are read with successive calls to OCI_LobRead2()
+ *
+ * @note
+ * For CLOBs and NCLOBs, pieces hold otext characters and piece sizes are expressed in bytes.
+ * With UTF8 strings, a multi bytes character can be split on two pieces.
+ *
+ * @note
+ * If the sink returns FALSE, the read is stopped and the function returns TRUE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobStreamRead
+(
+    OCI_Lob *     lob,
+    big_uint      size,
+    POCI_LOB_SINK sink,
+    void *        ctx
+);
+
+/**
+ * @brief
+ * Stream the content provided by a user source into a lob
+ *
+ * @param lob    - Lob handle
+ * @param source - Callback providing the content by pieces
+ * @param ctx    - User context pointer passed to the source
+ *
+ * @note
+ * The content is written at the current lob offset, that is moved past the data written.
+ * The source is called until it returns 0
+ *
+ * @note
+ * The source fills buffers allocated once for the whole call and whose size is a
+ * multiple of the lob chunk size (see OCI_LobGetChunkSize()).
+ * With Oracle 10g clients and 64 bits lob support, the lob is streamed by a single OCI
+ * call in callback mode. Otherwise, pieces are written with successive calls to OCI_LobWrite2()
+ *
+ * @note
+ * For CLOBs and NCLOBs, pieces must hold otext characters and piece sizes are expressed in bytes
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobStreamWrite
+(
+    OCI_Lob *       lob,
+    POCI_LOB_SOURCE source,
+    void *          ctx
+);
+
+/**
+ * @brief
+ * Stream the content of a lob into a file
+ *
+ * @param lob      - Lob handle
+ * @param size     - Maximum number of characters or bytes to read (0 to read up to the end of the lob)
+ * @param filename - Path of the file to create
+ *
+ * @note
+ * See OCI_LobStreamRead(). For CLOBs and NCLOBs, the file receives otext characters
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobStreamToFile
+(
+    OCI_Lob *     lob,
+    big_uint      size,
+    const otext * filename
+);
+
+/**
+ * @brief
+ * Stream the content of a file into a lob
+ *
+ * @param lob      - Lob handle
+ * @param filename - Path of the file to read
+ *
+ * @note
+ * See OCI_LobStreamWrite(). For CLOBs and NCLOBs, the file must hold otext characters
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_LobStreamFromFile
+(
+    OCI_Lob *     lob,
+    const otext * filename
+);
+
 /**
  * @brief
  * Truncate the given lob to a shorter length
@@ -12945,7 +13907,8 @@ OCI_EXPORT boolean OCI_API OCI_RefToText
  *   call each function until its has completed its job
  *
  * OCILIB implements OCI in blocking mode. The application has to wait for OCI
- * calls to complete to continue.
+ * calls to complete to continue (see @ref OcilibCApiAsync for non blocking
+ * executions and fetches).
  *
  * Some operations can be long to be processed by the server.
  *
@@ -12983,6 +13946,141 @@ OCI_EXPORT boolean OCI_API OCI_Break
  * @} OcilibCApiAbort
  */
 
+/**
+ * @defgroup OcilibCApiAsync Asynchronous executions and fetches
+ * @{
+ *
+ * OCILIB can start statement executions and fetches without waiting for the server
+ * to process them, using the OCI non-blocking mode of the connection server handle.
+ *
+ * A call to OCI_ExecuteAsync() or OCI_FetchAsync() sends the request and returns
+ * immediately. The application then calls OCI_AsyncPoll() whenever it wants (e.g. from
+ * an event loop) until the returned status is not OCI_ASYNC_PENDING anymore.
+ * Thus, a single thread can drive many in-flight statements opened on different connections.
+ *
+ * Possible status returned by OCI_AsyncPoll() :
+ * - OCI_ASYNC_NONE    : no asynchronous call started or the last one was cancelled
+ * - OCI_ASYNC_PENDING : the call is still processed by the server
+ * - OCI_ASYNC_DONE    : the call has completed, see OCI_AsyncGetResult()
+ * - OCI_ASYNC_FAILED  : the call has failed and the error has been raised
+ *
+ * @note
+ * Only one asynchronous call can be pending on a given connection and no other call
+ * involving a server round trip must be performed on this connection until it completes.
+ * Starting another asynchronous call, preparing or executing a statement, fetching rows,
+ * committing, rolling back, managing transactions, writing LONGs, describing types or
+ * pinging the server on the connection raises an OCI_ERR_ASYNC_PENDING error.
+ * Other round trips (e.g. LOB operations) are not checked and must be avoided by the program.
+ *
+ * @note
+ * When statement profiling is enabled (see OCI_SetProfiling()), asynchronous
+ * executions and fetches are profiled. Their elapsed time runs from the start of the call
+ * to the OCI_AsyncPoll() call that completes it.
+ *
+ * @note
+ * Non-blocking mode is only enabled for the duration of the asynchronous call.
+ * Piecewise operations (LONG columns) and commits performed in auto commit mode
+ * when the call completes are processed in blocking mode.
+ *
+ */
+
+/**
+ * @brief
+ * Start the execution of a prepared SQL statement or PL/SQL block without waiting for its completion
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * Use OCI_AsyncPoll() to complete the execution
+ *
+ * @return
+ * TRUE if the execution was started otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Start fetching the next row of the resultset without waiting for the server
+ *
+ * @param rs - Resultset handle
+ *
+ * @note
+ * If the next row is already available in the fetch buffer, the call completes immediately.
+ * Otherwise, the next block of rows is requested to the server.
+ *
+ * @note
+ * Once OCI_AsyncPoll() returns OCI_ASYNC_DONE, OCI_AsyncGetResult() returns TRUE
+ * if a row has been fetched and FALSE if the end of the resultset has been reached
+ *
+ * @return
+ * TRUE if the fetch was started otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_FetchAsync
+(
+    OCI_Resultset *rs
+);
+
+/**
+ * @brief
+ * Make progress on the pending asynchronous call of the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * This call never blocks waiting for the server
+ *
+ * @return
+ * OCI_ASYNC_NONE, OCI_ASYNC_PENDING, OCI_ASYNC_DONE or OCI_ASYNC_FAILED
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_AsyncPoll
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Return the result of the last completed asynchronous call of the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @return
+ * For executions, TRUE on success. For fetches, TRUE if a row has been fetched
+ */
+
+OCI_EXPORT boolean OCI_API OCI_AsyncGetResult
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @brief
+ * Cancel the pending asynchronous call of the given statement
+ *
+ * @param stmt - Statement handle
+ *
+ * @note
+ * The call is aborted on the server and the connection is switched back to blocking mode.
+ * A pending call is automatically cancelled when its statement or connection is freed.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_AsyncCancel
+(
+    OCI_Statement *stmt
+);
+
+/**
+ * @} OcilibCApiAsync
+ */
+
 /**
  * @defgroup OcilibCApiMetadata Describing Schema Meta data and Objects
  * @{
@@ -13421,10 +14519,75 @@ OCI_EXPORT boolean OCI_DescribeFmt
 );
 
 /**
- * @} OcilibCApiFormatting
- */
-
-/**
+ * @brief
+ * Enable or disable the binding of input values in formatted functions
+ *
+ * @param con    - Connection handle
+ * @param enable - Enable binding of input values
+ *
+ * @note
+ * By default, formatted functions insert input values as SQL literals in the SQL text.
+ * Thus every call with different values produces a distinct SQL statement that must be
+ * hard parsed by the server and cannot be reused by the statement cache.
+ *
+ * @note
+ * When enabled, input values are replaced by bind placeholders (':1', ':2', ...) and are
+ * bound with their native types. Calls with different values share the same SQL text.
+ * The following identifiers are still inserted in the SQL text:
+ * - '%m' : meta data strings (table or column names, ...)
+ * - '%r' : references
+ *
+ * @note
+ * NULL input values are bound as NULL strings.
+ *
+ * @note
+ * DDL statements do not support bind variables. Formatted calls on SQL statements starting with
+ * ALTER, ANALYZE, AUDIT, COMMENT, CREATE, DROP, GRANT, NOAUDIT, PURGE, RENAME, REVOKE or TRUNCATE
+ * keep inserting input values as SQL literals, whatever the value of this option.
+ *
+ * @warning
+ * Input values are copied, except for OCI_Date, OCI_Timestamp, OCI_Interval and OCI_Number
+ * handles that are bound directly. When using OCI_PrepareFmt(), these handles must remain
+ * valid until the statement is executed.
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetFormatBinding
+(
+    OCI_Connection *con,
+    boolean         enable
+);
+
+/**
+ * @brief
+ * Indicate if input values of formatted functions are bound
+ *
+ * @param con - Connection handle
+ *
+ * @note
+ * See OCI_SetFormatBinding() for more details
+ *
+ * @return
+ * TRUE if enabled otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_GetFormatBinding
+(
+    OCI_Connection *con
+);
+
+/**
+ * @} OcilibCApiFormatting
+ */
+
+/**
  * @defgroup OcilibCApiHashTables Hash tables
  * @{
  *
@@ -14154,6 +15317,118 @@ OCI_EXPORT boolean OCI_API OCI_DirPathSetEntry
     boolean      complete
 );
 
+/**
+ * @brief
+ * Set all the entries of a column from a caller column vector
+ *
+ * @param dp    - Direct path Handle
+ * @param index - Column index
+ * @param data  - Array of values
+ * @param size  - Size in bytes of an element of the array of values
+ * @param lens  - Array of values sizes (optional)
+ * @param nulls - Null bitmap (optional)
+ *
+ * @note
+ * The vectors hold one element per row of the current batch
+ * (see OCI_DirPathSetCurrentRows()). Element i starts at offset i * size in
+ * the 'data' buffer.
+ *
+ * @note
+ * Values sizes are expressed as for OCI_DirPathSetEntry(). If 'lens' is NULL,
+ * binary values are 'size' bytes long and other values are null terminated strings.
+ *
+ * @note
+ * Element i is null if bit (i % 8) of byte (i / 8) of the 'nulls' bitmap is set,
+ * as for OCI_BindSetNullBitmap()
+ *
+ * @note
+ * When the column values do not need a client side conversion (binary columns,
+ * string columns when no Unicode conversion is required, and date or numeric
+ * columns without numeric format in ANSI builds), the column array entries point
+ * directly to the caller vectors that are then read by OCI_DirPathConvert().
+ * In that case, these vectors must remain valid and unchanged until the next call
+ * to OCI_DirPathReset(). Otherwise, values are copied by this call.
+ *
+ * @note
+ * Values used in place are not truncated : a value longer than the maximum size of
+ * its column is reported by OCI_DirPathConvert() as a conversion error. In default
+ * conversion mode, the conversion fails with the error OCI_ERR_MAX_VALUE. In force
+ * mode, the row is rejected and retrieved with OCI_DirPathGetErrorRow().
+ *
+ * @note
+ * A later call to OCI_DirPathSetEntry() for the same column replaces the whole
+ * column vector by the internal buffers
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathSetColumnData
+(
+    OCI_DirPath *  dp,
+    unsigned int   index,
+    void *         data,
+    unsigned int   size,
+    unsigned int * lens,
+    unsigned char *nulls
+);
+
+/**
+ * @brief
+ * Set the rows of the direct path column array from an Arrow record batch
+ *
+ * @param dp     - Direct path Handle
+ * @param schema - Arrow schema of the record batch (struct type)
+ * @param array  - Arrow record batch (struct array)
+ *
+ * @note
+ * The batch columns are mapped by position to the direct path columns and the
+ * number of current rows is set to the number of rows of the batch that cannot exceed
+ * OCI_DirPathGetMaxRows().
+ *
+ * @note
+ * Supported Arrow formats :
+ * - utf8 : character, numeric and date columns
+ * - binary : binary columns (RAW, LONG RAW, BLOB)
+ * - int16, int32, int64, their unsigned counterparts, float32 and float64 : numeric
+ *   and character columns
+ * - timestamp with any unit and time zone : date and timestamp columns
+ *
+ * @note
+ * When no client side conversion is needed, utf8 and binary values are used in place
+ * like column vectors set with OCI_DirPathSetColumnData() and the batch must not be
+ * released before the rows are converted. Other values are copied.
+ *
+ * @note
+ * utf8 values are handed over as is in ANSI builds and decoded to wide strings in
+ * Unicode builds.
+ *
+ * @note
+ * utf8 and binary values are not truncated : the call fails with the error
+ * OCI_ERR_MAX_VALUE if a value is longer than the maximum size of its column.
+ *
+ * @note
+ * Numeric values are converted to NUMBER client side for columns declared with a numeric
+ * format. Otherwise they are converted to text using '.' as decimal separator.
+ *
+ * @warning
+ * Timestamp values are converted to text. Date and timestamp columns must be declared
+ * with the formats OCI_ARROW_DATE_FORMAT and OCI_ARROW_TIMESTAMP_FORMAT using
+ * OCI_DirPathSetColumn()
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathSetArrowBatch
+(
+    OCI_DirPath *             dp,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray * array
+);
+
 /**
  * @brief
  * Convert provided user data to the direct path stream format
@@ -14537,6 +15812,134 @@ OCI_EXPORT boolean OCI_API OCI_DirPathSetConvertMode
     unsigned int mode
 );
 
+/**
+ * @brief
+ * Enable or disable pipelined loads
+ *
+ * @param dp    - Direct path Handle
+ * @param value - enable/disable pipelined mode
+ *
+ * @note
+ * In pipelined mode, OCI_DirPathLoad() hands the converted stream over to a
+ * background thread and returns immediately, so that the application can set
+ * the next batch of rows while the previous one is being loaded.
+ * Two streams are used alternatively.
+ *
+ * @note
+ * Oracle does not support concurrent calls on a direct path context. Thus the client side
+ * conversions of OCI_DirPathSetConvertThreads() overlap the background load, but the
+ * conversion of the column array into a stream performed by OCI_DirPathConvert() waits
+ * for the end of the background load before starting.
+ *
+ * @note
+ * Each error raised by a background load is reported by the next call collecting it,
+ * as for synchronous loads (the error handler is called for every rejected row).
+ *
+ * @note
+ * As a consequence, OCI_DirPathLoad() returns the status of the previously
+ * loaded batch and OCI_DirPathGetAffectedRows(), OCI_DirPathGetErrorRow()
+ * report that batch too. The outcome of the last batch is reported by
+ * OCI_DirPathFinish(), OCI_DirPathSave() or OCI_DirPathFlushRow()
+ *
+ * @note
+ * This mode requires OCILIB to be initialized with OCI_ENV_THREADED
+ *
+ * @note
+ * This call must be performed before calling OCI_DirPathPrepare()
+ *
+ * @note
+ * Default value is FALSE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathSetPipelined
+(
+    OCI_DirPath *dp,
+    boolean      value
+);
+
+/**
+ * @brief
+ * Return TRUE if pipelined loads are enabled for the given direct path handle
+ *
+ * @param dp - Direct path Handle
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathGetPipelined
+(
+    OCI_DirPath *dp
+);
+
+/**
+ * @brief
+ * Set the number of threads converting NUMBER and DATE values on client side
+ *
+ * @param dp    - Direct path Handle
+ * @param value - Number of threads
+ *
+ * @note
+ * By default, values of NUMBER columns with a format are converted by OCI
+ * when calling OCI_DirPathSetEntry() and DATE values are converted by the server.
+ *
+ * @note
+ * When value is not 0, such values are kept as strings and converted to their
+ * Oracle internal format by OCI_DirPathConvert() in plain C, without any OCI call.
+ * Rows are split in ranges converted by 'value' threads, the calling thread
+ * being one of them. The other threads are started by OCI_DirPathPrepare() and
+ * run until OCI_DirPathFree() is called
+ *
+ * @note
+ * Client side conversion applies to :
+ * - NUMBER columns with a format only made of '9', '0' and one '.' (e.g. "99999.99")
+ * - DATE columns with a format only made of YYYY, MM, DD, HH24, MI, SS
+ *   and separators (space, '-', '/', ',', '.', ';', ':')
+ *
+ * @note
+ * Numeric strings are parsed in C when written with digits, an optional '-' sign
+ * and '.' as decimal separator, within the format digits positions. Other strings
+ * as well as dates before 1583 are converted with OCI using the column format on
+ * the calling thread. Values rejected by OCI are reported like conversion errors :
+ * in OCI_DCM_FORCE mode, no error is raised and the row is reported by
+ * OCI_DirPathGetErrorRow()
+ *
+ * @note
+ * More than one thread requires OCILIB to be initialized with OCI_ENV_THREADED
+ *
+ * @note
+ * This call must be performed before calling OCI_DirPathSetColumn() for
+ * the columns to convert on client side
+ *
+ * @note
+ * Default value is 0
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathSetConvertThreads
+(
+    OCI_DirPath *dp,
+    unsigned int value
+);
+
+/**
+ * @brief
+ * Return the number of threads converting NUMBER and DATE values on client side
+ *
+ * @param dp - Direct path Handle
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DirPathGetConvertThreads
+(
+    OCI_DirPath *dp
+);
+
 /**
  * @brief
  * Return the number of rows successfully loaded into the database so far
@@ -14650,862 +16053,951 @@ OCI_EXPORT unsigned int OCI_API OCI_DirPathGetErrorRow
 );
 
 /**
- * @} OcilibCApiDirectPath
- */
-
-/**
- * @defgroup OcilibCApiAdvancedQueuing Oracle Advanced Queuing (A/Q)
- * @{
- *
- * OCILIB supports Oracle Advanced Queues features
- *
- * Let's Oracle talk about this features !
+ * @brief
+ * Load the records of a delimited text file
  *
- * @par Oracle Queues (from Oracle Streams - Advanced Queuing User's Guide)
+ * @param dp        - Direct path Handle
+ * @param filename  - Path of the file to load
+ * @param badfile   - Path of the file receiving rejected records (can be NULL)
+ * @param logfile   - Path of the file receiving rejection reasons (can be NULL)
+ * @param delimiter - Fields delimiter character
+ * @param quote     - Fields enclosing character (0 if fields are never enclosed)
+ * @param mode      - Load mode
  *
- * Oracle Streams AQ provides database-integrated message queuing functionality.
- * It is built on top of Oracle Streams and leverages the functions of Oracle
- * Database so that messages can be stored persistently, propagated between
- * queues on different computers and databases, and transmitted using Oracle
- * Net Services and HTTP(S).
- * Because Oracle Streams AQ is implemented in database tables, all operational
- * benefits of high availability, scalability, and reliability are also
- * applicable to queue data. Standard database features such as recovery,
- * restart, and security are supported by Oracle Streams AQ. You can use
- * database development and management tools such as Oracle Enterprise Manager
- * to monitor queues. Like other database tables, queue tables can be imported
- * and exported.
+ * @note
+ * Possible values for parameter 'mode' :
+ *   - OCI_DLF_DEFAULT : fields are mapped to the direct path columns by position
+ *   - OCI_DLF_HEADER  : the first record holds the field names that are mapped to the
+ *                       direct path columns with the same name. Other fields are ignored
  *
- * @par OCILIB implementation
+ * @note
+ * Each line of the file is a record unless the line feed belongs to an enclosed field.
+ * Within an enclosed field, a doubled enclosing character stands for a single one.
+ * Empty fields and missing fields are loaded as NULL.
  *
- * OCILIB provides a (nearly) full C implementation of Advanced Queues available in
- * Oracle OCI and proposes the following data types :
- *  - OCI_Msg     : Implementation of message to enqueue/dequeue from/to queues
- *  - OCI_Enqueue : Implementation of enqueuing process
- *  - OCI_Dequeue : Implementation of dequeuing process
- *  - OCI_Agent   : Implementation of Advanced queues Agents
+ * @note
+ * The file is read by large chunks and its records are set, converted and loaded
+ * by batches of OCI_DirPathGetMaxRows() rows. It must be called after OCI_DirPathPrepare()
+ * and OCI_DirPathFinish() must be called afterwards to commit the load.
  *
- * OCILIB support AQ messages notification with Oracle Client 10gR2 or above
+ * @note
+ * Records that cannot be loaded do not stop the load. They are written as read to
+ * 'badfile' that can be fixed and loaded again. The record number and the reason of each
+ * rejection are written to 'logfile'.
  *
- * Note that the only AQ features not supported yet by OCILIB are :
- *   - Payloads of type AnyData
- *   - Enqueuing/dequeuing arrays of messages
- *   - Optional delivery mode introduced in 10gR2
+ * @warning
+ * Conversion mode OCI_DCM_FORCE is used during the call, whatever the conversion mode
+ * set with OCI_DirPathSetConvertMode().
+ * It cannot be used when pipelined loads are enabled.
  *
- * OCILIB provides as well a C API to administrate queues and queue tables initially
- * reserved to PL/SQL and Java (wrappers around PL/SQL calls).
- * This API, based on internal PL/SQL calls wrapping the DBMS_AQADM packages procedures, allow the
- * following actions :
- *  - create, alter, drop and purge queue tables (OCI_QueueTableXXX calls)
- *  - create, alter, drop, start, stop queues (OCI_QueueXXX calls)
+ * @return
+ * TRUE on success otherwise FALSE
  *
- * Note that the user connected to the database needs particular privileges to manipulate or
- * administrate queues (See Oracle Streams - Advanced Queuing User's Guide for more information
- * on these privileges)
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DirPathLoadFile
+(
+    OCI_DirPath *dp,
+    const otext *filename,
+    const otext *badfile,
+    const otext *logfile,
+    otext        delimiter,
+    otext        quote,
+    unsigned int mode
+);
+
+/**
+ * @brief
+ * Return the number of records rejected by the last call to OCI_DirPathLoadFile()
  *
- * @par Example
- * @include queue.c
+ * @param dp - Direct path Handle
  *
  */
 
+OCI_EXPORT unsigned int OCI_API OCI_DirPathGetRejectedCount
+(
+    OCI_DirPath *dp
+);
+
 /**
  * @brief
- * Create a message object based on the given payload type
+ * Retrieve the throughput and timing statistics collected by a direct path handle
  *
- * @param typinf - Type info handle
+ * @param dp    - Direct path Handle
+ * @param stats - Structure receiving the statistics
  *
  * @note
- * OCILIB supports 2 type of message payload :
- * - Oracle types (UDT)
- * - RAW data
+ * Statistics are always collected, at the cost of a few clock reads per batch.
+ * They are kept until OCI_DirPathResetStats() is called.
  *
  * @note
- * Oracle Type AnyData is not supported in the current version of OCILIB
+ * Counters :
+ * - conversions       : number of OCI_DirPathConvert() calls
+ * - rows_converted    : number of rows converted into streams
+ * - rows_loaded       : number of rows loaded into the database
+ * - streams           : number of streams loaded
+ * - bytes             : total size of the loaded streams (bytes / streams gives the average
+ *                       stream size and rows_loaded / streams the average rows per stream)
+ * - conversion_errors : number of rows rejected by conversions
+ * - load_errors       : number of rows rejected by loads
+ * - stream_full       : number of conversions that returned OCI_DPR_FULL
+ * - retries           : number of conversion passes resumed after a rejected row in force mode
  *
  * @note
- * the parameter 'typinf' indicates the type of payload :
- * - For object payload, retrieve the object type information handle with
- *   OCI_TypeInfoGet() using the object type name
- * - For RAW payload, you MUST pass the object type information retrieved with
- *   OCI_TypeInfoGet() using "SYS.RAW" as object type name
- *
- * @warning
- * Newly created Message handles have NULL payloads.
- * For Message handling Objects payloads, OCI_MsgGetObject() returns NULL until an object handle is
- * assigned to the message.
+ * Phases (see OCI_ProfilePhase, one sample per batch or per pass) :
+ * - OCI_DPP_FILL   : time between the end of the previous load (or OCI_DirPathPrepare() or
+ *                    OCI_DirPathReset()) and OCI_DirPathConvert(). It is the time spent
+ *                    by the application to provide the batch entries
+ * - OCI_DPP_VALUES : client side conversion of NUMBER and DATE values
+ *                    (see OCI_DirPathSetConvertThreads())
+ * - OCI_DPP_ARRAY  : setup of the column array from the entries
+ * - OCI_DPP_STREAM : conversion of the column array into the stream
+ * - OCI_DPP_LOAD   : stream load, including the resumptions after rejected rows.
+ *                    In pipelined mode, it is measured by the loading thread
  *
  * @note
- * When a local OCI_Msg handle is enqueued, it keeps its attributes. If it's enqueued again, another
- * identical message is posted into the queue.
- * To reset a message and empty all its properties, call OCI_MsgReset()
- * Note that OCI_MsgReset() clears the message payload.
+ * In pipelined mode, the load related counters of a batch are updated when the next
+ * batch is loaded or when the load is finished
  *
  * @return
- * Return the message handle on success otherwise NULL on failure
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Msg * OCI_API OCI_MsgCreate
+OCI_EXPORT boolean OCI_API OCI_DirPathGetStats
 (
-    OCI_TypeInfo *typinf
+    OCI_DirPath      *dp,
+    OCI_DirPathStats *stats
 );
 
 /**
  * @brief
- * Free a message object
- *
- * @param msg - Message handle
+ * Reset the statistics collected by a direct path handle
  *
- * @warning
- * Only message handles created with OCI_MsgCreate() should be freed by OCI_MsgFree()
+ * @param dp - Direct path Handle
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgFree
+OCI_EXPORT boolean OCI_API OCI_DirPathResetStats
 (
-    OCI_Msg *msg
+    OCI_DirPath *dp
 );
 
 /**
  * @brief
- * Reset all attributes of a message object
+ * Set a callback reporting the progress of a direct path load
  *
- * @param msg - Message handle
+ * @param dp       - Direct path Handle
+ * @param handler  - Pointer to a callback function (NULL to disable it)
+ * @param interval - Minimum delay in milliseconds between two calls
+ * @param ctx      - User context pointer passed to the callback
  *
  * @note
- * This function calls OCI_MsgSetxxx() with default or NULL attributes
+ * The handler is called by OCI_DirPathLoad() when at least 'interval' milliseconds
+ * have elapsed since its previous call, and by OCI_DirPathFinish() with the final
+ * statistics. An interval of 0 reports every load.
  *
- * @warning
- * OCI_MsgReset() clears the message payload and set it to NULL
- * For messages handling objects payloads, OCI_MsgSetObject() must be called again to assign a
- * payload.
+ * @note
+ * The statistics structure is only valid during the call.
+ * The handler is always called on the thread calling OCI_DirPathLoad() or
+ * OCI_DirPathFinish(), even in pipelined mode where streams are loaded by background
+ * threads. It must not call direct path functions on the same handle.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgReset
+OCI_EXPORT boolean OCI_API OCI_DirPathSetProgressHandler
 (
-    OCI_Msg *msg
+    OCI_DirPath          *dp,
+    POCI_DIRPATH_PROGRESS handler,
+    unsigned int          interval,
+    void                 *ctx
 );
 
+/**
+ * @} OcilibCApiDirectPath
+ */
+
+/**
+ * @defgroup OcilibCApiDirectPathLoader Parallel direct path loading
+ * @{
+ *
+ * OCILIB provides a loader object that drives several direct path contexts
+ * in order to load a table in parallel.
+ *
+ * A loader opens one direct path context per given connection, either on the whole
+ * table (contexts then run in parallel mode, see OCI_DirPathSetParallel()) or on
+ * one partition per context.
+ *
+ * Rows are provided one at a time with OCI_DirPathLoaderAddRow() and are buffered
+ * by the context they are targeted to. By default, rows are given to the contexts
+ * in turn, one batch of rows per context. When a context buffer is full, its rows
+ * are converted and loaded by a dedicated thread while the program keeps adding
+ * rows to the other contexts. A context still loading its previous batch makes
+ * OCI_DirPathLoaderAddRow() wait for it.
+ *
+ * Contexts run in forced conversion mode (see OCI_DirPathSetConvertMode()) :
+ * rows rejected during conversion or load are skipped and counted
+ * (see OCI_DirPathLoaderGetErrorCount()).
+ *
+ * OCI_DirPathLoaderFinish() saves the data of all contexts only if every context
+ * has loaded its rows successfully. Otherwise, all contexts are aborted.
+ *
+ * @warning
+ * Loaders require OCILIB to be initialized with OCI_ENV_THREADED
+ *
+ * @par How to use a loader
+ *
+ * - 1 : Create a loader with OCI_DirPathLoaderCreate()
+ * - 2 : Describe the columns to load with OCI_DirPathLoaderSetColumn()
+ * - 3 : Set (optional) direct path attributes of each context returned by OCI_DirPathLoaderGetContext()
+ * - 4 : Prepare the load with OCI_DirPathLoaderPrepare()
+ * - 5 : Add rows with OCI_DirPathLoaderAddRow()
+ * - 6 : Commit the load with OCI_DirPathLoaderFinish()
+ * - 7 : Free the loader with OCI_DirPathLoaderFree()
+ *
+ */
+
 /**
  * @brief
- * Get the object payload of the given message
+ * Create a parallel direct path loader
  *
- * @param msg - Message handle
+ * @param cons       - Array of connection handles, one per context
+ * @param nb_cons    - Number of connections
+ * @param name       - Table name
+ * @param partitions - Array of partition names, one per context (optional)
+ * @param nb_cols    - Number of columns to load
+ * @param nb_rows    - Number of rows of a batch
+ *
+ * @note
+ * Connections must not be used by the program until the loader is freed
+ *
+ * @note
+ * When partitions are given, each context loads into its partition only.
+ * The program should then give the target of each row to OCI_DirPathLoaderAddRow()
+ * as rows not belonging to the partition are rejected.
  *
  * @return
- * Return the object handle on success otherwise NULL on failure or if payload is NULL
+ * Return the loader handle on success otherwise NULL on failure
  *
  */
 
-OCI_EXPORT OCI_Object * OCI_API OCI_MsgGetObject
+OCI_EXPORT OCI_DirPathLoader * OCI_API OCI_DirPathLoaderCreate
 (
-    OCI_Msg *msg
+    OCI_Connection **cons,
+    unsigned int     nb_cons,
+    const otext     *name,
+    const otext    **partitions,
+    unsigned int     nb_cols,
+    unsigned int     nb_rows
 );
 
 /**
  * @brief
- * Set the object payload of the given message
+ * Free a loader object
  *
- * @param msg - Message handle
- * @param obj - Object handle
+ * @param ldr - Loader handle
+ *
+ * @note
+ * A load that has not been finished is aborted
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetObject
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderFree
 (
-    OCI_Msg *   msg,
-    OCI_Object *obj
+    OCI_DirPathLoader *ldr
 );
 
 /**
  * @brief
- * Get the RAW payload of the given message
+ * Describe a column to load for all contexts
  *
- * @param msg  - Message handle
- * @param raw  - Input buffer
- * @param size - Input buffer maximum size
+ * @param ldr     - Loader handle
+ * @param index   - Column index
+ * @param name    - Column name
+ * @param maxsize - Maximum input value size for a column entry
+ * @param format  - Date or numeric format to use
  *
  * @note
- * On output, parameter 'size' holds the number of bytes copied into the given buffer
+ * See OCI_DirPathSetColumn() for details
  *
  * @return
- * TRUE on success otherwise FALSE on failure or if payload is object based.
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgGetRaw
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderSetColumn
 (
-    OCI_Msg *     msg,
-    void *        raw,
-    unsigned int *size
+    OCI_DirPathLoader *ldr,
+    unsigned int       index,
+    const otext       *name,
+    unsigned int       maxsize,
+    const otext       *format
 );
 
 /**
  * @brief
- * Set the RAW payload of the given message
- *
- * @param msg  - Message handle
- * @param raw  - Raw data
- * @param size - Raw data size
+ * Return the number of direct path contexts of the given loader
  *
- * @return
- * TRUE on success otherwise FALSE on failure or if payload is object based.
+ * @param ldr - Loader handle
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetRaw
+OCI_EXPORT unsigned int OCI_API OCI_DirPathLoaderGetContextCount
 (
-    OCI_Msg *    msg,
-    const void * raw,
-    unsigned int size
+    OCI_DirPathLoader *ldr
 );
 
 /**
  * @brief
- * Return the number of attempts that have been made to dequeue the message
+ * Return a direct path context of the given loader
  *
- * @param msg - Message handle
+ * @param ldr   - Loader handle
+ * @param index - Context index (starting at 1)
+ *
+ * @note
+ * The returned handle can be used to set direct path attributes before
+ * calling OCI_DirPathLoaderPrepare(), e.g. OCI_DirPathSetBufferSize() or
+ * OCI_DirPathSetNoLog().
+ * The conversion and pipelined modes must not be changed
+ *
+ * @note
+ * The returned handle is owned by the loader and must not be freed
+ *
+ * @return
+ * The direct path handle on success otherwise NULL
  *
  */
 
-OCI_EXPORT int OCI_API OCI_MsgGetAttemptCount
+OCI_EXPORT OCI_DirPath * OCI_API OCI_DirPathLoaderGetContext
 (
-    OCI_Msg *msg
+    OCI_DirPathLoader *ldr,
+    unsigned int       index
 );
 
 /**
  * @brief
- * Return the number of seconds that a message is delayed for dequeuing
+ * Prepare all contexts of the given loader
  *
- * @param msg - Message handle
+ * @param ldr - Loader handle
  *
  * @note
- * see OCI_MsgSetEnqueueDelay() for more details
+ * The number of rows of a batch is the smallest number of rows granted
+ * to a context by Oracle (see OCI_DirPathGetMaxRows())
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT int OCI_API OCI_MsgGetEnqueueDelay
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderPrepare
 (
-    OCI_Msg *msg
+    OCI_DirPathLoader *ldr
 );
 
 /**
  * @brief
- * set the number of seconds to delay the enqueued message
+ * Add a row to load
  *
- * @param msg   - Message handle
- * @param value - Delay in seconds
+ * @param ldr    - Loader handle
+ * @param target - Index of the context that loads the row (starting at 1) or 0
+ * @param values - Array of column values
+ * @param sizes  - Array of column values sizes
  *
  * @note
- * The delay represents the number of seconds after which a message is available for dequeuing.
- * When the message is enqueued, its state is set to OCI_AMS_WAITING.
- * When the delay expires, its state is set to OCI_AMS_READY.
+ * Values and sizes are given as for OCI_DirPathSetEntry(). A NULL value loads a null.
+ * Values are copied, so the arrays can be reused once the call returns.
  *
  * @note
- * If parameter 'value' is set to zero (default value), the message will be immediately available
- * for dequeuing
+ * A value longer than the maximum size of its column is not truncated : the call fails
+ * with the error OCI_ERR_MAX_VALUE and the row is not added.
  *
- * @warning
- * Dequeuing by Message ID overrides the delay specification.
+ * @note
+ * When target is 0, the row goes to the context currently receiving rows.
+ * Otherwise, it must not be greater than OCI_DirPathLoaderGetContextCount().
  *
- * @warning
- * Delaying processing requires the queue monitor to be started.
+ * @note
+ * When the batch of the target context is full, it is handed over to the context
+ * thread. If the context failed to load a previous batch, the call fails and
+ * OCI_DirPathLoaderAbort() should be called.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetEnqueueDelay
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderAddRow
 (
-    OCI_Msg *msg,
-    int      value
+    OCI_DirPathLoader *ldr,
+    unsigned int       target,
+    void             **values,
+    unsigned int      *sizes
 );
 
 /**
  * @brief
- * return the time the message was enqueued
+ * Load the remaining rows and commit the load of all contexts
  *
- * @param msg - Message handle
+ * @param ldr - Loader handle
  *
  * @note
- * Only use this function for message dequeued from queues
+ * Data is saved only if all contexts have loaded their rows without failure.
+ * Otherwise, all contexts are aborted and FALSE is returned.
+ *
+ * @warning
+ * Contexts are finished one after the other. If finishing a context fails,
+ * the next ones are aborted but the data saved by the previous ones remains.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Date * OCI_API OCI_MsgGetEnqueueTime
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderFinish
 (
-    OCI_Msg *msg
+    OCI_DirPathLoader *ldr
 );
 
 /**
  * @brief
- * Return the duration that the message is available for dequeuing
+ * Terminate the load of all contexts without saving the data
  *
- * @param msg - Message handle
+ * @param ldr - Loader handle
  *
- * @note
- * see OCI_MsgSetExpiration() for more details
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT int OCI_API OCI_MsgGetExpiration
+OCI_EXPORT boolean OCI_API OCI_DirPathLoaderAbort
 (
-    OCI_Msg *msg
+    OCI_DirPathLoader *ldr
 );
 
 /**
  * @brief
- * set the duration that the message is available for dequeuing
+ * Return the number of rows successfully loaded by all contexts
  *
- * @param msg   - Message handle
- * @param value - duration in seconds
- *
- * @note
- * This parameter is an offset from the delay (see OCI_MsgSetEnqueueDelay())
- * While waiting for expiration, the message state is set to OCI_AMS_READY.
- * If the message is not dequeued before it expires, it will be moved to the exception queue
- * with the state OCI_AMS_EXPIRED.
+ * @param ldr - Loader handle
  *
  * @note
- * If parameter 'value' is set to -1 (default value), the message will not expire
- *
- * @warning
- * Expiration processing requires the queue monitor to be started.
- *
- * @return
- * TRUE on success otherwise FALSE
+ * The value is accurate once OCI_DirPathLoaderFinish() has been called
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetExpiration
+OCI_EXPORT unsigned int OCI_API OCI_DirPathLoaderGetRowCount
 (
-    OCI_Msg *msg,
-    int      value
+    OCI_DirPathLoader *ldr
 );
 
 /**
  * @brief
- * Return the state of the message at the time of the dequeue
+ * Return the number of rows rejected by all contexts
  *
- * @param msg - Message handle
+ * @param ldr - Loader handle
  *
- * @return
- *  - OCI_UNKNOWN       :  the function has failed to get the message state
- *  - OCI_AMS_READY     :  the message is ready to be processed
- *  - OCI_AMS_WAITING   :  the message delay has not yet completed
- *  - OCI_AMS_PROCESSED :  the message has been processed
- *  - OCI_AMS_EXPIRED   :  the message has moved to exception queue
+ * @note
+ * The value is accurate once OCI_DirPathLoaderFinish() has been called
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_MsgGetState
+OCI_EXPORT unsigned int OCI_API OCI_DirPathLoaderGetErrorCount
 (
-    OCI_Msg *msg
+    OCI_DirPathLoader *ldr
 );
 
 /**
- * @brief
- * Return the priority of the message
+ * @} OcilibCApiDirectPathLoader
+ */
+
+/**
+ * @defgroup OcilibCApiBatcher Array DML batcher
+ * @{
  *
- * @param msg - Message handle
+ * OCILIB provides a batcher object that turns row by row DML executions into
+ * array DML executions without having to manage array binds.
+ *
+ * A batcher wraps a DML statement. Values are provided row by row and are buffered
+ * into internally allocated array binds. Buffered rows are sent to the server
+ * with a single array execution (see OCI_BindArraySetSize()) when :
+ *
+ * - the maximum number of rows given to OCI_BatcherCreate() is reached
+ * - the maximum buffered data size given to OCI_BatcherSetFlushLimits() is reached
+ * - the maximum buffering delay given to OCI_BatcherSetFlushLimits() is elapsed
+ * - OCI_BatcherFlush() is called
  *
  * @note
- * see OCI_MsgSetPriority() for more details
+ * Thresholds are checked by OCI_BatcherAddRow(). The batcher never sends rows from
+ * another thread : programs receiving rows at a low rate should call
+ * OCI_BatcherCheckDelay() periodically in order to honor the maximum buffering delay
+ * while no row is appended.
+ *
+ * @par Rejected rows
+ *
+ * Flushes are performed in batch error mode (see OCI_GetBatchError()), including
+ * flushes of a single row.
+ * Rows rejected by the server are reported to the callback given to
+ * OCI_BatcherSetErrorHandler() with their index since the batcher creation.
+ * The other rows are processed.
+ * The OCILIB error handler is called as for any array DML execution raising batch errors.
+ * OCI_BatcherFlush() then returns FALSE and OCI_BatcherAddRow() returns OCI_BRS_REJECTED.
+ *
+ * If the execution fails as a whole, the rows remain buffered and the call
+ * can be repeated with OCI_BatcherFlush(). If the buffer is full, the next
+ * OCI_BatcherSetXXX() or OCI_BatcherAddRow() call retries the flush before
+ * accepting new values and fails if the rows still cannot be sent.
+ *
+ * @note
+ * In auto commit mode (see OCI_SetAutoCommit()), each flush is committed.
+ *
+ * @par How to use a batcher
+ *
+ * - 1 : Create a batcher with OCI_BatcherCreate()
+ * - 2 : Describe each bind variable of the statement with OCI_BatcherSetColumn()
+ * - 3 : Set the values of the current row with OCI_BatcherSetXXX() calls
+ * - 4 : Append the current row with OCI_BatcherAddRow()
+ * - 5 : Repeat steps 3 and 4
+ * - 6 : Send the remaining rows with OCI_BatcherFlush()
+ * - 7 : Free the batcher with OCI_BatcherFree()
  *
  */
 
-OCI_EXPORT int OCI_API OCI_MsgGetPriority
+/**
+ * @brief
+ * Create a batcher object
+ *
+ * @param con      - Connection handle
+ * @param sql      - DML statement
+ * @param nb_cols  - Number of bind variables in the statement
+ * @param max_rows - Maximum number of rows buffered before being sent to the server
+ *
+ * @return
+ * Return the batcher handle on success otherwise NULL on failure
+ *
+ */
+
+OCI_EXPORT OCI_Batcher * OCI_API OCI_BatcherCreate
 (
-    OCI_Msg *msg
+    OCI_Connection *con,
+    const otext    *sql,
+    unsigned int    nb_cols,
+    unsigned int    max_rows
 );
 
 /**
  * @brief
- * Set the priority of the message
+ * Free a batcher object
  *
- * @param msg   - Message handle
- * @param value - Message priority
+ * @param bat - Batcher handle
  *
- * @note
- *   - The priority can be any number, including negative numbers.
- *   - A smaller number indicates higher priority.
- *   - Default value is zero.
+ * @warning
+ * Buffered rows that have not been sent yet are discarded.
+ * Call OCI_BatcherFlush() before freeing the batcher.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetPriority
+OCI_EXPORT boolean OCI_API OCI_BatcherFree
 (
-    OCI_Msg *msg,
-    int      value
+    OCI_Batcher *bat
 );
 
 /**
  * @brief
- * Return the ID of the message
+ * Describe a bind variable of the batcher statement
  *
- * @param msg - Message handle
- * @param id  - Input buffer
- * @param len - Input buffer maximum size
+ * @param bat     - Batcher handle
+ * @param index   - Column index (starting at 1)
+ * @param name    - Bind variable name
+ * @param type    - Column type
+ * @param subtype - Numeric subtype
+ * @param len     - Maximum string length
  *
  * @note
- * The message ID is :
- *  - generated when the message is enqueued in the queue
- *  - retrieved when the message is dequeued from the queue
+ * Possible values for parameter 'type' :
+ * - OCI_CDT_NUMERIC : parameter 'subtype' must be OCI_NUM_INT, OCI_NUM_BIGINT or OCI_NUM_DOUBLE
+ * - OCI_CDT_TEXT : parameter 'len' is the maximum number of characters of the values
+ * - OCI_CDT_DATETIME
  *
  * @note
- * On output, parameter 'len' holds the number of bytes copied into the given buffer
+ * Unused parameters are ignored
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgGetID
+OCI_EXPORT boolean OCI_API OCI_BatcherSetColumn
 (
-    OCI_Msg *     msg,
-    void *        id,
-    unsigned int *len
+    OCI_Batcher *bat,
+    unsigned int index,
+    const otext *name,
+    unsigned int type,
+    unsigned int subtype,
+    unsigned int len
 );
 
 /**
  * @brief
- * Return the original ID of the message in the last queue that generated this message
- *
- * @param msg - Message handle
- * @param id  - Input buffer
- * @param len - Input buffer maximum size
+ * Set additional thresholds that trigger sending buffered rows to the server
  *
- * @warning
- * When a message is propagated from/to different queues, this ID is the one generated for the
- * message in the previous queue.
+ * @param bat       - Batcher handle
+ * @param max_bytes - Maximum size in bytes of the buffered values (0 for no limit)
+ * @param max_delay - Maximum delay in seconds since the first buffered row (0 for no limit)
  *
  * @note
- * On output, parameter 'len' holds the number of bytes copied into the given buffer
+ * The buffered size is the sum of the sizes of the numeric and date values and of
+ * the lengths of the string values.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgGetOriginalID
+OCI_EXPORT boolean OCI_API OCI_BatcherSetFlushLimits
 (
-    OCI_Msg *     msg,
-    void *        id,
-    unsigned int *len
+    OCI_Batcher *bat,
+    unsigned int max_bytes,
+    unsigned int max_delay
 );
 
 /**
  * @brief
- * Set the original ID of the message in the last queue that generated this message
+ * Set the callback called for each row rejected by the server
  *
- * @param msg  - Message handle
- * @param id   - Message ID
- * @param len  - Message ID size
+ * @param bat     - Batcher handle
+ * @param handler - Pointer to a callback procedure (NULL to remove it)
  *
- * @warning
- * When a message is propagated from/to different queues, this ID is the one generated for the
- * message in the previous queue.
+ * @note
+ * The error handle passed to the callback is only valid within the callback.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetOriginalID
+OCI_EXPORT boolean OCI_API OCI_BatcherSetErrorHandler
 (
-    OCI_Msg *    msg,
-    const void * id,
-    unsigned int len
+    OCI_Batcher       *bat,
+    POCI_BATCHER_ERROR handler
 );
 
 /**
  * @brief
- * Return the original sender of a message
+ * Set an integer value for the given column of the current row
  *
- * @param msg    - Message handle
+ * @param bat   - Batcher handle
+ * @param index - Column index (starting at 1)
+ * @param value - Value
+ *
+ * @note
+ * The column must be numeric. The value is converted to the column subtype.
  *
  * @return
- * Sender Handle (OCI_Agent *) on success (if set at enqueue time) otherwise NULL
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Agent * OCI_API OCI_MsgGetSender
+OCI_EXPORT boolean OCI_API OCI_BatcherSetInt
 (
-    OCI_Msg *msg
+    OCI_Batcher *bat,
+    unsigned int index,
+    int          value
 );
 
 /**
  * @brief
- * Set the original sender of a message
+ * Set a big integer value for the given column of the current row
  *
- * @param msg    - Message handle
- * @param sender - Message sender
+ * @param bat   - Batcher handle
+ * @param index - Column index (starting at 1)
+ * @param value - Value
+ *
+ * @note
+ * The column must be numeric. The value is converted to the column subtype.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetSender
+OCI_EXPORT boolean OCI_API OCI_BatcherSetBigInt
 (
-    OCI_Msg *  msg,
-    OCI_Agent *sender
+    OCI_Batcher *bat,
+    unsigned int index,
+    big_int      value
 );
 
 /**
  * @brief
- * Set the recipient list of a message to enqueue
+ * Set a double value for the given column of the current row
  *
- * @param msg       - Message handle
- * @param consumers - Recipients list (array of agent handles)
- * @param count     - Number of recipients
+ * @param bat   - Batcher handle
+ * @param index - Column index (starting at 1)
+ * @param value - Value
  *
- * @warning
- * This function should only be used for queues which allow multiple consumers.
- * The default recipients are the queue subscribers.
+ * @note
+ * The column must be numeric. The value is converted to the column subtype.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetConsumers
+OCI_EXPORT boolean OCI_API OCI_BatcherSetDouble
 (
-    OCI_Msg *    msg,
-    OCI_Agent ** consumers,
-    unsigned int count
+    OCI_Batcher *bat,
+    unsigned int index,
+    double       value
 );
 
 /**
  * @brief
- * Get the correlation identifier of the message
+ * Set a string value for the given column of the current row
  *
- * @param msg - Message handle
+ * @param bat   - Batcher handle
+ * @param index - Column index (starting at 1)
+ * @param value - Value (NULL for a null value)
  *
  * @note
- * see OCI_MsgSetCorrelation() for more details
+ * The value is truncated to the maximum length given to OCI_BatcherSetColumn()
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_MsgGetCorrelation
+OCI_EXPORT boolean OCI_API OCI_BatcherSetString
 (
-    OCI_Msg *msg
+    OCI_Batcher *bat,
+    unsigned int index,
+    const otext *value
 );
 
 /**
  * @brief
- * set the correlation identifier of the message
+ * Set a date value for the given column of the current row
  *
- * @param msg         - Message handle
- * @param correlation - Message correlation text
+ * @param bat   - Batcher handle
+ * @param index - Column index (starting at 1)
+ * @param value - Value (NULL for a null value)
  *
  * @note
- * see OCI_DequeueSetCorrelation()  for more details
+ * The value is copied
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetCorrelation
+OCI_EXPORT boolean OCI_API OCI_BatcherSetDate
 (
-    OCI_Msg *    msg,
-    const otext *correlation
+    OCI_Batcher *bat,
+    unsigned int index,
+    OCI_Date    *value
 );
 
 /**
  * @brief
- * Get the Exception queue name of the message
+ * Set a null value for the given column of the current row
  *
- * @param msg - Message handle
- *
- * @warning
- * When calling this function on a message retrieved with OCI_DequeueGet(), the returned value is
- * NULL if the default exception queue associated with the current queue is used (e.g. no user
- * defined specified at enqueue time for the message)
+ * @param bat   - Batcher handle
+ * @param index - Column index (starting at 1)
  *
  * @note
- * see OCI_MsgSetExceptionQueue() for more details
- *
- */
-OCI_EXPORT const otext * OCI_API OCI_MsgGetExceptionQueue
-(
-    OCI_Msg *msg
-);
-
-/**
- * @brief
- * Set the name of the queue to which the message is moved to if it cannot be
- * processed successfully
- *
- * @param msg   - Message handle
- * @param queue - Exception queue name
- *
- * @warning
- * From Oracle Documentation :
- *
- * "Messages are moved into exception queues in two cases :
- *  - If the number of unsuccessful dequeue attempts has exceeded the attribute 'max_retries' of
- *    given queue
- *  - if the message has expired.
- *
- * All messages in the exception queue are in the EXPIRED state.
- *
- * The default is the exception queue associated with the queue table.
- *
- * If the exception queue specified does not exist at the time of the move the message will be
- * moved to the default exception queue associated with the queue table and a warning will be
- * logged in the alert file.
- *
- * This attribute must refer to a valid queue name."
+ * Columns that are not set when calling OCI_BatcherAddRow() are null
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_MsgSetExceptionQueue
+OCI_EXPORT boolean OCI_API OCI_BatcherSetNull
 (
-    OCI_Msg *    msg,
-    const otext *queue
+    OCI_Batcher *bat,
+    unsigned int index
 );
 
 /**
  * @brief
- * Create a Enqueue object for the given queue
- *
- * @param typinf - Type info handle
- * @param name   - Queue name
- *
- * @note
- * OCILIB supports 2 type of message payload :
- * - Oracle types (UDT)
- * - RAW data
+ * Append the current row to the buffered rows
  *
- * @note
- * Oracle Type AnyData is not supported in the current version of OCILIB
+ * @param bat - Batcher handle
  *
  * @note
- * the parameter 'typinf' indicates the type of payload to enqueue to the given queue :
- * - For object payload, retrieve the object type information handle with
- *   OCI_TypeInfoGet() using the object type name
- * - For RAW payload, you MUST pass the object type information retrieved with
- *   OCI_TypeInfoGet() using "SYS.RAW" as object type name
+ * If a threshold is reached, buffered rows are sent to the server
  *
  * @return
- * Return the Enqueue handle on success otherwise NULL on failure
+ * Possible values are :
+ * - OCI_BRS_ERROR    : an error occurred and the row has not been appended
+ * - OCI_BRS_BUFFERED : the row has been appended to the buffered rows
+ * - OCI_BRS_FLUSHED  : the row has been appended and all buffered rows have been sent
+ * - OCI_BRS_REJECTED : the row has been appended and buffered rows have been sent but
+ *   some of them were rejected by the server
+ * - OCI_BRS_FAILED   : the row has been appended but sending the buffered rows failed.
+ *   They remain buffered.
  *
  */
 
-OCI_EXPORT OCI_Enqueue * OCI_API OCI_EnqueueCreate
+OCI_EXPORT unsigned int OCI_API OCI_BatcherAddRow
 (
-    OCI_TypeInfo *typinf,
-    const otext * name
+    OCI_Batcher *bat
 );
 
 /**
  * @brief
- * Free a Enqueue object
+ * Send all buffered rows to the server
  *
- * @param enqueue - Enqueue handle
+ * @param bat - Batcher handle
  *
  * @return
- * TRUE on success otherwise FALSE
+ * TRUE on success otherwise FALSE (including when rows were rejected by the server)
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_EnqueueFree
+OCI_EXPORT boolean OCI_API OCI_BatcherFlush
 (
-    OCI_Enqueue *enqueue
+    OCI_Batcher *bat
 );
 
 /**
  * @brief
- * Enqueue a message on the queue associated to the Enqueue object
+ * Send buffered rows to the server if a threshold is reached
  *
- * @param enqueue - Enqueue handle
- * @param msg     - Message handle to enqueue
+ * @param bat - Batcher handle
+ *
+ * @note
+ * This call is meant to be called periodically by programs receiving rows at a
+ * low rate in order to send rows buffered for longer than the maximum delay given
+ * to OCI_BatcherSetFlushLimits().
  *
  * @return
- * TRUE on success otherwise FALSE
+ * TRUE if no flush was needed or if it succeeded otherwise FALSE
+ * (including when rows were rejected by the server)
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_EnqueuePut
-(
-    OCI_Enqueue *enqueue,
-    OCI_Msg *    msg
-);
-
-/**
-* @brief
-* Set the enqueuing sequence of messages to put in the queue
-*
-* @param enqueue  - Enqueue handle
-* @param sequence - enqueuing sequence
-*
-* @note
-* Possible values for parameter 'sequence' :
-*   - OCI_ASD_BEFORE : enqueue message before another message
-*   - OCI_ASD_TOP    : enqueue message before all messages
-*
-* @note
-* Default value is OCI_ASD_TOP
-*
-* @note
-* if the parameter 'sequence' is set to OCI_ASD_BEFORE, the application must
-* call OCI_EnqueueSetRelativeMsgID() before enqueuing the next message in the queue.
-*
-* @note
-* In order to stop enqueuing message using a sequence deviation, call
-* OCI_EnqueueSetSequenceDeviation() with the value OCI_ASD_TOP
-*
-* @return
-* TRUE on success otherwise FALSE
-*
-*/
-
-OCI_EXPORT boolean OCI_API OCI_EnqueueSetSequenceDeviation
+OCI_EXPORT boolean OCI_API OCI_BatcherCheckDelay
 (
-    OCI_Enqueue *enqueue,
-    unsigned int sequence
+    OCI_Batcher *bat
 );
 
 /**
  * @brief
- * Return the sequence deviation of messages to enqueue to the queue
- *
- * @param enqueue - Enqueue handle
+ * Return the number of rows buffered and not sent yet
  *
- * @note
- * see OCI_EnqueueSetSequenceDeviation() for more details
+ * @param bat - Batcher handle
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_EnqueueGetSequenceDeviation
+OCI_EXPORT unsigned int OCI_API OCI_BatcherGetPendingRows
 (
-    OCI_Enqueue *enqueue
+    OCI_Batcher *bat
 );
 
 /**
  * @brief
- * Set whether the new message is enqueued as part of the current transaction
+ * Return the number of rows sent to the server since the batcher creation
  *
- * @param enqueue    - Enqueue handle
- * @param visibility - Enqueuing visibility
- *
- * @note
- * Possible values for parameter 'visibility' :
- *   - OCI_AMV_IMMEDIATE : enqueue is an independent transaction
- *   - OCI_AMV_ON_COMMIT : enqueue is part of current transaction
+ * @param bat - Batcher handle
  *
  * @note
- * Default value is OCI_AMV_ON_COMMIT
- *
- * @return
- * TRUE on success otherwise FALSE
+ * Rejected rows are included
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_EnqueueSetVisibility
+OCI_EXPORT unsigned int OCI_API OCI_BatcherGetProcessedRows
 (
-    OCI_Enqueue *enqueue,
-    unsigned int visibility
+    OCI_Batcher *bat
 );
 
 /**
  * @brief
- * Get the enqueuing/locking behavior
- *
- * @param enqueue - Enqueue handle
+ * Return the number of rows rejected by the server since the batcher creation
  *
- * @note
- * see OCI_EnqueueSetVisibility() for more details
+ * @param bat - Batcher handle
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_EnqueueGetVisibility
+OCI_EXPORT unsigned int OCI_API OCI_BatcherGetErrorCount
 (
-    OCI_Enqueue *enqueue
+    OCI_Batcher *bat
 );
 
 /**
- * @brief
- * Set a message identifier to use for enqueuing messages using a sequence deviation
- *
- * @param enqueue - Enqueue handle
- * @param id      - message identifier
- * @param len     - pointer to message identifier length
- *
- * @note
- * This call is only valid if OCI_EnqueueSetSequenceDeviation() has been called
- * with the value  OCI_ASD_BEFORE
- *
- * @warning
- * if the function cannot assign the message id, the content of the parameter 'len' is set to zero.
- *
- * @note
- * see OCI_EnqueueSetSequenceDeviation() for more details
- *
- * @return
- * TRUE on success otherwise FALSE
- *
+ * @} OcilibCApiBatcher
  */
 
-OCI_EXPORT boolean OCI_API OCI_EnqueueSetRelativeMsgID
-(
-    OCI_Enqueue *enqueue,
-    const void * id,
-    unsigned int len
-);
-
 /**
- * @brief
- * Get the current associated message identifier used for enqueuing messages
- * using a sequence deviation
- *
- * @param enqueue - Enqueue handle
- * @param id      - buffer to receive the message identifier
- * @param len     - pointer to buffer max length
+ * @defgroup OcilibCApiAdvancedQueuing Oracle Advanced Queuing (A/Q)
+ * @{
  *
- * @warning
- * When the function returns, parameter 'len' hold the number of bytes assigned to parameter 'id'
+ * OCILIB supports Oracle Advanced Queues features
  *
- * @note
- * see OCI_EnqueueGetRelativeMsgID() for more details
+ * Let's Oracle talk about this features !
  *
- * @return
- * TRUE on success otherwise FALSE
+ * @par Oracle Queues (from Oracle Streams - Advanced Queuing User's Guide)
  *
- */
-
-OCI_EXPORT boolean OCI_API OCI_EnqueueGetRelativeMsgID
-(
-    OCI_Enqueue * enqueue,
-    void *        id,
-    unsigned int *len
-);
+ * Oracle Streams AQ provides database-integrated message queuing functionality.
+ * It is built on top of Oracle Streams and leverages the functions of Oracle
+ * Database so that messages can be stored persistently, propagated between
+ * queues on different computers and databases, and transmitted using Oracle
+ * Net Services and HTTP(S).
+ * Because Oracle Streams AQ is implemented in database tables, all operational
+ * benefits of high availability, scalability, and reliability are also
+ * applicable to queue data. Standard database features such as recovery,
+ * restart, and security are supported by Oracle Streams AQ. You can use
+ * database development and management tools such as Oracle Enterprise Manager
+ * to monitor queues. Like other database tables, queue tables can be imported
+ * and exported.
+ *
+ * @par OCILIB implementation
+ *
+ * OCILIB provides a (nearly) full C implementation of Advanced Queues available in
+ * Oracle OCI and proposes the following data types :
+ *  - OCI_Msg     : Implementation of message to enqueue/dequeue from/to queues
+ *  - OCI_Enqueue : Implementation of enqueuing process
+ *  - OCI_Dequeue : Implementation of dequeuing process
+ *  - OCI_Agent   : Implementation of Advanced queues Agents
+ *
+ * OCILIB support AQ messages notification with Oracle Client 10gR2 or above
+ *
+ * Note that the only AQ features not supported yet by OCILIB are :
+ *   - Payloads of type AnyData
+ *   - Enqueuing/dequeuing arrays of messages
+ *   - Optional delivery mode introduced in 10gR2
+ *
+ * OCILIB provides as well a C API to administrate queues and queue tables initially
+ * reserved to PL/SQL and Java (wrappers around PL/SQL calls).
+ * This API, based on internal PL/SQL calls wrapping the DBMS_AQADM packages procedures, allow the
+ * following actions :
+ *  - create, alter, drop and purge queue tables (OCI_QueueTableXXX calls)
+ *  - create, alter, drop, start, stop queues (OCI_QueueXXX calls)
+ *
+ * Note that the user connected to the database needs particular privileges to manipulate or
+ * administrate queues (See Oracle Streams - Advanced Queuing User's Guide for more information
+ * on these privileges)
+ *
+ * @par Example
+ * @include queue.c
+ *
+ */
 
 /**
  * @brief
- * Create a Dequeue object for the given queue
+ * Create a message object based on the given payload type
  *
  * @param typinf - Type info handle
- * @param name   - Queue name
  *
  * @note
  * OCILIB supports 2 type of message payload :
@@ -15516,1367 +17008,2827 @@ OCI_EXPORT boolean OCI_API OCI_EnqueueGetRelativeMsgID
  * Oracle Type AnyData is not supported in the current version of OCILIB
  *
  * @note
- * the parameter 'typinf' indicates the type of payload to dequeue from the given queue :
+ * the parameter 'typinf' indicates the type of payload :
  * - For object payload, retrieve the object type information handle with
  *   OCI_TypeInfoGet() using the object type name
  * - For RAW payload, you MUST pass the object type information retrieved with
  *   OCI_TypeInfoGet() using "SYS.RAW" as object type name
  *
+ * @warning
+ * Newly created Message handles have NULL payloads.
+ * For Message handling Objects payloads, OCI_MsgGetObject() returns NULL until an object handle is
+ * assigned to the message.
+ *
+ * @note
+ * When a local OCI_Msg handle is enqueued, it keeps its attributes. If it's enqueued again, another
+ * identical message is posted into the queue.
+ * To reset a message and empty all its properties, call OCI_MsgReset()
+ * Note that OCI_MsgReset() clears the message payload.
+ *
  * @return
- * Return the Dequeue handle on success otherwise NULL on failure
+ * Return the message handle on success otherwise NULL on failure
  *
  */
 
-OCI_EXPORT OCI_Dequeue * OCI_API OCI_DequeueCreate
+OCI_EXPORT OCI_Msg * OCI_API OCI_MsgCreate
 (
-    OCI_TypeInfo *typinf,
-    const otext * name
+    OCI_TypeInfo *typinf
 );
 
 /**
  * @brief
- * Free a Dequeue object
+ * Free a message object
  *
- * @param dequeue - Dequeue handle
+ * @param msg - Message handle
+ *
+ * @warning
+ * Only message handles created with OCI_MsgCreate() should be freed by OCI_MsgFree()
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueFree
+OCI_EXPORT boolean OCI_API OCI_MsgFree
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Dequeue messages from the given queue
+ * Reset all attributes of a message object
  *
- * @param dequeue - Dequeue handle
+ * @param msg - Message handle
  *
- * @warning
- * The returned message is handled by the dequeue object.
- * Do not release it with OCI_MsgFree()
+ * @note
+ * This function calls OCI_MsgSetxxx() with default or NULL attributes
  *
  * @warning
- * When dequeuing from a multiple consumer queue, you need
- * to set the navigation mode to OCI_ADN_FIRST_MSG using
- * OCI_DequeueSetNavigation()
+ * OCI_MsgReset() clears the message payload and set it to NULL
+ * For messages handling objects payloads, OCI_MsgSetObject() must be called again to assign a
+ * payload.
  *
  * @return
- * Message handle on success otherwise NULL on failure or on timeout
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Msg * OCI_API OCI_DequeueGet
+OCI_EXPORT boolean OCI_API OCI_MsgReset
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Subscribe for asynchronous messages notifications
- *
- * @param dequeue  - Dequeue handle
- * @param port     - Port to use for notifications
- * @param timeout  - notification timeout
- * @param callback - User handler callback fired when messages are ready to be dequeued
- *
- * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * asynchronous messages notifications
+ * Get the object payload of the given message
  *
- * @note
- * Requires Oracle Client 10gR2 or above
+ * @param msg - Message handle
  *
  * @return
- * TRUE on success otherwise FALSE
+ * Return the object handle on success otherwise NULL on failure or if payload is NULL
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSubscribe
+OCI_EXPORT OCI_Object * OCI_API OCI_MsgGetObject
 (
-    OCI_Dequeue *  dequeue,
-    unsigned int   port,
-    unsigned int   timeout,
-    POCI_NOTIFY_AQ callback
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Unsubscribe for asynchronous messages notifications
+ * Set the object payload of the given message
  *
- * @param dequeue - Dequeue handle
+ * @param msg - Message handle
+ * @param obj - Object handle
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueUnsubscribe
+OCI_EXPORT boolean OCI_API OCI_MsgSetObject
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *   msg,
+    OCI_Object *obj
 );
 
 /**
  * @brief
- * Set the current consumer name to retrieve message for.
+ * Get the RAW payload of the given message
  *
- * @param dequeue  - Dequeue handle
- * @param consumer - consumer name
+ * @param msg  - Message handle
+ * @param raw  - Input buffer
+ * @param size - Input buffer maximum size
  *
- * @warning
- * If a queue is not set up for multiple consumers, OCI_DequeueSetConsumer()
- * should not be called or called with parameter 'consumer' set to NULL
+ * @note
+ * On output, parameter 'size' holds the number of bytes copied into the given buffer
  *
  * @return
- * TRUE on success otherwise FALSE
+ * TRUE on success otherwise FALSE on failure or if payload is object based.
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetConsumer
+OCI_EXPORT boolean OCI_API OCI_MsgGetRaw
 (
-    OCI_Dequeue *dequeue,
-    const otext *consumer
+    OCI_Msg *     msg,
+    void *        raw,
+    unsigned int *size
 );
 
 /**
  * @brief
- * Get the current consumer name associated with the dequeuing process.
+ * Set the RAW payload of the given message
  *
- * @param dequeue - Dequeue handle
+ * @param msg  - Message handle
+ * @param raw  - Raw data
+ * @param size - Raw data size
  *
- * @note
- * see OCI_DequeueSetConsumer() for more details
+ * @return
+ * TRUE on success otherwise FALSE on failure or if payload is object based.
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_DequeueGetConsumer
+OCI_EXPORT boolean OCI_API OCI_MsgSetRaw
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *    msg,
+    const void * raw,
+    unsigned int size
 );
 
 /**
  * @brief
- * set the correlation identifier of the message to be dequeued
- *
- * @param dequeue - Dequeue handle
- * @param pattern - correlation identifier
- *
- * @note
- * Special pattern matching characters, such as "%" or "_" can be used.
- * If more than one message satisfies the pattern, the order of dequeuing is undetermined.
+ * Return the number of attempts that have been made to dequeue the message
  *
- * @return
- * TRUE on success otherwise FALSE
+ * @param msg - Message handle
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetCorrelation
+OCI_EXPORT int OCI_API OCI_MsgGetAttemptCount
 (
-    OCI_Dequeue *dequeue,
-    const otext *pattern
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Get the correlation identifier of the message to be dequeued
+ * Return the number of seconds that a message is delayed for dequeuing
  *
- * @param dequeue - Dequeue handle
+ * @param msg - Message handle
  *
  * @note
- * see OCI_DequeueSetCorrelation() for more details
+ * see OCI_MsgSetEnqueueDelay() for more details
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_DequeueGetCorrelation
+OCI_EXPORT int OCI_API OCI_MsgGetEnqueueDelay
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Set the message identifier of the message to be dequeued
+ * set the number of seconds to delay the enqueued message
  *
- * @param dequeue - Dequeue handle
- * @param id      - message identifier
- * @param len     - size of the message identifier
+ * @param msg   - Message handle
+ * @param value - Delay in seconds
+ *
+ * @note
+ * The delay represents the number of seconds after which a message is available for dequeuing.
+ * When the message is enqueued, its state is set to OCI_AMS_WAITING.
+ * When the delay expires, its state is set to OCI_AMS_READY.
+ *
+ * @note
+ * If parameter 'value' is set to zero (default value), the message will be immediately available
+ * for dequeuing
  *
  * @warning
- * if the function cannot assign the message id, the content of the parameter 'len' is set to zero.
+ * Dequeuing by Message ID overrides the delay specification.
+ *
+ * @warning
+ * Delaying processing requires the queue monitor to be started.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetRelativeMsgID
+OCI_EXPORT boolean OCI_API OCI_MsgSetEnqueueDelay
 (
-    OCI_Dequeue *dequeue,
-    const void * id,
-    unsigned int len
+    OCI_Msg *msg,
+    int      value
 );
 
 /**
  * @brief
- * Get the message identifier of the message to be dequeued
- *
- * @param dequeue - Dequeue handle
- * @param id      - message identifier
- * @param len     - size of the message identifier
+ * return the time the message was enqueued
  *
- * @warning
- * When the function returns, parameter 'len' hold the number of bytes assigned to parameter 'id'
+ * @param msg - Message handle
  *
  * @note
- * see OCI_DequeueSetRelativeMsgID() for more details
+ * Only use this function for message dequeued from queues
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueGetRelativeMsgID
+OCI_EXPORT OCI_Date * OCI_API OCI_MsgGetEnqueueTime
 (
-    OCI_Dequeue * dequeue,
-    void *        id,
-    unsigned int *len
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Set whether the new message is dequeued as part of the current transaction
- *
- * @param dequeue    - Dequeue handle
- * @param visibility - dequeuing mode
+ * Return the duration that the message is available for dequeuing
  *
- * @warning
- * The visibility parameter is ignored when using the OCI_ADM_BROWSE dequeuing
- * mode (see OCI_DequeueSetMode())
+ * @param msg - Message handle
  *
  * @note
- * Possible values for parameter 'mode' :
- *   - OCI_AMV_IMMEDIATE : dequeue is an independent transaction
- *   - OCI_AMV_ON_COMMIT : dequeue is part of current transaction
- *
- * @note
- * Default value is OCI_AMV_ON_COMMIT
- *
- * @return
- * TRUE on success otherwise FALSE
+ * see OCI_MsgSetExpiration() for more details
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetVisibility
+OCI_EXPORT int OCI_API OCI_MsgGetExpiration
 (
-    OCI_Dequeue *dequeue,
-    unsigned int visibility
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Get the dequeuing/locking behavior
+ * set the duration that the message is available for dequeuing
  *
- * @param dequeue - Dequeue handle
+ * @param msg   - Message handle
+ * @param value - duration in seconds
  *
  * @note
- * see OCI_DequeueSetVisibility() for more details
- *
- */
-
-OCI_EXPORT unsigned int OCI_API OCI_DequeueGetVisibility
-(
-    OCI_Dequeue *dequeue
-);
-
-/**
- * @brief
- * Set the dequeuing/locking behavior
- *
- * @param dequeue - Dequeue handle
- * @param mode    - dequeuing mode
+ * This parameter is an offset from the delay (see OCI_MsgSetEnqueueDelay())
+ * While waiting for expiration, the message state is set to OCI_AMS_READY.
+ * If the message is not dequeued before it expires, it will be moved to the exception queue
+ * with the state OCI_AMS_EXPIRED.
  *
  * @note
- * Possible values for parameter 'mode' :
- *   - OCI_ADM_BROWSE        : read message without acquiring a lock
- *   - OCI_ADM_LOCKED        : read and obtain write lock on message
- *   - OCI_ADM_REMOVE        : read the message and delete it
- *   - OCI_ADM_REMOVE_NODATA : confirm receipt of the message, but do not
- *                             deliver the actual message content
+ * If parameter 'value' is set to -1 (default value), the message will not expire
  *
- * @note
- * Default value is OCI_ADM_REMOVE
+ * @warning
+ * Expiration processing requires the queue monitor to be started.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetMode
+OCI_EXPORT boolean OCI_API OCI_MsgSetExpiration
 (
-    OCI_Dequeue *dequeue,
-    unsigned int mode
+    OCI_Msg *msg,
+    int      value
 );
 
 /**
  * @brief
- * Get the dequeuing/locking behavior
+ * Return the state of the message at the time of the dequeue
  *
- * @param dequeue - Dequeue handle
+ * @param msg - Message handle
  *
- * @note
- * see OCI_DequeueSetMode() for more details
+ * @return
+ *  - OCI_UNKNOWN       :  the function has failed to get the message state
+ *  - OCI_AMS_READY     :  the message is ready to be processed
+ *  - OCI_AMS_WAITING   :  the message delay has not yet completed
+ *  - OCI_AMS_PROCESSED :  the message has been processed
+ *  - OCI_AMS_EXPIRED   :  the message has moved to exception queue
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_DequeueGetMode
+OCI_EXPORT unsigned int OCI_API OCI_MsgGetState
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Set the position of messages to be retrieved.
- *
- * @param dequeue  - Dequeue handle
- * @param position - navigation position
- *
- * @note
- * The dequeuing uses the following sequence :
- *   - find messages using the navigation position
- *   - apply search criteria (message correlation)
- *   - get message
+ * Return the priority of the message
  *
- * @note
- * Possible values for parameter 'position' :
- *   - OCI_ADN_FIRST_MSG        : retrieves the first message which is available
- *   - OCI_ADN_NEXT_MSG         : retrieves the next message which is available
- *   - OCI_ADN_NEXT_TRANSACTION : skips the remainder of the current transaction
- *                                group (if any) and retrieves the first message
- *                                of the next transaction group.
+ * @param msg - Message handle
  *
  * @note
- * Default value is OCI_ADN_NEXT_MSG
- *
- * @warning
- * OCI_ADN_NEXT_TRANSACTION can only be used if message grouping is enabled for the given queue.
- *
- * @return
- * TRUE on success otherwise FALSE
+ * see OCI_MsgSetPriority() for more details
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetNavigation
+OCI_EXPORT int OCI_API OCI_MsgGetPriority
 (
-    OCI_Dequeue *dequeue,
-    unsigned int position
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Return the navigation position of messages to retrieve from the queue
+ * Set the priority of the message
  *
- * @param dequeue - Dequeue handle
+ * @param msg   - Message handle
+ * @param value - Message priority
  *
  * @note
- * see OCI_DequeueSetNavigation() for more details
+ *   - The priority can be any number, including negative numbers.
+ *   - A smaller number indicates higher priority.
+ *   - Default value is zero.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_DequeueGetNavigation
+OCI_EXPORT boolean OCI_API OCI_MsgSetPriority
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *msg,
+    int      value
 );
 
 /**
  * @brief
- * set the time that OCIDequeueGet() waits for messages if no messages are
- * currently available
+ * Return the ID of the message
  *
- * @param dequeue - Dequeue handle
- * @param timeout - timeout in seconds
+ * @param msg - Message handle
+ * @param id  - Input buffer
+ * @param len - Input buffer maximum size
  *
  * @note
- * - Any positive values in seconds are valid.
- * - The value 0  is accepted and means OCIDequeueGet() does not wait for
- *   messages and returns immediately if no messages are available
- * - The value -1 is accepted and means OCIDequeueGet() waits for ever (until
- *   a message is available in the queue)
+ * The message ID is :
+ *  - generated when the message is enqueued in the queue
+ *  - retrieved when the message is dequeued from the queue
  *
  * @note
- * Default value is -1 (wait for ever)
+ * On output, parameter 'len' holds the number of bytes copied into the given buffer
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetWaitTime
+OCI_EXPORT boolean OCI_API OCI_MsgGetID
 (
-    OCI_Dequeue *dequeue,
-    int          timeout
+    OCI_Msg *     msg,
+    void *        id,
+    unsigned int *len
 );
 
 /**
  * @brief
- * Return the time that OCIDequeueGet() waits for messages if no messages are currently available
+ * Return the original ID of the message in the last queue that generated this message
  *
- * @param dequeue - Dequeue handle
+ * @param msg - Message handle
+ * @param id  - Input buffer
+ * @param len - Input buffer maximum size
+ *
+ * @warning
+ * When a message is propagated from/to different queues, this ID is the one generated for the
+ * message in the previous queue.
  *
  * @note
- * see OCI_DequeueSetWaitTime() for more details
+ * On output, parameter 'len' holds the number of bytes copied into the given buffer
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT int OCI_API OCI_DequeueGetWaitTime
+OCI_EXPORT boolean OCI_API OCI_MsgGetOriginalID
 (
-    OCI_Dequeue *dequeue
+    OCI_Msg *     msg,
+    void *        id,
+    unsigned int *len
 );
 
 /**
  * @brief
- * Set the Agent list to listen to message for
+ * Set the original ID of the message in the last queue that generated this message
  *
- * @param dequeue   - Dequeue handle
- * @param consumers - Agent handle array
- * @param count     - Number of agents the array
+ * @param msg  - Message handle
+ * @param id   - Message ID
+ * @param len  - Message ID size
+ *
+ * @warning
+ * When a message is propagated from/to different queues, this ID is the one generated for the
+ * message in the previous queue.
  *
  * @return
- * return TRUE on success otherwise FALSE
+ * TRUE on success otherwise FALSE
+ *
  */
 
-OCI_EXPORT boolean OCI_API OCI_DequeueSetAgentList
+OCI_EXPORT boolean OCI_API OCI_MsgSetOriginalID
 (
-    OCI_Dequeue *dequeue,
-    OCI_Agent ** consumers,
-    unsigned int count
+    OCI_Msg *    msg,
+    const void * id,
+    unsigned int len
 );
 
 /**
  * @brief
- * Listen for messages that match any recipient of the associated Agent list
- *
- * @param dequeue - Dequeue handle
- * @param timeout - Timeout in second
- *
- * @note
- * If an Agent handle is returned, messages are available for this agent.
- * In order to retrieve its messages :
- * - call OCI_DequeueSetConsumer() with the name of agent using OCI_AgentGetName()
- * - call OCI_DequeueGet() to dequeue it's pending messages
+ * Return the original sender of a message
  *
- * @warning
- * The return value is valid only until:
- * - OCIDequeueListen() is called again
- * - OCI_DequeueFree( is called to free the Dequeue object
- * So Do not store the handle value across calls to OCIDequeueListen()
+ * @param msg    - Message handle
  *
  * @return
- * An Agent handle for who messages are available on success otherwise NULL
+ * Sender Handle (OCI_Agent *) on success (if set at enqueue time) otherwise NULL
+ *
  */
 
-OCI_EXPORT OCI_Agent * OCI_API OCI_DequeueListen
+OCI_EXPORT OCI_Agent * OCI_API OCI_MsgGetSender
 (
-    OCI_Dequeue *dequeue,
-    int          timeout
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Create an AQ agent object
- *
- * @param con     - Connection handle
- * @param name    - Agent name
- * @param address - Agent address
- *
- * @note
- * An AQ agent object is :
- * - used as recipient information when enqueuing a message
- * - used as sender information when dequeuing a message
- * - used for listening message only from identified senders
+ * Set the original sender of a message
  *
- * @note
- * the AQ agent address can be any Oracle identifier, up to 128 bytes.
- * the AQ agent name    can be any Oracle identifier, up to 30  bytes.
+ * @param msg    - Message handle
+ * @param sender - Message sender
  *
  * @return
- * AQ agent handle on success otherwise NULL
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Agent * OCI_API OCI_AgentCreate
+OCI_EXPORT boolean OCI_API OCI_MsgSetSender
 (
-    OCI_Connection *con,
-    const otext *   name,
-    const otext *   address
+    OCI_Msg *  msg,
+    OCI_Agent *sender
 );
 
 /**
  * @brief
- * Free an AQ agent object
+ * Set the recipient list of a message to enqueue
  *
- * @param agent - AQ agent handle
+ * @param msg       - Message handle
+ * @param consumers - Recipients list (array of agent handles)
+ * @param count     - Number of recipients
  *
  * @warning
- * Only AQ agent handle created with OCI_AgentCreate() should be freed by OCI_AgentFree()
+ * This function should only be used for queues which allow multiple consumers.
+ * The default recipients are the queue subscribers.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_AgentFree
+OCI_EXPORT boolean OCI_API OCI_MsgSetConsumers
 (
-    OCI_Agent *agent
+    OCI_Msg *    msg,
+    OCI_Agent ** consumers,
+    unsigned int count
 );
 
 /**
  * @brief
- * Set the given AQ agent name
+ * Get the correlation identifier of the message
  *
- * @param agent - AQ agent handle
- * @param name  - AQ agent name
+ * @param msg - Message handle
  *
  * @note
- * the AQ agent name is used to identified an message send or recipient when enqueuing/dequeuing
- * a message
+ * see OCI_MsgSetCorrelation() for more details
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_MsgGetCorrelation
+(
+    OCI_Msg *msg
+);
+
+/**
+ * @brief
+ * set the correlation identifier of the message
+ *
+ * @param msg         - Message handle
+ * @param correlation - Message correlation text
  *
  * @note
- * the AQ agent name can be any Oracle identifier, up to 30 bytes.
+ * see OCI_DequeueSetCorrelation()  for more details
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_AgentSetName
+OCI_EXPORT boolean OCI_API OCI_MsgSetCorrelation
 (
-    OCI_Agent *  agent,
-    const otext *name
+    OCI_Msg *    msg,
+    const otext *correlation
 );
 
 /**
  * @brief
- * Get the given AQ agent name
+ * Get the Exception queue name of the message
  *
- * @param agent - AQ agent handle
+ * @param msg - Message handle
  *
- * @return
- * AQ agent name on success otherwise NULL on failure
+ * @warning
+ * When calling this function on a message retrieved with OCI_DequeueGet(), the returned value is
+ * NULL if the default exception queue associated with the current queue is used (e.g. no user
+ * defined specified at enqueue time for the message)
+ *
+ * @note
+ * see OCI_MsgSetExceptionQueue() for more details
  *
  */
-
-OCI_EXPORT const otext * OCI_API OCI_AgentGetName
+OCI_EXPORT const otext * OCI_API OCI_MsgGetExceptionQueue
 (
-    OCI_Agent *agent
+    OCI_Msg *msg
 );
 
 /**
  * @brief
- * Set the given AQ agent address
+ * Set the name of the queue to which the message is moved to if it cannot be
+ * processed successfully
  *
- * @param agent   - AQ agent handle
- * @param address - AQ agent address
+ * @param msg   - Message handle
+ * @param queue - Exception queue name
  *
- * @note
- * the parameter 'address' must be of the form : [schema.]queue_name[\@dblink]
+ * @warning
+ * From Oracle Documentation :
  *
- * @note
- * the AQ agent address can be any Oracle identifier, up to 128 bytes.
+ * "Messages are moved into exception queues in two cases :
+ *  - If the number of unsuccessful dequeue attempts has exceeded the attribute 'max_retries' of
+ *    given queue
+ *  - if the message has expired.
+ *
+ * All messages in the exception queue are in the EXPIRED state.
+ *
+ * The default is the exception queue associated with the queue table.
+ *
+ * If the exception queue specified does not exist at the time of the move the message will be
+ * moved to the default exception queue associated with the queue table and a warning will be
+ * logged in the alert file.
+ *
+ * This attribute must refer to a valid queue name."
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_AgentSetAddress
+OCI_EXPORT boolean OCI_API OCI_MsgSetExceptionQueue
 (
-    OCI_Agent *  agent,
-    const otext *address
+    OCI_Msg *    msg,
+    const otext *queue
 );
 
 /**
  * @brief
- * Get the given AQ agent address
+ * Create a Enqueue object for the given queue
  *
- * @param agent - AQ agent handle
+ * @param typinf - Type info handle
+ * @param name   - Queue name
  *
  * @note
- * See OCI_AgentSetAddress()
+ * OCILIB supports 2 type of message payload :
+ * - Oracle types (UDT)
+ * - RAW data
+ *
+ * @note
+ * Oracle Type AnyData is not supported in the current version of OCILIB
+ *
+ * @note
+ * the parameter 'typinf' indicates the type of payload to enqueue to the given queue :
+ * - For object payload, retrieve the object type information handle with
+ *   OCI_TypeInfoGet() using the object type name
+ * - For RAW payload, you MUST pass the object type information retrieved with
+ *   OCI_TypeInfoGet() using "SYS.RAW" as object type name
  *
  * @return
- * AQ agent address on success otherwise NULL on failure
+ * Return the Enqueue handle on success otherwise NULL on failure
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_AgentGetAddress
+OCI_EXPORT OCI_Enqueue * OCI_API OCI_EnqueueCreate
 (
-    OCI_Agent *agent
+    OCI_TypeInfo *typinf,
+    const otext * name
 );
 
 /**
  * @brief
- * Create a queue
- *
- * @param con                   - Connection handle
- * @param queue_name            - Queue name
- * @param queue_table           - Queue table name
- * @param queue_type            - Queue type
- * @param max_retries           - Maximum number of attempts to dequeue a message
- * @param retry_delay           - Number of seconds between attempts to dequeue a message
- * @param retention_time        - number of seconds a message is retained in the queue table after
- *                                being dequeued from the queue
- * @param dependency_tracking   - Parameter reserved for future use by Oracle (MUST be set to FALSE)
- * @param comment               - Description of the queue
+ * Free a Enqueue object
  *
- * @note
- * Parameter 'queue_name' can specify the schema where to create to queue ([schema.]queue_name)
- * Queue names cannot be longer than 24 characters (Oracle limit for user queues)
+ * @param enqueue - Enqueue handle
  *
- * @note
- * Possible values for parameter 'queue_type' :
- *  - OCI_AQT_NORMAL            : Normal queue
- *  - OCI_AQT_EXCEPTION         : Exception queue
- *  - OCI_AQT_NON_PERSISTENT    : Non persistent queue
+ * @return
+ * TRUE on success otherwise FALSE
  *
- * To set default values, pass :
- *  - queue_type     : OCI_AQT_NORMAL
- *  - max_retries    : 0
- *  - retry_delay    : 0
- *  - retention_time : 0
- *  - comment        : NULL
+ */
+
+OCI_EXPORT boolean OCI_API OCI_EnqueueFree
+(
+    OCI_Enqueue *enqueue
+);
+
+/**
+ * @brief
+ * Enqueue a message on the queue associated to the Enqueue object
  *
- * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.CREATE_QUEUE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * @param enqueue - Enqueue handle
+ * @param msg     - Message handle to enqueue
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueCreate
+OCI_EXPORT boolean OCI_API OCI_EnqueuePut
 (
-    OCI_Connection *con,
-    const otext *   queue_name,
-    const otext *   queue_table,
-    unsigned int    queue_type,
-    unsigned int    max_retries,
-    unsigned int    retry_delay,
-    unsigned int    retention_time,
-    boolean         dependency_tracking,
-    const otext *   comment
+    OCI_Enqueue *enqueue,
+    OCI_Msg *    msg
+);
+
+/**
+* @brief
+* Set the enqueuing sequence of messages to put in the queue
+*
+* @param enqueue  - Enqueue handle
+* @param sequence - enqueuing sequence
+*
+* @note
+* Possible values for parameter 'sequence' :
+*   - OCI_ASD_BEFORE : enqueue message before another message
+*   - OCI_ASD_TOP    : enqueue message before all messages
+*
+* @note
+* Default value is OCI_ASD_TOP
+*
+* @note
+* if the parameter 'sequence' is set to OCI_ASD_BEFORE, the application must
+* call OCI_EnqueueSetRelativeMsgID() before enqueuing the next message in the queue.
+*
+* @note
+* In order to stop enqueuing message using a sequence deviation, call
+* OCI_EnqueueSetSequenceDeviation() with the value OCI_ASD_TOP
+*
+* @return
+* TRUE on success otherwise FALSE
+*
+*/
+
+OCI_EXPORT boolean OCI_API OCI_EnqueueSetSequenceDeviation
+(
+    OCI_Enqueue *enqueue,
+    unsigned int sequence
 );
 
 /**
  * @brief
- * Alter the given queue
+ * Return the sequence deviation of messages to enqueue to the queue
  *
- * @param con                   - Connection handle
- * @param queue_name            - Queue name
- * @param max_retries           - Maximum number of attempts to dequeue a message
- * @param retry_delay           - Number of seconds between attempts to dequeue a message
- * @param retention_time        - number of seconds a message is retained in the queue table after
- *                                being dequeued from the queue
- * @param comment               - Description of the queue
+ * @param enqueue - Enqueue handle
  *
  * @note
- * See OCI_QueueCreate() for more details
+ * see OCI_EnqueueSetSequenceDeviation() for more details
  *
- * @warning
- * This function updates all attributes handled in the parameter list !
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_EnqueueGetSequenceDeviation
+(
+    OCI_Enqueue *enqueue
+);
+
+/**
+ * @brief
+ * Set whether the new message is enqueued as part of the current transaction
+ *
+ * @param enqueue    - Enqueue handle
+ * @param visibility - Enqueuing visibility
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.ALTER_QUEUE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * Possible values for parameter 'visibility' :
+ *   - OCI_AMV_IMMEDIATE : enqueue is an independent transaction
+ *   - OCI_AMV_ON_COMMIT : enqueue is part of current transaction
+ *
+ * @note
+ * Default value is OCI_AMV_ON_COMMIT
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueAlter
+OCI_EXPORT boolean OCI_API OCI_EnqueueSetVisibility
 (
-    OCI_Connection *con,
-    const otext *   queue_name,
-    unsigned int    max_retries,
-    unsigned int    retry_delay,
-    unsigned int    retention_time,
-    const otext *   comment
+    OCI_Enqueue *enqueue,
+    unsigned int visibility
 );
 
 /**
  * @brief
- * Drop the given queue
- *
- * @param con        - Connection handle
- * @param queue_name - Queue name
+ * Get the enqueuing/locking behavior
  *
- * @warning
- * A queue can be dropped only if it has been stopped before.
+ * @param enqueue - Enqueue handle
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.DROP_QUEUE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * see OCI_EnqueueSetVisibility() for more details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_EnqueueGetVisibility
+(
+    OCI_Enqueue *enqueue
+);
+
+/**
+ * @brief
+ * Set a message identifier to use for enqueuing messages using a sequence deviation
+ *
+ * @param enqueue - Enqueue handle
+ * @param id      - message identifier
+ * @param len     - pointer to message identifier length
+ *
+ * @note
+ * This call is only valid if OCI_EnqueueSetSequenceDeviation() has been called
+ * with the value  OCI_ASD_BEFORE
+ *
+ * @warning
+ * if the function cannot assign the message id, the content of the parameter 'len' is set to zero.
+ *
+ * @note
+ * see OCI_EnqueueSetSequenceDeviation() for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_EnqueueSetRelativeMsgID
+(
+    OCI_Enqueue *enqueue,
+    const void * id,
+    unsigned int len
+);
+
+/**
+ * @brief
+ * Get the current associated message identifier used for enqueuing messages
+ * using a sequence deviation
+ *
+ * @param enqueue - Enqueue handle
+ * @param id      - buffer to receive the message identifier
+ * @param len     - pointer to buffer max length
+ *
+ * @warning
+ * When the function returns, parameter 'len' hold the number of bytes assigned to parameter 'id'
+ *
+ * @note
+ * see OCI_EnqueueGetRelativeMsgID() for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_EnqueueGetRelativeMsgID
+(
+    OCI_Enqueue * enqueue,
+    void *        id,
+    unsigned int *len
+);
+
+/**
+ * @brief
+ * Create a Dequeue object for the given queue
+ *
+ * @param typinf - Type info handle
+ * @param name   - Queue name
+ *
+ * @note
+ * OCILIB supports 2 type of message payload :
+ * - Oracle types (UDT)
+ * - RAW data
+ *
+ * @note
+ * Oracle Type AnyData is not supported in the current version of OCILIB
+ *
+ * @note
+ * the parameter 'typinf' indicates the type of payload to dequeue from the given queue :
+ * - For object payload, retrieve the object type information handle with
+ *   OCI_TypeInfoGet() using the object type name
+ * - For RAW payload, you MUST pass the object type information retrieved with
+ *   OCI_TypeInfoGet() using "SYS.RAW" as object type name
+ *
+ * @return
+ * Return the Dequeue handle on success otherwise NULL on failure
+ *
+ */
+
+OCI_EXPORT OCI_Dequeue * OCI_API OCI_DequeueCreate
+(
+    OCI_TypeInfo *typinf,
+    const otext * name
+);
+
+/**
+ * @brief
+ * Free a Dequeue object
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueFree
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * Dequeue messages from the given queue
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @warning
+ * The returned message is handled by the dequeue object.
+ * Do not release it with OCI_MsgFree()
+ *
+ * @warning
+ * When dequeuing from a multiple consumer queue, you need
+ * to set the navigation mode to OCI_ADN_FIRST_MSG using
+ * OCI_DequeueSetNavigation()
+ *
+ * @return
+ * Message handle on success otherwise NULL on failure or on timeout
+ *
+ */
+
+OCI_EXPORT OCI_Msg * OCI_API OCI_DequeueGet
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * Subscribe for asynchronous messages notifications
+ *
+ * @param dequeue  - Dequeue handle
+ * @param port     - Port to use for notifications
+ * @param timeout  - notification timeout
+ * @param callback - User handler callback fired when messages are ready to be dequeued
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * asynchronous messages notifications
+ *
+ * @note
+ * Requires Oracle Client 10gR2 or above
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSubscribe
+(
+    OCI_Dequeue *  dequeue,
+    unsigned int   port,
+    unsigned int   timeout,
+    POCI_NOTIFY_AQ callback
+);
+
+/**
+ * @brief
+ * Unsubscribe for asynchronous messages notifications
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueUnsubscribe
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * Set the current consumer name to retrieve message for.
+ *
+ * @param dequeue  - Dequeue handle
+ * @param consumer - consumer name
+ *
+ * @warning
+ * If a queue is not set up for multiple consumers, OCI_DequeueSetConsumer()
+ * should not be called or called with parameter 'consumer' set to NULL
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetConsumer
+(
+    OCI_Dequeue *dequeue,
+    const otext *consumer
+);
+
+/**
+ * @brief
+ * Get the current consumer name associated with the dequeuing process.
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @note
+ * see OCI_DequeueSetConsumer() for more details
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_DequeueGetConsumer
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * set the correlation identifier of the message to be dequeued
+ *
+ * @param dequeue - Dequeue handle
+ * @param pattern - correlation identifier
+ *
+ * @note
+ * Special pattern matching characters, such as "%" or "_" can be used.
+ * If more than one message satisfies the pattern, the order of dequeuing is undetermined.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetCorrelation
+(
+    OCI_Dequeue *dequeue,
+    const otext *pattern
+);
+
+/**
+ * @brief
+ * Get the correlation identifier of the message to be dequeued
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @note
+ * see OCI_DequeueSetCorrelation() for more details
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_DequeueGetCorrelation
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * Set the message identifier of the message to be dequeued
+ *
+ * @param dequeue - Dequeue handle
+ * @param id      - message identifier
+ * @param len     - size of the message identifier
+ *
+ * @warning
+ * if the function cannot assign the message id, the content of the parameter 'len' is set to zero.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetRelativeMsgID
+(
+    OCI_Dequeue *dequeue,
+    const void * id,
+    unsigned int len
+);
+
+/**
+ * @brief
+ * Get the message identifier of the message to be dequeued
+ *
+ * @param dequeue - Dequeue handle
+ * @param id      - message identifier
+ * @param len     - size of the message identifier
+ *
+ * @warning
+ * When the function returns, parameter 'len' hold the number of bytes assigned to parameter 'id'
+ *
+ * @note
+ * see OCI_DequeueSetRelativeMsgID() for more details
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueGetRelativeMsgID
+(
+    OCI_Dequeue * dequeue,
+    void *        id,
+    unsigned int *len
+);
+
+/**
+ * @brief
+ * Set whether the new message is dequeued as part of the current transaction
+ *
+ * @param dequeue    - Dequeue handle
+ * @param visibility - dequeuing mode
+ *
+ * @warning
+ * The visibility parameter is ignored when using the OCI_ADM_BROWSE dequeuing
+ * mode (see OCI_DequeueSetMode())
+ *
+ * @note
+ * Possible values for parameter 'mode' :
+ *   - OCI_AMV_IMMEDIATE : dequeue is an independent transaction
+ *   - OCI_AMV_ON_COMMIT : dequeue is part of current transaction
+ *
+ * @note
+ * Default value is OCI_AMV_ON_COMMIT
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetVisibility
+(
+    OCI_Dequeue *dequeue,
+    unsigned int visibility
+);
+
+/**
+ * @brief
+ * Get the dequeuing/locking behavior
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @note
+ * see OCI_DequeueSetVisibility() for more details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DequeueGetVisibility
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * Set the dequeuing/locking behavior
+ *
+ * @param dequeue - Dequeue handle
+ * @param mode    - dequeuing mode
+ *
+ * @note
+ * Possible values for parameter 'mode' :
+ *   - OCI_ADM_BROWSE        : read message without acquiring a lock
+ *   - OCI_ADM_LOCKED        : read and obtain write lock on message
+ *   - OCI_ADM_REMOVE        : read the message and delete it
+ *   - OCI_ADM_REMOVE_NODATA : confirm receipt of the message, but do not
+ *                             deliver the actual message content
+ *
+ * @note
+ * Default value is OCI_ADM_REMOVE
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetMode
+(
+    OCI_Dequeue *dequeue,
+    unsigned int mode
+);
+
+/**
+ * @brief
+ * Get the dequeuing/locking behavior
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @note
+ * see OCI_DequeueSetMode() for more details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DequeueGetMode
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * Set the position of messages to be retrieved.
+ *
+ * @param dequeue  - Dequeue handle
+ * @param position - navigation position
+ *
+ * @note
+ * The dequeuing uses the following sequence :
+ *   - find messages using the navigation position
+ *   - apply search criteria (message correlation)
+ *   - get message
+ *
+ * @note
+ * Possible values for parameter 'position' :
+ *   - OCI_ADN_FIRST_MSG        : retrieves the first message which is available
+ *   - OCI_ADN_NEXT_MSG         : retrieves the next message which is available
+ *   - OCI_ADN_NEXT_TRANSACTION : skips the remainder of the current transaction
+ *                                group (if any) and retrieves the first message
+ *                                of the next transaction group.
+ *
+ * @note
+ * Default value is OCI_ADN_NEXT_MSG
+ *
+ * @warning
+ * OCI_ADN_NEXT_TRANSACTION can only be used if message grouping is enabled for the given queue.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetNavigation
+(
+    OCI_Dequeue *dequeue,
+    unsigned int position
+);
+
+/**
+ * @brief
+ * Return the navigation position of messages to retrieve from the queue
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @note
+ * see OCI_DequeueSetNavigation() for more details
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_DequeueGetNavigation
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * set the time that OCIDequeueGet() waits for messages if no messages are
+ * currently available
+ *
+ * @param dequeue - Dequeue handle
+ * @param timeout - timeout in seconds
+ *
+ * @note
+ * - Any positive values in seconds are valid.
+ * - The value 0  is accepted and means OCIDequeueGet() does not wait for
+ *   messages and returns immediately if no messages are available
+ * - The value -1 is accepted and means OCIDequeueGet() waits for ever (until
+ *   a message is available in the queue)
+ *
+ * @note
+ * Default value is -1 (wait for ever)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetWaitTime
+(
+    OCI_Dequeue *dequeue,
+    int          timeout
+);
+
+/**
+ * @brief
+ * Return the time that OCIDequeueGet() waits for messages if no messages are currently available
+ *
+ * @param dequeue - Dequeue handle
+ *
+ * @note
+ * see OCI_DequeueSetWaitTime() for more details
+ *
+ */
+
+OCI_EXPORT int OCI_API OCI_DequeueGetWaitTime
+(
+    OCI_Dequeue *dequeue
+);
+
+/**
+ * @brief
+ * Set the Agent list to listen to message for
+ *
+ * @param dequeue   - Dequeue handle
+ * @param consumers - Agent handle array
+ * @param count     - Number of agents the array
+ *
+ * @return
+ * return TRUE on success otherwise FALSE
+ */
+
+OCI_EXPORT boolean OCI_API OCI_DequeueSetAgentList
+(
+    OCI_Dequeue *dequeue,
+    OCI_Agent ** consumers,
+    unsigned int count
+);
+
+/**
+ * @brief
+ * Listen for messages that match any recipient of the associated Agent list
+ *
+ * @param dequeue - Dequeue handle
+ * @param timeout - Timeout in second
+ *
+ * @note
+ * If an Agent handle is returned, messages are available for this agent.
+ * In order to retrieve its messages :
+ * - call OCI_DequeueSetConsumer() with the name of agent using OCI_AgentGetName()
+ * - call OCI_DequeueGet() to dequeue it's pending messages
+ *
+ * @warning
+ * The return value is valid only until:
+ * - OCIDequeueListen() is called again
+ * - OCI_DequeueFree( is called to free the Dequeue object
+ * So Do not store the handle value across calls to OCIDequeueListen()
+ *
+ * @return
+ * An Agent handle for who messages are available on success otherwise NULL
+ */
+
+OCI_EXPORT OCI_Agent * OCI_API OCI_DequeueListen
+(
+    OCI_Dequeue *dequeue,
+    int          timeout
+);
+
+/**
+ * @brief
+ * Create an AQ agent object
+ *
+ * @param con     - Connection handle
+ * @param name    - Agent name
+ * @param address - Agent address
+ *
+ * @note
+ * An AQ agent object is :
+ * - used as recipient information when enqueuing a message
+ * - used as sender information when dequeuing a message
+ * - used for listening message only from identified senders
+ *
+ * @note
+ * the AQ agent address can be any Oracle identifier, up to 128 bytes.
+ * the AQ agent name    can be any Oracle identifier, up to 30  bytes.
+ *
+ * @return
+ * AQ agent handle on success otherwise NULL
+ *
+ */
+
+OCI_EXPORT OCI_Agent * OCI_API OCI_AgentCreate
+(
+    OCI_Connection *con,
+    const otext *   name,
+    const otext *   address
+);
+
+/**
+ * @brief
+ * Free an AQ agent object
+ *
+ * @param agent - AQ agent handle
+ *
+ * @warning
+ * Only AQ agent handle created with OCI_AgentCreate() should be freed by OCI_AgentFree()
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_AgentFree
+(
+    OCI_Agent *agent
+);
+
+/**
+ * @brief
+ * Set the given AQ agent name
+ *
+ * @param agent - AQ agent handle
+ * @param name  - AQ agent name
+ *
+ * @note
+ * the AQ agent name is used to identified an message send or recipient when enqueuing/dequeuing
+ * a message
+ *
+ * @note
+ * the AQ agent name can be any Oracle identifier, up to 30 bytes.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_AgentSetName
+(
+    OCI_Agent *  agent,
+    const otext *name
+);
+
+/**
+ * @brief
+ * Get the given AQ agent name
+ *
+ * @param agent - AQ agent handle
+ *
+ * @return
+ * AQ agent name on success otherwise NULL on failure
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_AgentGetName
+(
+    OCI_Agent *agent
+);
+
+/**
+ * @brief
+ * Set the given AQ agent address
+ *
+ * @param agent   - AQ agent handle
+ * @param address - AQ agent address
+ *
+ * @note
+ * the parameter 'address' must be of the form : [schema.]queue_name[\@dblink]
+ *
+ * @note
+ * the AQ agent address can be any Oracle identifier, up to 128 bytes.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_AgentSetAddress
+(
+    OCI_Agent *  agent,
+    const otext *address
+);
+
+/**
+ * @brief
+ * Get the given AQ agent address
+ *
+ * @param agent - AQ agent handle
+ *
+ * @note
+ * See OCI_AgentSetAddress()
+ *
+ * @return
+ * AQ agent address on success otherwise NULL on failure
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_AgentGetAddress
+(
+    OCI_Agent *agent
+);
+
+/**
+ * @brief
+ * Create a queue
+ *
+ * @param con                   - Connection handle
+ * @param queue_name            - Queue name
+ * @param queue_table           - Queue table name
+ * @param queue_type            - Queue type
+ * @param max_retries           - Maximum number of attempts to dequeue a message
+ * @param retry_delay           - Number of seconds between attempts to dequeue a message
+ * @param retention_time        - number of seconds a message is retained in the queue table after
+ *                                being dequeued from the queue
+ * @param dependency_tracking   - Parameter reserved for future use by Oracle (MUST be set to FALSE)
+ * @param comment               - Description of the queue
+ *
+ * @note
+ * Parameter 'queue_name' can specify the schema where to create to queue ([schema.]queue_name)
+ * Queue names cannot be longer than 24 characters (Oracle limit for user queues)
+ *
+ * @note
+ * Possible values for parameter 'queue_type' :
+ *  - OCI_AQT_NORMAL            : Normal queue
+ *  - OCI_AQT_EXCEPTION         : Exception queue
+ *  - OCI_AQT_NON_PERSISTENT    : Non persistent queue
+ *
+ * To set default values, pass :
+ *  - queue_type     : OCI_AQT_NORMAL
+ *  - max_retries    : 0
+ *  - retry_delay    : 0
+ *  - retention_time : 0
+ *  - comment        : NULL
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.CREATE_QUEUE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueCreate
+(
+    OCI_Connection *con,
+    const otext *   queue_name,
+    const otext *   queue_table,
+    unsigned int    queue_type,
+    unsigned int    max_retries,
+    unsigned int    retry_delay,
+    unsigned int    retention_time,
+    boolean         dependency_tracking,
+    const otext *   comment
+);
+
+/**
+ * @brief
+ * Alter the given queue
+ *
+ * @param con                   - Connection handle
+ * @param queue_name            - Queue name
+ * @param max_retries           - Maximum number of attempts to dequeue a message
+ * @param retry_delay           - Number of seconds between attempts to dequeue a message
+ * @param retention_time        - number of seconds a message is retained in the queue table after
+ *                                being dequeued from the queue
+ * @param comment               - Description of the queue
+ *
+ * @note
+ * See OCI_QueueCreate() for more details
+ *
+ * @warning
+ * This function updates all attributes handled in the parameter list !
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.ALTER_QUEUE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueAlter
+(
+    OCI_Connection *con,
+    const otext *   queue_name,
+    unsigned int    max_retries,
+    unsigned int    retry_delay,
+    unsigned int    retention_time,
+    const otext *   comment
+);
+
+/**
+ * @brief
+ * Drop the given queue
+ *
+ * @param con        - Connection handle
+ * @param queue_name - Queue name
+ *
+ * @warning
+ * A queue can be dropped only if it has been stopped before.
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.DROP_QUEUE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueDrop
+(
+    OCI_Connection *con,
+    const otext *   queue_name
+);
+
+/**
+ * @brief
+ * Start the given queue
+ *
+ * @param con        - Connection handle
+ * @param queue_name - Queue name
+ * @param enqueue    - Enable enqueue
+ * @param dequeue    - Enable dequeue
+ *
+ * @warning
+ * For exception queues, only enqueuing is allowed
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.START_QUEUE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueStart
+(
+    OCI_Connection *con,
+    const otext *   queue_name,
+    boolean         enqueue,
+    boolean         dequeue
+);
+
+/**
+ * @brief
+ * Stop enqueuing or dequeuing or both on the given queue
+ *
+ * @param con        - Connection handle
+ * @param queue_name - Queue name
+ * @param enqueue    - Disable enqueue
+ * @param dequeue    - Disable dequeue
+ * @param wait       - Wait for current pending enqueues/dequeues
+ *
+ * @warning
+ * A queue cannot be stopped if there are pending transactions against the queue.
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.STOP_QUEUE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueStop
+(
+    OCI_Connection *con,
+    const otext *   queue_name,
+    boolean         enqueue,
+    boolean         dequeue,
+    boolean         wait
+);
+
+/**
+ * @brief
+ * Create a queue table for messages of the given type
+ *
+ * @param con                   - Connection handle
+ * @param queue_table           - Queue table name
+ * @param queue_payload_type    - Message type name
+ * @param storage_clause        - Additional clauses for the table storage
+ * @param sort_list             - Additional columns name to use for sorting
+ * @param multiple_consumers    - Enable multiple consumers for each messages
+ * @param message_grouping      - Specifies if messages are grouped within a transaction
+ * @param comment               - Description of the queue table
+ * @param primary_instance      - primary owner (instance) of the queue table
+ * @param secondary_instance    - Owner of the queue table if the primary instance is not available
+ * @param compatible            - lowest database version with which the queue table is compatible
+ *
+ * @note
+ * Parameter 'queue_table' can specify the schema where to create to queue table ([schema.]queue_table)
+ * Queue table names cannot be longer than 24 characters (Oracle limit for user queue tables)
+ *
+ * @note
+ * Possible values for parameter 'queue_payload_type' :
+ * - For Oracle types (UDT) : use the type name ([schema.].type_name)
+ * - For RAW data           : use "SYS.RAW" or "RAW"
+ *
+ * @note
+ * Possible values for parameter 'message_grouping' :
+ *  - OCI_AGM_NONE            : each message is treated individually
+ *  - OCI_AGM_TRANSACTIONNAL  : all messages enqueued in one transaction are considered part of
+ *                              the same group and can be dequeued as a group of related messages.
+ *
+ * @note
+ * Possible values for parameter 'compatible' :
+ * - "8.0", "8.1", "10.0"
+ *
+ * To set default values, pass :
+ *  - storage_clause    : NULL
+ *  - sort_list         : NULL
+ *  - message_grouping  : OCI_AGM_NONE
+ *  - comment           : NULL
+ *  - primary_instance  : 0
+ *  - primary_instance  : 0
+ *  - compatible        : NULL
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.CREATE_QUEUE_TABLE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueTableCreate
+(
+    OCI_Connection *con,
+    const otext *   queue_table,
+    const otext *   queue_payload_type,
+    const otext *   storage_clause,
+    const otext *   sort_list,
+    boolean         multiple_consumers,
+    unsigned int    message_grouping,
+    const otext *   comment,
+    unsigned int    primary_instance,
+    unsigned int    secondary_instance,
+    const otext *   compatible
+);
+
+/**
+ * @brief
+ * Alter the given queue table
+ *
+ * @param con                   - Connection handle
+ * @param queue_table           - Queue table name
+ * @param comment               - Description of the queue table
+ * @param primary_instance      - primary owner (instance) of the queue table
+ * @param secondary_instance    - Owner of the queue table if the primary instance is not available
+ *
+ * @note
+ * See OCI_QueueTableCreate() from more details
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.ALTER_QUEUE_TABLE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueTableAlter
+(
+    OCI_Connection *con,
+    const otext *   queue_table,
+    const otext *   comment,
+    unsigned int    primary_instance,
+    unsigned int    secondary_instance
+);
+
+/**
+ * @brief
+ * Drop the given queue table
+ *
+ * @param con         - Connection handle
+ * @param queue_table - Queue table name
+ * @param force       - Force the deletion of objects related to the queue table
+ *
+ * @note
+ * Possible values for 'force' :
+ *  - TRUE  : all queues using the queue table and their associated propagation schedules are
+ *            dropped automatically
+ *  - FALSE : All the queues using the given queue table must be stopped and dropped before the
+ *            queue table can be dropped.
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.DROP_QUEUE_TABLE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueTableDrop
+(
+    OCI_Connection *con,
+    const otext *   queue_table,
+    boolean         force
+);
+
+/**
+ * @brief
+ * Purge messages from the given queue table
+ *
+ * @param con             - Connection handle
+ * @param queue_table     - Queue table name
+ * @param purge_condition - Optional SQL based conditions (see notes)
+ * @param block           - Lock all queues using the queue table while doing the purge
+ * @param delivery_mode   - Type of message to purge
+ *
+ * @note
+ * Possible values for parameter 'delivery_mode' :
+ *  - OCI_APM_BUFFERED      : purge only buffered   messages
+ *  - OCI_APM_PERSISTENT    : purge only persistent messages
+ *  - OCI_APM_ALL           : purge all messages
+ *
+ * @note
+ * For more information about the SQL purge conditions, refer to
+ *  Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @warning
+ * This feature is only available from Oracle 10gR2.
+ * This function does nothing and returns TRUE is the server version is < Oracle 10gR2
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.PURGE_QUEUE_TABLE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueTablePurge
+(
+    OCI_Connection *con,
+    const otext *   queue_table,
+    const otext *   purge_condition,
+    boolean         block,
+    unsigned int    delivery_mode
+);
+
+/**
+ * @brief
+ * Migrate a queue table from one version to another
+ *
+ * @param con             - Connection handle
+ * @param queue_table     - Queue table name
+ * @param compatible      - Database version with witch the queue table has to migrate
+ *
+ * @note
+ * Possible values for parameter 'compatible' :
+ * - "8.0", "8.1", "10.0"
+ *
+ * @note
+ * this call wraps the PL/SQL procedure DBMS_AQADM.MIGRATE_QUEUE_TABLE().
+ * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_QueueTableMigrate
+(
+    OCI_Connection *con,
+    const otext *   queue_table,
+    const otext *   compatible
+);
+
+/**
+ * @} OcilibCApiAdvancedQueuing
+ */
+
+/**
+ * @defgroup OcilibCApiSubscriptions Database Change notifications (DCN or CQN)
+ * @{
+ *
+ * OCILIB supports Oracle 10gR2 feature Database Change Notifications (DCN)
+ * also named Continuous Query Notifications (CQN)
+ *
+ * This features allows a client application to register notifications
+ * when some changes are made in a database :
+ * - Database status changes : startup and shutdown
+ * - Database objects changes :
+ *  - DDL changes : alter or drop actions
+ *  - DML changes : insert, delete, update actions
+ *
+ * This feature can be really useful in applications that hold
+ * a cache of data. Instead of refreshing data periodically by
+ * connecting to the server, the application could only refresh
+ * modified data when necessary or perform specific tasks depending on
+ * the events. It saves application time, network traffic and can help
+ * the design of the application logic.
+ *
+ * The database status change notification is also interesting to be
+ * informed of instance startup / shutdown
+ *
+ * Check Oracle documentation for more details about this feature
+ *
+ * @note
+ * No active database connection is required to receive the
+ * notifications as they are handled by the Oracle client using a
+ * dedicated socket connection to the server
+ *
+ * @par Database changes
+ *
+ * The client application can be notified of any database status
+ * change (single DB or multiple DB in a RAC environment).
+ *
+ * @par Object changes
+ *
+ * The notifications of object changes are based on the registration
+ * of a query ('select' SQL statement).
+ *
+ * Oracle server will notify of any changes of any object that is
+ * part of the statement result set.
+ *
+ * Registering a statement will notify about any changes on its
+ * result set rows performed after the registration of the query.
+ *
+ * The query can be a simple 'select * from table' or a complex
+ * query involving many tables and/or criteria in the where clause.
+ *
+ * For Object changes, the notification can be at :
+ *  - At Object level : only the object name (schema + object) is given
+ *  - At row level : same that object level + RowID of the altered row
+ *
+ * @warning
+ * Trying to use this features with a client/server version < 10gR2 will raise an error
+ *
+ * @par Example
+ * @include notification.c
+ *
+ */
+
+/**
+ * @brief
+ * Register a notification against the given database
+ *
+ * @param con      - Connection handle
+ * @param name     - Notification name
+ * @param type     - Subscription type
+ * @param handler  - User handler callback
+ * @param port     - Port to use for notifications
+ * @param timeout  - notification timeout
+ *
+ * @note
+ * Parameter 'type' can be one of the following values :
+ *
+ * - OCI_CNT_OBJECTS   : request for changes at objects (e.g. tables) level (DDL / DML)
+ * - OCI_CNT_ROWS      : request for changes at rows level (DML)
+ * - OCI_CNT_DATABASES : request for changes at database level (startup, shutdown)
+ * - OCI_CNT_ALL       : request for all changes
+ *
+ * @note
+ * Parameter 'port' and 'timeout' are optional (use value 0 a optional value)
+ * 
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ * @ @warning Port usage
+ * All notifications are using the same port. 
+ * Port number can be either:
+ *   - determined automatically by Oracle client once the first subscription had been created and can be retrieved using OCI_SubscriptionGetPort()
+ *   - Set by the parameter 'port' during the first call to OCI_SubscriptionRegister(). In this case later calls can provide same port number or 0
+ * 
+ * @note
+ * Requires Oracle Client 10gR2 or above
+ *
+ * @note
+ * Subscription handles are automatically managed by the library
+ *
+ * @return
+ * Subscription handle on success or NULL on failure
+ *
+ */
+
+OCI_EXPORT OCI_Subscription * OCI_API OCI_SubscriptionRegister
+(
+    OCI_Connection *con,
+    const otext *   name,
+    unsigned int    type,
+    POCI_NOTIFY     handler,
+    unsigned int    port,
+    unsigned int    timeout
+);
+
+/**
+ * @brief
+ * Unregister a previously registered notification
+ *
+ * @param sub - Subscription handle
+ *
+ * @note
+ * OCI_Cleanup() will automatically unregister any registered subscriptions
+ *
+ * @note
+ * If the database connection passed to OCI_SubscriptionRegister()
+ * has been closed by the time that the application calls
+ * OCI_SubscriptionUnregister, the library internally reconnects
+ * to the given database, performs the unregistration and then disconnects
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SubscriptionUnregister
+(
+    OCI_Subscription *sub
+);
+
+/**
+ * @brief
+ * Add a statement to the notification to monitor
+ *
+ * @param sub  - Subscription handle
+ * @param stmt - Statement handle
+ *
+ * @note
+ * The given statement must be prepared but not executed before being passed to this function.
+ * OCI_SubscriptionAddStatement() executes the statement and register it for notifications
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ * @note
+ * The given statement must hold a 'SELECT' SQL statement
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SubscriptionAddStatement
+(
+    OCI_Subscription *sub,
+    OCI_Statement *   stmt
+);
+
+/**
+ * @brief
+ * Return the name of the given registered subscription
+ *
+ * @param sub - Subscription handle
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_SubscriptionGetName
+(
+    OCI_Subscription *sub
+);
+
+/**
+ * @brief
+ * Return the port used by the notification
+ *
+ * @param sub - Subscription handle
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_SubscriptionGetPort
+(
+    OCI_Subscription *sub
+);
+
+/**
+ * @brief
+ * Return the timeout of the given registered subscription
+ *
+ * @param sub - Subscription handle
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_SubscriptionGetTimeout
+(
+    OCI_Subscription *sub
+);
+
+/**
+ * @brief
+ * Return the connection handle associated with a subscription handle
+ *
+ * @param sub - Subscription handle
+ *
+ * @note
+ * It may return a NULL handle if the connection used in OCI_SubscriptionRegister has been closed.
+ *
+ */
+
+OCI_EXPORT OCI_Connection * OCI_API OCI_SubscriptionGetConnection
+(
+    OCI_Subscription *sub
+);
+
+/**
+ * @brief
+ * Return the type of event reported by a notification
+ *
+ * @param event - Event handle
+ *
+ * @note
+ * The returned value can be one of the following values :
+ *
+ * - OCI_ENT_STARTUP        : a database has been started up
+ * - OCI_ENT_SHUTDOWN       : a database has been shut down
+ * - OCI_ENT_SHUTDOWN_ANY   : a database has been shut down (RAC)
+ * - OCI_ENT_DROP_DATABASE  : a database has been dropped
+ * - OCI_ENT_DEREGISTER     : the notification is timed out
+ * - OCI_ENT_OBJECT_CHANGED : a database object has been modified
+ *
+ * @note
+ * OCI_EventGetDatabase() returns the affected database
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ * @note
+ * OCI_EventGetObject() returns the affected object
+ * ('schema_name'.'object_name')
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_EventGetType
+(
+    OCI_Event *event
+);
+
+/**
+ * @brief
+ * Return the type of operation reported by a notification
+ *
+ * @param event - Event handle
+ *
+ * @note
+ * This call is only valid when OCI_EventGetType() reports the
+ * event type OCI_ENT_OBJECT_CHANGED
+ *
+ * @note
+ * The returned value can be one of the following values :
+ *
+ * - OCI_ONT_INSERT  : an insert has been performed
+ * - OCI_ONT_UPDATE  : an update has been performed
+ * - OCI_ONT_DELETE  : a  delete has been performed
+ * - OCI_ONT_ALTER   : an alter  has been performed
+ * - OCI_ONT_DROP    : a  drop   has been performed
+ * - OCI_ONT_GENERIC : generic undefined action
+ *
+ * @note
+ * OCI_EventGetDatabase() returns the affected database
+ *
+ * @note
+ * OCI_EventGetObject() returns the affected object ('schema_name'.'object_name')
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ * @note
+ * if OCI_CNT_ROWS is passed to OCI_SubscriptionRegister(),
+ * the rowid of the altered row can be retrieved with OCI_EventGetRowid()
+ *
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_EventGetOperation
+(
+    OCI_Event *event
+);
+
+/**
+ * @brief
+ * Return the name of the database that generated the event
+ *
+ * @param event - Event handle
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_EventGetDatabase
+(
+    OCI_Event *event
+);
+
+/**
+ * @brief
+ * Return the name of the object that generated the event
+ *
+ * @param event - Event handle
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_EventGetObject
+(
+    OCI_Event *event
+);
+
+/**
+ * @brief
+ * Return the rowid of the altered database object row
+ *
+ * @param event - Event handle
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ */
+
+OCI_EXPORT const otext * OCI_API OCI_EventGetRowid
+(
+    OCI_Event *event
+);
+
+/**
+ * @brief
+ * Return the subscription handle that generated this event
+ *
+ * @param event - Event handle
+ *
+ * @note
+ * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
+ * subscriptions
+ *
+ */
+
+OCI_EXPORT OCI_Subscription * OCI_API OCI_EventGetSubscription
+(
+    OCI_Event *event
+);
+
+/**
+ * @} OcilibCApiSubscriptions
+ */
+
+/**
+ * @defgroup OcilibCApiResultCache Client side result cache
+ * @{
+ *
+ * OCILIB can keep the results of queries in client memory and serve later
+ * executions of the same query with the same bind values without any server
+ * round trip.
+ *
+ * A cache can be enabled :
+ *
+ * - for a given connection with OCI_SetResultCache()
+ * - for all connections retrieved from a pool with OCI_PoolSetResultCache()
+ *
+ * A connection own cache takes precedence over the cache of its pool.
+ *
+ * Entries are keyed by the SQL text and the values of the input binds.
+ * A result is stored once its resultset has been entirely fetched.
+ * The least recently used entries are evicted when the maximum number of entries
+ * or the maximum memory size is reached.
+ *
+ * Only the following statements are cached :
+ *
+ * - queries executed in default mode (no scrollable cursors)
+ * - with scalar input binds (strings, raws, numerics and dates), no array binds
+ * - returning only columns of type string, raw, numeric or date
+ *
+ * Other statements are always executed on the server.
+ *
+ * @par Invalidation
+ *
+ * Entries expire after the time to live given to OCI_SetResultCache() / OCI_PoolSetResultCache().
+ *
+ * A subscription registered with the OCI_CNT_OBJECTS flag can be attached to the cache
+ * with OCI_SetResultCacheSubscription() / OCI_PoolSetResultCacheSubscription().
+ * Queries stored in the cache are then registered against the subscription
+ * and database change notifications invalidate only the entries depending on the
+ * modified tables. Dependencies are the tables registered by the server for each query
+ * (thus including the base tables of views and synonyms). Entries for which the server
+ * did not report any table are invalidated by any change notification.
+ * Database events clear the whole cache.
+ *
+ * @note
+ * The subscription must have been registered on the same database.
+ * Its user handler is still called for each notification.
  *
- * @return
- * TRUE on success otherwise FALSE
+ * @warning
+ * The cache must be configured before executing statements that use it.
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueDrop
-(
-    OCI_Connection *con,
-    const otext *   queue_name
-);
-
 /**
  * @brief
- * Start the given queue
- *
- * @param con        - Connection handle
- * @param queue_name - Queue name
- * @param enqueue    - Enable enqueue
- * @param dequeue    - Enable dequeue
+ * Enable, reconfigure or disable the client side result cache of the given connection
  *
- * @warning
- * For exception queues, only enqueuing is allowed
+ * @param con         - Connection handle
+ * @param max_entries - Maximum number of cached results (0 disables the cache)
+ * @param max_size    - Maximum memory size in bytes used by cached results (0 for no limit)
+ * @param ttl         - Time to live in seconds of cached results (0 for no limit)
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.START_QUEUE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * Calling this function on a connection that already has a cache discards its content.
+ * A subscription previously attached to the cache remains attached.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueStart
+OCI_EXPORT boolean OCI_API OCI_SetResultCache
 (
     OCI_Connection *con,
-    const otext *   queue_name,
-    boolean         enqueue,
-    boolean         dequeue
+    unsigned int    max_entries,
+    unsigned int    max_size,
+    unsigned int    ttl
 );
 
 /**
  * @brief
- * Stop enqueuing or dequeuing or both on the given queue
+ * Attach a subscription to the result cache used by the given connection for invalidating its entries
  *
- * @param con        - Connection handle
- * @param queue_name - Queue name
- * @param enqueue    - Disable enqueue
- * @param dequeue    - Disable dequeue
- * @param wait       - Wait for current pending enqueues/dequeues
+ * @param con - Connection handle
+ * @param sub - Subscription handle (NULL to detach the current subscription)
  *
- * @warning
- * A queue cannot be stopped if there are pending transactions against the queue.
+ * @note
+ * The subscription must be created with the OCI_CNT_OBJECTS flag.
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.STOP_QUEUE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * Attaching a subscription clears the cache content.
  *
  * @return
- * TRUE on success otherwise FALSE
+ * TRUE on success otherwise FALSE (including when no result cache is enabled)
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueStop
+OCI_EXPORT boolean OCI_API OCI_SetResultCacheSubscription
 (
-    OCI_Connection *con,
-    const otext *   queue_name,
-    boolean         enqueue,
-    boolean         dequeue,
-    boolean         wait
+    OCI_Connection   *con,
+    OCI_Subscription *sub
 );
 
 /**
  * @brief
- * Create a queue table for messages of the given type
- *
- * @param con                   - Connection handle
- * @param queue_table           - Queue table name
- * @param queue_payload_type    - Message type name
- * @param storage_clause        - Additional clauses for the table storage
- * @param sort_list             - Additional columns name to use for sorting
- * @param multiple_consumers    - Enable multiple consumers for each messages
- * @param message_grouping      - Specifies if messages are grouped within a transaction
- * @param comment               - Description of the queue table
- * @param primary_instance      - primary owner (instance) of the queue table
- * @param secondary_instance    - Owner of the queue table if the primary instance is not available
- * @param compatible            - lowest database version with which the queue table is compatible
- *
- * @note
- * Parameter 'queue_table' can specify the schema where to create to queue table ([schema.]queue_table)
- * Queue table names cannot be longer than 24 characters (Oracle limit for user queue tables)
- *
- * @note
- * Possible values for parameter 'queue_payload_type' :
- * - For Oracle types (UDT) : use the type name ([schema.].type_name)
- * - For RAW data           : use "SYS.RAW" or "RAW"
- *
- * @note
- * Possible values for parameter 'message_grouping' :
- *  - OCI_AGM_NONE            : each message is treated individually
- *  - OCI_AGM_TRANSACTIONNAL  : all messages enqueued in one transaction are considered part of
- *                              the same group and can be dequeued as a group of related messages.
- *
- * @note
- * Possible values for parameter 'compatible' :
- * - "8.0", "8.1", "10.0"
- *
- * To set default values, pass :
- *  - storage_clause    : NULL
- *  - sort_list         : NULL
- *  - message_grouping  : OCI_AGM_NONE
- *  - comment           : NULL
- *  - primary_instance  : 0
- *  - primary_instance  : 0
- *  - compatible        : NULL
+ * Remove all entries from the result cache used by the given connection
  *
- * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.CREATE_QUEUE_TABLE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * @param con - Connection handle
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueTableCreate
+OCI_EXPORT boolean OCI_API OCI_ClearResultCache
 (
-    OCI_Connection *con,
-    const otext *   queue_table,
-    const otext *   queue_payload_type,
-    const otext *   storage_clause,
-    const otext *   sort_list,
-    boolean         multiple_consumers,
-    unsigned int    message_grouping,
-    const otext *   comment,
-    unsigned int    primary_instance,
-    unsigned int    secondary_instance,
-    const otext *   compatible
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Alter the given queue table
+ * Return the number of executions served from the result cache used by the given connection
  *
- * @param con                   - Connection handle
- * @param queue_table           - Queue table name
- * @param comment               - Description of the queue table
- * @param primary_instance      - primary owner (instance) of the queue table
- * @param secondary_instance    - Owner of the queue table if the primary instance is not available
- *
- * @note
- * See OCI_QueueTableCreate() from more details
+ * @param con - Connection handle
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.ALTER_QUEUE_TABLE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
- *
- * @return
- * TRUE on success otherwise FALSE
+ * If the connection uses its pool cache, the value is shared by all connections of the pool
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueTableAlter
+OCI_EXPORT unsigned int OCI_API OCI_GetResultCacheHits
 (
-    OCI_Connection *con,
-    const otext *   queue_table,
-    const otext *   comment,
-    unsigned int    primary_instance,
-    unsigned int    secondary_instance
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Drop the given queue table
- *
- * @param con         - Connection handle
- * @param queue_table - Queue table name
- * @param force       - Force the deletion of objects related to the queue table
+ * Return the number of cacheable executions that were sent to the server
  *
- * @note
- * Possible values for 'force' :
- *  - TRUE  : all queues using the queue table and their associated propagation schedules are
- *            dropped automatically
- *  - FALSE : All the queues using the given queue table must be stopped and dropped before the
- *            queue table can be dropped.
+ * @param con - Connection handle
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.DROP_QUEUE_TABLE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
- *
- * @return
- * TRUE on success otherwise FALSE
+ * If the connection uses its pool cache, the value is shared by all connections of the pool
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueTableDrop
+OCI_EXPORT unsigned int OCI_API OCI_GetResultCacheMisses
 (
-    OCI_Connection *con,
-    const otext *   queue_table,
-    boolean         force
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Purge messages from the given queue table
- *
- * @param con             - Connection handle
- * @param queue_table     - Queue table name
- * @param purge_condition - Optional SQL based conditions (see notes)
- * @param block           - Lock all queues using the queue table while doing the purge
- * @param delivery_mode   - Type of message to purge
- *
- * @note
- * Possible values for parameter 'delivery_mode' :
- *  - OCI_APM_BUFFERED      : purge only buffered   messages
- *  - OCI_APM_PERSISTENT    : purge only persistent messages
- *  - OCI_APM_ALL           : purge all messages
+ * Enable, reconfigure or disable the result cache shared by all connections of the given pool
  *
- * @note
- * For more information about the SQL purge conditions, refer to
- *  Oracle Streams - Advanced Queuing User's Guide for more details
- *
- * @warning
- * This feature is only available from Oracle 10gR2.
- * This function does nothing and returns TRUE is the server version is < Oracle 10gR2
+ * @param pool        - Pool handle
+ * @param max_entries - Maximum number of cached results (0 disables the cache)
+ * @param max_size    - Maximum memory size in bytes used by cached results (0 for no limit)
+ * @param ttl         - Time to live in seconds of cached results (0 for no limit)
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.PURGE_QUEUE_TABLE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * Calling this function on a pool that already has a cache discards its content.
+ * A subscription previously attached to the cache remains attached.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueTablePurge
+OCI_EXPORT boolean OCI_API OCI_PoolSetResultCache
 (
-    OCI_Connection *con,
-    const otext *   queue_table,
-    const otext *   purge_condition,
-    boolean         block,
-    unsigned int    delivery_mode
+    OCI_Pool    *pool,
+    unsigned int max_entries,
+    unsigned int max_size,
+    unsigned int ttl
 );
 
 /**
  * @brief
- * Migrate a queue table from one version to another
+ * Attach a subscription to the result cache of the given pool for invalidating its entries
  *
- * @param con             - Connection handle
- * @param queue_table     - Queue table name
- * @param compatible      - Database version with witch the queue table has to migrate
- *
- * @note
- * Possible values for parameter 'compatible' :
- * - "8.0", "8.1", "10.0"
+ * @param pool - Pool handle
+ * @param sub  - Subscription handle (NULL to detach the current subscription)
  *
  * @note
- * this call wraps the PL/SQL procedure DBMS_AQADM.MIGRATE_QUEUE_TABLE().
- * Refer to Oracle Streams - Advanced Queuing User's Guide for more details
+ * The subscription must be created with the OCI_CNT_OBJECTS flag.
  *
  * @return
- * TRUE on success otherwise FALSE
+ * TRUE on success otherwise FALSE (including when no result cache is enabled)
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_QueueTableMigrate
+OCI_EXPORT boolean OCI_API OCI_PoolSetResultCacheSubscription
 (
-    OCI_Connection *con,
-    const otext *   queue_table,
-    const otext *   compatible
+    OCI_Pool         *pool,
+    OCI_Subscription *sub
 );
 
 /**
- * @} OcilibCApiAdvancedQueuing
+ * @} OcilibCApiResultCache
  */
 
 /**
- * @defgroup OcilibCApiSubscriptions Database Change notifications (DCN or CQN)
+ * @defgroup OcilibCApiPreparedCache Prepared statement cache
  * @{
  *
- * OCILIB supports Oracle 10gR2 feature Database Change Notifications (DCN)
- * also named Continuous Query Notifications (CQN)
+ * OCILIB can keep prepared statements alive between their uses on a given connection.
  *
- * This features allows a client application to register notifications
- * when some changes are made in a database :
- * - Database status changes : startup and shutdown
- * - Database objects changes :
- *  - DDL changes : alter or drop actions
- *  - DML changes : insert, delete, update actions
+ * Oracle client statement cache (see OCI_SetStatementCacheSize()) avoids server parsing
+ * but each new OCI_Statement handle still needs to allocate its bind buffers, to describe
+ * its select list and to allocate its define buffers.
  *
- * This feature can be really useful in applications that hold
- * a cache of data. Instead of refreshing data periodically by
- * connecting to the server, the application could only refresh
- * modified data when necessary or perform specific tasks depending on
- * the events. It saves application time, network traffic and can help
- * the design of the application logic.
+ * The prepared statement cache keeps whole OCI_Statement handles :
  *
- * The database status change notification is also interesting to be
- * informed of instance startup / shutdown
+ * - OCI_StatementAcquire() returns an idle statement prepared with the same SQL text
+ *   and the same bind signature if any, otherwise a new statement prepared with the
+ *   given SQL text
+ * - OCI_StatementRelease() gives the statement back to the cache instead of freeing it
  *
- * Check Oracle documentation for more details about this feature
+ * A statement retrieved from the cache keeps its binds, its bind buffers, its resultset,
+ * its define buffers and its columns description. Only the bind values need to be updated
+ * before executing it again.
+ *
+ * Statements returned by OCI_StatementAcquire() have rebinding enabled
+ * (see OCI_AllowRebinding()). Binding again a variable with the same name and the same
+ * type reuses the existing bind. Binding it with another type raises an exception.
+ *
+ * The bind signature describes the binds the program is about to perform : the bind
+ * array size, then the bind names with their type, separated by commas and in binding order.
+ * Types are given with the OCI_ExecuteStmtFmt() specifiers (%s, %t, %p, %v, %n, %i, %u,
+ * %g, %li, %lu, %hi, %hu). For example :
+ *
+ * - NULL or "" : no binds
+ * - ":code %i, :name %s" : an integer and a string
+ * - "[100] :code %i, :name %s" : the same binds as arrays of 100 elements
+ *
+ * When released, a statement records the signature of its binds. An idle statement is
+ * only returned for the same SQL text and the same signature (bind names are compared
+ * case insensitively). Any difference is counted as a cache miss.
+ *
+ * Statements having binds that cannot be described by a signature (lobs, files, raws,
+ * objects, collections, references, cursors...) are freed when released.
+ *
+ * When the cache is full, the least recently released statement is freed.
  *
  * @note
- * No active database connection is required to receive the
- * notifications as they are handled by the Oracle client using a
- * dedicated socket connection to the server
+ * Idle statements are freed when the connection is closed.
  *
- * @par Database changes
+ * @warning
+ * Bind buffers provided by the program must remain valid while the statement is
+ * in the cache if the statement is executed again without binding them again.
  *
- * The client application can be notified of any database status
- * change (single DB or multiple DB in a RAC environment).
+ */
+
+/**
+ * @brief
+ * Set the maximum number of idle statements kept in the prepared statement cache of the given connection
  *
- * @par Object changes
+ * @param con  - Connection handle
+ * @param size - Maximum number of idle statements (0 disables the cache)
  *
- * The notifications of object changes are based on the registration
- * of a query ('select' SQL statement).
+ * @note
+ * Reducing the size frees the least recently released statements in excess.
+ * Disabling the cache frees all idle statements.
  *
- * Oracle server will notify of any changes of any object that is
- * part of the statement result set.
+ * @return
+ * TRUE on success otherwise FALSE
  *
- * Registering a statement will notify about any changes on its
- * result set rows performed after the registration of the query.
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetPreparedCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    size
+);
+
+/**
+ * @brief
+ * Return the maximum number of idle statements kept in the prepared statement cache of the given connection
  *
- * The query can be a simple 'select * from table' or a complex
- * query involving many tables and/or criteria in the where clause.
+ * @param con - Connection handle
  *
- * For Object changes, the notification can be at :
- *  - At Object level : only the object name (schema + object) is given
- *  - At row level : same that object level + RowID of the altered row
+ * @note
+ * Default value is 0 (cache disabled)
  *
- * @warning
- * Trying to use this features with a client/server version < 10gR2 will raise an error
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetPreparedCacheSize
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Return the number of calls to OCI_StatementAcquire() served from the prepared statement cache
  *
- * @par Example
- * @include notification.c
+ * @param con - Connection handle
  *
  */
 
+OCI_EXPORT unsigned int OCI_API OCI_GetPreparedCacheHits
+(
+    OCI_Connection *con
+);
+
 /**
  * @brief
- * Register a notification against the given database
+ * Return the number of calls to OCI_StatementAcquire() that had to prepare a new statement
  *
- * @param con      - Connection handle
- * @param name     - Notification name
- * @param type     - Subscription type
- * @param handler  - User handler callback
- * @param port     - Port to use for notifications
- * @param timeout  - notification timeout
+ * @param con - Connection handle
  *
- * @note
- * Parameter 'type' can be one of the following values :
+ */
+
+OCI_EXPORT unsigned int OCI_API OCI_GetPreparedCacheMisses
+(
+    OCI_Connection *con
+);
+
+/**
+ * @brief
+ * Return a statement prepared with the given SQL text
  *
- * - OCI_CNT_OBJECTS   : request for changes at objects (e.g. tables) level (DDL / DML)
- * - OCI_CNT_ROWS      : request for changes at rows level (DML)
- * - OCI_CNT_DATABASES : request for changes at database level (startup, shutdown)
- * - OCI_CNT_ALL       : request for all changes
+ * @param con   - Connection handle
+ * @param sql   - SQL text
+ * @param binds - Bind signature (can be NULL if no binds)
  *
  * @note
- * Parameter 'port' and 'timeout' are optional (use value 0 a optional value)
- * 
- * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * If the prepared statement cache holds an idle statement prepared with the same SQL
+ * text and the same bind signature, it is returned with all its binds and defines.
+ * Otherwise a new statement is created and prepared.
  *
- * @ @warning Port usage
- * All notifications are using the same port. 
- * Port number can be either:
- *   - determined automatically by Oracle client once the first subscription had been created and can be retrieved using OCI_SubscriptionGetPort()
- *   - Set by the parameter 'port' during the first call to OCI_SubscriptionRegister(). In this case later calls can provide same port number or 0
- * 
  * @note
- * Requires Oracle Client 10gR2 or above
+ * See @ref OcilibCApiPreparedCache for the bind signature format.
  *
  * @note
- * Subscription handles are automatically managed by the library
+ * Statements returned by this call must be given back with OCI_StatementRelease()
+ * but can also be freed with OCI_StatementFree().
  *
  * @return
- * Subscription handle on success or NULL on failure
+ * Return the statement handle on success otherwise NULL
  *
  */
 
-OCI_EXPORT OCI_Subscription * OCI_API OCI_SubscriptionRegister
+OCI_EXPORT OCI_Statement * OCI_API OCI_StatementAcquire
 (
     OCI_Connection *con,
-    const otext *   name,
-    unsigned int    type,
-    POCI_NOTIFY     handler,
-    unsigned int    port,
-    unsigned int    timeout
+    const otext    *sql,
+    const otext    *binds
 );
 
 /**
  * @brief
- * Unregister a previously registered notification
- *
- * @param sub - Subscription handle
- *
- * @note
- * OCI_Cleanup() will automatically unregister any registered subscriptions
+ * Give back a statement to the prepared statement cache of its connection
  *
- * @note
- * If the database connection passed to OCI_SubscriptionRegister()
- * has been closed by the time that the application calls
- * OCI_SubscriptionUnregister, the library internally reconnects
- * to the given database, performs the unregistration and then disconnects
+ * @param stmt - Statement handle
  *
  * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * If the cache is disabled or if the statement has not been prepared,
+ * the statement is freed.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_SubscriptionUnregister
+OCI_EXPORT boolean OCI_API OCI_StatementRelease
 (
-    OCI_Subscription *sub
+    OCI_Statement *stmt
 );
 
 /**
- * @brief
- * Add a statement to the notification to monitor
+ * @} OcilibCApiPreparedCache
+ */
+
+/**
+ * @defgroup OcilibCApiProfiling Statement profiling
+ * @{
  *
- * @param sub  - Subscription handle
- * @param stmt - Statement handle
+ * OCILIB can collect execution statistics for the SQL statements run on a given connection.
+ *
+ * Once enabled with OCI_SetProfiling(), statistics are collected per SQL text for the
+ * following phases :
+ *
+ * - OCI_PROFILE_PREPARE : statement preparation
+ * - OCI_PROFILE_EXECUTE : whole execute calls, including the bind values processing
+ * - OCI_PROFILE_FETCH   : fetch round trips
+ * - OCI_PROFILE_CONVERT : client side processing of bind values before execute calls
+ *   and of fetched rows after fetch round trips
+ *
+ * For each phase, the number of calls, the total, minimum and maximum durations in
+ * nanoseconds and a latency histogram of OCI_PROFILE_BUCKETS slots are kept
+ * (see OCI_ProfilePhase). The number of rows processed (affected rows for DML, fetched
+ * rows for queries) and the number of bytes received in the fetch buffers are also kept.
+ *
+ * Entries are keyed by the hash value and the content of the SQL text.
+ * The SQL identifier of an entry is recorded if it has been retrieved with
+ * OCI_GetSqlIdentifier() while profiling.
+ *
+ * Statistics can be retrieved with OCI_GetProfileInfo() or exported as a JSON
+ * document with OCI_ProfilesToJson().
  *
  * @note
- * The given statement must be prepared but not executed before being passed to this function.
- * OCI_SubscriptionAddStatement() executes the statement and register it for notifications
+ * When profiling is disabled, the cost of the instrumentation is a pointer check per call.
  *
  * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * Only successful calls are accounted. Statements without SQL text (such as ref cursors)
+ * are not profiled.
  *
  * @note
- * The given statement must hold a 'SELECT' SQL statement
+ * Non blocking executions and fetches (see @ref OcilibCApiAsync) are profiled. Their
+ * duration runs from the start of the call to the OCI_AsyncPoll() call that completes it.
+ *
+ * @note
+ * Like other connection related objects, statistics must not be accessed by a thread while
+ * another thread is using the connection.
+ *
+ */
+
+/**
+ * @brief
+ * Enable or disable the statement profiler of the given connection
+ *
+ * @param con   - Connection handle
+ * @param value - Enable/disable profiling
+ *
+ * @note
+ * Collected statistics are kept when profiling is disabled.
+ * They are freed by OCI_ClearProfiles() or when the connection is closed.
  *
  * @return
  * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT boolean OCI_API OCI_SubscriptionAddStatement
+OCI_EXPORT boolean OCI_API OCI_SetProfiling
 (
-    OCI_Subscription *sub,
-    OCI_Statement *   stmt
+    OCI_Connection *con,
+    boolean         value
 );
 
 /**
  * @brief
- * Return the name of the given registered subscription
+ * Return TRUE if the statement profiler of the given connection is enabled
  *
- * @param sub - Subscription handle
+ * @param con - Connection handle
  *
  * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * Default value is FALSE
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_SubscriptionGetName
+OCI_EXPORT boolean OCI_API OCI_GetProfiling
 (
-    OCI_Subscription *sub
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Return the port used by the notification
+ * Discard all the statistics collected by the statement profiler of the given connection
  *
- * @param sub - Subscription handle
+ * @param con - Connection handle
  *
- * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * @warning
+ * Strings returned by previous calls to OCI_GetProfileInfo() are no longer valid
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_SubscriptionGetPort
+OCI_EXPORT boolean OCI_API OCI_ClearProfiles
 (
-    OCI_Subscription *sub
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Return the timeout of the given registered subscription
- *
- * @param sub - Subscription handle
+ * Return the number of SQL texts profiled on the given connection
  *
- * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * @param con - Connection handle
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_SubscriptionGetTimeout
+OCI_EXPORT unsigned int OCI_API OCI_GetProfileCount
 (
-    OCI_Subscription *sub
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Return the connection handle associated with a subscription handle
+ * Retrieve the statistics collected for a profiled SQL text
  *
- * @param sub - Subscription handle
+ * @param con   - Connection handle
+ * @param index - Entry index (starting at 1)
+ * @param info  - Structure receiving the statistics
  *
  * @note
- * It may return a NULL handle if the connection used in OCI_SubscriptionRegister has been closed.
+ * Entries are ordered by their first use.
+ *
+ * @note
+ * SQL text and SQL identifier strings are owned by the profiler and remain valid
+ * until OCI_ClearProfiles() is called or the connection is closed.
+ *
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Connection * OCI_API OCI_SubscriptionGetConnection
+OCI_EXPORT boolean OCI_API OCI_GetProfileInfo
 (
-    OCI_Subscription *sub
+    OCI_Connection  *con,
+    unsigned int     index,
+    OCI_ProfileInfo *info
 );
 
 /**
  * @brief
- * Return the type of event reported by a notification
+ * Export the statistics collected by the statement profiler as a JSON document
  *
- * @param event - Event handle
+ * @param con  - Connection handle
+ * @param size - Destination string length pointer in characters
+ * @param str  - Destination string
  *
  * @note
- * The returned value can be one of the following values :
- *
- * - OCI_ENT_STARTUP        : a database has been started up
- * - OCI_ENT_SHUTDOWN       : a database has been shut down
- * - OCI_ENT_SHUTDOWN_ANY   : a database has been shut down (RAC)
- * - OCI_ENT_DROP_DATABASE  : a database has been dropped
- * - OCI_ENT_DEREGISTER     : the notification is timed out
- * - OCI_ENT_OBJECT_CHANGED : a database object has been modified
+ * In order to compute the needed string length, call the method with a NULL string
+ * Then call the method again with a buffer of at least (size + 1) characters
  *
  * @note
- * OCI_EventGetDatabase() returns the affected database
+ * The document holds a "statements" array with one object per SQL text.
+ * Each object holds the "sql", "sql_id", "hash", "rows" and "bytes" values and one
+ * object per phase ("prepare", "execute", "fetch", "convert") holding the "count",
+ * "total_ns", "min_ns", "max_ns" and "histogram" values.
  *
  * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * If the buffer is too small, the output is truncated to the given size.
+ * On return, size holds the length of the whole document.
  *
- * @note
- * OCI_EventGetObject() returns the affected object
- * ('schema_name'.'object_name')
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_EventGetType
+OCI_EXPORT boolean OCI_API OCI_ProfilesToJson
 (
-    OCI_Event *event
+    OCI_Connection *con,
+    unsigned int   *size,
+    otext          *str
 );
 
 /**
- * @brief
- * Return the type of operation reported by a notification
+ * @} OcilibCApiProfiling
+ */
+
+/**
+ * @defgroup OcilibCApiDescribeCache Select list describe cache
+ * @{
  *
- * @param event - Event handle
+ * When a query is executed by a new OCI_Statement handle, OCILIB retrieves the description
+ * of each column of its select list (name, type, size, precision, scale, charset form, ...)
+ * and maps it to OCILIB types. For wide queries run at a high rate, this work is repeated
+ * for every new statement handle.
  *
- * @note
- * This call is only valid when OCI_EventGetType() reports the
- * event type OCI_ENT_OBJECT_CHANGED
+ * The describe cache keeps, per connection, the mapped columns description of the most
+ * recently executed queries, keyed by their SQL text. Later executions of the same SQL text
+ * by other statement handles reuse it instead of describing the select list again.
  *
- * @note
- * The returned value can be one of the following values :
+ * A cached description is discarded :
  *
- * - OCI_ONT_INSERT  : an insert has been performed
- * - OCI_ONT_UPDATE  : an update has been performed
- * - OCI_ONT_DELETE  : a  delete has been performed
- * - OCI_ONT_ALTER   : an alter  has been performed
- * - OCI_ONT_DROP    : a  drop   has been performed
- * - OCI_ONT_GENERIC : generic undefined action
+ * - when the number of columns returned by the server differs
+ * - when the type, size, precision or scale of a column returned by the server differs
+ * - when an execute or fetch call of the query fails
+ * - when a DDL or ALTER statement (including ALTER SESSION) is executed on the connection
+ * - when OCI_ClearDescribeCache() is called
  *
- * @note
- * OCI_EventGetDatabase() returns the affected database
+ * When the cache is full, the least recently used entry is discarded.
  *
  * @note
- * OCI_EventGetObject() returns the affected object ('schema_name'.'object_name')
+ * Queries returning named types (objects, collections, references) are not cached.
  *
  * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * Validating a cached description only reads the type and size attributes of the select list
+ * that OCI already received with the execute call. It does not require any server call.
  *
- * @note
- * if OCI_CNT_ROWS is passed to OCI_SubscriptionRegister(),
- * the rowid of the altered row can be retrieved with OCI_EventGetRowid()
+ * @warning
+ * Columns renamed by other sessions or within PL/SQL blocks executed by this connection,
+ * without any type or size change, are not detected. Call OCI_ClearDescribeCache() after
+ * such changes.
  *
  */
 
-OCI_EXPORT unsigned int OCI_API OCI_EventGetOperation
+/**
+ * @brief
+ * Set the maximum number of queries kept in the describe cache of the given connection
+ *
+ * @param con  - Connection handle
+ * @param size - Maximum number of queries (0 disables the cache)
+ *
+ * @return
+ * TRUE on success otherwise FALSE
+ *
+ */
+
+OCI_EXPORT boolean OCI_API OCI_SetDescribeCacheSize
 (
-    OCI_Event *event
+    OCI_Connection *con,
+    unsigned int    size
 );
 
 /**
  * @brief
- * Return the name of the database that generated the event
+ * Return the maximum number of queries kept in the describe cache of the given connection
  *
- * @param event - Event handle
+ * @param con - Connection handle
  *
  * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * Default value is 0 (cache disabled)
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_EventGetDatabase
+OCI_EXPORT unsigned int OCI_API OCI_GetDescribeCacheSize
 (
-    OCI_Event *event
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Return the name of the object that generated the event
- *
- * @param event - Event handle
+ * Return the number of select lists served from the describe cache of the given connection
  *
- * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * @param con - Connection handle
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_EventGetObject
+OCI_EXPORT unsigned int OCI_API OCI_GetDescribeCacheHits
 (
-    OCI_Event *event
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Return the rowid of the altered database object row
- *
- * @param event - Event handle
+ * Return the number of select lists that had to be described while the describe cache was enabled
  *
- * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * @param con - Connection handle
  *
  */
 
-OCI_EXPORT const otext * OCI_API OCI_EventGetRowid
+OCI_EXPORT unsigned int OCI_API OCI_GetDescribeCacheMisses
 (
-    OCI_Event *event
+    OCI_Connection *con
 );
 
 /**
  * @brief
- * Return the subscription handle that generated this event
+ * Discard all the entries of the describe cache of the given connection
  *
- * @param event - Event handle
+ * @param con - Connection handle
  *
- * @note
- * OCI_ENV_EVENTS flag must be passed to OCI_Initialize() to be able to use
- * subscriptions
+ * @return
+ * TRUE on success otherwise FALSE
  *
  */
 
-OCI_EXPORT OCI_Subscription * OCI_API OCI_EventGetSubscription
+OCI_EXPORT boolean OCI_API OCI_ClearDescribeCache
 (
-    OCI_Event *event
+    OCI_Connection *con
 );
 
 /**
- * @} OcilibCApiSubscriptions
+ * @} OcilibCApiDescribeCache
  */
 
 /**
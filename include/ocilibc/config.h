@@ -470,8 +470,15 @@ typedef unsigned int big_uint;
 #define OCI_ERR_XA_CONN_FROM_STRING         29
 #define OCI_ERR_BIND_EXTERNAL_NOT_ALLOWED   30
 #define OCI_ERR_UNFREED_BYTES               31
+#define OCI_ERR_ASYNC_PENDING               32
+#define OCI_ERR_DIRPATH_LOADER              33
+#define OCI_ERR_FILE_OPEN                   34
+#define OCI_ERR_ARROW_FORMAT                35
+#define OCI_ERR_FILE_IO                     36
+#define OCI_ERR_BIND_PRODUCER               37
+#define OCI_ERR_MAX_VALUE                   38
 
-#define OCI_ERR_COUNT                       32
+#define OCI_ERR_COUNT                       39
 
 /* Public OCILIB handles */
 
@@ -506,6 +513,8 @@ typedef unsigned int big_uint;
 #define OCI_IPC_ENQUEUE          38
 #define OCI_IPC_DEQUEUE          39
 #define OCI_IPC_AGENT            40
+#define OCI_IPC_BATCHER          41
+#define OCI_IPC_DIRPATH_LOADER   42
 
 /* allocated bytes types */
 
@@ -526,6 +535,8 @@ typedef unsigned int big_uint;
 #define OCI_PREFETCH_SIZE                   20
 #define OCI_LONG_EXPLICIT                   1
 #define OCI_LONG_IMPLICIT                   2
+#define OCI_LOB_LOCATOR                     1
+#define OCI_LOB_INLINE                      2
 
 /* unknown value */
 
@@ -685,6 +696,26 @@ typedef unsigned int big_uint;
 #define OCI_BDM_OUT                         2
 #define OCI_BDM_IN_OUT                      (OCI_BDM_IN | OCI_BDM_OUT)
 
+/* asynchronous call status */
+
+#define OCI_ASYNC_NONE                      0
+#define OCI_ASYNC_PENDING                   1
+#define OCI_ASYNC_DONE                      2
+#define OCI_ASYNC_FAILED                    3
+
+/* statement profiler phases */
+
+#define OCI_PROFILE_PREPARE                 0
+#define OCI_PROFILE_EXECUTE                 1
+#define OCI_PROFILE_FETCH                   2
+#define OCI_PROFILE_CONVERT                 3
+
+#define OCI_PROFILE_PHASES                  4
+
+/* statement profiler latency histogram size */
+
+#define OCI_PROFILE_BUCKETS                 24
+
 /* Column property flags     */
 
 #define OCI_CPF_NONE                        0
@@ -733,6 +764,14 @@ typedef unsigned int big_uint;
 #define OCI_TIMESTAMP_TZ                    2
 #define OCI_TIMESTAMP_LTZ                   3
 
+/* native date time representations */
+
+#define OCI_DTM_EPOCH                       1
+#define OCI_DTM_EPOCH_MICRO                 2
+#define OCI_DTM_TM                          3
+#define OCI_DTM_EPOCH_MILLI                 4
+#define OCI_DTM_EPOCH_NANO                  5
+
 /* interval types */
 
 #define OCI_INTERVAL_YM                     1
@@ -835,6 +874,14 @@ typedef unsigned int big_uint;
 #define OCI_AQT_EXCEPTION                   1
 #define OCI_AQT_NON_PERSISTENT              2
 
+/* batcher row append status */
+
+#define OCI_BRS_ERROR                       0
+#define OCI_BRS_BUFFERED                    1
+#define OCI_BRS_FLUSHED                     2
+#define OCI_BRS_REJECTED                    3
+#define OCI_BRS_FAILED                      4
+
 /* direct path processing return status */
 
 #define OCI_DPR_COMPLETE                    1
@@ -848,6 +895,26 @@ typedef unsigned int big_uint;
 #define OCI_DCM_DEFAULT                     1
 #define OCI_DCM_FORCE                       2
 
+/* direct path statistics phases */
+
+#define OCI_DPP_FILL                        0
+#define OCI_DPP_VALUES                      1
+#define OCI_DPP_ARRAY                       2
+#define OCI_DPP_STREAM                      3
+#define OCI_DPP_LOAD                        4
+
+#define OCI_DPP_PHASES                      5
+
+/* direct path delimited file load modes */
+
+#define OCI_DLF_DEFAULT                     0
+#define OCI_DLF_HEADER                      1
+
+/* direct path column formats matching Arrow timestamp values */
+
+#define OCI_ARROW_DATE_FORMAT               OTEXT("YYYY-MM-DD HH24:MI:SS")
+#define OCI_ARROW_TIMESTAMP_FORMAT          OTEXT("YYYY-MM-DD HH24:MI:SS.FF9")
+
 /* trace size constants */
 
 #define OCI_SIZE_TRACE_ID                   64
@@ -1174,6 +1241,7 @@ typedef unsigned int big_uint;
 #define OCI_SIZE_BUFFER                     512
 #define OCI_SIZE_LARGE_BUFFER               ((64*1024)-1)
 #define OCI_SIZE_LONG                       ((64*1024)-1)
+#define OCI_SIZE_LOB_INLINE                 4000
 #define OCI_SIZE_DATE                       45
 #define OCI_SIZE_TIMESTAMP                  54
 #define OCI_SIZE_FORMAT_TODATE              14
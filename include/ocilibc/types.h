@@ -407,6 +407,26 @@ typedef struct OCI_Thread OCI_Thread;
 
 typedef struct OCI_DirPath OCI_DirPath;
 
+/**
+ * @typedef OCI_Batcher
+ *
+ * @brief
+ * OCILIB array DML batcher for row by row inserts
+ *
+ */
+
+typedef struct OCI_Batcher OCI_Batcher;
+
+/**
+ * @typedef OCI_DirPathLoader
+ *
+ * @brief
+ * OCILIB parallel direct path loader driving several direct path contexts
+ *
+ */
+
+typedef struct OCI_DirPathLoader OCI_DirPathLoader;
+
 /**
  * @typedef OCI_Subscription
  *
@@ -621,6 +641,105 @@ typedef void (*POCI_HA_HANDLER)
     OCI_Timestamp * time
 );
 
+/**
+ * @var POCI_BATCHER_ERROR
+ *
+ * @brief
+ * Batcher rejected row callback prototype
+ *
+ * @param bat - Batcher handle
+ * @param err - Error handle of the rejected row
+ * @param row - Index of the rejected row since the batcher creation (starting at 1)
+ *
+ */
+
+typedef void (*POCI_BATCHER_ERROR)
+(
+    OCI_Batcher *  bat,
+    OCI_Error *    err,
+    unsigned int   row
+);
+
+/**
+ * @var POCI_BIND_PRODUCER
+ *
+ * @brief
+ * Streaming bind value producer callback prototype
+ *
+ * @param bnd  - Bind handle
+ * @param iter - Index of the DML iteration the value is requested for (starting at 1)
+ * @param data - Pointer to set to the value to bind (NULL for a null value)
+ * @param size - Value size (characters for strings, bytes for raws, ignored otherwise)
+ * @param ctx  - User context pointer given at bind time
+ *
+ * @note
+ * The callback must return FALSE to abort the statement execution.
+ * The execute call then fails with the error OCI_ERR_BIND_PRODUCER giving the bind name
+ * and the iteration index.
+ *
+ */
+
+typedef boolean (*POCI_BIND_PRODUCER)
+(
+    OCI_Bind *     bnd,
+    unsigned int   iter,
+    void **        data,
+    unsigned int * size,
+    void *         ctx
+);
+
+/**
+ * @var POCI_LOB_SINK
+ *
+ * @brief
+ * Lob streaming read sink callback prototype
+ *
+ * @param lob    - Lob handle
+ * @param buffer - Piece of lob content
+ * @param size   - Size of the piece in bytes
+ * @param ctx    - User context pointer given to OCI_LobStreamRead()
+ *
+ * @note
+ * The buffer is reused for the next piece and is only valid during the call
+ *
+ * @note
+ * The callback must return FALSE to stop the streaming
+ *
+ */
+
+typedef boolean (*POCI_LOB_SINK)
+(
+    OCI_Lob *      lob,
+    const void *   buffer,
+    unsigned int   size,
+    void *         ctx
+);
+
+/**
+ * @var POCI_LOB_SOURCE
+ *
+ * @brief
+ * Lob streaming write source callback prototype
+ *
+ * @param lob    - Lob handle
+ * @param buffer - Buffer to fill with the next piece of content
+ * @param size   - Size of the buffer in bytes
+ * @param ctx    - User context pointer given to OCI_LobStreamWrite()
+ *
+ * @note
+ * The callback returns the number of bytes copied into the buffer.
+ * Returning 0 ends the streaming
+ *
+ */
+
+typedef unsigned int (*POCI_LOB_SOURCE)
+(
+    OCI_Lob *      lob,
+    void *         buffer,
+    unsigned int   size,
+    void *         ctx
+);
+
 /* public structures */
 
 /**
@@ -711,6 +830,152 @@ typedef struct OCI_HashEntry
     struct OCI_HashEntry *next;
 } OCI_HashEntry;
 
+/**
+ * @typedef OCI_ProfilePhase
+ *
+ * @brief
+ * Statistics of one execution phase of a profiled SQL statement
+ *
+ * Durations are expressed in nanoseconds.
+ *
+ * Histogram slot 0 counts the calls that lasted less than 1 microsecond.
+ * Slot i counts the calls that lasted from 2^(i-1) to 2^i - 1 microseconds.
+ * The last slot also counts all the longer calls.
+ *
+ */
+
+typedef struct OCI_ProfilePhase
+{
+    unsigned int count;
+    big_uint     total;
+    big_uint     min;
+    big_uint     max;
+    unsigned int histogram[OCI_PROFILE_BUCKETS];
+} OCI_ProfilePhase;
+
+/**
+ * @typedef OCI_ProfileInfo
+ *
+ * @brief
+ * Statistics collected by the statement profiler for one SQL statement
+ *
+ */
+
+typedef struct OCI_ProfileInfo
+{
+    const otext     *sql;
+    const otext     *sql_id;
+    unsigned int     hash;
+    big_uint         rows;
+    big_uint         bytes;
+    OCI_ProfilePhase phases[OCI_PROFILE_PHASES];
+} OCI_ProfileInfo;
+
+/**
+ * @typedef OCI_DirPathStats
+ *
+ * @brief
+ * Throughput and timing statistics collected by a direct path handle
+ *
+ * See OCI_DirPathGetStats() for details
+ *
+ */
+
+typedef struct OCI_DirPathStats
+{
+    big_uint         conversions;
+    big_uint         rows_converted;
+    big_uint         rows_loaded;
+    big_uint         streams;
+    big_uint         bytes;
+    unsigned int     conversion_errors;
+    unsigned int     load_errors;
+    unsigned int     stream_full;
+    unsigned int     retries;
+    OCI_ProfilePhase phases[OCI_DPP_PHASES];
+} OCI_DirPathStats;
+
+/**
+ * @var POCI_DIRPATH_PROGRESS
+ *
+ * @brief
+ * Direct path progress callback prototype
+ *
+ * @param dp    - Direct path handle
+ * @param stats - Statistics collected so far
+ * @param ctx   - User context pointer given to OCI_DirPathSetProgressHandler()
+ *
+ */
+
+typedef void (*POCI_DIRPATH_PROGRESS)
+(
+    OCI_DirPath *            dp,
+    const OCI_DirPathStats * stats,
+    void *                   ctx
+);
+
+/**
+ * @struct ArrowSchema
+ *
+ * @brief
+ * Apache Arrow C data interface type description
+ *
+ * @note
+ * Declared as specified by the Arrow C data interface, it can be used along with
+ * the same declaration from any Arrow implementation
+ *
+ */
+
+/**
+ * @struct ArrowArray
+ *
+ * @brief
+ * Apache Arrow C data interface array data
+ *
+ * @note
+ * Declared as specified by the Arrow C data interface, it can be used along with
+ * the same declaration from any Arrow implementation
+ *
+ */
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#include <stdint.h>
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE           2
+#define ARROW_FLAG_MAP_KEYS_SORTED    4
+
+struct ArrowSchema
+{
+    const char          *format;
+    const char          *name;
+    const char          *metadata;
+    int64_t              flags;
+    int64_t              n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema  *dictionary;
+    void               (*release)(struct ArrowSchema *);
+    void                *private_data;
+};
+
+struct ArrowArray
+{
+    int64_t             length;
+    int64_t             null_count;
+    int64_t             offset;
+    int64_t             n_buffers;
+    int64_t             n_children;
+    const void        **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray  *dictionary;
+    void              (*release)(struct ArrowArray *);
+    void               *private_data;
+};
+
+#endif /* ARROW_C_DATA_INTERFACE */
+
 /**
  * @} OcilibCApiDatatypes
  */
@@ -36,6 +36,14 @@ extern "C" {
 #define OCILIBPP_CPP_98 199711L
 #define OCILIBPP_CPP_11 201103L
 #define OCILIBPP_CPP_14 201402L
+#define OCILIBPP_CPP_17 201703L
+#define OCILIBPP_CPP_20 202002L
+
+#if defined(_MSVC_LANG)
+#define OCILIBPP_CPP_VERSION _MSVC_LANG
+#else
+#define OCILIBPP_CPP_VERSION __cplusplus
+#endif
 
 #if __cplusplus < OCILIBPP_CPP_11
 
@@ -62,6 +70,14 @@ extern "C" {
 #define OCILIBPP_HAS_ENABLEIF
 #define OCILIBPP_HAS_VARIADIC
 
+#if OCILIBPP_CPP_VERSION >= OCILIBPP_CPP_17
+#define OCILIBPP_HAS_STRING_VIEW
+#endif
+
+#if OCILIBPP_CPP_VERSION >= OCILIBPP_CPP_20
+#define OCILIBPP_HAS_SPAN
+#endif
+
 #ifdef  OCILIBCPP_DEBUG_MEMORY
 
 #include <iostream>
@@ -89,6 +105,14 @@ extern "C" {
 #undef OCILIBPP_HAS_VARIADIC
 #endif
 
+#ifdef OCILIBPP_HAS_STRING_VIEW
+#undef OCILIBPP_HAS_STRING_VIEW
+#endif
+
+#ifdef OCILIBPP_HAS_SPAN
+#undef OCILIBPP_HAS_SPAN
+#endif
+
 #ifdef OCILIBPP_DEBUG_MEMORY_ENABLED
 #undef OCILIBPP_DEBUG_MEMORY_ENABLED
 #endif
@@ -103,6 +127,18 @@ extern "C" {
 
 #endif
 
+#ifdef OCILIBPP_HAS_VARIADIC
+#include <tuple>
+#endif
+
+#ifdef OCILIBPP_HAS_STRING_VIEW
+#include <string_view>
+#endif
+
+#ifdef OCILIBPP_HAS_SPAN
+#include <span>
+#endif
+
 namespace ocilib
 {
 
@@ -137,6 +173,40 @@ typedef void * AnyPointer;
 */
 typedef std::vector<unsigned char> Raw;
 
+#ifdef OCILIBPP_HAS_STRING_VIEW
+
+/**
+ * @typedef ocilib::ostring_view
+ *
+ * @brief
+ * Non owning view on a otext string (see @ref OcilibCApiSupportedCharsets )
+ *
+ * @note
+ * - Only available when compiling with C++17 or above
+ * - for ANSI builds, ocilib::ostring_view is equivalent to std::string_view
+ * - for UNICODE builds, ocilib::ostring_view is equivalent to std::wstring_view
+ *
+ */
+typedef std::basic_string_view<otext, std::char_traits<otext> > ostring_view;
+
+#endif
+
+#ifdef OCILIBPP_HAS_SPAN
+
+/**
+* @typedef ocilib::RawView
+*
+* @brief
+* Non owning view on SQL RAW data
+*
+* @note
+* Only available when compiling with C++20 or above
+*
+*/
+typedef std::span<const unsigned char> RawView;
+
+#endif
+
 /**
  * @typedef ocilib::MutexHandle
  *
@@ -0,0 +1,129 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ocilibcpp/types.hpp"
+
+namespace ocilib
+{
+
+inline Batcher::Batcher(const Connection &connection, const ostring& sql, unsigned int nbCols, unsigned int maxRows)
+{
+    Acquire(core::Check(OCI_BatcherCreate(connection, sql.c_str(), nbCols, maxRows)), reinterpret_cast<HandleFreeFunc>(OCI_BatcherFree), nullptr, connection.GetHandle());
+}
+
+inline Batcher::Batcher(OCI_Batcher *pBatcher)
+{
+    Acquire(pBatcher, nullptr, nullptr, nullptr);
+}
+
+inline void Batcher::SetColumn(unsigned int colIndex, const ostring& name, DataType type, NumericType numericType, unsigned int maxLength)
+{
+    core::Check(OCI_BatcherSetColumn(*this, colIndex, name.c_str(), type, numericType, maxLength));
+}
+
+inline void Batcher::SetFlushLimits(unsigned int maxBytes, unsigned int maxDelay)
+{
+    core::Check(OCI_BatcherSetFlushLimits(*this, maxBytes, maxDelay));
+}
+
+inline void Batcher::SetErrorHandler(ErrorHandlerProc handler)
+{
+    core::Check(OCI_BatcherSetErrorHandler(*this, static_cast<POCI_BATCHER_ERROR>(handler != nullptr ? Environment::BatcherErrorHandler : nullptr)));
+
+    Environment::SetUserCallback<ErrorHandlerProc>(static_cast<OCI_Batcher*>(*this), handler);
+}
+
+template<>
+inline void Batcher::Set<int>(unsigned int colIndex, const int &value)
+{
+    core::Check(OCI_BatcherSetInt(*this, colIndex, value));
+}
+
+template<>
+inline void Batcher::Set<big_int>(unsigned int colIndex, const big_int &value)
+{
+    core::Check(OCI_BatcherSetBigInt(*this, colIndex, value));
+}
+
+template<>
+inline void Batcher::Set<double>(unsigned int colIndex, const double &value)
+{
+    core::Check(OCI_BatcherSetDouble(*this, colIndex, value));
+}
+
+template<>
+inline void Batcher::Set<ostring>(unsigned int colIndex, const ostring &value)
+{
+    core::Check(OCI_BatcherSetString(*this, colIndex, value.c_str()));
+}
+
+template<>
+inline void Batcher::Set<Date>(unsigned int colIndex, const Date &value)
+{
+    core::Check(OCI_BatcherSetDate(*this, colIndex, value));
+}
+
+inline void Batcher::SetNull(unsigned int colIndex)
+{
+    core::Check(OCI_BatcherSetNull(*this, colIndex));
+}
+
+inline Batcher::AddRowStatus Batcher::AddRow()
+{
+    const unsigned int res = OCI_BatcherAddRow(*this);
+
+    /* errors raised while sending the buffered rows are reported by the status */
+
+    if (OCI_BRS_ERROR == res)
+    {
+        core::Check(res);
+    }
+
+    return AddRowStatus(static_cast<AddRowStatus::Type>(res));
+}
+
+inline void Batcher::Flush()
+{
+    core::Check(OCI_BatcherFlush(*this));
+}
+
+inline void Batcher::CheckDelay()
+{
+    core::Check(OCI_BatcherCheckDelay(*this));
+}
+
+inline unsigned int Batcher::GetPendingRows() const
+{
+    return core::Check(OCI_BatcherGetPendingRows(*this));
+}
+
+inline unsigned int Batcher::GetProcessedRows() const
+{
+    return core::Check(OCI_BatcherGetProcessedRows(*this));
+}
+
+inline unsigned int Batcher::GetErrorCount() const
+{
+    return core::Check(OCI_BatcherGetErrorCount(*this));
+}
+
+}
@@ -81,6 +81,21 @@ inline bool Connection::GetAutoCommit() const
     return (core::Check(OCI_GetAutoCommit(*this)) == TRUE);
 }
 
+inline void Connection::SetCommitOnExecute(bool enabled)
+{
+    core::Check(OCI_SetCommitOnExecute(*this, enabled));
+}
+
+inline bool Connection::GetCommitOnExecute() const
+{
+    return (core::Check(OCI_GetCommitOnExecute(*this)) == TRUE);
+}
+
+inline unsigned int Connection::GetServerCalls() const
+{
+    return core::Check(OCI_GetServerCalls(*this));
+}
+
 inline bool Connection::IsServerAlive() const
 {
     return (core::Check(OCI_IsConnected(*this)) == TRUE);
@@ -246,6 +261,76 @@ inline void Connection::SetStatementCacheSize(unsigned int value)
     core::Check(OCI_SetStatementCacheSize(*this, value));
 }
 
+inline void Connection::SetResultCache(unsigned int maxEntries, unsigned int maxSize, unsigned int ttl)
+{
+    core::Check(OCI_SetResultCache(*this, maxEntries, maxSize, ttl));
+}
+
+inline void Connection::SetResultCacheSubscription(const Subscription& subscription)
+{
+    core::Check(OCI_SetResultCacheSubscription(*this, subscription));
+}
+
+inline void Connection::ClearResultCache()
+{
+    core::Check(OCI_ClearResultCache(*this));
+}
+
+inline unsigned int Connection::GetResultCacheHits() const
+{
+    return core::Check(OCI_GetResultCacheHits(*this));
+}
+
+inline unsigned int Connection::GetResultCacheMisses() const
+{
+    return core::Check(OCI_GetResultCacheMisses(*this));
+}
+
+inline void Connection::SetPreparedCacheSize(unsigned int value)
+{
+    core::Check(OCI_SetPreparedCacheSize(*this, value));
+}
+
+inline unsigned int Connection::GetPreparedCacheSize() const
+{
+    return core::Check(OCI_GetPreparedCacheSize(*this));
+}
+
+inline unsigned int Connection::GetPreparedCacheHits() const
+{
+    return core::Check(OCI_GetPreparedCacheHits(*this));
+}
+
+inline unsigned int Connection::GetPreparedCacheMisses() const
+{
+    return core::Check(OCI_GetPreparedCacheMisses(*this));
+}
+
+inline void Connection::SetDescribeCacheSize(unsigned int value)
+{
+    core::Check(OCI_SetDescribeCacheSize(*this, value));
+}
+
+inline unsigned int Connection::GetDescribeCacheSize() const
+{
+    return core::Check(OCI_GetDescribeCacheSize(*this));
+}
+
+inline unsigned int Connection::GetDescribeCacheHits() const
+{
+    return core::Check(OCI_GetDescribeCacheHits(*this));
+}
+
+inline unsigned int Connection::GetDescribeCacheMisses() const
+{
+    return core::Check(OCI_GetDescribeCacheMisses(*this));
+}
+
+inline void Connection::ClearDescribeCache()
+{
+    core::Check(OCI_ClearDescribeCache(*this));
+}
+
 inline unsigned int Connection::GetDefaultLobPrefetchSize() const
 {
     return core::Check(OCI_GetDefaultLobPrefetchSize(*this));
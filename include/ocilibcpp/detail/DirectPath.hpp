@@ -136,6 +136,26 @@ inline void DirectPath::SetConversionMode(ConversionMode value)
     core::Check(OCI_DirPathSetConvertMode(*this, value));
 }
 
+inline void DirectPath::SetPipelined(bool value)
+{
+    core::Check(OCI_DirPathSetPipelined(*this, static_cast<boolean>(value)));
+}
+
+inline bool DirectPath::GetPipelined()
+{
+    return (core::Check(OCI_DirPathGetPipelined(*this)) == TRUE);
+}
+
+inline void DirectPath::SetConvertThreads(unsigned int value)
+{
+    core::Check(OCI_DirPathSetConvertThreads(*this, value));
+}
+
+inline unsigned int DirectPath::GetConvertThreads()
+{
+    return core::Check(OCI_DirPathGetConvertThreads(*this));
+}
+
 inline unsigned int DirectPath::GetErrorColumn()
 {
     return core::Check(OCI_DirPathGetErrorColumn(*this));
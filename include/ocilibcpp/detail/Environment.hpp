@@ -216,6 +216,18 @@ inline void Environment::NotifyHandlerAQ(OCI_Dequeue *pDequeue)
     }
 }
 
+inline void Environment::BatcherErrorHandler(OCI_Batcher *pBatcher, OCI_Error *pError, unsigned int row)
+{
+    const Batcher::ErrorHandlerProc handler = GetUserCallback<Batcher::ErrorHandlerProc>(pBatcher);
+
+    if (handler)
+    {
+        Batcher batcher(pBatcher);
+        Exception exception(pError);
+        handler(batcher, exception, row);
+    }
+}
+
 template<class T>
 T Environment::GetUserCallback(AnyPointer ptr)
 {
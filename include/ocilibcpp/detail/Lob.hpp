@@ -112,6 +112,89 @@ unsigned int Lob<T, U>::Write(const T& content)
     return res;
 }
 
+template<class T, int U>
+std::vector<T> Lob<T, U>::Read(const std::vector<Lob>& lobs, unsigned int length)
+{
+    typedef typename T::value_type ValueType;
+
+    std::vector<T> result;
+
+    const size_t count = lobs.size();
+
+    if (count == 0)
+    {
+        return result;
+    }
+
+    const size_t stride = static_cast<size_t>(U == LobBinary ? 1 : Environment::GetCharMaxSize()) * (length + 1);
+
+    core::ManagedBuffer<ValueType> buffer(stride * count);
+
+    std::vector<OCI_Lob*> handles(count);
+    std::vector<AnyPointer> buffers(count);
+    std::vector<unsigned int> charCounts(count, U == LobBinary ? 0 : length);
+    std::vector<unsigned int> byteCounts(count, U == LobBinary ? length : 0);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        handles[i] = lobs[i];
+        buffers[i] = static_cast<AnyPointer>(static_cast<ValueType*>(buffer) + i * stride);
+    }
+
+    core::Check(OCI_LobArrayRead(handles.data(), static_cast<unsigned int>(count), buffers.data(), charCounts.data(), byteCounts.data()));
+
+    result.reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const ValueType* data = static_cast<const ValueType*>(buffers[i]);
+
+        result.push_back(T(data, data + byteCounts[i] / sizeof(ValueType)));
+    }
+
+    return result;
+}
+
+template<class T, int U>
+std::vector<unsigned int> Lob<T, U>::Write(const std::vector<Lob>& lobs, const std::vector<T>& contents)
+{
+    const size_t count = lobs.size() < contents.size() ? lobs.size() : contents.size();
+
+    std::vector<unsigned int> result(count, 0);
+
+    std::vector<OCI_Lob*> handles;
+    std::vector<AnyPointer> buffers;
+    std::vector<unsigned int> charCounts;
+    std::vector<unsigned int> byteCounts;
+    std::vector<size_t> indexes;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const T& content = contents[i];
+
+        if (!content.empty())
+        {
+            handles.push_back(lobs[i]);
+            buffers.push_back(static_cast<AnyPointer>(const_cast<typename T::value_type*>(&content[0])));
+            charCounts.push_back(0);
+            byteCounts.push_back(static_cast<unsigned int>(content.size() * sizeof(typename T::value_type)));
+            indexes.push_back(i);
+        }
+    }
+
+    if (!handles.empty())
+    {
+        core::Check(OCI_LobArrayWrite(handles.data(), static_cast<unsigned int>(handles.size()), buffers.data(), charCounts.data(), byteCounts.data()));
+
+        for (size_t i = 0; i < indexes.size(); i++)
+        {
+            result[indexes[i]] = U == LobBinary ? byteCounts[i] : charCounts[i];
+        }
+    }
+
+    return result;
+}
+
 template<class T, int U>
 void Lob<T, U>::Append(const Lob& other)
 {
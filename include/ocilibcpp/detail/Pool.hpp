@@ -114,4 +114,14 @@ inline void Pool::SetStatementCacheSize(unsigned int value)
     core::Check(OCI_PoolSetStatementCacheSize(*this, value));
 }
 
+inline void Pool::SetResultCache(unsigned int maxEntries, unsigned int maxSize, unsigned int ttl)
+{
+    core::Check(OCI_PoolSetResultCache(*this, maxEntries, maxSize, ttl));
+}
+
+inline void Pool::SetResultCacheSubscription(const Subscription& subscription)
+{
+    core::Check(OCI_PoolSetResultCacheSubscription(*this, subscription));
+}
+
 }
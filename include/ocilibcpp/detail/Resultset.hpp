@@ -35,6 +35,11 @@ inline bool Resultset::Next()
     return (core::Check(OCI_FetchNext(*this)) == TRUE);
 }
 
+inline void Resultset::NextAsync()
+{
+    core::Check(OCI_FetchAsync(*this));
+}
+
 inline bool Resultset::Prev()
 {
     return (core::Check(OCI_FetchPrev(*this)) == TRUE);
@@ -166,6 +171,86 @@ unsigned int Resultset::ForEach(T callback, U adapter)
     return GetCurrentRow();
 }
 
+inline Resultset::RowIterator::RowIterator() : _resultset(nullptr)
+{
+
+}
+
+inline Resultset::RowIterator::RowIterator(Resultset* resultset) : _resultset(resultset)
+{
+    if (_resultset && !_resultset->Next())
+    {
+        _resultset = nullptr;
+    }
+}
+
+inline Resultset::RowIterator::reference Resultset::RowIterator::operator*() const
+{
+    return *_resultset;
+}
+
+inline Resultset::RowIterator::pointer Resultset::RowIterator::operator->() const
+{
+    return _resultset;
+}
+
+inline Resultset::RowIterator& Resultset::RowIterator::operator++()
+{
+    if (_resultset && !_resultset->Next())
+    {
+        _resultset = nullptr;
+    }
+
+    return *this;
+}
+
+inline void Resultset::RowIterator::operator++(int)
+{
+    ++(*this);
+}
+
+inline bool Resultset::RowIterator::operator == (const RowIterator& other) const
+{
+    return _resultset == other._resultset;
+}
+
+inline bool Resultset::RowIterator::operator != (const RowIterator& other) const
+{
+    return !(*this == other);
+}
+
+inline Resultset::RowIterator Resultset::begin()
+{
+    return RowIterator(this);
+}
+
+inline Resultset::RowIterator Resultset::end()
+{
+    return RowIterator();
+}
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+template<class... Ts>
+std::tuple<Ts...> Resultset::Row() const
+{
+    return GetRow<Ts...>(1);
+}
+
+template<class T>
+std::tuple<T> Resultset::GetRow(unsigned int index) const
+{
+    return std::tuple<T>(Get<T>(index));
+}
+
+template<class T, class U, class... Ts>
+std::tuple<T, U, Ts...> Resultset::GetRow(unsigned int index) const
+{
+    return std::tuple_cat(GetRow<T>(index), GetRow<U, Ts...>(index + 1));
+}
+
+#endif
+
 template<>
 inline short Resultset::Get<short>(unsigned int index) const
 {
@@ -310,6 +395,82 @@ inline Raw Resultset::Get<Raw>(const ostring& name) const
     return core::MakeRaw(buffer, size);
 }
 
+#ifdef OCILIBPP_HAS_STRING_VIEW
+
+template<>
+inline ostring_view Resultset::Get<ostring_view>(unsigned int index) const
+{
+    /* a valid pointer implies a successful call, so errors are only checked on NULL values */
+
+    const otext* value = OCI_GetString(*this, index);
+
+    if (!value)
+    {
+        core::Check(value);
+
+        return ostring_view();
+    }
+
+    return ostring_view(value);
+}
+
+template<>
+inline ostring_view Resultset::Get<ostring_view>(const ostring& name) const
+{
+    const otext* value = OCI_GetString2(*this, name.c_str());
+
+    if (!value)
+    {
+        core::Check(value);
+
+        return ostring_view();
+    }
+
+    return ostring_view(value);
+}
+
+#endif
+
+#ifdef OCILIBPP_HAS_SPAN
+
+template<>
+inline RawView Resultset::Get<RawView>(unsigned int index) const
+{
+    unsigned int size = 0;
+
+    /* a valid pointer implies a successful call, so errors are only checked on NULL values */
+
+    const void* value = OCI_GetRawBuffer(*this, index, &size);
+
+    if (!value)
+    {
+        core::Check(value);
+
+        return RawView();
+    }
+
+    return RawView(static_cast<const unsigned char*>(value), size);
+}
+
+template<>
+inline RawView Resultset::Get<RawView>(const ostring& name) const
+{
+    unsigned int size = 0;
+
+    const void* value = OCI_GetRawBuffer2(*this, name.c_str(), &size);
+
+    if (!value)
+    {
+        core::Check(value);
+
+        return RawView();
+    }
+
+    return RawView(static_cast<const unsigned char*>(value), size);
+}
+
+#endif
+
 template<>
 inline Date Resultset::Get<Date>(unsigned int index) const
 {
@@ -107,6 +107,35 @@ unsigned int Statement::ExecutePrepared(T callback, U adapter)
     return Fetch(callback, adapter);
 }
 
+inline void Statement::ExecuteAsync()
+{
+    ReleaseResultsets();
+    SetInData();
+    core::Check(OCI_ExecuteAsync(*this));
+}
+
+inline Statement::AsyncStatus Statement::PollAsync()
+{
+    const AsyncStatus status = AsyncStatus(static_cast<AsyncStatus::Type>(core::Check(OCI_AsyncPoll(*this))));
+
+    if (AsyncDone == status)
+    {
+        SetOutData();
+    }
+
+    return status;
+}
+
+inline bool Statement::GetAsyncResult() const
+{
+    return (core::Check(OCI_AsyncGetResult(*this)) == TRUE);
+}
+
+inline void Statement::CancelAsync()
+{
+    core::Check(OCI_AsyncCancel(*this));
+}
+
 inline void Statement::Execute(const ostring& sql)
 {
     ClearBinds();
@@ -245,7 +274,7 @@ template<typename M, class T>
 void Statement::BindVector1(M &method, const ostring& name, std::vector<T> &values,  BindInfo::BindDirection mode, BindInfo::VectorType type)
 {
     support::BindArray * bnd = core::OnAllocate(new support::BindArray(*this, name, mode));
-    bnd->SetVector<T>(values, type == BindInfo::AsPlSqlTable, sizeof(typename support::BindResolver<T>::OutputType));
+    bnd->SetVector<T>(values, type == BindInfo::AsPlSqlTable, type == BindInfo::AsDirectArray, sizeof(typename support::BindResolver<T>::OutputType));
 
     const boolean res = method(*this, name.c_str(), bnd->GetData<T>(), bnd->GetSizeForBindCall());
 
@@ -267,7 +296,7 @@ template<typename M, class T, class U>
 void Statement::BindVector2(M &method, const ostring& name, std::vector<T> &values, BindInfo::BindDirection mode, U subType, BindInfo::VectorType type)
 {
     support::BindArray * bnd = core::OnAllocate(new support::BindArray(*this, name, mode));
-    bnd->SetVector<T>(values, type == BindInfo::AsPlSqlTable, sizeof(typename support::BindResolver<T>::OutputType));
+    bnd->SetVector<T>(values, type == BindInfo::AsPlSqlTable, type == BindInfo::AsDirectArray, sizeof(typename support::BindResolver<T>::OutputType));
 
     const boolean res = method(*this, name.c_str(), bnd->GetData<T>(), subType, bnd->GetSizeForBindCall());
 
@@ -651,7 +680,7 @@ template<>
 inline void Statement::Bind<ostring, unsigned int>(const ostring& name, std::vector<ostring> &values,  unsigned int maxSize, BindInfo::BindDirection mode, BindInfo::VectorType type)
 {
     support::BindArray * bnd = core::OnAllocate(new support::BindArray(*this, name, mode));
-    bnd->SetVector<ostring>(values, type == BindInfo::AsPlSqlTable, maxSize+1);
+    bnd->SetVector<ostring>(values, type == BindInfo::AsPlSqlTable, false, maxSize+1);
 
     const boolean res = OCI_BindArrayOfStrings(*this, name.c_str(), bnd->GetData<ostring>(), maxSize, bnd->GetSizeForBindCall());
 
@@ -679,7 +708,7 @@ template<>
 inline void Statement::Bind<Raw, unsigned int>(const ostring& name, std::vector<Raw> &values, unsigned int maxSize, BindInfo::BindDirection mode, BindInfo::VectorType type)
 {
     support::BindArray * bnd = core::OnAllocate(new support::BindArray(*this, name, mode));
-    bnd->SetVector<Raw>(values, type == BindInfo::AsPlSqlTable, maxSize);
+    bnd->SetVector<Raw>(values, type == BindInfo::AsPlSqlTable, false, maxSize);
 
     const boolean res = OCI_BindArrayOfRaws(*this, name.c_str(), bnd->GetData<Raw>(), maxSize, bnd->GetSizeForBindCall());
 
@@ -927,6 +956,26 @@ inline Statement::LongMode Statement::GetLongMode() const
     return LongMode(static_cast<LongMode::Type>(core::Check(OCI_GetLongMode(*this))));
 }
 
+inline void Statement::SetLobMode(LobMode value)
+{
+    core::Check(OCI_SetLobMode(*this, value));
+}
+
+inline Statement::LobMode Statement::GetLobMode() const
+{
+    return LobMode(static_cast<LobMode::Type>(core::Check(OCI_GetLobMode(*this))));
+}
+
+inline void Statement::SetLobInlineSize(unsigned int value)
+{
+    core::Check(OCI_SetLobInlineSize(*this, value));
+}
+
+inline unsigned int Statement::GetLobInlineSize() const
+{
+    return core::Check(OCI_GetLobInlineSize(*this));
+}
+
 inline unsigned int Statement::GetSQLCommand() const
 {
     return core::Check(OCI_GetSQLCommand(*this));
@@ -34,9 +34,9 @@ namespace ocilib
         }
 
         template<class T>
-        void BindArray::SetVector(std::vector<T>& vector, bool isPlSqlTable, unsigned int elemSize)
+        void BindArray::SetVector(std::vector<T>& vector, bool isPlSqlTable, bool isExternal, unsigned int elemSize)
         {
-            _object = core::OnAllocate(new BindArrayObject<T>(_statement, GetName(), vector, isPlSqlTable, GetMode(), elemSize));
+            _object = core::OnAllocate(new BindArrayObject<T>(_statement, GetName(), vector, isPlSqlTable, isExternal, GetMode(), elemSize));
         }
 
         inline BindArray::~BindArray() noexcept
@@ -44,6 +44,13 @@ namespace ocilib
             delete core::OnDeallocate(_object);
         }
 
+        inline void BindArray::SetBind(OCI_Bind* bind)
+        {
+            BindObject::SetBind(bind);
+
+            _object->SetBind(bind);
+        }
+
         template<class T>
         typename BindResolver<T>::OutputType* BindArray::GetData()  const
         {
@@ -79,8 +86,8 @@ namespace ocilib
 
 
         template<class T>
-        BindArray::BindArrayObject<T>::BindArrayObject(const ocilib::Statement& statement, const ostring& name, ObjectVector& vector, bool isPlSqlTable, unsigned int mode, unsigned int elemSize)
-            : _statement(statement), _name(name), _vector(vector), _data(nullptr), _isPlSqlTable(isPlSqlTable), _mode(mode), _elemCount(BindArrayObject<T>::GetSize()), _elemSize(elemSize)
+        BindArray::BindArrayObject<T>::BindArrayObject(const ocilib::Statement& statement, const ostring& name, ObjectVector& vector, bool isPlSqlTable, bool isExternal, unsigned int mode, unsigned int elemSize)
+            : _statement(statement), _name(name), _vector(vector), _data(nullptr), _bind(nullptr), _isPlSqlTable(isPlSqlTable), _isExternal(isExternal), _mode(mode), _elemCount(BindArrayObject<T>::GetSize()), _elemSize(elemSize)
         {
             AllocData();
         }
@@ -91,9 +98,30 @@ namespace ocilib
             FreeData();
         }
 
+        template<class T>
+        void BindArray::BindArrayObject<T>::SetBind(OCI_Bind* bind)
+        {
+            _bind = bind;
+        }
+
         template<class T>
         void BindArray::BindArrayObject<T>::AllocData()
         {
+            /* vector storage is used as is only if it holds native values, is large enough
+               and the C API does not allocate its own buffers */
+
+            if (_isExternal)
+            {
+                _isExternal = BindResolver<T>::IsDirect && _vector.size() >= _elemCount &&
+                              OCI_BAM_EXTERNAL == core::Check(OCI_GetBindAllocation(_statement));
+            }
+
+            if (_isExternal)
+            {
+                _data = BindDirectStorage<T>::Get(_vector);
+                return;
+            }
+
             _data = core::OnAllocate(new NativeType[_elemCount], _elemCount);
 
             memset(_data, 0, sizeof(NativeType) * _elemCount);
@@ -122,12 +150,22 @@ namespace ocilib
         template<class T>
         void BindArray::BindArrayObject<T>::FreeData() const
         {
+            if (_isExternal)
+            {
+                return;
+            }
+
             delete[] core::OnDeallocate(_data);
         }
 
         template<class T>
         void BindArray::BindArrayObject<T>::SetInData()
         {
+            if (_isExternal)
+            {
+                return;
+            }
+
             typename ObjectVector::iterator it, it_end;
 
             unsigned int index = 0;
@@ -163,6 +201,8 @@ namespace ocilib
             unsigned int index = 0;
             const unsigned int currElemCount = GetSize();
 
+            _sizes.resize(_elemCount);
+
             for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
             {
                 Raw& value = *it;
@@ -172,13 +212,23 @@ namespace ocilib
                     memcpy(_data + (_elemSize * index), &value[0], value.size());
                 }
 
-                OCI_BindSetDataSizeAtPos(OCI_GetBind2(_statement, GetName().c_str()), index + 1, static_cast<unsigned int>(value.size()));
+                _sizes[index] = static_cast<unsigned int>(value.size());
+            }
+
+            if (index > 0)
+            {
+                core::Check(OCI_BindSetDataSizes(_bind, &_sizes[0], index));
             }
         }
 
         template<class T>
         void BindArray::BindArrayObject<T>::SetOutData()
         {
+            if (_isExternal)
+            {
+                return;
+            }
+
             typename ObjectVector::iterator it, it_end;
 
             unsigned int index = 0;
@@ -195,16 +245,22 @@ namespace ocilib
         {
             std::vector<ostring>::iterator it, it_end;
 
-            OCI_Bind* pBind = core::Check(OCI_GetBind2(_statement, GetName().c_str()));
+            const unsigned int currElemCount = GetSize() < _elemCount ? GetSize() : _elemCount;
+
+            _sizes.resize(_elemCount);
+
+            if (currElemCount > 0)
+            {
+                core::Check(OCI_BindGetDataSizes(_bind, &_sizes[0], currElemCount));
+            }
 
             unsigned int index = 0;
-            const unsigned int currElemCount = GetSize();
 
-            for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+            for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < currElemCount; ++it, ++index)
             {
-                otext* currData = _data + (_elemSize * sizeof(otext) * index);
+                otext* currData = _data + (_elemSize * index);
 
-                (*it).assign(currData, currData + core::Check(OCI_BindGetDataSizeAtPos(pBind, index + 1)));
+                (*it).assign(currData, currData + _sizes[index]);
             }
         }
 
@@ -213,16 +269,22 @@ namespace ocilib
         {
             std::vector<Raw>::iterator it, it_end;
 
-            OCI_Bind* pBind = core::Check(OCI_GetBind2(_statement, GetName().c_str()));
+            const unsigned int currElemCount = GetSize() < _elemCount ? GetSize() : _elemCount;
+
+            _sizes.resize(_elemCount);
+
+            if (currElemCount > 0)
+            {
+                core::Check(OCI_BindGetDataSizes(_bind, &_sizes[0], currElemCount));
+            }
 
             unsigned int index = 0;
-            const unsigned int currElemCount = GetSize();
 
-            for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < _elemCount && index < currElemCount; ++it, ++index)
+            for (it = _vector.begin(), it_end = _vector.end(); it != it_end && index < currElemCount; ++it, ++index)
             {
                 unsigned char* currData = _data + (_elemSize * index);
 
-                (*it).assign(currData, currData + core::Check(OCI_BindGetDataSizeAtPos(pBind, index + 1)));
+                (*it).assign(currData, currData + _sizes[index]);
             }
         }
 
@@ -30,7 +30,7 @@ namespace ocilib
 {
     namespace support
     {
-        inline BindObject::BindObject(const ocilib::Statement& statement, const ostring& name, unsigned int mode) : _statement(statement), _name(name), _mode(mode)
+        inline BindObject::BindObject(const ocilib::Statement& statement, const ostring& name, unsigned int mode) : _statement(statement), _name(name), _mode(mode), _bind(nullptr)
         {
         }
 
@@ -52,5 +52,15 @@ namespace ocilib
         {
             return _mode;
         }
+
+        inline OCI_Bind* BindObject::GetBind() const
+        {
+            return _bind;
+        }
+
+        inline void BindObject::SetBind(OCI_Bind* bind)
+        {
+            _bind = bind;
+        }
     }
 }
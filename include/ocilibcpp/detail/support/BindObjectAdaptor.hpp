@@ -52,8 +52,7 @@ namespace ocilib
         {
             if (GetMode() & OCI_BDM_OUT)
             {
-                OCI_Bind* bnd = core::Check(OCI_GetBind2(_statement, _name.c_str()));
-                size_t size = core::Check(OCI_BindGetDataSize(bnd));
+                size_t size = core::Check(OCI_BindGetDataSize(_bind));
 
                 _object.assign(_data, _data + size);
             }
@@ -31,12 +31,13 @@ namespace ocilib
         * @brief Resolve a bind input / output types
         *
         */
-        template<class I, class O, boolean B>
+        template<class I, class O, boolean B, boolean D = false>
         struct BindResolverType
         {
             typedef I InputType;
             typedef O OutputType;
             static const bool IsHandle = B;
+            static const bool IsDirect = D;
         };
 
         /**
@@ -45,7 +46,7 @@ namespace ocilib
         *
         */
         template<class T>
-        struct BindResolverScalarType : BindResolverType<T, T, false> {};
+        struct BindResolverScalarType : BindResolverType<T, T, false, true> {};
 
         /**
         *
@@ -79,5 +80,22 @@ namespace ocilib
         template<> struct BindResolver<ocilib::Reference> : BindResolverHandleType<ocilib::Reference, OCI_Ref*> {};
         template<> struct BindResolver<ocilib::Object> : BindResolverHandleType<ocilib::Object, OCI_Object*> {};
         template<> struct BindResolver<ocilib::Statement> : BindResolverHandleType<ocilib::Statement, OCI_Statement*> {};
+
+        /**
+        *
+        * @brief Return the storage of a vector when it can be directly used by the C API, nullptr otherwise
+        *
+        */
+        template<class T, bool D = BindResolver<T>::IsDirect>
+        struct BindDirectStorage
+        {
+            static typename BindResolver<T>::OutputType* Get(std::vector<T>&) { return nullptr; }
+        };
+
+        template<class T>
+        struct BindDirectStorage<T, true>
+        {
+            static T* Get(std::vector<T>& vector) { return vector.empty() ? nullptr : &vector[0]; }
+        };
     }
 }
@@ -50,6 +50,8 @@ namespace ocilib
 
         inline void BindsHolder::AddBindObject(BindObject* bindObject)
         {
+            bindObject->SetBind(core::Check(OCI_GetBind2(_statement, bindObject->GetName().c_str())));
+
             if (core::Check(OCI_IsRebindingAllowed(_statement)))
             {
                 std::vector<BindObject*>::iterator it, it_end;
@@ -62,6 +62,9 @@ namespace ocilib
 
             unsigned int GetMode() const;
 
+            OCI_Bind* GetBind() const;
+            virtual void SetBind(OCI_Bind* bind);
+
             virtual void SetInData() = 0;
             virtual void SetOutData() = 0;
 
@@ -70,6 +73,7 @@ namespace ocilib
             const ocilib::Statement& _statement;
             ostring _name;
             unsigned int _mode;
+            OCI_Bind* _bind;
         };
 
        /**
@@ -84,11 +88,13 @@ namespace ocilib
             virtual ~BindArray() noexcept;
 
             template<class T>
-            void SetVector(std::vector<T>& vector, bool isPlSqlTable, unsigned int elemSize);
+            void SetVector(std::vector<T>& vector, bool isPlSqlTable, bool isExternal, unsigned int elemSize);
 
             template<class T>
             typename BindResolver<T>::OutputType* GetData() const;
 
+            void SetBind(OCI_Bind* bind) override;
+
             void SetInData() override;
             void SetOutData() override;
 
@@ -101,6 +107,7 @@ namespace ocilib
             {
             public:
                 virtual ~AbstractBindArrayObject() {};
+                virtual void SetBind(OCI_Bind* bind) = 0;
                 virtual void SetInData() = 0;
                 virtual void SetOutData() = 0;
                 virtual ostring GetName() const = 0;
@@ -118,8 +125,9 @@ namespace ocilib
                 typedef std::vector<ObjectType> ObjectVector;
                 typedef typename BindResolver<ObjectType>::OutputType NativeType;
 
-                BindArrayObject(const ocilib::Statement& statement, const ostring& name, ObjectVector& vector, bool isPlSqlTable, unsigned int mode, unsigned int elemSize);
+                BindArrayObject(const ocilib::Statement& statement, const ostring& name, ObjectVector& vector, bool isPlSqlTable, bool isExternal, unsigned int mode, unsigned int elemSize);
                 virtual ~BindArrayObject() noexcept;
+                void SetBind(OCI_Bind* bind) override;
                 void SetInData() override;
                 void SetOutData() override;
                 ostring GetName()const  override;
@@ -139,7 +147,10 @@ namespace ocilib
                 ostring _name;
                 ObjectVector& _vector;
                 NativeType* _data;
+                OCI_Bind* _bind;
+                std::vector<unsigned int> _sizes;
                 bool _isPlSqlTable;
+                bool _isExternal;
                 unsigned int _mode;
                 unsigned int _elemCount;
                 unsigned int _elemSize;
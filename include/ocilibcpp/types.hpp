@@ -352,6 +352,7 @@ namespace ocilib
         template<class T>
         friend T core::Check(T result);
         friend class Statement;
+        friend class Environment;
 
     public:
 
@@ -485,6 +486,7 @@ namespace ocilib
         friend class Pool;
         friend class Subscription;
         friend class Dequeue;
+        friend class Batcher;
         template<class>
         friend class core::HandleHolder;
 
@@ -1109,6 +1111,7 @@ namespace ocilib
         static unsigned int TAFHandler(OCI_Connection* pConnection, unsigned int type, unsigned int event);
         static void NotifyHandler(OCI_Event* pEvent);
         static void NotifyHandlerAQ(OCI_Dequeue* pDequeue);
+        static void BatcherErrorHandler(OCI_Batcher* pBatcher, OCI_Error* pError, unsigned int row);
 
         template<class T>
         static T GetUserCallback(AnyPointer ptr);
@@ -1550,6 +1553,29 @@ namespace ocilib
          *
          */
         void SetStatementCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Enable, reconfigure or disable the client side result cache shared by the pool connections
+         *
+         * @param maxEntries - Maximum number of cached results (0 disables the cache)
+         * @param maxSize    - Maximum memory size in bytes used by cached results (0 for no limit)
+         * @param ttl        - Time to live in seconds of cached results (0 for no limit)
+         *
+         * @note
+         * Check OCI_PoolSetResultCache() for cacheable statements
+         *
+         */
+        void SetResultCache(unsigned int maxEntries, unsigned int maxSize = 0, unsigned int ttl = 0);
+
+        /**
+         * @brief
+         * Attach a subscription to the pool result cache for invalidating its entries on database changes
+         *
+         * @param subscription - Subscription registered with Subscription::ObjectChanges
+         *
+         */
+        void SetResultCacheSubscription(const Subscription& subscription);
     };
 
     /**
@@ -1572,6 +1598,7 @@ namespace ocilib
         friend class Reference;
         friend class Resultset;
         friend class Subscription;
+        friend class Batcher;
 
         template<class, int>
         friend class Lob;
@@ -1832,6 +1859,35 @@ namespace ocilib
          */
         bool GetAutoCommit() const;
 
+        /**
+         * @brief
+         * Enable or disable commits performed by the execute calls in auto commit mode
+         *
+         * @param enabled - new status
+         *
+         * @note
+         * Check OCI_SetCommitOnExecute() for more details
+         *
+         */
+        void SetCommitOnExecute(bool enabled);
+
+        /**
+         * @brief
+         * Indicates if commits are performed by the execute calls in auto commit mode
+         *
+         */
+        bool GetCommitOnExecute() const;
+
+        /**
+         * @brief
+         * Return the number of server bound OCI calls performed for the connection
+         *
+         * @note
+         * Check OCI_GetServerCalls() for the calls taken into account
+         *
+         */
+        unsigned int GetServerCalls() const;
+
         /**
         * @brief
         * Indicate if the connection is still connected to the server
@@ -2197,6 +2253,123 @@ namespace ocilib
          */
         void SetStatementCacheSize(unsigned int value);
 
+        /**
+         * @brief
+         * Enable, reconfigure or disable the client side result cache of the connection
+         *
+         * @param maxEntries - Maximum number of cached results (0 disables the cache)
+         * @param maxSize    - Maximum memory size in bytes used by cached results (0 for no limit)
+         * @param ttl        - Time to live in seconds of cached results (0 for no limit)
+         *
+         * @note
+         * Check OCI_SetResultCache() for cacheable statements
+         *
+         */
+        void SetResultCache(unsigned int maxEntries, unsigned int maxSize = 0, unsigned int ttl = 0);
+
+        /**
+         * @brief
+         * Attach a subscription to the result cache used by the connection for invalidating its entries
+         *
+         * @param subscription - Subscription registered with Subscription::ObjectChanges
+         *
+         */
+        void SetResultCacheSubscription(const Subscription& subscription);
+
+        /**
+         * @brief
+         * Remove all entries from the result cache used by the connection
+         *
+         */
+        void ClearResultCache();
+
+        /**
+         * @brief
+         * Return the number of executions served from the result cache used by the connection
+         *
+         */
+        unsigned int GetResultCacheHits() const;
+
+        /**
+         * @brief
+         * Return the number of cacheable executions that were sent to the server
+         *
+         */
+        unsigned int GetResultCacheMisses() const;
+
+        /**
+         * @brief
+         * Set the maximum number of idle statements kept in the prepared statement cache of the connection
+         *
+         * @param value - Maximum number of idle statements (0 disables the cache)
+         *
+         * @note
+         * Check OCI_SetPreparedCacheSize() for more details
+         *
+         */
+        void SetPreparedCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Return the maximum number of idle statements kept in the prepared statement cache of the connection
+         *
+         */
+        unsigned int GetPreparedCacheSize() const;
+
+        /**
+         * @brief
+         * Return the number of statements served from the prepared statement cache of the connection
+         *
+         */
+        unsigned int GetPreparedCacheHits() const;
+
+        /**
+         * @brief
+         * Return the number of statements that had to be prepared on a prepared statement cache miss
+         *
+         */
+        unsigned int GetPreparedCacheMisses() const;
+
+        /**
+         * @brief
+         * Set the maximum number of queries kept in the describe cache of the connection
+         *
+         * @param value - Maximum number of queries (0 disables the cache)
+         *
+         * @note
+         * Check OCI_SetDescribeCacheSize() for more details
+         *
+         */
+        void SetDescribeCacheSize(unsigned int value);
+
+        /**
+         * @brief
+         * Return the maximum number of queries kept in the describe cache of the connection
+         *
+         */
+        unsigned int GetDescribeCacheSize() const;
+
+        /**
+         * @brief
+         * Return the number of select lists served from the describe cache of the connection
+         *
+         */
+        unsigned int GetDescribeCacheHits() const;
+
+        /**
+         * @brief
+         * Return the number of select lists described on a describe cache miss
+         *
+         */
+        unsigned int GetDescribeCacheMisses() const;
+
+        /**
+         * @brief
+         * Discard all the entries of the describe cache of the connection
+         *
+         */
+        void ClearDescribeCache();
+
         /**
          * @brief
          * Return the default LOB prefetch buffer size for the connection
@@ -4047,6 +4220,39 @@ namespace ocilib
         */
         unsigned int Write(const T& content);
 
+        /**
+        * @brief
+        * Read a portion of several lobs in a single server round trip
+        *
+        * @param lobs   - Lobs to read (e.g. a lob column of fetched rows)
+        * @param length - Maximum number of characters or bytes to read from each lob
+        *
+        * @note
+        * Each lob is read from its current position.
+        * All lobs must belong to the same connection
+        *
+        * @return
+        * The content read from each lob
+        *
+        */
+        static std::vector<T> Read(const std::vector<Lob>& lobs, unsigned int length);
+
+        /**
+        * @brief
+        * Write contents at the current position of several lobs in a single server round trip
+        *
+        * @param lobs     - Lobs to write
+        * @param contents - Content to write into the lob at the same index
+        *
+        * @note
+        * All lobs must belong to the same connection
+        *
+        * @return
+        * Number of character or bytes written into each lob
+        *
+        */
+        static std::vector<unsigned int> Write(const std::vector<Lob>& lobs, const std::vector<T>& contents);
+
         /**
         * @brief
         * Append the given content to the lob
@@ -5395,7 +5601,9 @@ namespace ocilib
             /** Vector is binded as an array in a regular DML array operation */
             AsArray = 1,
             /** Vector is binded as a PL/SQL index by table */
-            AsPlSqlTable = 2
+            AsPlSqlTable = 2,
+            /** Vector storage is directly binded (without copies) in a regular DML array operation */
+            AsDirectArray = 3
         };
 
         /**
@@ -5627,6 +5835,32 @@ namespace ocilib
         */
         typedef core::Enum<BindModeValues> BindMode;
 
+        /**
+        * @brief
+        * Asynchronous call status enumerated values
+        *
+        */
+        enum AsyncStatusValues
+        {
+            /** No asynchronous call started or the last one was cancelled */
+            AsyncNone = OCI_ASYNC_NONE,
+            /** The call is still processed by the server */
+            AsyncPending = OCI_ASYNC_PENDING,
+            /** The call has completed */
+            AsyncDone = OCI_ASYNC_DONE,
+            /** The call has failed */
+            AsyncFailed = OCI_ASYNC_FAILED
+        };
+
+        /**
+        * @brief
+        * Asynchronous call status
+        *
+        * Possible values are Statement::AsyncStatusValues
+        *
+        */
+        typedef core::Enum<AsyncStatusValues> AsyncStatus;
+
         /**
         * @brief
         * LONG data type mapping modes enumerated values
@@ -5649,6 +5883,28 @@ namespace ocilib
         */
         typedef core::Enum<LongModeValues> LongMode;
 
+        /**
+        * @brief
+        * LOB data type mapping modes enumerated values
+        *
+        */
+        enum LobModeValues
+        {
+            /** BLOB, CLOB and NCLOB are mapped to Lob objects */
+            LobLocator = OCI_LOB_LOCATOR,
+            /** BLOB are mapped to Raw objects and CLOB and NCLOB to ostring objects */
+            LobInline = OCI_LOB_INLINE
+        };
+
+        /**
+        * @brief
+        * LOB data type mapping modes
+        *
+        * Possible values are Statement::LobModeValues
+        *
+        */
+        typedef core::Enum<LobModeValues> LobMode;
+
         /**
         * @brief
         * Create an empty null Statement instance
@@ -5844,6 +6100,46 @@ namespace ocilib
         template<class T, class U>
         unsigned int Execute(const ostring& sql, T callback, U adapter);
 
+        /**
+        * @brief
+        * Start the execution of the prepared statement without waiting for its completion
+        *
+        * @note
+        * Call PollAsync() until it does not return Statement::AsyncPending anymore
+        *
+        * @note
+        * See OCI_ExecuteAsync() for more details
+        *
+        */
+        void ExecuteAsync();
+
+        /**
+        * @brief
+        * Make progress on the pending asynchronous call of the statement without blocking
+        *
+        * @note
+        * If the completed call has failed, an exception is thrown
+        *
+        */
+        AsyncStatus PollAsync();
+
+        /**
+        * @brief
+        * Return the result of the last completed asynchronous call
+        *
+        * @note
+        * For fetches started with Resultset::NextAsync(), returns true if a row has been fetched
+        *
+        */
+        bool GetAsyncResult() const;
+
+        /**
+        * @brief
+        * Cancel the pending asynchronous call of the statement
+        *
+        */
+        void CancelAsync();
+
         /**
         * @brief
         * Return the number of rows affected by the SQL statement
@@ -6102,6 +6398,14 @@ namespace ocilib
         * It is not necessary to specify the template data type in the bind call as all possible specializations can be resolved
         * automatically from the arguments.
         *
+        * @note
+        * With BindInfo::AsDirectArray, vectors of native numeric types (short, int, big_int, float, double and their unsigned
+        * versions) are binded directly: no copy happens between the vector and the bind buffers around executions.
+        * In that case, the vector must hold at least GetBindArraySize() elements when binded and it must not be resized,
+        * reassigned or destroyed until the statement is re-prepared or freed, as the C API keeps using its storage.
+        * If these conditions cannot be met (other types, smaller vector, internal bind allocation mode),
+        * the vector is binded as with BindInfo::AsArray.
+        *
         */
         template<class T>
         void Bind(const ostring& name, std::vector<T>& values, BindInfo::BindDirection mode, BindInfo::VectorType type = BindInfo::AsArray);
@@ -6403,6 +6707,44 @@ namespace ocilib
         */
         LongMode GetLongMode() const;
 
+        /**
+        * @brief
+        * Set the LOB data type handling mode of a SQL statement
+        *
+        * @param value - lob mode value
+        *
+        * @note
+        * With Statement::LobInline mode, values larger than GetLobInlineSize() are truncated
+        *
+        */
+        void SetLobMode(LobMode value);
+
+        /**
+        * @brief
+        * Return the LOB data type handling mode of a SQL statement
+        *
+        */
+        LobMode GetLobMode() const;
+
+        /**
+        * @brief
+        * Set the maximum size of LOB values fetched in Statement::LobInline mode
+        *
+        * @param value - maximum size in characters for CLOBs and in bytes for BLOBs
+        *
+        */
+        void SetLobInlineSize(unsigned int value);
+
+        /**
+        * @brief
+        * Return the maximum size of LOB values fetched in Statement::LobInline mode
+        *
+        * @note
+        * Default value is set to constant OCI_SIZE_LOB_INLINE
+        *
+        */
+        unsigned int GetLobInlineSize() const;
+
         /**
         * @brief
         * Return the Oracle SQL code the command held by the statement
@@ -6519,6 +6861,11 @@ namespace ocilib
         * @note
         * Column position starts at 1.
         *
+        * @note
+        * When compiling with C++17 or above, T can be ostring_view (and RawView with C++20 or above).
+        * These views point to the resultset internal buffers and do not perform any allocation.
+        * They remain valid until the next fetch
+        *
         */
         template<class T>
         T Get(unsigned int index) const;
@@ -6627,6 +6974,81 @@ namespace ocilib
         template<typename T, typename U>
         unsigned int ForEach(T callback, U adapter);
 
+        /**
+        * @brief
+        * Forward only iterator over the rows of a resultset
+        *
+        * @note
+        * Incrementing the iterator performs a call to Resultset::Next().
+        * Dereferencing it returns the resultset itself positioned on the current row
+        *
+        */
+        class RowIterator
+        {
+        public:
+
+            typedef std::input_iterator_tag iterator_category;
+            typedef Resultset value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const Resultset* pointer;
+            typedef const Resultset& reference;
+
+            RowIterator();
+            explicit RowIterator(Resultset* resultset);
+
+            reference operator*() const;
+            pointer operator->() const;
+
+            RowIterator& operator++();
+            void operator++(int);
+
+            bool operator == (const RowIterator& other) const;
+            bool operator != (const RowIterator& other) const;
+
+        private:
+
+            Resultset* _resultset;
+        };
+
+        /**
+        * @brief
+        * Fetch the first row to fetch and return an iterator on it
+        *
+        * @note
+        * It allows iterating the resultset with a range based for loop:
+        * for (auto& row : rs) { row.Get<int>(1); }
+        *
+        * @warning
+        * Rows are fetched with Resultset::Next(). The resultset can be iterated only once
+        *
+        */
+        RowIterator begin();
+
+        /**
+        * @brief
+        * Return the iterator marking the end of the resultset
+        *
+        */
+        RowIterator end();
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+        /**
+        * @brief
+        * Return the current row values as a tuple of the given C++ types
+        *
+        * @tparam Ts - C++ types of the values to retrieve, one per column starting from the first column
+        *
+        * @note
+        * Combined with ostring_view and RawView, it allows reading rows without any heap allocation:
+        * auto [id, value, label] = rs.Row<int, double, ostring_view>();
+        *
+        */
+        template<class... Ts>
+        std::tuple<Ts...> Row() const;
+
+#endif
+
         /**
         * @brief
         * Fetch the next row of the resultset
@@ -6642,6 +7064,17 @@ namespace ocilib
         */
         bool Next();
 
+        /**
+        * @brief
+        * Start fetching the next row of the resultset without waiting for the server
+        *
+        * @note
+        * Call Statement::PollAsync() until it does not return Statement::AsyncPending anymore
+        * and then Statement::GetAsyncResult() to know if a row has been fetched
+        *
+        */
+        void NextAsync();
+
         /**
         * @brief
         * Fetch the previous row of the resultset
@@ -6831,6 +7264,16 @@ namespace ocilib
     private:
 
         Resultset(OCI_Resultset* resultset, core::Handle* parent);
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+        template<class T>
+        std::tuple<T> GetRow(unsigned int index) const;
+
+        template<class T, class U, class... Ts>
+        std::tuple<T, U, Ts...> GetRow(unsigned int index) const;
+
+#endif
     };
 
     /**
@@ -8969,6 +9412,53 @@ namespace ocilib
          */
         void SetConversionMode(ConversionMode value);
 
+        /**
+         * @brief
+         * Enable or disable pipelined loads
+         *
+         * @param value - enable/disable pipelined mode
+         *
+         * @note
+         * When enabled, Load() returns immediately and reports the previous batch
+         * while the current one is loaded in background.
+         * See OCI_DirPathSetPipelined() for details
+         *
+         * @note
+         * Default value is false
+         *
+         */
+        void SetPipelined(bool value);
+
+        /**
+         * @brief
+         * Return true if pipelined loads are enabled
+         *
+         */
+        bool GetPipelined();
+
+        /**
+         * @brief
+         * Set the number of threads converting NUMBER and DATE values on client side
+         *
+         * @param value - Number of threads
+         *
+         * @note
+         * Must be called before SetColumn().
+         * See OCI_DirPathSetConvertThreads() for details
+         *
+         * @note
+         * Default value is 0
+         *
+         */
+        void SetConvertThreads(unsigned int value);
+
+        /**
+         * @brief
+         * Return the number of threads converting NUMBER and DATE values on client side
+         *
+         */
+        unsigned int GetConvertThreads();
+
         /**
          * @brief
          * Return the index of a column which caused an error during data conversion
@@ -9035,6 +9525,178 @@ namespace ocilib
         unsigned int GetErrorRow();
     };
 
+    /**
+     * @brief
+     * Array DML batcher
+     *
+     * This class wraps the OCILIB object handle OCI_Batcher and its related methods
+     *
+     */
+    class Batcher : public core::HandleHolder<OCI_Batcher*>
+    {
+        friend class Environment;
+
+    public:
+
+        /**
+         * @typedef ErrorHandlerProc
+         *
+         * @brief
+         * User callback for rows rejected by the server
+         *
+         * @note
+         * The row index is counted from the batcher creation and starts at 1
+         *
+         */
+        typedef void (*ErrorHandlerProc) (Batcher& batcher, const Exception& exception, unsigned int row);
+
+        /**
+        * @brief
+        * Row append status enumerated values
+        *
+        */
+        enum AddRowStatusValues
+        {
+            /** The row has been appended to the buffered rows */
+            RowBuffered = OCI_BRS_BUFFERED,
+            /** The row has been appended and all buffered rows have been sent */
+            RowFlushed = OCI_BRS_FLUSHED,
+            /** The row has been appended, buffered rows have been sent and some of them were rejected */
+            RowRejected = OCI_BRS_REJECTED,
+            /** The row has been appended but sending the buffered rows failed */
+            RowFailed = OCI_BRS_FAILED
+        };
+
+        /**
+        * @brief
+        * Row append status
+        *
+        * Possible values are Batcher::AddRowStatusValues
+        *
+        */
+        typedef core::Enum<AddRowStatusValues> AddRowStatus;
+
+        /**
+         * @brief
+         * Constructor
+         *
+         * @param connection - Connection
+         * @param sql        - DML statement
+         * @param nbCols     - Number of bind variables in the statement
+         * @param maxRows    - Maximum number of rows buffered before being sent to the server
+         *
+         */
+        Batcher(const Connection& connection, const ostring& sql, unsigned int nbCols, unsigned int maxRows);
+
+        /**
+         * @brief
+         * Describe a bind variable of the batcher statement
+         *
+         * @param colIndex    - Column index (starting at 1)
+         * @param name        - Bind variable name
+         * @param type        - Column type (TypeNumeric, TypeString or TypeDate)
+         * @param numericType - Numeric subtype for numeric columns (NumericInt, NumericBigInt or NumericDouble)
+         * @param maxLength   - Maximum number of characters for string columns
+         *
+         */
+        void SetColumn(unsigned int colIndex, const ostring& name, DataType type, NumericType numericType = NumericDouble, unsigned int maxLength = 0);
+
+        /**
+         * @brief
+         * Set additional thresholds that trigger sending buffered rows to the server
+         *
+         * @param maxBytes - Maximum size in bytes of the buffered values (0 for no limit)
+         * @param maxDelay - Maximum delay in seconds since the first buffered row (0 for no limit)
+         *
+         */
+        void SetFlushLimits(unsigned int maxBytes, unsigned int maxDelay);
+
+        /**
+         * @brief
+         * Set the callback called for each row rejected by the server
+         *
+         * @param handler - User callback (nullptr to remove it)
+         *
+         */
+        void SetErrorHandler(ErrorHandlerProc handler);
+
+        /**
+         * @brief
+         * Set the value of the given column for the current row
+         *
+         * @tparam T - Value type (int, big_int, double, ostring or Date)
+         *
+         * @param colIndex - Column index (starting at 1)
+         * @param value    - Value
+         *
+         */
+        template<class T>
+        void Set(unsigned int colIndex, const T& value);
+
+        /**
+         * @brief
+         * Set a null value for the given column of the current row
+         *
+         * @param colIndex - Column index (starting at 1)
+         *
+         */
+        void SetNull(unsigned int colIndex);
+
+        /**
+         * @brief
+         * Append the current row to the buffered rows
+         *
+         * @note
+         * An exception is thrown only when the row could not be appended.
+         * Errors raised when sending the buffered rows are reported by the returned status,
+         * the error handler and Flush().
+         *
+         */
+        AddRowStatus AddRow();
+
+        /**
+         * @brief
+         * Send all buffered rows to the server
+         *
+         */
+        void Flush();
+
+        /**
+         * @brief
+         * Send buffered rows to the server if a threshold is reached
+         *
+         * @note
+         * Check OCI_BatcherCheckDelay() for more details
+         *
+         */
+        void CheckDelay();
+
+        /**
+         * @brief
+         * Return the number of rows buffered and not sent yet
+         *
+         */
+        unsigned int GetPendingRows() const;
+
+        /**
+         * @brief
+         * Return the number of rows sent to the server since the batcher creation
+         *
+         */
+        unsigned int GetProcessedRows() const;
+
+        /**
+         * @brief
+         * Return the number of rows rejected by the server since the batcher creation
+         *
+         */
+        unsigned int GetErrorCount() const;
+
+    private:
+
+        Batcher(OCI_Batcher* pBatcher);
+    };
+
 
 #define OCILIB_DEFINE_FLAG_OPERATORS(T) \
         inline core::Flags<T> operator | (T a, T b) { return core::Flags<T>(a) | core::Flags<T>(b); } \
@@ -0,0 +1,297 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arrow.h"
+
+#include "date.h"
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowGetType
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ArrowGetType
+(
+    const struct ArrowSchema *schema,
+    unsigned int             *unit
+)
+{
+    const char *fmt = schema->format;
+
+    *unit = 0;
+
+    /* dictionary encoded arrays hold indexes, not values */
+
+    if (NULL == fmt || NULL != schema->dictionary)
+    {
+        return OCI_ARW_UNKNOWN;
+    }
+
+    if (fmt[0] && !fmt[1])
+    {
+        switch (fmt[0])
+        {
+            case 's': return OCI_ARW_INT16;
+            case 'S': return OCI_ARW_UINT16;
+            case 'i': return OCI_ARW_INT32;
+            case 'I': return OCI_ARW_UINT32;
+            case 'l': return OCI_ARW_INT64;
+            case 'L': return OCI_ARW_UINT64;
+            case 'f': return OCI_ARW_FLOAT;
+            case 'g': return OCI_ARW_DOUBLE;
+            case 'u': return OCI_ARW_UTF8;
+            case 'z': return OCI_ARW_BINARY;
+        }
+    }
+    else if ('t' == fmt[0] && 's' == fmt[1] && fmt[2] && ':' == fmt[3])
+    {
+        /* the time zone that may follow the colon does not change the epoch values */
+
+        switch (fmt[2])
+        {
+            case 's': *unit = OCI_DTM_EPOCH;       break;
+            case 'm': *unit = OCI_DTM_EPOCH_MILLI; break;
+            case 'u': *unit = OCI_DTM_EPOCH_MICRO; break;
+            case 'n': *unit = OCI_DTM_EPOCH_NANO;  break;
+        }
+
+        if (*unit > 0)
+        {
+            return OCI_ARW_TIMESTAMP;
+        }
+    }
+
+    return OCI_ARW_UNKNOWN;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowGetValueSize
+ * --------------------------------------------------------------------------------------------- */
+
+size_t ArrowGetValueSize
+(
+    unsigned int type
+)
+{
+    switch (type)
+    {
+        case OCI_ARW_INT16:
+        case OCI_ARW_UINT16:
+        {
+            return sizeof(short);
+        }
+        case OCI_ARW_INT32:
+        case OCI_ARW_UINT32:
+        {
+            return sizeof(int);
+        }
+        case OCI_ARW_FLOAT:
+        {
+            return sizeof(float);
+        }
+        case OCI_ARW_DOUBLE:
+        {
+            return sizeof(double);
+        }
+        case OCI_ARW_INT64:
+        case OCI_ARW_UINT64:
+        case OCI_ARW_TIMESTAMP:
+        {
+            return sizeof(big_int);
+        }
+    }
+
+    return 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowGetNumericType
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ArrowGetNumericType
+(
+    unsigned int type
+)
+{
+    switch (type)
+    {
+        case OCI_ARW_INT16:  return OCI_NUM_SHORT;
+        case OCI_ARW_UINT16: return OCI_NUM_USHORT;
+        case OCI_ARW_INT32:  return OCI_NUM_INT;
+        case OCI_ARW_UINT32: return OCI_NUM_UINT;
+        case OCI_ARW_INT64:  return OCI_NUM_BIGINT;
+        case OCI_ARW_UINT64: return OCI_NUM_BIGUINT;
+        case OCI_ARW_FLOAT:  return OCI_NUM_FLOAT;
+        case OCI_ARW_DOUBLE: return OCI_NUM_DOUBLE;
+    }
+
+    return 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowIsBatch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ArrowIsBatch
+(
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array
+)
+{
+    /* a record batch is a struct array whose children are the columns */
+
+    return NULL != schema->format && 0 == strcmp(schema->format, "+s") &&
+           NULL != array->release && schema->n_children == array->n_children &&
+           array->length >= 0 && array->length <= (int64_t) UB4MAXVAL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowIsNull
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ArrowIsNull
+(
+    const struct ArrowArray *array,
+    ub4                      pos
+)
+{
+    const ub1   *bits = (array->n_buffers > 0) ? (const ub1 *) array->buffers[0] : NULL;
+    const size_t i    = (size_t) array->offset + pos;
+
+    /* a set bit in the validity bitmap marks a valid entry */
+
+    return 0 != array->null_count && NULL != bits && 0 == (bits[i / 8] & (1 << (i % 8)));
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowGetValue
+ * --------------------------------------------------------------------------------------------- */
+
+const void * ArrowGetValue
+(
+    const struct ArrowArray *array,
+    size_t                   size,
+    ub4                      pos
+)
+{
+    return ((const ub1 *) array->buffers[1]) + ((size_t) array->offset + pos) * size;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowGetBytes
+ * --------------------------------------------------------------------------------------------- */
+
+void ArrowGetBytes
+(
+    const struct ArrowArray *array,
+    ub4                      pos,
+    const char             **data,
+    ub4                     *size
+)
+{
+    const int32_t *offsets = (const int32_t *) array->buffers[1];
+    const size_t   i       = (size_t) array->offset + pos;
+
+    *data = ((const char *) array->buffers[2]) + offsets[i];
+    *size = (ub4) (offsets[i + 1] - offsets[i]);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ArrowFormatValue
+ * --------------------------------------------------------------------------------------------- */
+
+int ArrowFormatValue
+(
+    const struct ArrowArray *array,
+    unsigned int             type,
+    unsigned int             unit,
+    ub4                      pos,
+    boolean                  fraction,
+    char                    *buffer,
+    int                      size
+)
+{
+    const void *value = ArrowGetValue(array, ArrowGetValueSize(type), pos);
+
+    switch (type)
+    {
+        case OCI_ARW_INT16:
+        {
+            return ocisprintf(buffer, size, "%d", (int) *(const short *) value);
+        }
+        case OCI_ARW_UINT16:
+        {
+            return ocisprintf(buffer, size, "%u", (unsigned int) *(const unsigned short *) value);
+        }
+        case OCI_ARW_INT32:
+        {
+            return ocisprintf(buffer, size, "%d", *(const int *) value);
+        }
+        case OCI_ARW_UINT32:
+        {
+            return ocisprintf(buffer, size, "%u", *(const unsigned int *) value);
+        }
+        case OCI_ARW_INT64:
+        {
+            return ocisprintf(buffer, size, "%lld", (long long) *(const big_int *) value);
+        }
+        case OCI_ARW_UINT64:
+        {
+            return ocisprintf(buffer, size, "%llu", (unsigned long long) *(const big_uint *) value);
+        }
+        case OCI_ARW_FLOAT:
+        {
+            return ocisprintf(buffer, size, "%.9g", (double) *(const float *) value);
+        }
+        case OCI_ARW_DOUBLE:
+        {
+            return ocisprintf(buffer, size, "%.17g", *(const double *) value);
+        }
+        case OCI_ARW_TIMESTAMP:
+        {
+            OCIDate date;
+            big_int secs = 0;
+            ub4     fsec = 0;
+
+            DateEpochSplit(*(const big_int *) value, unit, &secs, &fsec);
+
+            if (!DateEpochToOCIDate(secs, &date))
+            {
+                return -1;
+            }
+
+            /* matches OCI_ARROW_DATE_FORMAT and OCI_ARROW_TIMESTAMP_FORMAT */
+
+            if (fraction)
+            {
+                return ocisprintf(buffer, size, "%04d-%02d-%02d %02d:%02d:%02d.%09u",
+                                  (int) date.OCIDateYYYY, (int) date.OCIDateMM, (int) date.OCIDateDD,
+                                  (int) date.OCIDateTime.OCITimeHH, (int) date.OCIDateTime.OCITimeMI,
+                                  (int) date.OCIDateTime.OCITimeSS, (unsigned int) fsec);
+            }
+
+            return ocisprintf(buffer, size, "%04d-%02d-%02d %02d:%02d:%02d",
+                              (int) date.OCIDateYYYY, (int) date.OCIDateMM, (int) date.OCIDateDD,
+                              (int) date.OCIDateTime.OCITimeHH, (int) date.OCIDateTime.OCITimeMI,
+                              (int) date.OCIDateTime.OCITimeSS);
+        }
+    }
+
+    return -1;
+}
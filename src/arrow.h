@@ -0,0 +1,80 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_ARROW_H_INCLUDED
+#define OCILIB_ARROW_H_INCLUDED
+
+#include "types.h"
+
+unsigned int ArrowGetType
+(
+    const struct ArrowSchema *schema,
+    unsigned int             *unit
+);
+
+size_t ArrowGetValueSize
+(
+    unsigned int type
+);
+
+unsigned int ArrowGetNumericType
+(
+    unsigned int type
+);
+
+boolean ArrowIsBatch
+(
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array
+);
+
+boolean ArrowIsNull
+(
+    const struct ArrowArray *array,
+    ub4                      pos
+);
+
+const void * ArrowGetValue
+(
+    const struct ArrowArray *array,
+    size_t                   size,
+    ub4                      pos
+);
+
+void ArrowGetBytes
+(
+    const struct ArrowArray *array,
+    ub4                      pos,
+    const char             **data,
+    ub4                     *size
+);
+
+int ArrowFormatValue
+(
+    const struct ArrowArray *array,
+    unsigned int             type,
+    unsigned int             unit,
+    ub4                      pos,
+    boolean                  fraction,
+    char                    *buffer,
+    int                      size
+);
+
+#endif /* OCILIB_ARROW_H_INCLUDED */
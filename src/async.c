@@ -0,0 +1,394 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "async.h"
+
+#include "macros.h"
+#include "profiler.h"
+#include "resultset.h"
+#include "statement.h"
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncSetNonBlocking
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean AsyncSetNonBlocking
+(
+    OCI_Connection *con,
+    boolean         value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    ub1 current = 0;
+
+    CHECK_ATTRIB_GET
+    (
+        OCI_HTYPE_SERVER, OCI_ATTR_NONBLOCKING_MODE,
+        con->svr, &current, NULL,
+        con->err
+    )
+
+    /* setting the attribute toggles the server handle mode */
+
+    if ((0 != current) != (FALSE != value))
+    {
+        CHECK_ATTRIB_SET
+        (
+            OCI_HTYPE_SERVER, OCI_ATTR_NONBLOCKING_MODE,
+            con->svr, NULL, 0,
+            con->err
+        )
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncRecordExecute
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean AsyncRecordExecute
+(
+    OCI_Statement *stmt
+)
+{
+    if (0 == stmt->async_start)
+    {
+        return TRUE;
+    }
+
+    /* rows of queries are accounted by fetches */
+
+    const big_uint rows = OCI_CST_SELECT != stmt->type ? StatementGetAffectedRows(stmt) : 0;
+
+    return ProfilerRecord(stmt, OCI_PROFILE_EXECUTE, stmt->async_start, rows, 0);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncStep
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean AsyncStep
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_Resultset *rs = stmt->async_rs;
+    const ub1      op = stmt->async_op;
+    sword          ret;
+
+    /* a non blocking call must be repeated with the same arguments until it completes */
+
+    if (OCI_ASYNC_OP_EXECUTE == op)
+    {
+        ret = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err,
+                             stmt->async_iters, (ub4)0, (OCISnapshot *)NULL,
+                             (OCISnapshot *)NULL, stmt->async_mode);
+    }
+    else
+    {
+        ResultsetFetchCall(rs, OCI_SFD_NEXT, 0);
+
+        ret = rs->fetch_status;
+    }
+
+    if (OCI_STILL_EXECUTING == ret)
+    {
+        stmt->async_status = OCI_ASYNC_PENDING;
+
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    /* the call has completed : restore blocking mode before finalizing it */
+
+    stmt->async_op     = OCI_ASYNC_OP_NONE;
+    stmt->async_rs     = NULL;
+    stmt->async_status = OCI_ASYNC_FAILED;
+
+    stmt->con->async_stmt = NULL;
+
+    CHECK(AsyncSetNonBlocking(stmt->con, FALSE))
+
+    if (OCI_ASYNC_OP_EXECUTE == op)
+    {
+        stmt->async_result = StatementExecuteEnd(stmt, stmt->async_mode, ret);
+
+        CHECK(stmt->async_result)
+        CHECK(AsyncRecordExecute(stmt))
+    }
+    else
+    {
+        const big_uint fetched = stmt->async_start ? ProfilerClock() : 0;
+
+        stmt->async_result = ResultsetFetchComplete(rs, OCI_SFD_NEXT, 0);
+
+        CHECK(ProfilerRecordFetch(rs, stmt->async_start, fetched, stmt->async_result ? rs->row_fetched : 0))
+
+        if (stmt->async_result)
+        {
+            rs->bof     = FALSE;
+            rs->row_cur = 1;
+
+            rs->row_abs++;
+        }
+        else
+        {
+            /* no more rows is not a failure */
+
+            CHECK(rs->eof)
+        }
+    }
+
+    stmt->async_status = OCI_ASYNC_DONE;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncExecute
+ * --------------------------------------------------------------------------------------------- */
+
+boolean AsyncExecute
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    ub4     mode   = OCI_DEFAULT;
+    ub4     iters  = 0;
+    boolean cached = FALSE;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+    if (NULL != stmt->con->async_stmt)
+    {
+        THROW_NO_ARGS(ExceptionAsyncPending)
+    }
+
+    stmt->async_status = OCI_ASYNC_FAILED;
+    stmt->async_result = FALSE;
+    stmt->async_start  = ProfilerStart(stmt->con);
+
+    CHECK(StatementExecuteBegin(stmt, &mode, &iters, &cached))
+
+    if (cached)
+    {
+        stmt->async_status = OCI_ASYNC_DONE;
+        stmt->async_result = TRUE;
+
+        CHECK(AsyncRecordExecute(stmt))
+    }
+    else
+    {
+        CHECK(AsyncSetNonBlocking(stmt->con, TRUE))
+
+        stmt->async_op    = OCI_ASYNC_OP_EXECUTE;
+        stmt->async_mode  = mode;
+        stmt->async_iters = iters;
+
+        stmt->con->async_stmt = stmt;
+
+        CHECK(AsyncStep(stmt))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncFetch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean AsyncFetch
+(
+    OCI_Resultset *rs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_STMT_STATUS(rs->stmt, OCI_STMT_EXECUTED)
+
+    OCI_Statement *stmt = rs->stmt;
+
+    if (NULL != stmt->con->async_stmt)
+    {
+        THROW_NO_ARGS(ExceptionAsyncPending)
+    }
+
+    stmt->async_status = OCI_ASYNC_FAILED;
+    stmt->async_result = FALSE;
+
+    if (rs->eof || stmt->nb_rbinds > 0 || rs->row_cur < rs->row_fetched ||
+        OCI_NO_DATA == rs->fetch_status)
+    {
+        /* the next row is already available or known to be missing : no round trip needed */
+
+        stmt->async_result = ResultsetFetchNext(rs);
+
+        if (!stmt->async_result)
+        {
+            CHECK(rs->eof)
+        }
+
+        stmt->async_status = OCI_ASYNC_DONE;
+    }
+    else
+    {
+        CHECK(ResultsetClearFetchedObjectInstances(rs))
+        CHECK(AsyncSetNonBlocking(stmt->con, TRUE))
+
+        stmt->async_op    = OCI_ASYNC_OP_FETCH;
+        stmt->async_rs    = rs;
+        stmt->async_start = ProfilerStart(stmt->con);
+
+        stmt->con->async_stmt = stmt;
+        stmt->con->server_calls++;
+
+        CHECK(AsyncStep(stmt))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncPoll
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int AsyncPoll
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_ASYNC_FAILED,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    if (OCI_ASYNC_OP_NONE != stmt->async_op)
+    {
+        CHECK(AsyncStep(stmt))
+    }
+
+    SET_RETVAL(stmt->async_status)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncGetResult
+ * --------------------------------------------------------------------------------------------- */
+
+boolean AsyncGetResult
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        /* result */ boolean, FALSE,
+        /* handle */ OCI_IPC_STATEMENT, stmt,
+        /* member */ async_result
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * AsyncCancel
+ * --------------------------------------------------------------------------------------------- */
+
+boolean AsyncCancel
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    if (OCI_ASYNC_OP_NONE != stmt->async_op)
+    {
+        OCI_Connection *con = stmt->con;
+
+        stmt->async_op     = OCI_ASYNC_OP_NONE;
+        stmt->async_rs     = NULL;
+        stmt->async_status = OCI_ASYNC_NONE;
+        stmt->async_result = FALSE;
+
+        con->async_stmt = NULL;
+
+        /* in non blocking mode, a break must be followed by a reset of the protocol */
+
+        CHECK_OCI
+        (
+            con->err,
+            OCIBreak,
+            (dvoid*)con->cxt, con->err
+        )
+
+        CHECK_OCI
+        (
+            con->err,
+            OCIReset,
+            (dvoid*)con->svr, con->err
+        )
+
+        CHECK(AsyncSetNonBlocking(con, FALSE))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
@@ -0,0 +1,51 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_ASYNC_H_INCLUDED
+#define OCILIB_ASYNC_H_INCLUDED
+
+#include "types.h"
+
+boolean AsyncExecute
+(
+    OCI_Statement *stmt
+);
+
+boolean AsyncFetch
+(
+    OCI_Resultset *rs
+);
+
+unsigned int AsyncPoll
+(
+    OCI_Statement *stmt
+);
+
+boolean AsyncGetResult
+(
+    OCI_Statement *stmt
+);
+
+boolean AsyncCancel
+(
+    OCI_Statement *stmt
+);
+
+#endif /* OCILIB_ASYNC_H_INCLUDED */
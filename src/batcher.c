@@ -0,0 +1,761 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "batcher.h"
+
+#include "bind.h"
+#include "date.h"
+#include "error.h"
+#include "macros.h"
+#include "memory.h"
+#include "statement.h"
+
+/* a previous flush may have failed as a whole with a full buffer : retry it before
+   writing any value for the current row */
+
+#define CHECK_BATCHER_ROOM(bat)                                 \
+                                                                \
+    if ((bat)->nb_rows >= (bat)->max_rows)                      \
+    {                                                           \
+        BatcherFlush(bat);                                      \
+        CHECK((bat)->nb_rows < (bat)->max_rows)                 \
+    }
+
+#define CHECK_BATCHER_COLUMN(bat, index, col_type)              \
+                                                                \
+    CHECK_PTR(OCI_IPC_BATCHER, bat)                             \
+    CHECK_BOUND(index, 1, (bat)->nb_cols)                       \
+    CHECK_COMPAT((col_type) == (bat)->cols[(index) - 1].type)   \
+    CHECK_BATCHER_ROOM(bat)
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherIsDue
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean BatcherIsDue(OCI_Batcher *bat)
+{
+    if (0 == bat->nb_rows)
+    {
+        return FALSE;
+    }
+
+    return (bat->nb_rows >= bat->max_rows) ||
+           (bat->max_bytes > 0 && bat->nb_bytes >= bat->max_bytes) ||
+           (bat->max_delay > 0 && difftime(time(NULL), bat->started) >= (double) bat->max_delay);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetNumeric
+ * --------------------------------------------------------------------------------------------- */
+
+static void BatcherSetNumeric(OCI_BatcherColumn *col, ub4 row, double value, big_int bvalue, boolean is_big)
+{
+    if (OCI_NUM_INT == col->subtype)
+    {
+        ((int *) col->data)[row] = is_big ? (int) bvalue : (int) value;
+    }
+    else if (OCI_NUM_BIGINT == col->subtype)
+    {
+        ((big_int *) col->data)[row] = is_big ? bvalue : (big_int) value;
+    }
+    else
+    {
+        ((double *) col->data)[row] = is_big ? (double) bvalue : value;
+    }
+
+    col->set = TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Batcher * BatcherCreate
+(
+    OCI_Connection *con,
+    const otext    *sql,
+    unsigned int    nb_cols,
+    unsigned int    max_rows
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Batcher*, NULL,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    OCI_Batcher *bat = NULL;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_STRING, sql)
+    CHECK_BOUND(nb_cols, 1, OCI_BIND_MAX)
+    CHECK_MIN(max_rows, 1)
+
+    /* allocate batcher structure */
+
+    ALLOC_DATA(OCI_IPC_BATCHER, bat, 1)
+
+    bat->con      = con;
+    bat->nb_cols  = (ub2) nb_cols;
+    bat->max_rows = (ub4) max_rows;
+
+    /* prepare the DML statement for array execution */
+
+    bat->stmt = StatementCreate(con);
+    CHECK_NULL(bat->stmt)
+
+    CHECK(StatementPrepare(bat->stmt, sql))
+    CHECK(StatementSetBindArraySize(bat->stmt, max_rows))
+
+    /* allocating the column array */
+
+    ALLOC_DATA(OCI_IPC_BATCHER_COLS, bat->cols, bat->nb_cols)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            BatcherFree(bat);
+            bat = NULL;
+        }
+
+        SET_RETVAL(bat)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherFree
+(
+    OCI_Batcher *bat
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_PTR(OCI_IPC_BATCHER, bat)
+
+    if (NULL != bat->stmt)
+    {
+        StatementFree(bat->stmt);
+        bat->stmt = NULL;
+    }
+
+    for (ub2 i = 0; bat->cols && i < bat->nb_cols; i++)
+    {
+        if (OCI_CDT_DATETIME == bat->cols[i].type && NULL != bat->cols[i].data)
+        {
+            DateFreeArray((OCI_Date **) bat->cols[i].data);
+            bat->cols[i].data = NULL;
+        }
+
+        FREE(bat->cols[i].data)
+    }
+
+    FREE(bat->cols)
+
+    ErrorResetSource(NULL, bat);
+
+    FREE(bat)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetColumn
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetColumn
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    const otext *name,
+    unsigned int type,
+    unsigned int subtype,
+    unsigned int len
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_PTR(OCI_IPC_BATCHER, bat)
+    CHECK_PTR(OCI_IPC_STRING, name)
+    CHECK_BOUND(index, 1, bat->nb_cols)
+
+    OCI_BatcherColumn *col = &bat->cols[index - 1];
+
+    if (NULL != col->bnd)
+    {
+        THROW(ExceptionBindAlreadyUsed, name)
+    }
+
+    col->type    = type;
+    col->subtype = subtype;
+    col->len     = len;
+
+    /* allocate the array of values and bind it */
+
+    switch (type)
+    {
+        case OCI_CDT_NUMERIC:
+        {
+            if (OCI_NUM_INT == subtype)
+            {
+                col->size = sizeof(int);
+
+                ALLOC_BUFFER(OCI_IPC_INT, col->data, col->size, bat->max_rows)
+
+                CHECK(StatementBindArrayOfInts(bat->stmt, name, (int *) col->data, 0))
+            }
+            else if (OCI_NUM_BIGINT == subtype)
+            {
+                col->size = sizeof(big_int);
+
+                ALLOC_BUFFER(OCI_IPC_BIGINT, col->data, col->size, bat->max_rows)
+
+                CHECK(StatementBindArrayOfBigInts(bat->stmt, name, (big_int *) col->data, 0))
+            }
+            else if (OCI_NUM_DOUBLE == subtype)
+            {
+                col->size = sizeof(double);
+
+                ALLOC_BUFFER(OCI_IPC_DOUBLE, col->data, col->size, bat->max_rows)
+
+                CHECK(StatementBindArrayOfDoubles(bat->stmt, name, (double *) col->data, 0))
+            }
+            else
+            {
+                THROW(ExceptionArgInvalidValue, OTEXT("Numeric subtype"), subtype)
+            }
+
+            break;
+        }
+        case OCI_CDT_TEXT:
+        {
+            CHECK_MIN(len, 1)
+
+            col->size = (len + 1) * sizeof(otext);
+
+            ALLOC_BUFFER(OCI_IPC_STRING, col->data, col->size, bat->max_rows)
+
+            CHECK(StatementBindArrayOfStrings(bat->stmt, name, (otext *) col->data, len, 0))
+
+            break;
+        }
+        case OCI_CDT_DATETIME:
+        {
+            col->size = sizeof(OCIDate);
+            col->data = DateCreateArray(bat->con, bat->max_rows);
+
+            CHECK_NULL(col->data)
+
+            CHECK(StatementBindArrayOfDates(bat->stmt, name, (OCI_Date **) col->data, 0))
+
+            break;
+        }
+        default:
+        {
+            THROW(ExceptionDatatypeNotSupported, (int) type)
+        }
+    }
+
+    col->bnd = bat->stmt->ubinds[bat->stmt->nb_ubinds - 1];
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetFlushLimits
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetFlushLimits
+(
+    OCI_Batcher *bat,
+    unsigned int max_bytes,
+    unsigned int max_delay
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_PTR(OCI_IPC_BATCHER, bat)
+
+    bat->max_bytes = (size_t) max_bytes;
+    bat->max_delay = max_delay;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetErrorHandler
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetErrorHandler
+(
+    OCI_Batcher       *bat,
+    POCI_BATCHER_ERROR handler
+)
+{
+    SET_PROP
+    (
+        /* handle */ OCI_IPC_BATCHER, bat,
+        /* member */ handler, POCI_BATCHER_ERROR,
+        /* value  */ handler
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetInt
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetInt
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    int          value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_BATCHER_COLUMN(bat, index, OCI_CDT_NUMERIC)
+
+    BatcherSetNumeric(&bat->cols[index - 1], bat->nb_rows, 0.0, (big_int) value, TRUE);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetBigInt
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetBigInt
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    big_int      value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_BATCHER_COLUMN(bat, index, OCI_CDT_NUMERIC)
+
+    /* int columns cannot hold the full big_int range */
+
+    if (OCI_NUM_INT == bat->cols[index - 1].subtype)
+    {
+        CHECK_MIN(value, INT_MIN)
+        CHECK_MAX(value, INT_MAX)
+    }
+
+    BatcherSetNumeric(&bat->cols[index - 1], bat->nb_rows, 0.0, value, TRUE);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetDouble
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetDouble
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    double       value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_BATCHER_COLUMN(bat, index, OCI_CDT_NUMERIC)
+
+    BatcherSetNumeric(&bat->cols[index - 1], bat->nb_rows, value, 0, FALSE);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetString
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetString
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    const otext *value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_BATCHER_COLUMN(bat, index, OCI_CDT_TEXT)
+
+    OCI_BatcherColumn *col = &bat->cols[index - 1];
+
+    if (NULL == value)
+    {
+        col->set = FALSE;
+    }
+    else
+    {
+        otext *str = (otext *) (((ub1 *) col->data) + (size_t) bat->nb_rows * col->size);
+
+        ostrncpy(str, value, col->len);
+
+        str[col->len] = 0;
+
+        col->set = TRUE;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetDate
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetDate
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    OCI_Date    *value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_BATCHER_COLUMN(bat, index, OCI_CDT_DATETIME)
+
+    OCI_BatcherColumn *col = &bat->cols[index - 1];
+
+    if (NULL == value)
+    {
+        col->set = FALSE;
+    }
+    else
+    {
+        CHECK(DateAssign(((OCI_Date **) col->data)[bat->nb_rows], value))
+
+        col->set = TRUE;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherSetNull
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherSetNull
+(
+    OCI_Batcher *bat,
+    unsigned int index
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_PTR(OCI_IPC_BATCHER, bat)
+    CHECK_BOUND(index, 1, bat->nb_cols)
+
+    bat->cols[index - 1].set = FALSE;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherAddRow
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int BatcherAddRow
+(
+    OCI_Batcher *bat
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, OCI_BRS_ERROR,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_PTR(OCI_IPC_BATCHER, bat)
+    CHECK_BATCHER_ROOM(bat)
+
+    const ub4 pos = bat->nb_rows + 1;
+
+    /* update null indicators of the current row and reset columns for the next one */
+
+    for (ub2 i = 0; i < bat->nb_cols; i++)
+    {
+        OCI_BatcherColumn *col = &bat->cols[i];
+
+        if (NULL == col->bnd)
+        {
+            continue;
+        }
+
+        if (col->set)
+        {
+            CHECK(BindSetNotNullAtPos(col->bnd, pos))
+
+            if (OCI_CDT_TEXT == col->type)
+            {
+                const otext *str = (otext *) (((ub1 *) col->data) + (size_t) bat->nb_rows * col->size);
+
+                bat->nb_bytes += ostrlen(str) * sizeof(otext);
+            }
+            else
+            {
+                bat->nb_bytes += col->size;
+            }
+        }
+        else
+        {
+            CHECK(BindSetNullAtPos(col->bnd, pos))
+        }
+
+        col->set = FALSE;
+    }
+
+    if (0 == bat->nb_rows)
+    {
+        bat->started = time(NULL);
+    }
+
+    bat->nb_rows++;
+
+    /* from here, the row is buffered whatever the outcome of the flush */
+
+    unsigned int status = OCI_BRS_BUFFERED;
+
+    if (BatcherIsDue(bat))
+    {
+        const ub4 nb_errors = bat->nb_errors;
+
+        if (BatcherFlush(bat))
+        {
+            status = OCI_BRS_FLUSHED;
+        }
+        else if (bat->nb_errors > nb_errors)
+        {
+            status = OCI_BRS_REJECTED;
+        }
+        else
+        {
+            status = OCI_BRS_FAILED;
+        }
+    }
+
+    SET_RETVAL(status)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherFlush
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherFlush
+(
+    OCI_Batcher *bat
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_PTR(OCI_IPC_BATCHER, bat)
+
+    if (0 == bat->nb_rows)
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    OCI_Statement *stmt = bat->stmt;
+
+    CHECK(StatementSetBindArraySize(stmt, bat->nb_rows))
+
+    /* rows rejected by the server are reported by the execute call as a failure.
+       Batch error mode is requested even for a single row that would otherwise be
+       taken for a failure of the whole execution */
+
+    const boolean res = StatementExecuteInternal(stmt, OCI_BATCH_ERRORS);
+
+    const ub4 nb_errors = (NULL != stmt->batch) ? stmt->batch->count : 0;
+
+    if (!res && 0 == nb_errors)
+    {
+        /* the execution failed as a whole : rows are kept for a later attempt */
+
+        JUMP_EXIT()
+    }
+
+    /* report rejected rows */
+
+    for (ub4 i = 0; i < nb_errors; i++)
+    {
+        OCI_Error *err = &stmt->batch->errs[i];
+
+        if (NULL != bat->handler)
+        {
+            bat->handler(bat, err, bat->nb_sent + err->row);
+        }
+    }
+
+    bat->nb_errors += nb_errors;
+    bat->nb_sent   += bat->nb_rows;
+    bat->nb_rows    = 0;
+    bat->nb_bytes   = 0;
+
+    CHECK(0 == nb_errors)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherCheckDelay
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BatcherCheckDelay
+(
+    OCI_Batcher *bat
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BATCHER, bat
+    )
+
+    CHECK_PTR(OCI_IPC_BATCHER, bat)
+
+    if (BatcherIsDue(bat))
+    {
+        CHECK(BatcherFlush(bat))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherGetPendingRows
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int BatcherGetPendingRows
+(
+    OCI_Batcher *bat
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_BATCHER, bat,
+        /* member */ nb_rows
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherGetProcessedRows
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int BatcherGetProcessedRows
+(
+    OCI_Batcher *bat
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_BATCHER, bat,
+        /* member */ nb_sent
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BatcherGetErrorCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int BatcherGetErrorCount
+(
+    OCI_Batcher *bat
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_BATCHER, bat,
+        /* member */ nb_errors
+    )
+}
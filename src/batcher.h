@@ -0,0 +1,133 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_BATCHER_H_INCLUDED
+#define OCILIB_BATCHER_H_INCLUDED
+
+#include "types.h"
+
+OCI_Batcher * BatcherCreate
+(
+    OCI_Connection *con,
+    const otext    *sql,
+    unsigned int    nb_cols,
+    unsigned int    max_rows
+);
+
+boolean BatcherFree
+(
+    OCI_Batcher *bat
+);
+
+boolean BatcherSetColumn
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    const otext *name,
+    unsigned int type,
+    unsigned int subtype,
+    unsigned int len
+);
+
+boolean BatcherSetFlushLimits
+(
+    OCI_Batcher *bat,
+    unsigned int max_bytes,
+    unsigned int max_delay
+);
+
+boolean BatcherSetErrorHandler
+(
+    OCI_Batcher       *bat,
+    POCI_BATCHER_ERROR handler
+);
+
+boolean BatcherSetInt
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    int          value
+);
+
+boolean BatcherSetBigInt
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    big_int      value
+);
+
+boolean BatcherSetDouble
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    double       value
+);
+
+boolean BatcherSetString
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    const otext *value
+);
+
+boolean BatcherSetDate
+(
+    OCI_Batcher *bat,
+    unsigned int index,
+    OCI_Date    *value
+);
+
+boolean BatcherSetNull
+(
+    OCI_Batcher *bat,
+    unsigned int index
+);
+
+unsigned int BatcherAddRow
+(
+    OCI_Batcher *bat
+);
+
+boolean BatcherFlush
+(
+    OCI_Batcher *bat
+);
+
+boolean BatcherCheckDelay
+(
+    OCI_Batcher *bat
+);
+
+unsigned int BatcherGetPendingRows
+(
+    OCI_Batcher *bat
+);
+
+unsigned int BatcherGetProcessedRows
+(
+    OCI_Batcher *bat
+);
+
+unsigned int BatcherGetErrorCount
+(
+    OCI_Batcher *bat
+);
+
+#endif /* OCILIB_BATCHER_H_INCLUDED */
@@ -50,6 +50,28 @@ static const unsigned int BindDirectionValues[] =
     OCI_BDM_IN_OUT
 };
 
+/* --------------------------------------------------------------------------------------------- *
+ * BindFreeDescriptors
+ * --------------------------------------------------------------------------------------------- */
+
+static void BindFreeDescriptors
+(
+    OCI_Bind *bnd
+)
+{
+
+#if OCI_VERSION_COMPILE >= OCI_9_0
+
+    if (bnd->nb_descs > 0 && NULL != bnd->buffer.data)
+    {
+        MemoryFreeDescriptorArray((dvoid **)bnd->buffer.data, OCI_DTYPE_TIMESTAMP, bnd->nb_descs);
+    }
+
+#endif
+
+    bnd->nb_descs = 0;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * BindAllocateInternalData
  * --------------------------------------------------------------------------------------------- */
@@ -431,10 +453,34 @@ boolean BindAllocateBuffers
 
                 if (reused)
                 {
+                    BindFreeDescriptors(bnd);
+
                     FREE(bnd->buffer.data)
                 }
 
                 ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, bnd->buffer.data, bnd->size, nballoc)
+
+#if OCI_VERSION_COMPILE >= OCI_9_0
+
+                /* epoch binds with fractional seconds own their timestamp descriptors */
+
+                if ((OCI_CDT_DATETIME == bnd->type) && (SQLT_TIMESTAMP == bnd->code))
+                {
+                    CHECK
+                    (
+                        MemoryAllocDescriptorArray
+                        (
+                            (dvoid *)bnd->stmt->con->env,
+                            (dvoid **)bnd->buffer.data,
+                            OCI_DTYPE_TIMESTAMP,
+                            (ub4) nballoc
+                        )
+                    )
+
+                    bnd->nb_descs = (ub4) nballoc;
+                }
+
+#endif
             }
             else
             {
@@ -691,6 +737,29 @@ boolean BindAddToStatement
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * BindMarkDirty
+ * --------------------------------------------------------------------------------------------- */
+
+void BindMarkDirty
+(
+    OCI_Bind *bnd,
+    ub4       lo,
+    ub4       hi
+)
+{
+    if (bnd->dirty_lo >= bnd->dirty_hi)
+    {
+        bnd->dirty_lo = lo;
+        bnd->dirty_hi = hi;
+    }
+    else
+    {
+        bnd->dirty_lo = min(bnd->dirty_lo, lo);
+        bnd->dirty_hi = max(bnd->dirty_hi, hi);
+    }
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * BindCreate
  * --------------------------------------------------------------------------------------------- */
@@ -835,6 +904,10 @@ OCI_Bind* BindCreate
 
     CHECK(BindAllocateBuffers(bnd, mode, reused, nballoc, nbelem, plsql_table))
 
+    /* all values have to be marshalled on the next execution */
+
+    BindMarkDirty(bnd, 0, UB4MAXVAL);
+
     /* if we bind an OCI_Long or any output bind, we need to change the
        execution mode to provide data at execute time */
 
@@ -895,6 +968,121 @@ OCI_Bind* BindCreate
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * BindCreateStream
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Bind* BindCreateStream
+(
+    OCI_Statement     *stmt,
+    const otext       *name,
+    ub4                size,
+    ub1                type,
+    unsigned int       code,
+    unsigned int       subtype,
+    POCI_BIND_PRODUCER producer,
+    void              *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Bind*, NULL,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_Bind *bnd   = NULL;
+    int       index = 0;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    /* check index if necessary */
+
+    if (OCI_BIND_BY_POS == stmt->bind_mode)
+    {
+        index = (int) ostrtol(&name[1], NULL, 10);
+
+        if (index <= 0 || index > OCI_BIND_MAX)
+        {
+            THROW(ExceptionOutOfBounds, index)
+        }
+    }
+
+    /* streaming binds cannot be reused as values are not stored */
+
+    if (BindGetIndex(stmt, name) > 0)
+    {
+        THROW(ExceptionBindAlreadyUsed, name)
+    }
+
+    CHECK(BindCheckAvailability(stmt, OCI_BIND_INPUT, FALSE))
+
+    if (NULL == stmt->map)
+    {
+        stmt->map = HashCreate(OCI_HASH_DEFAULT_SIZE, OCI_HASH_INTEGER);
+        CHECK_NULL(stmt->map)
+    }
+
+    ALLOC_DATA(OCI_IPC_BIND, bnd, 1)
+
+    bnd->stmt         = stmt;
+    bnd->input        = NULL;
+    bnd->type         = type;
+    bnd->size         = size;
+    bnd->code         = (ub2) code;
+    bnd->subtype      = (ub1) subtype;
+    bnd->is_array     = stmt->bind_array;
+    bnd->csfrm        = OCI_CSF_NONE;
+    bnd->direction    = OCI_BDM_IN;
+    bnd->alloc_mode   = OCI_BAM_EXTERNAL;
+    bnd->producer     = producer;
+    bnd->producer_ctx = ctx;
+    bnd->name         = ostrdup(name);
+
+    /* values are provided one at a time by the producer : only a single indicator
+       and, when a conversion is required, a single element buffer are needed
+       whatever the number of iterations */
+
+    bnd->buffer.count   = 1;
+    bnd->buffer.sizelen = sizeof(ub2);
+
+    ALLOC_DATA(OCI_IPC_BIND, bnd->buffer.inds, 1)
+
+    if ((OCI_CDT_NUMERIC == type && SQLT_VNU == code) ||
+        (OCI_CDT_TEXT    == type && Env.use_wide_char_conv))
+    {
+        bnd->alloc = TRUE;
+
+        ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, bnd->buffer.data, bnd->size, 1)
+    }
+
+    CHECK(BindPerformBinding(bnd, OCI_BIND_INPUT, index, OCI_DATA_AT_EXEC, FALSE))
+
+    CHECK_OCI
+    (
+        bnd->stmt->con->err,
+        OCIBindDynamic,
+        (OCIBind *)bnd->buffer.handle,
+        bnd->stmt->con->err,
+        (dvoid *)bnd,
+        CallbackStreamInBind,
+        (dvoid *)NULL,
+        NULL
+    )
+
+    CHECK(BindAddToStatement(bnd, OCI_BIND_INPUT, FALSE))
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE && NULL != bnd)
+        {
+            BindFree(bnd);
+            bnd = NULL;
+        }
+
+        SET_RETVAL(bnd)
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * BindFree
  * --------------------------------------------------------------------------------------------- */
@@ -955,16 +1143,26 @@ boolean BindFree
     {
         if (bnd->alloc)
         {
+            BindFreeDescriptors(bnd);
+
             FREE(bnd->buffer.data)
         }
     }
 
     ErrorResetSource(NULL, bnd);
 
+    /* indicators provided by the program are not owned by the bind */
+
+    if (bnd->ext_inds)
+    {
+        bnd->buffer.inds = NULL;
+    }
+
     FREE(bnd->buffer.inds)
     FREE(bnd->buffer.obj_inds)
     FREE(bnd->buffer.lens)
     FREE(bnd->buffer.tmpbuf)
+    FREE(bnd->ext_buffer)
     FREE(bnd->plrcds)
     FREE(bnd->name)
     FREE(bnd)
@@ -1049,6 +1247,8 @@ boolean BindSetNullIndicator
     if (bnd->buffer.inds)
     {
         bnd->buffer.inds[position - 1] = value;
+
+        BindMarkDirty(bnd, position - 1, position);
     }
 
     SET_SUCCESS()
@@ -1110,6 +1310,7 @@ unsigned int BindGetSubtype
     unsigned int type = OCI_UNKNOWN;
 
     if (OCI_CDT_NUMERIC   == bnd->type ||
+        OCI_CDT_DATETIME  == bnd->type ||
         OCI_CDT_LONG      == bnd->type ||
         OCI_CDT_LOB       == bnd->type ||
         OCI_CDT_FILE      == bnd->type ||
@@ -1175,6 +1376,54 @@ OCI_Statement * BindGetStatement
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * BindToBufferSize
+ * --------------------------------------------------------------------------------------------- */
+
+static ub2 BindToBufferSize
+(
+    OCI_Bind    *bnd,
+    unsigned int size
+)
+{
+    if (OCI_CDT_TEXT == bnd->type)
+    {
+        if (bnd->size == (sb4) size)
+        {
+            size += (unsigned int) (size_t) sizeof(dbtext);
+        }
+
+        size *= (unsigned int) sizeof(dbtext);
+    }
+
+    return (ub2) size;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindFromBufferSize
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int BindFromBufferSize
+(
+    OCI_Bind *bnd,
+    ub2       len
+)
+{
+    unsigned int size = (unsigned int) len;
+
+    if (OCI_CDT_TEXT == bnd->type)
+    {
+        if (bnd->size == (sb4)size)
+        {
+            size -= (unsigned int) sizeof(dbtext);
+        }
+
+        size /= (unsigned int) sizeof(dbtext);
+    }
+
+    return size;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * BindSetDataSize
  * --------------------------------------------------------------------------------------------- */
@@ -1206,22 +1455,15 @@ boolean BindSetDataSizeAtPos
     )
 
     CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
     CHECK_BOUND(position, 1, bnd->buffer.count)
     CHECK_MIN(size, 1)
 
     CHECK_NULL(bnd->buffer.lens)
 
-    if (OCI_CDT_TEXT == bnd->type)
-    {
-        if (bnd->size == (sb4) size)
-        {
-            size += (unsigned int) (size_t) sizeof(dbtext);
-        }
-
-        size *= (unsigned int) sizeof(dbtext);
-    }
+    ((ub2 *) bnd->buffer.lens)[position-1] = BindToBufferSize(bnd, size);
 
-    ((ub2 *) bnd->buffer.lens)[position-1] = (ub2) size;
+    BindMarkDirty(bnd, position - 1, position);
 
     SET_SUCCESS()
 
@@ -1261,19 +1503,80 @@ unsigned int BindGetDataSizeAtPos
 
     CHECK_NULL(bnd->buffer.lens)
 
-    unsigned int size = (unsigned int)((ub2 *)bnd->buffer.lens)[position - 1];
+    SET_RETVAL(BindFromBufferSize(bnd, ((ub2 *)bnd->buffer.lens)[position - 1]))
 
-    if (OCI_CDT_TEXT == bnd->type)
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindSetDataSizes
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindSetDataSizes
+(
+    OCI_Bind           *bnd,
+    const unsigned int *sizes,
+    unsigned int        count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
+    CHECK_PTR(OCI_IPC_VOID, sizes)
+    CHECK_BOUND(count, 1, bnd->buffer.count)
+
+    CHECK_NULL(bnd->buffer.lens)
+
+    ub2 *lens = (ub2 *) bnd->buffer.lens;
+
+    for (ub4 i = 0; i < count; i++)
     {
-        if (bnd->size == (sb4)size)
-        {
-            size -= (unsigned int) sizeof(dbtext);
-        }
+        lens[i] = BindToBufferSize(bnd, sizes[i]);
+    }
 
-        size /= (unsigned int) sizeof(dbtext);
+    BindMarkDirty(bnd, 0, count);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindGetDataSizes
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindGetDataSizes
+(
+    OCI_Bind     *bnd,
+    unsigned int *sizes,
+    unsigned int  count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_PTR(OCI_IPC_VOID, sizes)
+    CHECK_BOUND(count, 1, bnd->buffer.count)
+
+    CHECK_NULL(bnd->buffer.lens)
+
+    const ub2 *lens = (ub2 *) bnd->buffer.lens;
+
+    for (ub4 i = 0; i < count; i++)
+    {
+        sizes[i] = BindFromBufferSize(bnd, lens[i]);
     }
 
-    SET_RETVAL(size)
+    SET_SUCCESS()
 
     EXIT_FUNC()
 }
@@ -1295,6 +1598,7 @@ boolean BindSetNullAtPos
     )
 
     CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
     CHECK_BOUND(position, 1, bnd->buffer.count)
 
     CHECK(BindSetNullIndicator(bnd, position, OCI_IND_NULL))
@@ -1333,6 +1637,7 @@ boolean BindSetNotNullAtPos
     )
 
     CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
     CHECK_BOUND(position, 1, bnd->buffer.count)
 
     CHECK(BindSetNullIndicator(bnd, position, OCI_IND_NOTNULL))
@@ -1371,6 +1676,7 @@ boolean BindIsNullAtPos
     )
 
     CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
     CHECK_BOUND(position, 1, bnd->buffer.count)
 
     CHECK_NULL(bnd->buffer.inds)
@@ -1392,6 +1698,209 @@ boolean BindIsNull
     return BindIsNullAtPos(bnd, 1);
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * BindSetNullBitmap
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindSetNullBitmap
+(
+    OCI_Bind            *bnd,
+    const unsigned char *bitmap,
+    unsigned int         count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
+    CHECK_PTR(OCI_IPC_VOID, bitmap)
+    CHECK_BOUND(count, 1, bnd->buffer.count)
+
+    CHECK_NULL(bnd->buffer.inds)
+
+    OCIInd *inds = bnd->buffer.inds;
+
+    for (ub4 i = 0; i < count; i += 8)
+    {
+        const ub1 bits = bitmap[i / 8];
+        const ub4 last = min(i + 8, count);
+
+        /* fast path for bytes without any null element */
+
+        if (0 == bits)
+        {
+            for (ub4 j = i; j < last; j++)
+            {
+                inds[j] = OCI_IND_NOTNULL;
+            }
+        }
+        else
+        {
+            for (ub4 j = i; j < last; j++)
+            {
+                inds[j] = (bits & (1 << (j - i))) ? OCI_IND_NULL : OCI_IND_NOTNULL;
+            }
+        }
+    }
+
+    BindMarkDirty(bnd, 0, count);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindSetIndicators
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindSetIndicators
+(
+    OCI_Bind    *bnd,
+    const short *inds,
+    unsigned int count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
+    CHECK_PTR(OCI_IPC_VOID, inds)
+    CHECK_BOUND(count, 1, bnd->buffer.count)
+
+    CHECK_NULL(bnd->buffer.inds)
+
+    for (ub4 i = 0; i < count; i++)
+    {
+        bnd->buffer.inds[i] = inds[i] < 0 ? OCI_IND_NULL : OCI_IND_NOTNULL;
+    }
+
+    BindMarkDirty(bnd, 0, count);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindGetIndicators
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindGetIndicators
+(
+    OCI_Bind    *bnd,
+    short       *inds,
+    unsigned int count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_COMPAT(NULL == bnd->producer)
+    CHECK_PTR(OCI_IPC_VOID, inds)
+    CHECK_BOUND(count, 1, bnd->buffer.count)
+
+    CHECK_NULL(bnd->buffer.inds)
+
+    memcpy(inds, bnd->buffer.inds, sizeof(short) * count);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindSetIndicatorArray
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindSetIndicatorArray
+(
+    OCI_Bind *bnd,
+    short    *inds
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+
+    /* object binds, LONG binds, streaming binds and register binds
+       manage their indicators internally */
+
+    CHECK_COMPAT(SQLT_NTY != bnd->code && OCI_CDT_LONG != bnd->type && NULL == bnd->producer)
+
+    for (ub4 i = 0; i < bnd->stmt->nb_rbinds; i++)
+    {
+        CHECK_COMPAT(bnd->stmt->rbinds[i] != bnd)
+    }
+
+    if (NULL != inds)
+    {
+        if (!bnd->ext_inds)
+        {
+            FREE(bnd->buffer.inds)
+        }
+
+        bnd->buffer.inds = (OCIInd *) inds;
+        bnd->ext_inds    = TRUE;
+    }
+    else if (bnd->ext_inds)
+    {
+        const ub4 count = max(bnd->buffer.count, bnd->stmt->nb_iters_init);
+
+        bnd->buffer.inds = NULL;
+        bnd->ext_inds    = FALSE;
+
+        ALLOC_DATA(OCI_IPC_BIND, bnd->buffer.inds, count)
+    }
+
+    /* register the new indicators array address to OCI */
+
+    const int index = (OCI_BIND_BY_POS == bnd->stmt->bind_mode) ? (int) ostrtol(&bnd->name[1], NULL, 10) : 0;
+
+    CHECK(BindPerformBinding(bnd, OCI_BIND_INPUT, index, OCI_DEFAULT, NULL != bnd->plrcds))
+
+    /* binding again resets the charset form */
+
+    ub1 csfrm = bnd->csfrm;
+
+    if ((OCI_CDT_LOB == bnd->type) && (OCI_NCLOB == bnd->subtype))
+    {
+        csfrm = SQLCS_NCHAR;
+    }
+
+    if (OCI_CSF_NONE != csfrm)
+    {
+        CHECK_ATTRIB_SET
+        (
+            OCI_HTYPE_BIND, OCI_ATTR_CHARSET_FORM,
+            bnd->buffer.handle, &csfrm, sizeof(csfrm),
+            bnd->stmt->con->err
+        )
+    }
+
+    BindMarkDirty(bnd, 0, UB4MAXVAL);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * BindSetCharsetForm
  * --------------------------------------------------------------------------------------------- */
@@ -1486,3 +1995,53 @@ unsigned int BindGetAllocationMode
         /* member */ alloc_mode
     )
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindSetDirty
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindSetDirty
+(
+    OCI_Bind *bnd
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+
+    BindMarkDirty(bnd, 0, UB4MAXVAL);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * BindSetDirtyAtPos
+ * --------------------------------------------------------------------------------------------- */
+
+boolean BindSetDirtyAtPos
+(
+    OCI_Bind    *bnd,
+    unsigned int position
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_BIND, bnd
+    )
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+    CHECK_BOUND(position, 1, bnd->buffer.count)
+
+    BindMarkDirty(bnd, position - 1, position);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
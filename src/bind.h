@@ -23,6 +23,13 @@
 
 #include "types.h"
 
+void BindMarkDirty
+(
+    OCI_Bind* bnd,
+    ub4       lo,
+    ub4       hi
+);
+
 OCI_Bind* BindCreate
 (
     OCI_Statement* stmt,
@@ -37,6 +44,18 @@ OCI_Bind* BindCreate
     unsigned int   nbelem
 );
 
+OCI_Bind* BindCreateStream
+(
+    OCI_Statement     *stmt,
+    const otext       *name,
+    ub4                size,
+    ub1                type,
+    unsigned int       code,
+    unsigned int       subtype,
+    POCI_BIND_PRODUCER producer,
+    void              *ctx
+);
+
 boolean BindFree
 (
     OCI_Bind* bnd
@@ -109,6 +128,20 @@ unsigned int BindGetDataSizeAtPos
     unsigned int position
 );
 
+boolean BindSetDataSizes
+(
+    OCI_Bind           *bnd,
+    const unsigned int *sizes,
+    unsigned int        count
+);
+
+boolean BindGetDataSizes
+(
+    OCI_Bind     *bnd,
+    unsigned int *sizes,
+    unsigned int  count
+);
+
 boolean BindSetNullAtPos
 (
     OCI_Bind   * bnd,
@@ -142,6 +175,33 @@ boolean BindIsNull
     OCI_Bind* bnd
 );
 
+boolean BindSetNullBitmap
+(
+    OCI_Bind            *bnd,
+    const unsigned char *bitmap,
+    unsigned int         count
+);
+
+boolean BindSetIndicators
+(
+    OCI_Bind    *bnd,
+    const short *inds,
+    unsigned int count
+);
+
+boolean BindGetIndicators
+(
+    OCI_Bind    *bnd,
+    short       *inds,
+    unsigned int count
+);
+
+boolean BindSetIndicatorArray
+(
+    OCI_Bind *bnd,
+    short    *inds
+);
+
 boolean BindSetCharsetForm
 (
     OCI_Bind    *bnd,
@@ -164,4 +224,15 @@ unsigned int BindGetAllocationMode
     OCI_Bind* bnd
 );
 
+boolean BindSetDirty
+(
+    OCI_Bind* bnd
+);
+
+boolean BindSetDirtyAtPos
+(
+    OCI_Bind   * bnd,
+    unsigned int position
+);
+
 #endif /* OCILIB_BIND_H_INCLUDED */
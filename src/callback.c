@@ -22,7 +22,10 @@
 
 #include "event.h"
 #include "list.h"
+#include "lob.h"
 #include "macros.h"
+#include "number.h"
+#include "resultcache.h"
 #include "resultset.h"
 #include "strings.h"
 #include "timestamp.h"
@@ -100,6 +103,203 @@ sb4 CallbackInBind
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * CallbackStreamInBind
+ * --------------------------------------------------------------------------------------------- */
+
+sb4 CallbackStreamInBind
+(
+    dvoid   *ictxp,
+    OCIBind *bindp,
+    ub4      iter,
+    ub4      index,
+    dvoid  **bufpp,
+    ub4     *alenp,
+    ub1     *piecep,
+    dvoid  **indp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ sb4, OCI_ERROR,
+        /* context */ OCI_IPC_BIND, ictxp
+    )
+
+    OCI_Bind    *bnd  = (OCI_Bind *) ictxp;
+    void        *data = NULL;
+    unsigned int size = 0;
+
+    OCI_NOT_USED(index)
+    OCI_NOT_USED(bindp)
+
+    CHECK_PTR(OCI_IPC_BIND, bnd)
+
+    /* ask the application for the value of the current iteration */
+
+    if (!bnd->producer(bnd, (unsigned int) iter + 1, &data, &size, bnd->producer_ctx))
+    {
+        /* the execution is aborted and the failure reported once it returns */
+
+        bnd->failed_iter = iter + 1;
+
+        JUMP_EXIT()
+    }
+
+    *bufpp  = (dvoid *) 0;
+    *alenp  = (ub4    ) 0;
+    *piecep = (ub1    ) OCI_ONE_PIECE;
+    *indp   = (dvoid *) bnd->buffer.inds;
+
+    *bnd->buffer.inds = OCI_IND_NULL;
+
+    if (NULL != data)
+    {
+        *bnd->buffer.inds = OCI_IND_NOTNULL;
+
+        switch (bnd->type)
+        {
+            case OCI_CDT_TEXT:
+            {
+                const unsigned int max_chars = (unsigned int) (bnd->size / sizeof(dbtext));
+
+                if (0 == size)
+                {
+                    size = (unsigned int) ostrlen((otext *) data);
+                }
+
+                if (size > max_chars)
+                {
+                    size = max_chars;
+                }
+
+                if (Env.use_wide_char_conv)
+                {
+                    StringUTF32ToUTF16(data, bnd->buffer.data, size);
+
+                    data = bnd->buffer.data;
+                }
+
+                *alenp = (ub4) (size * sizeof(dbtext));
+                break;
+            }
+            case OCI_CDT_RAW:
+            {
+                *alenp = (ub4) (size > (unsigned int) bnd->size ? (unsigned int) bnd->size : size);
+                break;
+            }
+            case OCI_CDT_NUMERIC:
+            {
+                if (OCI_NUM_BIGINT & bnd->subtype)
+                {
+                    CHECK(NumberTranslateValue(bnd->stmt->con, data, bnd->subtype,
+                                               bnd->buffer.data, OCI_NUM_NUMBER))
+
+                    data = bnd->buffer.data;
+                }
+
+                *alenp = (ub4) bnd->size;
+                break;
+            }
+            case OCI_CDT_DATETIME:
+            {
+                data   = ((OCI_Date *) data)->handle;
+                *alenp = (ub4) bnd->size;
+                break;
+            }
+        }
+
+        *bufpp = (dvoid *) data;
+    }
+
+    SET_RETVAL(OCI_CONTINUE)
+
+    EXIT_FUNC()
+}
+
+#ifdef OCI_LOB2_API_ENABLED
+
+/* --------------------------------------------------------------------------------------------- *
+ * CallbackLobStreamRead
+ * --------------------------------------------------------------------------------------------- */
+
+sb4 CallbackLobStreamRead
+(
+    dvoid       *ctxp,
+    CONST dvoid *bufp,
+    oraub8       len,
+    ub1          piece,
+    dvoid      **changed_bufpp,
+    oraub8      *changed_lenp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ sb4, OCI_ERROR,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_LobStream *ls = (OCI_LobStream *) ctxp;
+
+    OCI_NOT_USED(piece)
+    OCI_NOT_USED(changed_bufpp)
+    OCI_NOT_USED(changed_lenp)
+
+    CHECK_PTR(OCI_IPC_VOID, ls)
+
+    /* returning an error stops the read when the user sink does not want more data */
+
+    CHECK(LobStreamPush(ls, (void *) bufp, (unsigned int) len))
+
+    SET_RETVAL(OCI_CONTINUE)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * CallbackLobStreamWrite
+ * --------------------------------------------------------------------------------------------- */
+
+sb4 CallbackLobStreamWrite
+(
+    dvoid   *ctxp,
+    dvoid   *bufp,
+    oraub8  *lenp,
+    ub1     *piece,
+    dvoid  **changed_bufpp,
+    oraub8  *changed_lenp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ sb4, OCI_ERROR,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_LobStream *ls = (OCI_LobStream *) ctxp;
+
+    OCI_NOT_USED(bufp)
+
+    CHECK_PTR(OCI_IPC_VOID, ls)
+
+    /* hand the piece filled in advance to OCI and fill the next one in the buffer
+       of the piece that OCI has just written */
+
+    *changed_bufpp = (dvoid *) (ls->buffer + (size_t) ls->index * ls->stride);
+    *changed_lenp  = (oraub8) ls->pending;
+    *lenp          = (oraub8) ls->pending;
+
+    ls->index   = 1 - ls->index;
+    ls->pending = LobStreamPull(ls, ls->index);
+
+    *piece = (ub1) (ls->pending > 0 ? OCI_NEXT_PIECE : OCI_LAST_PIECE);
+
+    SET_RETVAL(OCI_CONTINUE)
+
+    EXIT_FUNC()
+}
+
+#endif
+
 /* --------------------------------------------------------------------------------------------- *
  * ProcOutBind
  * --------------------------------------------------------------------------------------------- */
@@ -398,6 +598,10 @@ ub4 CallbackNotifyChanges
                 sub->event.op = sub->event.op & (~OCI_OPCODE_ALLROWS);
                 sub->event.op = sub->event.op & (~OCI_OPCODE_ALLOPS);
 
+                /* invalidate result cache entries depending on the table */
+
+                ResultCacheNotify(sub, sub->event.objname);
+
                 /* if requested, get row details */
 
                 if (sub->type & OCI_CNT_ROWS)
@@ -477,6 +681,10 @@ ub4 CallbackNotifyChanges
     }
     else if (sub->event.type > 0)
     {
+        /* database state changes : result cache entries cannot be trusted anymore */
+
+        ResultCacheNotify(sub, NULL);
+
         sub->handler(&sub->event);
     }
 
@@ -35,6 +35,42 @@ sb4 CallbackInBind
     dvoid  **indp
 );
 
+sb4 CallbackStreamInBind
+(
+    dvoid   *ictxp,
+    OCIBind *bindp,
+    ub4      iter,
+    ub4      index,
+    dvoid  **bufpp,
+    ub4     *alenp,
+    ub1     *piecep,
+    dvoid  **indp
+);
+
+#ifdef OCI_LOB2_API_ENABLED
+
+sb4 CallbackLobStreamRead
+(
+    dvoid       *ctxp,
+    CONST dvoid *bufp,
+    oraub8       len,
+    ub1          piece,
+    dvoid      **changed_bufpp,
+    oraub8      *changed_lenp
+);
+
+sb4 CallbackLobStreamWrite
+(
+    dvoid   *ctxp,
+    dvoid   *bufp,
+    oraub8  *lenp,
+    ub1     *piece,
+    dvoid  **changed_bufpp,
+    oraub8  *changed_lenp
+);
+
+#endif
+
 sb4 CallbackOutBind
 (
     dvoid   *octxp,
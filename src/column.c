@@ -542,6 +542,10 @@ boolean ColumnMapInfo
 
     const ub2 char_size = (ub2) ( (Env.nls_utf8 ) ? OCI_UTF8_BYTES_PER_CHAR : sizeof(otext) );
 
+    /* LOBs can be inlined in select lists only, not in returning into placeholders */
+
+    const boolean lob_inline = (stmt && OCI_LOB_INLINE == stmt->lob_mode && 0 == stmt->nb_rbinds);
+
     CHECK_PTR(OCI_IPC_COLUMN, col)
 
     /* map Oracle SQL code to OCILIB types and setup of internal buffer size */
@@ -727,6 +731,16 @@ boolean ColumnMapInfo
         }
         case SQLT_BLOB:
         {
+            if (lob_inline)
+            {
+                /* values are fetched into the raw buffer instead of a locator */
+
+                col->datatype = OCI_CDT_RAW;
+                col->libcode  = SQLT_BIN;
+                col->bufsize  = (ub4) (stmt->lob_inline_size + (ub4) sizeof(otext));
+                break;
+            }
+
             col->datatype   = OCI_CDT_LOB;
             col->subtype    = OCI_BLOB;
             col->handletype = OCI_DTYPE_LOB;
@@ -735,6 +749,16 @@ boolean ColumnMapInfo
         }
         case SQLT_CLOB:
         {
+            if (lob_inline)
+            {
+                /* values are fetched into the string buffer instead of a locator */
+
+                col->datatype = OCI_CDT_TEXT;
+                col->libcode  = SQLT_STR;
+                col->bufsize  = (ub4) ((stmt->lob_inline_size + 1) * char_size);
+                break;
+            }
+
             col->datatype   = OCI_CDT_LOB;
             col->handletype = OCI_DTYPE_LOB;
             col->bufsize    = (ub4) sizeof(OCILobLocator *);
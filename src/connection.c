@@ -20,12 +20,17 @@
 
 #include "connection.h"
 
+#include "async.h"
 #include "bind.h"
 #include "callback.h"
+#include "describecache.h"
 #include "error.h"
 #include "format.h"
 #include "list.h"
 #include "macros.h"
+#include "preparedcache.h"
+#include "profiler.h"
+#include "resultcache.h"
 #include "statement.h"
 #include "strings.h"
 #include "timestamp.h"
@@ -595,6 +600,8 @@ boolean ConnectionLogonRegular
 
         /* start session */
 
+        con->server_calls++;
+
         CHECK_OCI
         (
             con->err,
@@ -956,6 +963,13 @@ boolean ConnectionLogOff
 
     /* free all statements */
 
+    if (NULL != con->async_stmt)
+    {
+        AsyncCancel(con->async_stmt);
+    }
+
+    PreparedCacheClear(con);
+
     ListForEach(con->stmts, (POCI_LIST_FOR_EACH)StatementDispose);
     ListClear(con->stmts);
 
@@ -1060,6 +1074,22 @@ boolean ConnectionDispose
     FREE(con->domain_name)
     FREE(con->trace)
 
+    if (NULL != con->rcache)
+    {
+        ResultCacheFree(con->rcache);
+        con->rcache = NULL;
+    }
+
+    if (NULL != con->pcache)
+    {
+        FREE(con->pcache->buckets)
+        FREE(con->pcache)
+    }
+
+    ProfilerFree(con);
+
+    DescribeCacheFree(con);
+
     if (!con->pool)
     {
         FREE(con->db)
@@ -1228,6 +1258,10 @@ boolean ConnectionCommit
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
+    CHECK_NO_ASYNC_CALL(con)
+
+    con->server_calls++;
+
     CHECK_OCI
     (
         con->err,
@@ -1257,6 +1291,10 @@ boolean ConnectionRollback
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
 
+    CHECK_NO_ASYNC_CALL(con)
+
+    con->server_calls++;
+
     CHECK_OCI
     (
         con->err,
@@ -1304,6 +1342,93 @@ boolean ConnectionGetAutoCommit
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetCommitOnExecute
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetCommitOnExecute
+(
+    OCI_Connection *con,
+    boolean         enable
+)
+{
+    SET_PROP
+    (
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ commit_exec, boolean,
+        /* value  */ enable
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetCommitOnExecute
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionGetCommitOnExecute
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ boolean, FALSE,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ commit_exec
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetFormatBinding
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetFormatBinding
+(
+    OCI_Connection *con,
+    boolean         enable
+)
+{
+    SET_PROP
+    (
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ fmt_binds, boolean,
+        /* value  */ enable
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetFormatBinding
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionGetFormatBinding
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ boolean, FALSE,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ fmt_binds
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetServerCalls
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetServerCalls
+(
+    OCI_Connection *con
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_CONNECTION, con,
+        /* member */ server_calls
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ConnectionIsConnected
  * --------------------------------------------------------------------------------------------- */
@@ -1597,10 +1722,14 @@ const otext * ConnectionGetServerVersion
         int ver_min = 0;
         int ver_rev = 0;
 
+        CHECK_NO_ASYNC_CALL(con)
+
         ALLOC_DATA(OCI_IPC_STRING, con->ver_str, OCI_SIZE_BUFFER + 1)
 
         dbstr = StringGetDBString(con->ver_str, &dbsize);
 
+        con->server_calls++;
+
 #if OCI_VERSION_COMPILE >= OCI_18_1
 
         ub4 version = 0;
@@ -2251,6 +2380,10 @@ boolean ConnectionPing
 
     if (Env.version_runtime >= OCI_10_2)
     {
+        CHECK_NO_ASYNC_CALL(con)
+
+        con->server_calls++;
+
         CHECK_OCI
         (
             con->err,
@@ -2802,6 +2935,164 @@ boolean ConnectionSetStatementCacheSize
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetResultCache
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetResultCache
+(
+    OCI_Connection *con,
+    unsigned int    max_entries,
+    unsigned int    max_size,
+    unsigned int    ttl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    OCI_Subscription *sub = NULL;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* drop the current cache, keeping its invalidation subscription */
+
+    if (NULL != con->rcache)
+    {
+        sub = con->rcache->sub;
+
+        ResultCacheReleaseConnection(con, con->rcache);
+        ResultCacheFree(con->rcache);
+
+        con->rcache = NULL;
+    }
+
+    if (max_entries > 0)
+    {
+        con->rcache = ResultCacheCreate(max_entries, max_size, ttl);
+        CHECK_NULL(con->rcache)
+
+        con->rcache->sub = sub;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionSetResultCacheSubscription
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionSetResultCacheSubscription
+(
+    OCI_Connection   *con,
+    OCI_Subscription *sub
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    OCI_ResultCache *cache = ResultCacheGet(con);
+    CHECK_NULL(cache)
+
+    CHECK(ResultCacheSetSubscription(cache, sub))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionClearResultCache
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ConnectionClearResultCache
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    OCI_ResultCache *cache = ResultCacheGet(con);
+
+    if (NULL != cache)
+    {
+        CHECK(ResultCacheClear(cache))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetResultCacheHits
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetResultCacheHits
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    OCI_ResultCache *cache = ResultCacheGet(con);
+
+    if (NULL != cache)
+    {
+        SET_RETVAL(ResultCacheGetHits(cache))
+    }
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ConnectionGetResultCacheMisses
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ConnectionGetResultCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    OCI_ResultCache *cache = ResultCacheGet(con);
+
+    if (NULL != cache)
+    {
+        SET_RETVAL(ResultCacheGetMisses(cache))
+    }
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ConnectionGetDefaultLobPrefetchSize
  * --------------------------------------------------------------------------------------------- */
@@ -2996,9 +3287,11 @@ boolean ConnectionExecuteImmediateFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     CHECK_PTR(OCI_IPC_CONNECTION, con)
     CHECK_PTR(OCI_IPC_STRING,     sql)
@@ -3025,6 +3318,14 @@ boolean ConnectionExecuteImmediateFmt
     /* prepare and execute SQL buffer */
 
     CHECK(StatementPrepareInternal(stmt, sql_fmt))
+
+    /* bind values replaced by placeholders */
+
+    if (con->fmt_binds)
+    {
+        CHECK(FormatBindSql(stmt, sql, &bind_pass_args))
+    }
+
     CHECK(StatementExecuteInternal(stmt, OCI_DEFAULT))
 
     /* get resultset and set up variables */
@@ -3040,6 +3341,7 @@ boolean ConnectionExecuteImmediateFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         if (NULL != stmt)
         {
@@ -104,6 +104,33 @@ boolean ConnectionGetAutoCommit
     OCI_Connection* con
 );
 
+boolean ConnectionSetCommitOnExecute
+(
+    OCI_Connection* con,
+    boolean         enable
+);
+
+boolean ConnectionGetCommitOnExecute
+(
+    OCI_Connection* con
+);
+
+boolean ConnectionSetFormatBinding
+(
+    OCI_Connection* con,
+    boolean         enable
+);
+
+boolean ConnectionGetFormatBinding
+(
+    OCI_Connection* con
+);
+
+unsigned int ConnectionGetServerCalls
+(
+    OCI_Connection* con
+);
+
 boolean ConnectionIsConnected
 (
     OCI_Connection* con
@@ -299,6 +326,35 @@ boolean ConnectionSetStatementCacheSize
     unsigned int    value
 );
 
+boolean ConnectionSetResultCache
+(
+    OCI_Connection* con,
+    unsigned int    max_entries,
+    unsigned int    max_size,
+    unsigned int    ttl
+);
+
+boolean ConnectionSetResultCacheSubscription
+(
+    OCI_Connection  * con,
+    OCI_Subscription* sub
+);
+
+boolean ConnectionClearResultCache
+(
+    OCI_Connection* con
+);
+
+unsigned int ConnectionGetResultCacheHits
+(
+    OCI_Connection* con
+);
+
+unsigned int ConnectionGetResultCacheMisses
+(
+    OCI_Connection* con
+);
+
 unsigned int ConnectionGetDefaultLobPrefetchSize
 (
     OCI_Connection* con
@@ -25,6 +25,22 @@
 #include "macros.h"
 #include "strings.h"
 
+/* date format elements handled by DateParseString() and their maximum number of digits */
+
+static const otext * const DateFormatFields[] =
+{
+    OTEXT("YYYY"), OTEXT("MM"), OTEXT("DD"), OTEXT("HH24"), OTEXT("MI"), OTEXT("SS")
+};
+
+static const int DateFormatWidths[] =
+{
+    4, 2, 2, 2, 2, 2
+};
+
+#define DATE_FORMAT_SEPARATOR   (-1)
+#define DATE_FORMAT_UNKNOWN     (-2)
+#define DATE_FORMAT_DAY_MASK    0x07
+
 /* --------------------------------------------------------------------------------------------- *
  * DateInit
  * --------------------------------------------------------------------------------------------- */
@@ -939,3 +955,457 @@ boolean DateFromCTime
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateDaysFromCivil
+ * --------------------------------------------------------------------------------------------- */
+
+static big_int DateDaysFromCivil
+(
+    big_int year,
+    big_int month,
+    big_int day
+)
+{
+    /* days since 1970-01-01 in the proleptic gregorian calendar */
+
+    year -= (month <= 2);
+
+    const big_int era = (year >= 0 ? year : year - 399) / 400;
+    const big_int yoe = year - era * 400;
+    const big_int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const big_int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + doe - 719468;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateEpochToOCIDate
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DateEpochToOCIDate
+(
+    big_int  seconds,
+    OCIDate *date
+)
+{
+    big_int days = seconds / 86400;
+    big_int secs = seconds % 86400;
+
+    if (secs < 0)
+    {
+        secs += 86400;
+        days--;
+    }
+
+    days += 719468;
+
+    const big_int era = (days >= 0 ? days : days - 146096) / 146097;
+    const big_int doe = days - era * 146097;
+    const big_int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const big_int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const big_int mp  = (5 * doy + 2) / 153;
+    const big_int mt  = mp + (mp < 10 ? 3 : -9);
+    const big_int yr  = yoe + era * 400 + (mt <= 2);
+
+    if (yr < OCI_DATE_YEAR_MIN || yr > OCI_DATE_YEAR_MAX)
+    {
+        return FALSE;
+    }
+
+    date->OCIDateYYYY = (sb2) yr;
+    date->OCIDateMM   = (ub1) mt;
+    date->OCIDateDD   = (ub1) (doy - (153 * mp + 2) / 5 + 1);
+
+    date->OCIDateTime.OCITimeHH = (ub1) (secs / 3600);
+    date->OCIDateTime.OCITimeMI = (ub1) ((secs % 3600) / 60);
+    date->OCIDateTime.OCITimeSS = (ub1) (secs % 60);
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateOCIDateToEpoch
+ * --------------------------------------------------------------------------------------------- */
+
+big_int DateOCIDateToEpoch
+(
+    const OCIDate *date
+)
+{
+    const big_int days = DateDaysFromCivil(date->OCIDateYYYY, date->OCIDateMM, date->OCIDateDD);
+
+    return days * 86400 +
+           date->OCIDateTime.OCITimeHH * 3600 +
+           date->OCIDateTime.OCITimeMI * 60   +
+           date->OCIDateTime.OCITimeSS;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateEpochGetScale
+ * --------------------------------------------------------------------------------------------- */
+
+static big_int DateEpochGetScale
+(
+    unsigned int unit
+)
+{
+    switch (unit)
+    {
+        case OCI_DTM_EPOCH_MILLI:
+        {
+            return 1000;
+        }
+        case OCI_DTM_EPOCH_MICRO:
+        {
+            return 1000000;
+        }
+        case OCI_DTM_EPOCH_NANO:
+        {
+            return 1000000000;
+        }
+    }
+
+    return 1;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateEpochSplit
+ * --------------------------------------------------------------------------------------------- */
+
+void DateEpochSplit
+(
+    big_int      value,
+    unsigned int unit,
+    big_int     *seconds,
+    ub4         *fsec
+)
+{
+    const big_int scale = DateEpochGetScale(unit);
+
+    big_int frac = value % scale;
+
+    /* fractional part of values before the epoch counts forward from the previous second */
+
+    if (frac < 0)
+    {
+        frac += scale;
+    }
+
+    *seconds = (value - frac) / scale;
+    *fsec    = (ub4) (frac * (1000000000 / scale));
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateEpochJoin
+ * --------------------------------------------------------------------------------------------- */
+
+big_int DateEpochJoin
+(
+    big_int      seconds,
+    ub4          fsec,
+    unsigned int unit
+)
+{
+    const big_int scale = DateEpochGetScale(unit);
+
+    return seconds * scale + (big_int) fsec / (1000000000 / scale);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateTmToOCIDate
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DateTmToOCIDate
+(
+    const struct tm *ptm,
+    OCIDate         *date
+)
+{
+    const int year = ptm->tm_year + 1900;
+
+    if (year < OCI_DATE_YEAR_MIN || year > OCI_DATE_YEAR_MAX ||
+        ptm->tm_mon  < 0 || ptm->tm_mon  > 11 ||
+        ptm->tm_mday < 1 || ptm->tm_mday > 31 ||
+        ptm->tm_hour < 0 || ptm->tm_hour > 23 ||
+        ptm->tm_min  < 0 || ptm->tm_min  > 59 ||
+        ptm->tm_sec  < 0 || ptm->tm_sec  > 59)
+    {
+        return FALSE;
+    }
+
+    date->OCIDateYYYY = (sb2) year;
+    date->OCIDateMM   = (ub1) (ptm->tm_mon + 1);
+    date->OCIDateDD   = (ub1) ptm->tm_mday;
+
+    date->OCIDateTime.OCITimeHH = (ub1) ptm->tm_hour;
+    date->OCIDateTime.OCITimeMI = (ub1) ptm->tm_min;
+    date->OCIDateTime.OCITimeSS = (ub1) ptm->tm_sec;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateOCIDateToTm
+ * --------------------------------------------------------------------------------------------- */
+
+void DateOCIDateToTm
+(
+    const OCIDate *date,
+    struct tm     *ptm
+)
+{
+    const big_int days = DateDaysFromCivil(date->OCIDateYYYY, date->OCIDateMM, date->OCIDateDD);
+
+    memset(ptm, 0, sizeof(*ptm));
+
+    ptm->tm_year = date->OCIDateYYYY - 1900;
+    ptm->tm_mon  = date->OCIDateMM - 1;
+    ptm->tm_mday = date->OCIDateDD;
+
+    ptm->tm_hour = date->OCIDateTime.OCITimeHH;
+    ptm->tm_min  = date->OCIDateTime.OCITimeMI;
+    ptm->tm_sec  = date->OCIDateTime.OCITimeSS;
+
+    /* 1970-01-01 was a thursday */
+
+    ptm->tm_wday  = (int) (((days % 7) + 11) % 7);
+    ptm->tm_yday  = (int) (days - DateDaysFromCivil(date->OCIDateYYYY, 1, 1));
+    ptm->tm_isdst = 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateOCIDateToWire
+ * --------------------------------------------------------------------------------------------- */
+
+void DateOCIDateToWire
+(
+    const OCIDate *date,
+    ub1           *buffer
+)
+{
+    /* Oracle DATE internal format : excess 100 century and year,
+       month, day and excess 1 hour, minute and second */
+
+    buffer[0] = (ub1) (date->OCIDateYYYY / 100 + 100);
+    buffer[1] = (ub1) (date->OCIDateYYYY % 100 + 100);
+    buffer[2] = date->OCIDateMM;
+    buffer[3] = date->OCIDateDD;
+    buffer[4] = (ub1) (date->OCIDateTime.OCITimeHH + 1);
+    buffer[5] = (ub1) (date->OCIDateTime.OCITimeMI + 1);
+    buffer[6] = (ub1) (date->OCIDateTime.OCITimeSS + 1);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateWireToOCIDate
+ * --------------------------------------------------------------------------------------------- */
+
+void DateWireToOCIDate
+(
+    const ub1 *buffer,
+    OCIDate   *date
+)
+{
+    date->OCIDateYYYY = (sb2) (((buffer[0] - 100) * 100) + (buffer[1] - 100));
+    date->OCIDateMM   = buffer[2];
+    date->OCIDateDD   = buffer[3];
+
+    date->OCIDateTime.OCITimeHH = (ub1) (buffer[4] - 1);
+    date->OCIDateTime.OCITimeMI = (ub1) (buffer[5] - 1);
+    date->OCIDateTime.OCITimeSS = (ub1) (buffer[6] - 1);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateGetFormatField
+ * --------------------------------------------------------------------------------------------- */
+
+static int DateGetFormatField
+(
+    const otext *fmt,
+    size_t      *len
+)
+{
+    for (int i = 0; i < (int) (sizeof(DateFormatFields) / sizeof(DateFormatFields[0])); i++)
+    {
+        const otext *name = DateFormatFields[i];
+
+        size_t n = 0;
+
+        while (0 != name[n] && (otext) otoupper(fmt[n]) == name[n])
+        {
+            n++;
+        }
+
+        if (0 == name[n])
+        {
+            *len = n;
+
+            return i;
+        }
+    }
+
+    *len = 1;
+
+    switch (*fmt)
+    {
+        case OTEXT(' '):
+        case OTEXT('-'):
+        case OTEXT('/'):
+        case OTEXT(','):
+        case OTEXT('.'):
+        case OTEXT(';'):
+        case OTEXT(':'):
+        {
+            return DATE_FORMAT_SEPARATOR;
+        }
+    }
+
+    return DATE_FORMAT_UNKNOWN;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateIsParsableFormat
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DateIsParsableFormat
+(
+    const otext *fmt
+)
+{
+    int mask = 0;
+
+    if (NULL == fmt)
+    {
+        return FALSE;
+    }
+
+    /* only numeric elements that does not depend on NLS settings can be parsed
+       and the day must be fully specified */
+
+    while (0 != *fmt)
+    {
+        size_t len = 0;
+
+        const int field = DateGetFormatField(fmt, &len);
+
+        if (DATE_FORMAT_UNKNOWN == field || (field >= 0 && (mask & (1 << field))))
+        {
+            return FALSE;
+        }
+
+        if (field >= 0)
+        {
+            mask |= 1 << field;
+        }
+
+        fmt += len;
+    }
+
+    return DATE_FORMAT_DAY_MASK == (mask & DATE_FORMAT_DAY_MASK);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DateParseString
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DateParseString
+(
+    const otext *str,
+    const otext *fmt,
+    OCIDate     *date
+)
+{
+    /* converts a string to a date using a format accepted by DateIsParsableFormat()
+       without any OCI call. Like Oracle, separators are not required to match
+       the format and missing time elements default to 0 */
+
+    int values[sizeof(DateFormatWidths) / sizeof(DateFormatWidths[0])] = { 0 };
+    int mask = 0;
+
+    big_int days = 0;
+
+    const otext *p = str;
+
+    while (OTEXT(' ') == *p)
+    {
+        p++;
+    }
+
+    while (0 != *fmt)
+    {
+        size_t len = 0;
+        int    n   = 0;
+
+        const int field = DateGetFormatField(fmt, &len);
+
+        fmt += len;
+
+        if (DATE_FORMAT_UNKNOWN == field)
+        {
+            return FALSE;
+        }
+
+        if (DATE_FORMAT_SEPARATOR == field)
+        {
+            if (DATE_FORMAT_SEPARATOR == DateGetFormatField(p, &len))
+            {
+                p++;
+            }
+
+            continue;
+        }
+
+        if (0 == *p)
+        {
+            break;
+        }
+
+        for (; n < DateFormatWidths[field] && *p >= OTEXT('0') && *p <= OTEXT('9'); n++, p++)
+        {
+            values[field] = values[field] * 10 + (int) (*p - OTEXT('0'));
+        }
+
+        if (0 == n)
+        {
+            return FALSE;
+        }
+
+        mask |= 1 << field;
+    }
+
+    while (OTEXT(' ') == *p)
+    {
+        p++;
+    }
+
+    if (0 != *p || DATE_FORMAT_DAY_MASK != (mask & DATE_FORMAT_DAY_MASK))
+    {
+        return FALSE;
+    }
+
+    /* dates before the gregorian calendar adoption are left to Oracle */
+
+    if (values[0] < 1583 || values[0] > OCI_DATE_YEAR_MAX || values[1] < 1 || values[1] > 12 ||
+        values[2] < 1 || values[3] > 23 || values[4] > 59 || values[5] > 59)
+    {
+        return FALSE;
+    }
+
+    days = (values[1] < 12) ? DateDaysFromCivil(values[0], values[1] + 1, 1) :
+                              DateDaysFromCivil(values[0] + 1, 1, 1);
+
+    if (values[2] > days - DateDaysFromCivil(values[0], values[1], 1))
+    {
+        return FALSE;
+    }
+
+    date->OCIDateYYYY = (sb2) values[0];
+    date->OCIDateMM   = (ub1) values[1];
+    date->OCIDateDD   = (ub1) values[2];
+
+    date->OCIDateTime.OCITimeHH = (ub1) values[3];
+    date->OCIDateTime.OCITimeMI = (ub1) values[4];
+    date->OCIDateTime.OCITimeSS = (ub1) values[5];
+
+    return TRUE;
+}
@@ -194,4 +194,66 @@ boolean DateFromCTime
     time_t     t
 );
 
+boolean DateEpochToOCIDate
+(
+    big_int  seconds,
+    OCIDate *date
+);
+
+big_int DateOCIDateToEpoch
+(
+    const OCIDate *date
+);
+
+void DateEpochSplit
+(
+    big_int      value,
+    unsigned int unit,
+    big_int     *seconds,
+    ub4         *fsec
+);
+
+big_int DateEpochJoin
+(
+    big_int      seconds,
+    ub4          fsec,
+    unsigned int unit
+);
+
+boolean DateTmToOCIDate
+(
+    const struct tm *ptm,
+    OCIDate         *date
+);
+
+void DateOCIDateToTm
+(
+    const OCIDate *date,
+    struct tm     *ptm
+);
+
+void DateOCIDateToWire
+(
+    const OCIDate *date,
+    ub1           *buffer
+);
+
+void DateWireToOCIDate
+(
+    const ub1 *buffer,
+    OCIDate   *date
+);
+
+boolean DateIsParsableFormat
+(
+    const otext *fmt
+);
+
+boolean DateParseString
+(
+    const otext *str,
+    const otext *fmt,
+    OCIDate     *date
+);
+
 #endif /* OCILIB_DATE_H_INCLUDED */
@@ -200,6 +200,57 @@ boolean DefineIsDataNotNull
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * DefineCheckInlineLob
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DefineCheckInlineLob
+(
+    OCI_Define *def
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DEFINE, def
+    )
+
+    CHECK_PTR(OCI_IPC_DEFINE, def)
+
+    /* LOBs fetched in OCI_LOB_INLINE mode are truncated by OCI when larger than
+       the inline size. Such values are reported instead of being returned truncated */
+
+    if (def->rs->row_cur > 0 && OCI_CDT_LOB != def->col.datatype &&
+        (SQLT_CLOB == def->col.sqlcode || SQLT_BLOB == def->col.sqlcode))
+    {
+        const OCIInd ind = def->buf.inds[def->rs->row_cur - 1];
+        const ub4    len = (ub4) ((ub2 *) def->buf.lens)[def->rs->row_cur - 1];
+
+        const ub2 char_size = (ub2) (Env.nls_utf8 ? OCI_UTF8_BYTES_PER_CHAR : sizeof(otext));
+
+        /* a positive indicator holds the length before truncation, -2 a length
+           too large for the indicator. Raw buffers have room for a few more bytes */
+
+        if (OCI_CDT_RAW == def->col.datatype)
+        {
+            const ub4 max = def->col.bufsize - (ub4) sizeof(otext);
+
+            if (ind > 0 || -2 == ind || len > max)
+            {
+                THROW(ExceptionMaximumValue, (int) max)
+            }
+        }
+        else if (ind > 0 || -2 == ind)
+        {
+            THROW(ExceptionMaximumValue, (int) (def->col.bufsize / char_size - 1))
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * DefineGetNumber
  * --------------------------------------------------------------------------------------------- */
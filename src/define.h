@@ -45,6 +45,11 @@ boolean DefineIsDataNotNull
     OCI_Define* def
 );
 
+boolean DefineCheckInlineLob
+(
+    OCI_Define* def
+);
+
 boolean DefineGetNumber
 (
     OCI_Resultset* rs,
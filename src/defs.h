@@ -187,31 +187,37 @@ typedef unsigned short dbtext;
 
 /* ---- Internal pointers ----- */
 
-#define OCI_IPC_LIST             41
-#define OCI_IPC_LIST_ITEM        42
-#define OCI_IPC_BIND_ARRAY       43
-#define OCI_IPC_DEFINE           44
-#define OCI_IPC_DEFINE_ARRAY     45
-#define OCI_IPC_HASHENTRY        46
-#define OCI_IPC_HASHENTRY_ARRAY  47
-#define OCI_IPC_HASHVALUE        48
-#define OCI_IPC_THREADKEY        49
-#define OCI_IPC_OCIDATE          50
-#define OCI_IPC_TM               51
-#define OCI_IPC_RESULTSET_ARRAY  52
-#define OCI_IPC_PLS_SIZE_ARRAY   53
-#define OCI_IPC_PLS_RCODE_ARRAY  54
-#define OCI_IPC_SERVER_OUPUT     55
-#define OCI_IPC_INDICATOR_ARRAY  56
-#define OCI_IPC_LEN_ARRAY        57
-#define OCI_IPC_BUFF_ARRAY       58
-#define OCI_IPC_LONG_BUFFER      59
-#define OCI_IPC_TRACE_INFO       60
-#define OCI_IPC_DP_COL_ARRAY     61
-#define OCI_IPC_BATCH_ERRORS     62
-#define OCI_IPC_STATEMENT_ARRAY  63
-
-#define OCI_IPC_COUNT            (OCI_IPC_STATEMENT_ARRAY + 2)
+#define OCI_IPC_LIST             43
+#define OCI_IPC_LIST_ITEM        44
+#define OCI_IPC_BIND_ARRAY       45
+#define OCI_IPC_DEFINE           46
+#define OCI_IPC_DEFINE_ARRAY     47
+#define OCI_IPC_HASHENTRY        48
+#define OCI_IPC_HASHENTRY_ARRAY  49
+#define OCI_IPC_HASHVALUE        50
+#define OCI_IPC_THREADKEY        51
+#define OCI_IPC_OCIDATE          52
+#define OCI_IPC_TM               53
+#define OCI_IPC_RESULTSET_ARRAY  54
+#define OCI_IPC_PLS_SIZE_ARRAY   55
+#define OCI_IPC_PLS_RCODE_ARRAY  56
+#define OCI_IPC_SERVER_OUPUT     57
+#define OCI_IPC_INDICATOR_ARRAY  58
+#define OCI_IPC_LEN_ARRAY        59
+#define OCI_IPC_BUFF_ARRAY       60
+#define OCI_IPC_LONG_BUFFER      61
+#define OCI_IPC_TRACE_INFO       62
+#define OCI_IPC_DP_COL_ARRAY     63
+#define OCI_IPC_BATCH_ERRORS     64
+#define OCI_IPC_STATEMENT_ARRAY  65
+#define OCI_IPC_RCACHE           66
+#define OCI_IPC_RCACHE_ENTRY     67
+#define OCI_IPC_PCACHE           68
+#define OCI_IPC_PROFILER         69
+#define OCI_IPC_DCACHE           70
+#define OCI_IPC_BATCHER_COLS     71
+
+#define OCI_IPC_COUNT            (OCI_IPC_BATCHER_COLS + 2)
 
 /* --------------------------------------------------------------------------------------------- *
  * Oracle conditional features
@@ -252,6 +258,14 @@ typedef unsigned short dbtext;
 
 #define OCI_STMT_STATES_COUNT           5
 
+/* --------------------------------------------------------------------------------------------- *
+ * asynchronous operations
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_ASYNC_OP_NONE               0
+#define OCI_ASYNC_OP_EXECUTE            1
+#define OCI_ASYNC_OP_FETCH              2
+
 /* --------------------------------------------------------------------------------------------- *
  * connection states
  * --------------------------------------------------------------------------------------------- */
@@ -297,6 +311,33 @@ typedef unsigned short dbtext;
 
 #define OCI_DPS_COUNT                   OCI_DPS_TERMINATED
 
+/* number of streams converted and loaded alternatively in pipelined mode */
+
+#define OCI_DIRPATH_SLOTS               2
+
+/* initial read buffer size of delimited file loads */
+#define OCI_DIRPATH_FILE_BUFFER         (1024 * 1024)
+
+/* --------------------------------------------------------------------------------------------- *
+ * Arrow C data interface value types
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_ARW_UNKNOWN                 0
+#define OCI_ARW_INT16                   1
+#define OCI_ARW_UINT16                  2
+#define OCI_ARW_INT32                   3
+#define OCI_ARW_UINT32                  4
+#define OCI_ARW_INT64                   5
+#define OCI_ARW_UINT64                  6
+#define OCI_ARW_FLOAT                   7
+#define OCI_ARW_DOUBLE                  8
+#define OCI_ARW_UTF8                    9
+#define OCI_ARW_BINARY                  10
+#define OCI_ARW_TIMESTAMP               11
+
+/* maximum size of Arrow numeric and timestamp values converted to text */
+#define OCI_ARW_TEXT_SIZE               64
+
 /* --------------------------------------------------------------------------------------------- *
  * internal statement fetch direction
  * --------------------------------------------------------------------------------------------- */
@@ -314,6 +355,22 @@ typedef unsigned short dbtext;
 #define OCI_DDT_BINARY                  2
 #define OCI_DDT_NUMBER                  3
 #define OCI_DDT_OTHERS                  4
+#define OCI_DDT_DATE                    5
+
+/* --------------------------------------------------------------------------------------------- *
+ * direct path client side conversion status of a value
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_DCV_NONE                    0
+#define OCI_DCV_PENDING                 1
+#define OCI_DCV_OCI                     2
+
+/* --------------------------------------------------------------------------------------------- *
+ * Oracle internal formats
+ * --------------------------------------------------------------------------------------------- */
+
+/* maximum number of base 100 digits of a NUMBER mantissa */
+#define OCI_NUMBER_MAX_DIGITS           20
 
 /* --------------------------------------------------------------------------------------------- *
  *  output buffer server line size
@@ -322,6 +379,20 @@ typedef unsigned short dbtext;
 #define OCI_OUPUT_LSIZE                 255
 #define OCI_OUPUT_LSIZE_10G             32767
 
+/* --------------------------------------------------------------------------------------------- *
+ *  lob streaming piece size (rounded to a multiple of the lob chunk size)
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_SIZE_LOB_STREAM             (256 * 1024)
+
+/* --------------------------------------------------------------------------------------------- *
+ *  Oracle DATE internal format
+ * --------------------------------------------------------------------------------------------- */
+
+#define OCI_DATE_WIRE_SIZE              7
+#define OCI_DATE_YEAR_MIN               1
+#define OCI_DATE_YEAR_MAX               9999
+
 /* --------------------------------------------------------------------------------------------- *
 *  Undocumented OCI SQL TYPES
 * --------------------------------------------------------------------------------------------- */
@@ -0,0 +1,491 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "describecache.h"
+
+#include "helpers.h"
+#include "macros.h"
+#include "memory.h"
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheUnlink
+ * --------------------------------------------------------------------------------------------- */
+
+static void DescribeCacheUnlink(OCI_DescribeCache *cache, OCI_DescribeEntry *entry)
+{
+    if (NULL != entry->prev)
+    {
+        entry->prev->next = entry->next;
+    }
+    else
+    {
+        cache->head = entry->next;
+    }
+
+    if (NULL != entry->next)
+    {
+        entry->next->prev = entry->prev;
+    }
+    else
+    {
+        cache->tail = entry->prev;
+    }
+
+    entry->prev = NULL;
+    entry->next = NULL;
+
+    cache->count--;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheLink
+ * --------------------------------------------------------------------------------------------- */
+
+static void DescribeCacheLink(OCI_DescribeCache *cache, OCI_DescribeEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = cache->head;
+
+    if (NULL != cache->head)
+    {
+        cache->head->prev = entry;
+    }
+    else
+    {
+        cache->tail = entry;
+    }
+
+    cache->head = entry;
+    cache->count++;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheEntryFree
+ * --------------------------------------------------------------------------------------------- */
+
+static void DescribeCacheEntryFree(OCI_DescribeEntry *entry)
+{
+    if (NULL != entry->cols)
+    {
+        for (ub4 i = 0; i < entry->nb_cols; i++)
+        {
+            FREE(entry->cols[i].name)
+        }
+    }
+
+    FREE(entry->cols)
+    FREE(entry->sql)
+    FREE(entry)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheEvict
+ * --------------------------------------------------------------------------------------------- */
+
+static void DescribeCacheEvict(OCI_DescribeCache *cache, unsigned int size)
+{
+    while (cache->count > size && NULL != cache->tail)
+    {
+        OCI_DescribeEntry *entry = cache->tail;
+
+        DescribeCacheUnlink(cache, entry);
+        DescribeCacheEntryFree(entry);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheFind
+ * --------------------------------------------------------------------------------------------- */
+
+static OCI_DescribeEntry * DescribeCacheFind(OCI_DescribeCache *cache, const otext *sql)
+{
+    const unsigned int hash = ComputeStringHash(sql);
+
+    for (OCI_DescribeEntry *entry = cache->head; NULL != entry; entry = entry->next)
+    {
+        if (entry->hash == hash && 0 == ostrcmp(entry->sql, sql))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheMatch
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DescribeCacheMatch(OCI_Statement *stmt, const OCI_DescribeEntry *entry)
+{
+    boolean match = TRUE;
+
+    /* the implicit describe of the select list is available locally once the statement is
+       executed : getting the type and size of each column does not need a server call */
+
+    for (ub4 i = 0; i < entry->nb_cols && match; i++)
+    {
+        const OCI_Column *col = &entry->cols[i];
+
+        void *param   = NULL;
+        ub2   sqlcode = 0;
+        ub2   size    = 0;
+        sb2   prec    = 0;
+        sb1   scale   = 0;
+
+        match = (OCI_SUCCESS == OCIParamGet((dvoid *) stmt->stmt, OCI_HTYPE_STMT, stmt->con->err,
+                                            (void **) &param, (ub4) (i + 1)));
+
+        match = match && (OCI_SUCCESS == OCIAttrGet(param, OCI_DTYPE_PARAM, &sqlcode, NULL,
+                                                    OCI_ATTR_DATA_TYPE, stmt->con->err));
+
+        match = match && (OCI_SUCCESS == OCIAttrGet(param, OCI_DTYPE_PARAM, &size, NULL,
+                                                    OCI_ATTR_DATA_SIZE, stmt->con->err));
+
+        match = match && (OCI_SUCCESS == OCIAttrGet(param, OCI_DTYPE_PARAM, &prec, NULL,
+                                                    OCI_ATTR_PRECISION, stmt->con->err));
+
+        match = match && (OCI_SUCCESS == OCIAttrGet(param, OCI_DTYPE_PARAM, &scale, NULL,
+                                                    OCI_ATTR_SCALE, stmt->con->err));
+
+#if OCI_VERSION_COMPILE >= OCI_12_1
+
+        if (SQLT_UNDOCUMENTED_REC == sqlcode)
+        {
+            sqlcode = SQLT_REC;
+        }
+
+#endif
+
+        /* a zero size is replaced by the buffer size when mapping the column */
+
+        match = match && sqlcode == col->sqlcode && prec == col->prec && scale == col->scale &&
+                (size == col->size || (0 == size && col->size == (ub2) col->bufsize));
+
+        if (NULL != param)
+        {
+            OCIDescriptorFree(param, OCI_DTYPE_PARAM);
+        }
+    }
+
+    return match;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheSetSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DescribeCacheSetSize
+(
+    OCI_Connection *con,
+    unsigned int    size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    if (NULL == con->dcache)
+    {
+        if (0 == size)
+        {
+            SET_SUCCESS()
+            JUMP_EXIT()
+        }
+
+        ALLOC_DATA(OCI_IPC_DCACHE, con->dcache, 1)
+    }
+
+    DescribeCacheEvict(con->dcache, size);
+
+    if (0 == size)
+    {
+        FREE(con->dcache)
+    }
+    else
+    {
+        con->dcache->max_size = size;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheGetSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DescribeCacheGetSize
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->dcache ? con->dcache->max_size : 0)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheGetHits
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DescribeCacheGetHits
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->dcache ? con->dcache->hits : 0)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheGetMisses
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DescribeCacheGetMisses
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->dcache ? con->dcache->misses : 0)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheClear
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DescribeCacheClear
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    if (NULL != con->dcache)
+    {
+        DescribeCacheEvict(con->dcache, 0);
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheLookup
+ * --------------------------------------------------------------------------------------------- */
+
+const OCI_Column * DescribeCacheLookup
+(
+    OCI_Statement *stmt,
+    ub4            nb_cols
+)
+{
+    OCI_DescribeCache *cache = stmt->con->dcache;
+
+    if (NULL == cache || !IS_STRING_VALID(stmt->sql))
+    {
+        return NULL;
+    }
+
+    OCI_DescribeEntry *entry = DescribeCacheFind(cache, stmt->sql);
+
+    /* a different number of columns means the select list has changed */
+
+    if (NULL == entry || entry->nb_cols != nb_cols ||
+        entry->long_mode != stmt->long_mode || entry->lob_mode != stmt->lob_mode ||
+        entry->lob_size != stmt->lob_inline_size)
+    {
+        cache->misses++;
+
+        return NULL;
+    }
+
+    /* the same number of columns with different types or sizes (altered table or view, ...) */
+
+    if (!DescribeCacheMatch(stmt, entry))
+    {
+        DescribeCacheUnlink(cache, entry);
+        DescribeCacheEntryFree(entry);
+
+        cache->misses++;
+
+        return NULL;
+    }
+
+    /* move it to the head of the LRU list */
+
+    DescribeCacheUnlink(cache, entry);
+    DescribeCacheLink(cache, entry);
+
+    cache->hits++;
+
+    return entry->cols;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheStore
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DescribeCacheStore
+(
+    OCI_Resultset *rs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    OCI_Statement     *stmt  = rs->stmt;
+    OCI_DescribeCache *cache = stmt->con->dcache;
+    OCI_DescribeEntry *entry = NULL;
+
+    if (NULL == cache || !IS_STRING_VALID(stmt->sql) || 0 == rs->nb_defs)
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    /* named type descriptors can be freed by the program, so they cannot be cached */
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        if (NULL != rs->defs[i].col.typinf)
+        {
+            SET_SUCCESS()
+            JUMP_EXIT()
+        }
+    }
+
+    /* replace any outdated entry */
+
+    DescribeCacheRemove(stmt);
+
+    ALLOC_DATA(OCI_IPC_DCACHE, entry, 1)
+    ALLOC_DATA(OCI_IPC_COLUMN, entry->cols, rs->nb_defs)
+
+    entry->sql       = ostrdup(stmt->sql);
+    entry->hash      = ComputeStringHash(stmt->sql);
+    entry->long_mode = stmt->long_mode;
+    entry->lob_mode  = stmt->lob_mode;
+    entry->lob_size  = stmt->lob_inline_size;
+    entry->nb_cols   = rs->nb_defs;
+
+    for (ub4 i = 0; i < entry->nb_cols; i++)
+    {
+        entry->cols[i]      = rs->defs[i].col;
+        entry->cols[i].name = ostrdup(rs->defs[i].col.name);
+    }
+
+    DescribeCacheLink(cache, entry);
+    DescribeCacheEvict(cache, cache->max_size);
+
+    entry = NULL;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != entry)
+        {
+            DescribeCacheEntryFree(entry);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheRemove
+ * --------------------------------------------------------------------------------------------- */
+
+void DescribeCacheRemove
+(
+    OCI_Statement *stmt
+)
+{
+    OCI_DescribeCache *cache = stmt ? stmt->con->dcache : NULL;
+
+    if (NULL != cache && IS_STRING_VALID(stmt->sql))
+    {
+        OCI_DescribeEntry *entry = DescribeCacheFind(cache, stmt->sql);
+
+        if (NULL != entry)
+        {
+            DescribeCacheUnlink(cache, entry);
+            DescribeCacheEntryFree(entry);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DescribeCacheFree
+ * --------------------------------------------------------------------------------------------- */
+
+void DescribeCacheFree
+(
+    OCI_Connection *con
+)
+{
+    if (NULL != con && NULL != con->dcache)
+    {
+        DescribeCacheEvict(con->dcache, 0);
+
+        FREE(con->dcache)
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_DESCRIBECACHE_H_INCLUDED
+#define OCILIB_DESCRIBECACHE_H_INCLUDED
+
+#include "types.h"
+
+boolean DescribeCacheSetSize
+(
+    OCI_Connection *con,
+    unsigned int    size
+);
+
+unsigned int DescribeCacheGetSize
+(
+    OCI_Connection *con
+);
+
+unsigned int DescribeCacheGetHits
+(
+    OCI_Connection *con
+);
+
+unsigned int DescribeCacheGetMisses
+(
+    OCI_Connection *con
+);
+
+boolean DescribeCacheClear
+(
+    OCI_Connection *con
+);
+
+const OCI_Column * DescribeCacheLookup
+(
+    OCI_Statement *stmt,
+    ub4            nb_cols
+);
+
+boolean DescribeCacheStore
+(
+    OCI_Resultset *rs
+);
+
+void DescribeCacheRemove
+(
+    OCI_Statement *stmt
+);
+
+void DescribeCacheFree
+(
+    OCI_Connection *con
+);
+
+#endif /* OCILIB_DESCRIBECACHE_H_INCLUDED */
@@ -20,10 +20,14 @@
 
 #include "dirpath.h"
 
+#include "arrow.h"
+#include "date.h"
 #include "macros.h"
 #include "memory.h"
 #include "number.h"
+#include "profiler.h"
 #include "strings.h"
+#include "thread.h"
 
 static const unsigned int ConversionModeValues[] =
 {
@@ -31,6 +35,189 @@ static const unsigned int ConversionModeValues[] =
     OCI_DCM_FORCE
 };
 
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathIsZeroCopy
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathIsZeroCopy
+(
+    OCI_DirPathColumn *dpcol
+)
+{
+    /* caller memory can be used in place only if no client side conversion is needed */
+
+    switch (dpcol->type)
+    {
+        case OCI_DDT_BINARY:
+        {
+            return TRUE;
+        }
+        case OCI_DDT_TEXT:
+        {
+            return !Env.use_wide_char_conv;
+        }
+        case OCI_DDT_OTHERS:
+        {
+            return OCI_CHAR_WIDE != Env.charset;
+        }
+    }
+
+    return FALSE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathRecord
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathRecord
+(
+    OCI_DirPath *dp,
+    unsigned int phase,
+    big_uint     start
+)
+{
+    ProfilerUpdatePhase(&dp->stats.phases[phase], ProfilerClock() - start);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathNotifyProgress
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathNotifyProgress
+(
+    OCI_DirPath *dp,
+    boolean      force
+)
+{
+    if (NULL != dp->progress)
+    {
+        const big_uint now = ProfilerClock();
+
+        if (force || (now - dp->progress_last) >= dp->progress_step)
+        {
+            dp->progress_last = now;
+            dp->progress(dp, &dp->stats, dp->progress_ctx);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathGetVectorEntry
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathGetVectorEntry
+(
+    OCI_DirPathColumn *dpcol,
+    ub1               *vdata,
+    ub4                vsize,
+    ub4               *vlens,
+    ub1               *vnulls,
+    ub4                row,
+    void             **value,
+    unsigned int      *size
+)
+{
+    const ub4 bit = dpcol->ext_bit + row;
+
+    *value = NULL;
+    *size  = 0;
+
+    /* a set bit in the null bitmap marks a null entry, unless it is a validity bitmap */
+
+    if (NULL == vnulls || (0 == (vnulls[bit / 8] & (1 << (bit % 8)))) != (boolean) dpcol->ext_valid)
+    {
+        if (NULL != dpcol->ext_offs)
+        {
+            /* variable size elements stored back to back */
+
+            *value = vdata + dpcol->ext_offs[row];
+            *size  = (unsigned int) (dpcol->ext_offs[row + 1] - dpcol->ext_offs[row]);
+
+            return;
+        }
+
+        *value = vdata + (size_t) row * vsize;
+
+        if (NULL != vlens)
+        {
+            *size = vlens[row];
+        }
+        else if (OCI_DDT_BINARY == dpcol->type)
+        {
+            *size = vsize;
+        }
+        else
+        {
+            *size = (unsigned int) ostrlen((otext *) *value);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathGetVectorValue
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathGetVectorValue
+(
+    OCI_DirPathColumn *dpcol,
+    ub4                row,
+    ub1              **data,
+    ub4               *size
+)
+{
+    void        *value = NULL;
+    unsigned int len   = 0;
+
+    DirPathGetVectorEntry(dpcol, dpcol->ext_data, dpcol->ext_size, dpcol->ext_lens,
+                          dpcol->ext_nulls, row, &value, &len);
+
+    /* program vectors lengths are given in characters for text values
+       while offsets based vectors are already expressed in bytes */
+
+    if (OCI_DDT_BINARY != dpcol->type && NULL == dpcol->ext_offs)
+    {
+        len *= (unsigned int) sizeof(otext);
+    }
+
+    *data = (ub1 *) value;
+    *size = (ub4) len;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathCheckVectorValue
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathCheckVectorValue
+(
+    OCI_DirPath       *dp,
+    OCI_DirPathColumn *dpcol,
+    ub4                row
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    ub1 *data = NULL;
+    ub4  size = 0;
+
+    DirPathGetVectorValue(dpcol, row, &data, &size);
+
+    /* values cannot be clipped in the caller memory, an over long value
+       is rejected like a value that OCI would fail to convert */
+
+    if (OCI_DCM_DEFAULT == dp->cvt_mode)
+    {
+        CHECK_MAX(size, dpcol->maxsize)
+    }
+
+    SET_RETVAL(size <= dpcol->maxsize)
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * DirPathSetArray
  * --------------------------------------------------------------------------------------------- */
@@ -38,7 +225,8 @@ static const unsigned int ConversionModeValues[] =
 boolean DirPathSetArray
 (
     OCI_DirPath *dp,
-    ub4          row_from
+    ub4          row_from,
+    ub4          row_to
 )
 {
     ENTER_FUNC
@@ -61,34 +249,55 @@ boolean DirPathSetArray
 
     /* set entries */
 
-    for (row = row_from; row < dp->nb_cur; row++)
+    for (row = row_from; row < row_to; row++)
     {
+        ub1 **values = NULL;
+        ub4  *lens   = NULL;
+        ub1  *flags  = NULL;
+
+        /* all entries of the row are set in place in the column array */
+
+        CHECK_OCI
+        (
+            dp->con->err,
+            OCIDirPathColArrayRowGet,
+            dp->arr, dp->con->err, (ub4) dp->nb_entries,
+            &values, &lens, &flags
+        )
+
         for (col = 0; col < dp->nb_cols; col++)
         {
             OCI_DirPathColumn *dpcol = &(dp->cols[col]);
 
-            /* get internal data cell */
+            if (NULL != dpcol->ext_data)
+            {
+                /* caller column vector, values sizes being checked by DirPathConvertRows() */
 
-            data = ((ub1 *) dpcol->data) + (size_t) (row * dpcol->bufsize);
-            size = dpcol->lens[row];
-            flag = dpcol->flags[row];
+                DirPathGetVectorValue(dpcol, row, &data, &size);
 
-            if (SQLT_NUM == dpcol->sqlcode)
+                flag = (NULL != data) ? OCI_DIRPATH_COL_COMPLETE : OCI_DIRPATH_COL_NULL;
+            }
+            else
             {
-                OCINumber *num = (OCINumber *) data;
+                /* get internal data cell */
 
-                data = &num->OCINumberPart[1];
+                data = ((ub1 *) dpcol->data) + (size_t) (row * dpcol->bufsize);
+                size = dpcol->lens[row];
+                flag = dpcol->flags[row];
+
+                if (SQLT_NUM == dpcol->sqlcode)
+                {
+                    OCINumber *num = (OCINumber *) data;
+
+                    data = &num->OCINumberPart[1];
+                }
             }
 
             /* set entry value */
 
-            CHECK_OCI
-            (
-                dp->con->err,
-                OCIDirPathColArrayEntrySet,
-                dp->arr, dp->con->err, (ub4) dp->nb_entries,
-                (ub2) (col), (ub1*) data, (ub4) size, flag
-            )
+            values[col] = data;
+            lens[col]   = size;
+            flags[col]  = flag;
         }
 
         /* increment number of item set */
@@ -207,6 +416,400 @@ unsigned int DirPathArrayToStream
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathConvertTask
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathConvertTask
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_DirPathTask *task = (OCI_DirPathTask *) arg;
+    OCI_DirPath     *dp   = task->dp;
+
+    OCI_NOT_USED(thread)
+
+    /* may run on a worker thread : no OCI call is performed here, values that
+       cannot be converted in C are left to DirPathConvertRows() */
+
+    for (ub2 col = 0; col < dp->nb_cols; col++)
+    {
+        OCI_DirPathColumn *dpcol = &dp->cols[col];
+
+        if (!dpcol->cvt_client)
+        {
+            continue;
+        }
+
+        for (ub4 row = task->row_from; row < task->row_to; row++)
+        {
+            const otext *str  = dpcol->cvt_text + (size_t) row * (dpcol->maxsize + 1);
+            ub1         *data = dpcol->data + (size_t) row * dpcol->bufsize;
+
+            if (OCI_DCV_PENDING != dpcol->cvt_state[row])
+            {
+                continue;
+            }
+
+            dpcol->cvt_state[row] = OCI_DCV_OCI;
+
+            if (OCI_DDT_NUMBER == dpcol->type)
+            {
+                OCINumber *num = (OCINumber *) data;
+
+                if (NumberParseString(str, dpcol->format, num))
+                {
+                    dpcol->lens[row]      = (ub4) num->OCINumberPart[0];
+                    dpcol->cvt_state[row] = OCI_DCV_NONE;
+                }
+            }
+            else
+            {
+                OCIDate date;
+
+                if (DateParseString(str, dpcol->format, &date))
+                {
+                    DateOCIDateToWire(&date, data);
+
+                    dpcol->lens[row]      = OCI_DATE_WIRE_SIZE;
+                    dpcol->cvt_state[row] = OCI_DCV_NONE;
+                }
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathConvertWorker
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathConvertWorker
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_DirPathTask *task = (OCI_DirPathTask *) arg;
+
+    /* the worker converts a range of rows each time it is woken up */
+
+    for (;;)
+    {
+        ThreadEventWait(task->start);
+
+        if (task->stop)
+        {
+            break;
+        }
+
+        DirPathConvertTask(thread, task);
+
+        ThreadEventSet(task->done);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathStartWorkers
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathStartWorkers
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    /* the first task runs on the calling thread, the other ones on worker threads
+       living until the direct path handle is freed */
+
+    for (ub4 i = 1; i < dp->nb_threads; i++)
+    {
+        OCI_DirPathTask *task = &dp->tasks[i];
+
+        task->dp    = dp;
+        task->start = ThreadEventCreate();
+        task->done  = ThreadEventCreate();
+
+        CHECK_NULL(task->start)
+        CHECK_NULL(task->done)
+
+        task->thread = ThreadCreate();
+        CHECK_NULL(task->thread)
+
+        if (!ThreadRun(task->thread, DirPathConvertWorker, task))
+        {
+            ThreadFree(task->thread);
+            task->thread = NULL;
+
+            CHECK(FALSE)
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathStopWorkers
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathStopWorkers
+(
+    OCI_DirPath *dp
+)
+{
+    for (ub4 i = 1; i < dp->nb_threads; i++)
+    {
+        OCI_DirPathTask *task = &dp->tasks[i];
+
+        if (NULL != task->thread)
+        {
+            task->stop = TRUE;
+
+            ThreadEventSet(task->start);
+            ThreadJoin(task->thread);
+            ThreadFree(task->thread);
+
+            task->thread = NULL;
+        }
+
+        ThreadEventFree(task->start);
+        ThreadEventFree(task->done);
+
+        task->start = NULL;
+        task->done  = NULL;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathConvertValues
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathConvertValues
+(
+    OCI_DirPath *dp,
+    ub4          row_from
+)
+{
+    const ub4 nb_rows  = dp->nb_cur - row_from;
+    const ub4 nb_tasks = min(max(dp->nb_threads, 1), nb_rows);
+
+    /* rows are split in ranges converted in parallel by the workers started by
+       DirPathPrepare(), the calling thread converting the first one */
+
+    for (ub4 i = 0; i < nb_tasks; i++)
+    {
+        OCI_DirPathTask *task = &dp->tasks[i];
+
+        task->dp       = dp;
+        task->row_from = row_from + (ub4) (((big_uint) nb_rows * i) / nb_tasks);
+        task->row_to   = row_from + (ub4) (((big_uint) nb_rows * (i + 1)) / nb_tasks);
+
+        if (i > 0)
+        {
+            ThreadEventSet(task->start);
+        }
+    }
+
+    if (nb_tasks > 0)
+    {
+        DirPathConvertTask(NULL, &dp->tasks[0]);
+    }
+
+    for (ub4 i = 1; i < nb_tasks; i++)
+    {
+        ThreadEventWait(dp->tasks[i].done);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathConvertValue
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathConvertValue
+(
+    OCI_DirPath       *dp,
+    OCI_DirPathColumn *dpcol,
+    ub4                row
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    dbtext *dbstr1  = NULL;
+    dbtext *dbstr2  = NULL;
+    int     dbsize1 = -1;
+    int     dbsize2 = -1;
+
+    sword ret = OCI_SUCCESS;
+
+    const otext *str  = dpcol->cvt_text + (size_t) row * (dpcol->maxsize + 1);
+    ub1         *data = dpcol->data + (size_t) row * dpcol->bufsize;
+
+    /* value rejected by the C conversion, using the column format with OCI */
+
+    dbstr1 = StringGetDBString(str, &dbsize1);
+    dbstr2 = StringGetDBString(dpcol->format, &dbsize2);
+
+    if (OCI_DDT_NUMBER == dpcol->type)
+    {
+        OCINumber *num = (OCINumber *) data;
+
+        ret = OCINumberFromText(dp->con->err,
+                                (oratext *) dbstr1, (ub4) dbsize1,
+                                (oratext *) dbstr2, (ub4) dbsize2,
+                                (oratext *) NULL, (ub4) 0, num);
+
+        if (!OCI_FAILURE(ret))
+        {
+            dpcol->lens[row] = (ub4) num->OCINumberPart[0];
+        }
+    }
+    else
+    {
+        OCIDate date;
+
+        ret = OCIDateFromText(dp->con->err,
+                              (oratext *) dbstr1, (ub4) dbsize1,
+                              (oratext *) dbstr2, (ub1) dbsize2,
+                              (oratext *) NULL, (ub4) 0, &date);
+
+        if (!OCI_FAILURE(ret))
+        {
+            DateOCIDateToWire(&date, data);
+
+            dpcol->lens[row] = OCI_DATE_WIRE_SIZE;
+        }
+    }
+
+    /* in force mode, the rejected value is reported as the load error row
+       without raising an error */
+
+    if (OCI_FAILURE(ret))
+    {
+        if (OCI_DCM_FORCE == dp->cvt_mode)
+        {
+            CHECK(FALSE)
+        }
+
+        THROW(ExceptionOCI, dp->con->err, ret)
+    }
+
+    dpcol->cvt_state[row] = OCI_DCV_NONE;
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        StringReleaseDBString(dbstr1);
+        StringReleaseDBString(dbstr2);
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathConvertRows
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathConvertRows
+(
+    OCI_DirPath  *dp,
+    ub4           row_from,
+    unsigned int *status
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    ub4 row_err = dp->nb_cur;
+    ub2 col_err = 0;
+
+    big_uint start = 0;
+
+    /* values left by the client side conversion are converted by OCI and caller vectors
+       values are checked in rows order. In force mode, a rejected value stops the
+       conversion like an OCI conversion error */
+
+    for (ub4 row = row_from; row < row_err; row++)
+    {
+        for (ub2 col = 0; col < dp->nb_cols; col++)
+        {
+            OCI_DirPathColumn *dpcol = &dp->cols[col];
+
+            boolean valid = TRUE;
+
+            if (NULL != dpcol->ext_data)
+            {
+                valid = DirPathCheckVectorValue(dp, dpcol, row);
+            }
+            else if (dpcol->cvt_client && OCI_DCV_OCI == dpcol->cvt_state[row])
+            {
+                valid = DirPathConvertValue(dp, dpcol, row);
+            }
+
+            if (!valid)
+            {
+                CHECK(OCI_DCM_FORCE == dp->cvt_mode)
+
+                row_err = row;
+                col_err = col;
+                break;
+            }
+        }
+    }
+
+    /* set array values */
+
+    start = ProfilerClock();
+
+    CHECK(DirPathSetArray(dp, row_from, row_err))
+
+    DirPathRecord(dp, OCI_DPP_ARRAY, start);
+
+    /* try to convert values from array into stream */
+
+    if (row_err > row_from || row_err == dp->nb_cur)
+    {
+        start = ProfilerClock();
+
+        *status = DirPathArrayToStream(dp, row_from);
+
+        DirPathRecord(dp, OCI_DPP_STREAM, start);
+    }
+    else
+    {
+        *status = OCI_DPR_COMPLETE;
+    }
+
+    /* report the row rejected by the client side conversion like OCI does */
+
+    if (OCI_DPR_COMPLETE == *status && row_err < dp->nb_cur)
+    {
+        dp->err_rows[dp->nb_err] = row_err;
+        dp->err_cols[dp->nb_err] = col_err;
+
+        dp->nb_err++;
+
+        *status = OCI_DPR_ERROR;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * DirPahArrayToStream
  * --------------------------------------------------------------------------------------------- */
@@ -244,44 +847,229 @@ unsigned int DirPathLoadStream
         }
         case OCI_ERROR:
         {
+            /* the error is raised without leaving in order to record the erred row */
+
             status = OCI_DPR_ERROR;
-            THROW(ExceptionOCI, dp->con->err, ret)
+            ExceptionOCI(&call_context, dp->con->err, ret);
+            break;
+        }
+        case OCI_NO_DATA:
+        {
+            status = OCI_DPR_EMPTY;
+            break;
+        }
+        case OCI_NEED_DATA:
+        {
+            status = OCI_DPR_PARTIAL;
+            break;
+        }
+    }
+
+    /* retrieve the number of rows loaded so far */
+
+    CHECK_ATTRIB_GET
+    (
+        OCI_HTYPE_DIRPATH_STREAM, OCI_ATTR_ROW_COUNT,
+        dp->strm, &nb_loaded, &size,
+        dp->con->err
+    )
+
+    dp->nb_loaded    += nb_loaded;
+    dp->nb_processed += nb_loaded;
+
+    /* On failure, record errors rows */
+
+    if (OCI_FAILURE(ret))
+    {
+        dp->err_rows[dp->nb_err] = (dp->nb_err > 0) ? (dp->err_rows[dp->nb_err-1] + nb_loaded + 1) : dp->nb_processed;
+        dp->err_cols[dp->nb_err] = 0;
+        dp->nb_err++;
+    }
+
+    SET_RETVAL(status)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoadSlot
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathLoadSlot
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_DirPathSlot *slot = (OCI_DirPathSlot *) arg;
+    OCI_DirPath     *dp   = slot->dp;
+
+    const big_uint start = ProfilerClock();
+
+    sword ret = OCI_ERROR;
+
+    OCI_NOT_USED(thread)
+
+    /* runs on a background thread : only OCI calls using the slot own error
+       handles are performed here, errors being raised when the load is collected.
+       Each error gets its own handle so that all of them can be reported */
+
+    slot->nb_loaded = 0;
+    slot->nb_err    = 0;
+    slot->res_load  = OCI_DPR_ERROR;
+
+    while (OCI_ERROR == ret && slot->nb_err < dp->nb_cur)
+    {
+        OCIError *err = slot->errs[slot->nb_err];
+
+        ub4 nb_loaded = 0;
+        ub4 size      = sizeof(nb_loaded);
+
+        if (NULL == err)
+        {
+            if (!MemoryAllocHandle((dvoid *) dp->con->env, (dvoid **) (void *) &err, OCI_HTYPE_ERROR))
+            {
+                break;
+            }
+
+            slot->errs[slot->nb_err] = err;
+        }
+
+        ret = OCIDirPathLoadStream(dp->ctx, slot->strm, err);
+
+        OCIAttrGet(slot->strm, OCI_HTYPE_DIRPATH_STREAM, &nb_loaded,
+                   &size, OCI_ATTR_ROW_COUNT, err);
+
+        slot->nb_loaded += nb_loaded;
+
+        /* same error rows reporting than synchronous loads */
+
+        if (OCI_FAILURE(ret))
+        {
+            slot->err_rows[slot->nb_err] = (slot->nb_err > 0) ? (slot->err_rows[slot->nb_err-1] + nb_loaded + 1) : slot->nb_loaded;
+            slot->nb_err++;
+        }
+    }
+
+    switch (ret)
+    {
+        case OCI_SUCCESS:
+        {
+            slot->res_load = OCI_DPR_COMPLETE;
             break;
         }
         case OCI_NO_DATA:
         {
-            status = OCI_DPR_EMPTY;
-            break;
+            slot->res_load = OCI_DPR_EMPTY;
+            break;
+        }
+        case OCI_NEED_DATA:
+        {
+            slot->res_load = OCI_DPR_PARTIAL;
+            break;
+        }
+    }
+
+    slot->elapsed = ProfilerClock() - start;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathJoinLoad
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathJoinLoad
+(
+    OCI_DirPath *dp
+)
+{
+    /* OCI calls using the direct path context are not performed while a stream is loaded
+       in background : the calling thread waits for the load before converting a stream */
+
+    for (ub2 i = 0; i < OCI_DIRPATH_SLOTS; i++)
+    {
+        OCI_DirPathSlot *slot = &dp->slots[i];
+
+        if (NULL != slot->thread)
+        {
+            ThreadJoin(slot->thread);
+            ThreadFree(slot->thread);
+
+            slot->thread = NULL;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathWaitLoad
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathWaitLoad
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    OCI_DirPathSlot *done = NULL;
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+
+    DirPathJoinLoad(dp);
+
+    for (ub2 i = 0; i < OCI_DIRPATH_SLOTS; i++)
+    {
+        if (dp->slots[i].pending)
+        {
+            done = &dp->slots[i];
         }
-        case OCI_NEED_DATA:
+    }
+
+    /* publish the results of the background load like a synchronous one */
+
+    if (NULL != done)
+    {
+        done->pending = FALSE;
+
+        dp->nb_loaded   += done->nb_loaded;
+        dp->nb_processed = done->nb_loaded;
+        dp->res_load     = done->res_load;
+        dp->nb_err       = done->nb_err;
+        dp->idx_err_col  = 0;
+        dp->idx_err_row  = 0;
+
+        for (ub4 i = 0; i < done->nb_err; i++)
         {
-            status = OCI_DPR_PARTIAL;
-            break;
+            dp->err_rows[i] = done->err_rows[i];
+            dp->err_cols[i] = 0;
         }
-    }
 
-    /* retrieve the number of rows loaded so far */
+        ProfilerUpdatePhase(&dp->stats.phases[OCI_DPP_LOAD], done->elapsed);
 
-    CHECK_ATTRIB_GET
-    (
-        OCI_HTYPE_DIRPATH_STREAM, OCI_ATTR_ROW_COUNT,
-        dp->strm, &nb_loaded, &size,
-        dp->con->err
-    )
+        dp->stats.streams++;
+        dp->stats.bytes       += done->bytes;
+        dp->stats.rows_loaded += done->nb_loaded;
+        dp->stats.load_errors += done->nb_err;
 
-    dp->nb_loaded    += nb_loaded;
-    dp->nb_processed += nb_loaded;
+        /* as synchronous loads, each error is raised without leaving. A last partial or
+           empty load is recorded as an erred row too but it is not an error */
 
-    /* On failure, record errors rows */
+        const ub4 nb_raised = (OCI_DPR_PARTIAL == done->res_load || OCI_DPR_EMPTY == done->res_load) &&
+                              done->nb_err > 0 ? done->nb_err - 1 : done->nb_err;
 
-    if (OCI_FAILURE(ret))
-    {
-        dp->err_rows[dp->nb_err] = (dp->nb_err > 0) ? (dp->err_rows[dp->nb_err-1] + nb_loaded + 1) : dp->nb_loaded;
-        dp->err_cols[dp->nb_err] = 0;
-        dp->nb_err++;
+        for (ub4 i = 0; i < nb_raised; i++)
+        {
+            if (NULL != done->errs[i])
+            {
+                ExceptionOCI(&call_context, done->errs[i], OCI_ERROR);
+            }
+        }
     }
 
-    SET_RETVAL(status)
+    SET_SUCCESS()
 
     EXIT_FUNC()
 }
@@ -445,15 +1233,50 @@ boolean DirPathFree
 
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
 
+    /* wait for any background load before releasing the streams */
+
+    CHECK(DirPathWaitLoad(dp))
+
+    if (dp->pipelined)
+    {
+        for (i = 0; i < OCI_DIRPATH_SLOTS; i++)
+        {
+            OCI_DirPathSlot *slot = &dp->slots[i];
+
+            MemoryFreeHandle(slot->strm, OCI_HTYPE_DIRPATH_STREAM);
+
+            if (NULL != slot->errs)
+            {
+                for (ub4 j = 0; j < dp->nb_cur && NULL != slot->errs[j]; j++)
+                {
+                    MemoryFreeHandle(slot->errs[j], OCI_HTYPE_ERROR);
+                }
+            }
+
+            FREE(slot->errs)
+            FREE(slot->err_rows)
+        }
+
+        dp->strm = NULL;
+    }
+
     for (i = 0; i < dp->nb_cols; i++)
     {
         FREE(dp->cols[i].data)
         FREE(dp->cols[i].lens)
         FREE(dp->cols[i].flags)
         FREE(dp->cols[i].format)
+        FREE(dp->cols[i].cvt_text)
+        FREE(dp->cols[i].cvt_state)
+    }
+
+    if (NULL != dp->tasks)
+    {
+        DirPathStopWorkers(dp);
     }
 
     FREE(dp->cols)
+    FREE(dp->tasks)
     FREE(dp->err_cols)
     FREE(dp->err_rows)
 
@@ -498,7 +1321,8 @@ boolean DirPathSetColumn
     dbtext     *dbstr2  = NULL;
     int         dbsize2 = -1;
 
-    ub2 i = 0;
+    ub2 size = 0;
+    ub2 i    = 0;
 
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_NOT_PREPARED)
@@ -535,6 +1359,7 @@ boolean DirPathSetColumn
     dpcol->type        = OCI_DDT_TEXT;
     dpcol->index       = i;
     dpcol->format_size = 0;
+    dpcol->cvt_client  = FALSE;
 
     switch (col->datatype)
     {
@@ -558,7 +1383,15 @@ boolean DirPathSetColumn
                 dpcol->type        = OCI_DDT_NUMBER;
                 dpcol->sqlcode     = SQLT_NUM;
                 dpcol->bufsize     = sizeof(OCINumber);
-                dpcol->maxsize     = sizeof(OCINumber);
+                dpcol->cvt_client  = (dp->nb_threads > 0 && maxsize > 0 && NumberIsParsableFormat(format));
+
+                /* input strings are kept until DirPathConvert() if converted on client side,
+                   only formats made of digits and a decimal point being handled in C */
+
+                if (!dpcol->cvt_client)
+                {
+                    dpcol->maxsize = sizeof(OCINumber);
+                }
             }
             else
             {
@@ -578,6 +1411,16 @@ boolean DirPathSetColumn
                 dpcol->format_size = (ub4) ostrlen(format);
                 dpcol->maxsize     = (ub2) max(dpcol->format_size, maxsize);
                 dpcol->bufsize    *= sizeof(otext);
+
+                /* dates with a format handled in C can be converted on client side */
+
+                if (OCI_CDT_DATETIME == col->datatype && dp->nb_threads > 0 && DateIsParsableFormat(format))
+                {
+                    dpcol->type       = OCI_DDT_DATE;
+                    dpcol->sqlcode    = SQLT_DAT;
+                    dpcol->bufsize    = OCI_DATE_WIRE_SIZE;
+                    dpcol->cvt_client = TRUE;
+                }
             }
             break;
         }
@@ -652,12 +1495,14 @@ boolean DirPathSetColumn
         dp->typinf->con->err
     )
 
-    /* set column size */
+    /* set column size, input strings converted on client side are not seen by OCI */
+
+    size = dpcol->cvt_client ? dpcol->bufsize : dpcol->maxsize;
 
     CHECK_ATTRIB_SET
     (
         OCI_DTYPE_PARAM, OCI_ATTR_DATA_SIZE,
-        hattr, &dpcol->maxsize, sizeof(dpcol->maxsize),
+        hattr, &size, sizeof(size),
         dp->typinf->con->err
     )
 
@@ -687,7 +1532,7 @@ boolean DirPathSetColumn
 
     /* set column date/time format attribute */
 
-    if (dpcol->format && dpcol->format[0] && (OCI_DDT_NUMBER != dpcol->type))
+    if (dpcol->format && dpcol->format[0] && (OCI_DDT_NUMBER != dpcol->type) && (OCI_DDT_DATE != dpcol->type))
     {
         dbstr2 = StringGetDBString(dpcol->format, &dbsize2);
 
@@ -802,6 +1647,43 @@ boolean DirPathPrepare
 
     ALLOC_DATA(OCI_IPC_BUFF_ARRAY, dp->err_cols, dp->nb_cur)
 
+    /* in pipelined mode, each slot has its own stream and error handles
+       as a stream is loaded in background while the next batch is set */
+
+    if (dp->pipelined)
+    {
+        for (ub2 i = 0; i < OCI_DIRPATH_SLOTS; i++)
+        {
+            OCI_DirPathSlot *slot = &dp->slots[i];
+
+            slot->dp = dp;
+
+            if (i == 0)
+            {
+                slot->strm = dp->strm;
+            }
+            else
+            {
+                CHECK
+                (
+                    MemoryAllocHandle
+                    (
+                        (dvoid *)dp->ctx,
+                        (dvoid **)(void *)&slot->strm,
+                        OCI_HTYPE_DIRPATH_STREAM
+                    )
+                )
+            }
+
+            /* error handles are allocated on demand by the loading thread */
+
+            ALLOC_DATA(OCI_IPC_BUFF_ARRAY, slot->errs,     dp->nb_cur)
+            ALLOC_DATA(OCI_IPC_BUFF_ARRAY, slot->err_rows, dp->nb_cur)
+        }
+
+        dp->idx_slot = 0;
+    }
+
     /* now, we need to allocate internal buffers */
 
     for (ub2 i = 0; i < dp->nb_cols; i++)
@@ -811,9 +1693,28 @@ boolean DirPathPrepare
         ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->data,  col->bufsize, dp->nb_cur)
         ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->lens,  sizeof(ub4),  dp->nb_cur)
         ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->flags, sizeof(ub1),  dp->nb_cur)
+
+        if (col->cvt_client)
+        {
+            ALLOC_BUFFER(OCI_IPC_STRING,     col->cvt_text,  (col->maxsize + 1) * sizeof(otext), dp->nb_cur)
+            ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, col->cvt_state, sizeof(ub1), dp->nb_cur)
+
+            /* client side conversion tasks */
+
+            if (NULL == dp->tasks)
+            {
+                ALLOC_DATA(OCI_IPC_BUFF_ARRAY, dp->tasks, max(dp->nb_threads, 1))
+            }
+        }
+    }
+
+    if (NULL != dp->tasks)
+    {
+        CHECK(DirPathStartWorkers(dp))
     }
 
-    dp->status = OCI_DPS_PREPARED;
+    dp->status     = OCI_DPS_PREPARED;
+    dp->fill_start = ProfilerClock();
 
     SET_SUCCESS()
 
@@ -852,6 +1753,10 @@ boolean DirPathSetEntry
     dpcol = &dp->cols[index-1];
     CHECK_NULL(dpcol)
 
+    /* the entry replaces a column vector set with DirPathSetColumnData() */
+
+    dpcol->ext_data = NULL;
+
     /* check size */
 
     if (size > dpcol->maxsize)
@@ -890,10 +1795,27 @@ boolean DirPathSetEntry
 
         ub1 *data = ((ub1 *) dpcol->data) + (size_t) ((row-1) * dpcol->bufsize);
 
-        /* we weed to pack the buffer if wchar_t is 4 bytes */
+        if (dpcol->cvt_client)
+        {
+            /* NUMBER and DATE strings are converted later by DirPathConvert() */
+
+            otext *str = dpcol->cvt_text + (size_t) ((row-1) * (dpcol->maxsize + 1));
+
+            const otext *src = (const otext *) value;
+
+            unsigned int n = 0;
 
-        if (OCI_DDT_TEXT == dpcol->type && Env.use_wide_char_conv)
+            for (; n < size && 0 != src[n]; n++)
+            {
+                str[n] = src[n];
+            }
+
+            str[n] = 0;
+        }
+        else if (OCI_DDT_TEXT == dpcol->type && Env.use_wide_char_conv)
         {
+            /* we weed to pack the buffer if wchar_t is 4 bytes */
+
             size = ocharcount(size);
             StringUTF32ToUTF16(value, data, size);
         }
@@ -910,21 +1832,305 @@ boolean DirPathSetEntry
             /* if a format was provided for a numeric column, we convert the input
             buffer to a OCINumber */
 
-            OCINumber *num = (OCINumber *) data;
+            OCINumber *num = (OCINumber *) data;
+
+            CHECK(NumberFromStringInternal(dp->con, num, OCI_NUM_NUMBER,
+                                           (otext *)value, dpcol->format))
+
+            size = (unsigned int) num->OCINumberPart[0];
+        }
+        else
+        {
+            memcpy(data, value, (size_t) size);
+        }
+    }
+
+    dpcol->lens[row-1]  = size;
+    dpcol->flags[row-1] = flag;
+
+    if (dpcol->cvt_client)
+    {
+        dpcol->cvt_state[row-1] = (NULL != value) ? OCI_DCV_PENDING : OCI_DCV_NONE;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetColumnData
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetColumnData
+(
+    OCI_DirPath   *dp,
+    unsigned int   index,
+    void          *data,
+    unsigned int   size,
+    unsigned int  *lens,
+    unsigned char *nulls
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    OCI_DirPathColumn *dpcol = NULL;
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_PTR(OCI_IPC_VOID, data)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
+    CHECK_BOUND(index, 1, dp->nb_cols)
+    CHECK_MIN(size, 1)
+
+    dpcol = &dp->cols[index-1];
+
+    /* program vectors hold fixed size elements and null bitmaps */
+
+    dpcol->ext_offs  = NULL;
+    dpcol->ext_bit   = 0;
+    dpcol->ext_valid = FALSE;
+
+    if (DirPathIsZeroCopy(dpcol))
+    {
+        /* the column array entries will point to the caller vector */
+
+        dpcol->ext_data  = (ub1 *) data;
+        dpcol->ext_size  = (ub4) size;
+        dpcol->ext_lens  = (ub4 *) lens;
+        dpcol->ext_nulls = (ub1 *) nulls;
+    }
+    else
+    {
+        /* values need a client side conversion, they are copied as single entries */
+
+        for (ub4 row = 0; row < dp->nb_cur; row++)
+        {
+            void        *value = NULL;
+            unsigned int len   = 0;
+
+            DirPathGetVectorEntry(dpcol, (ub1 *) data, (ub4) size, (ub4 *) lens,
+                                  (ub1 *) nulls, row, &value, &len);
+
+            CHECK(DirPathSetEntry(dp, row + 1, index, value, len, TRUE))
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetArrowColumn
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathSetArrowColumn
+(
+    OCI_DirPath              *dp,
+    ub2                       index,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array,
+    ub4                       first
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    OCI_DirPathColumn *dpcol = &dp->cols[index-1];
+
+    otext       *str      = NULL;
+    ub4          str_size = 0;
+    unsigned int unit     = 0;
+    boolean      binary   = FALSE;
+
+    const unsigned int type = ArrowGetType(schema, &unit);
+
+    /* binary values can only be loaded into binary columns and vice versa */
+
+    if (OCI_ARW_UNKNOWN == type || NULL == array->buffers ||
+        (OCI_ARW_BINARY == type) != (OCI_DDT_BINARY == dpcol->type))
+    {
+        THROW(ExceptionArrowFormat, index)
+    }
+
+    binary = (OCI_ARW_UTF8 == type || OCI_ARW_BINARY == type);
+
+    /* program vectors are replaced */
+
+    dpcol->ext_data  = NULL;
+    dpcol->ext_lens  = NULL;
+    dpcol->ext_size  = 0;
+    dpcol->ext_offs  = NULL;
+    dpcol->ext_bit   = 0;
+    dpcol->ext_valid = FALSE;
+
+    if (binary && DirPathIsZeroCopy(dpcol) &&
+        (OCI_DDT_BINARY == dpcol->type || sizeof(otext) == sizeof(char)))
+    {
+        /* variable size values are used in place, the validity bitmap being read as is.
+           They cannot be truncated in place and over long values are rejected */
+
+        const ub4 pos = (ub4) array->offset + first;
+
+        for (ub4 i = 0; i < dp->nb_cur; i++)
+        {
+            if (!ArrowIsNull(array, first + i))
+            {
+                const char *data = NULL;
+                ub4         size = 0;
+
+                ArrowGetBytes(array, first + i, &data, &size);
+
+                CHECK_MAX(size, dpcol->maxsize)
+            }
+        }
+
+        dpcol->ext_data  = (ub1 *) array->buffers[2];
+        dpcol->ext_offs  = ((sb4 *) array->buffers[1]) + pos;
+        dpcol->ext_nulls = (0 != array->null_count) ? (ub1 *) array->buffers[0] : NULL;
+        dpcol->ext_bit   = pos;
+        dpcol->ext_valid = TRUE;
+
+        JUMP_EXIT()
+    }
+
+    /* other values are converted and copied to the column array */
+
+    str_size = max(dpcol->maxsize, OCI_ARW_TEXT_SIZE) + 1;
+
+    ALLOC_DATA(OCI_IPC_STRING, str, str_size)
+
+    for (ub4 i = 0; i < dp->nb_cur; i++)
+    {
+        const ub4 pos = first + i;
+
+        if (ArrowIsNull(array, pos))
+        {
+            CHECK(DirPathSetEntry(dp, i + 1, index, NULL, 0, TRUE))
+        }
+        else if (binary)
+        {
+            const char *data = NULL;
+            ub4         size = 0;
+
+            ArrowGetBytes(array, pos, &data, &size);
+
+            if (OCI_DDT_BINARY == dpcol->type)
+            {
+                CHECK_MAX(size, dpcol->maxsize)
+
+                CHECK(DirPathSetEntry(dp, i + 1, index, (void *) data, size, TRUE))
+            }
+            else
+            {
+                /* UTF-8 values are decoded, text columns sizes being expressed in bytes */
+
+                if (size + 1 > str_size)
+                {
+                    REALLOC_BUFFER(OCI_IPC_STRING, str, sizeof(otext), size + 1, str_size, size + 1)
+                }
+
+                size = StringUTF8ToNative(data, size, str);
+
+                CHECK_MAX((OCI_DDT_TEXT == dpcol->type) ? size * (ub4) sizeof(otext) : size, dpcol->maxsize)
+
+                CHECK(DirPathSetEntry(dp, i + 1, index, str, size, TRUE))
+            }
+        }
+        else if (OCI_DDT_NUMBER == dpcol->type && OCI_ARW_TIMESTAMP != type)
+        {
+            /* numeric values are converted to NUMBER without any string format */
+
+            OCINumber *num = (OCINumber *) (dpcol->data + (size_t) i * dpcol->bufsize);
+
+            CHECK(NumberTranslateValue(dp->con, (void *) ArrowGetValue(array, ArrowGetValueSize(type), pos),
+                                       ArrowGetNumericType(type), num, OCI_NUM_NUMBER))
+
+            dpcol->lens[i]  = (ub4) num->OCINumberPart[0];
+            dpcol->flags[i] = OCI_DIRPATH_COL_COMPLETE;
+
+            if (dpcol->cvt_client)
+            {
+                dpcol->cvt_state[i] = OCI_DCV_NONE;
+            }
+        }
+        else
+        {
+            /* numbers are converted to text using '.' as decimal separator and
+               timestamps to the OCI_ARROW_DATE_FORMAT or OCI_ARROW_TIMESTAMP_FORMAT */
+
+            char buffer[OCI_ARW_TEXT_SIZE];
+
+            const boolean fraction = (OCI_CDT_TIMESTAMP == dp->typinf->cols[dpcol->index].datatype);
+
+            const int size = ArrowFormatValue(array, type, unit, pos, fraction, buffer, (int) sizeof(buffer));
+
+            if (size < 0)
+            {
+                THROW(ExceptionOutOfBounds, (int) i + 1)
+            }
+
+            StringAnsiToNative(buffer, str, size);
+
+            str[size] = 0;
+
+            CHECK(DirPathSetEntry(dp, i + 1, index, str, (unsigned int) size, TRUE))
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        FREE(str)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetArrowBatch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetArrowBatch
+(
+    OCI_DirPath              *dp,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_PTR(OCI_IPC_VOID, schema)
+    CHECK_PTR(OCI_IPC_VOID, array)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
-            CHECK(NumberFromStringInternal(dp->con, num, OCI_NUM_NUMBER,
-                                           (otext *)value, dpcol->format))
+    /* batch children are mapped by position to the direct path columns */
 
-            size = (unsigned int) num->OCINumberPart[0];
-        }
-        else
-        {
-            memcpy(data, value, (size_t) size);
-        }
+    if (!ArrowIsBatch(schema, array) || schema->n_children != (int64_t) dp->nb_cols)
+    {
+        THROW(ExceptionArgInvalidValue, OTEXT("Arrow batch columns"), (unsigned int) schema->n_children)
     }
 
-    dpcol->lens[row-1]  = size;
-    dpcol->flags[row-1] = flag;
+    CHECK_BOUND(array->length, 1, dp->nb_rows)
+
+    CHECK(DirPathSetCurrentRows(dp, (unsigned int) array->length))
+
+    for (ub2 i = 0; i < dp->nb_cols; i++)
+    {
+        CHECK(DirPathSetArrowColumn(dp, (ub2) (i + 1), schema->children[i],
+                                    array->children[i], (ub4) array->offset))
+    }
 
     SET_SUCCESS()
 
@@ -956,6 +2162,20 @@ boolean DirPathReset
     dp->idx_err_row  = 0;
     dp->idx_err_col  = 0;
 
+    /* release caller column vectors */
+
+    for (ub2 i = 0; i < dp->nb_cols; i++)
+    {
+        dp->cols[i].ext_data = NULL;
+    }
+
+    /* a new batch is being set unless the current one is still */
+
+    if (0 == dp->fill_start)
+    {
+        dp->fill_start = ProfilerClock();
+    }
+
     /* reset array */
 
     CHECK_OCI
@@ -994,11 +2214,31 @@ unsigned int DirPathConvert
         /* context */ OCI_IPC_DIRPATH, dp
     )
 
-    ub4 row_from = 0;
+    ub4 row_from     = 0;
+    ub4 nb_converted = 0;
+    ub4 nb_err       = 0;
+
+    big_uint start = 0;
 
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    /* account the time spent setting the batch */
+
+    start = ProfilerClock();
+
+    if (0 != dp->fill_start)
+    {
+        ProfilerUpdatePhase(&dp->stats.phases[OCI_DPP_FILL], start - dp->fill_start);
+
+        dp->fill_start = 0;
+    }
+
+    dp->stats.conversions++;
+
+    nb_converted = dp->nb_converted;
+    nb_err       = dp->nb_err;
+
     /* reset the number of processed rows */
 
     dp->nb_processed = 0;
@@ -1011,6 +2251,25 @@ unsigned int DirPathConvert
         row_from = dp->err_rows[dp->nb_err - 1];
     }
 
+    /* convert NUMBER and DATE values on client side */
+
+    if (NULL != dp->tasks)
+    {
+        start = ProfilerClock();
+
+        DirPathConvertValues(dp, row_from);
+
+        DirPathRecord(dp, OCI_DPP_VALUES, start);
+    }
+
+    /* in pipelined mode, the stream conversion uses the direct path context
+       that must not be used while the previous batch is loaded */
+
+    if (dp->pipelined)
+    {
+        DirPathJoinLoad(dp);
+    }
+
     /* reset the stream if it is full */
 
     if (OCI_DPR_FULL == dp->res_conv)
@@ -1027,13 +2286,9 @@ unsigned int DirPathConvert
 
     dp->res_conv = OCI_DPR_ERROR;
 
-    /* set array values */
-
-    CHECK(DirPathSetArray(dp, row_from))
-
-    /* try to convert values from array into stream */
+    /* set array values and convert them into stream */
 
-    dp->res_conv = DirPathArrayToStream(dp, row_from);
+    CHECK(DirPathConvertRows(dp, row_from, &dp->res_conv))
 
     /* in case of conversion error, continue conversion in force mode
        other return from conversion */
@@ -1048,18 +2303,24 @@ unsigned int DirPathConvert
 
             row_from = dp->err_rows[dp->nb_err - 1] + 1;
 
-            /* set values again */
+            /* set values and perform conversion again */
 
-            CHECK(DirPathSetArray(dp, row_from))
+            CHECK(DirPathConvertRows(dp, row_from, &dp->res_conv))
 
-            /* perform conversion again */
-
-            dp->res_conv = DirPathArrayToStream(dp, row_from);
+            dp->stats.retries++;
         }
     }
 
     dp->nb_processed = dp->nb_converted;
 
+    dp->stats.rows_converted    += dp->nb_converted - nb_converted;
+    dp->stats.conversion_errors += dp->nb_err - nb_err;
+
+    if (OCI_DPR_FULL == dp->res_conv)
+    {
+        dp->stats.stream_full++;
+    }
+
     SET_RETVAL(dp->res_conv)
 
     EXIT_FUNC()
@@ -1080,9 +2341,21 @@ unsigned int DirPathLoad
         /* context */ OCI_IPC_DIRPATH, dp
     )
 
+    ub4 bytes = 0;
+    ub4 size  = sizeof(bytes);
+
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_CONVERTED)
 
+    /* retrieve the size of the stream to load */
+
+    CHECK_ATTRIB_GET
+    (
+        OCI_HTYPE_DIRPATH_STREAM, OCI_ATTR_BUF_SIZE,
+        dp->strm, &bytes, &size,
+        dp->con->err
+    )
+
     /* reset the number of processed rows */
 
     dp->nb_processed = 0;
@@ -1094,17 +2367,76 @@ unsigned int DirPathLoad
     dp->idx_err_row = 0;
     dp->res_load    = OCI_DPR_COMPLETE;
 
-    /* load the stream */
+    if (dp->pipelined)
+    {
+        OCI_DirPathSlot *slot = &dp->slots[dp->idx_slot];
+        OCI_DirPathSlot *next = &dp->slots[(dp->idx_slot + 1) % OCI_DIRPATH_SLOTS];
+
+        /* collect the previous batch that may still be loading. Its outcome is
+           the one reported by this call */
+
+        CHECK(DirPathWaitLoad(dp))
+
+        /* the stream of the previous batch receives the next one */
+
+        CHECK_OCI
+        (
+            dp->typinf->con->err,
+            OCIDirPathStreamReset,
+            next->strm, dp->con->err
+        )
+
+        /* hand the converted stream over to a loading thread */
+
+        slot->bytes  = bytes;
+        slot->thread = ThreadCreate();
+        CHECK_NULL(slot->thread)
+
+        if (!ThreadRun(slot->thread, DirPathLoadSlot, slot))
+        {
+            ThreadFree(slot->thread);
+            slot->thread = NULL;
 
-    dp->res_load = DirPathLoadStream(dp);
+            CHECK(FALSE)
+        }
+
+        slot->pending = TRUE;
 
-    /* continue to load the stream while it returns an error */
+        /* the next batch is set meanwhile */
 
-    while (OCI_DPR_ERROR == dp->res_load)
+        dp->idx_slot = (ub2) ((dp->idx_slot + 1) % OCI_DIRPATH_SLOTS);
+        dp->strm     = next->strm;
+        dp->status   = OCI_DPS_PREPARED;
+    }
+    else
     {
+        const big_uint start = ProfilerClock();
+
+        /* load the stream */
+
         dp->res_load = DirPathLoadStream(dp);
+
+        /* continue to load the stream while it returns an error */
+
+        while (OCI_DPR_ERROR == dp->res_load)
+        {
+            dp->res_load = DirPathLoadStream(dp);
+        }
+
+        DirPathRecord(dp, OCI_DPP_LOAD, start);
+
+        dp->stats.streams++;
+        dp->stats.bytes       += bytes;
+        dp->stats.rows_loaded += dp->nb_processed;
+        dp->stats.load_errors += dp->nb_err;
     }
 
+    /* the next batch starts to be set */
+
+    dp->fill_start = ProfilerClock();
+
+    DirPathNotifyProgress(dp, FALSE);
+
     SET_RETVAL(dp->res_load)
 
     EXIT_FUNC()
@@ -1128,6 +2460,10 @@ boolean DirPathFinish
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    /* the last pipelined batch outcome is reported here */
+
+    CHECK(DirPathWaitLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1137,6 +2473,10 @@ boolean DirPathFinish
 
     dp->status = OCI_DPS_TERMINATED;
 
+    /* final statistics */
+
+    DirPathNotifyProgress(dp, TRUE);
+
     SET_SUCCESS()
 
     EXIT_FUNC()
@@ -1160,6 +2500,10 @@ boolean DirPathAbort
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    /* the pending pipelined batch is discarded by the abort anyway */
+
+    CHECK(DirPathWaitLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1192,6 +2536,8 @@ boolean DirPathSave
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    CHECK(DirPathWaitLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1223,6 +2569,8 @@ boolean DirPathFlushRow
     CHECK_PTR(OCI_IPC_DIRPATH, dp)
     CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
 
+    CHECK(DirPathWaitLoad(dp))
+
     CHECK_OCI
     (
         dp->typinf->con->err,
@@ -1511,6 +2859,182 @@ boolean DirPathSetConvertMode
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetPipelined
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetPipelined
+(
+    OCI_DirPath *dp,
+    boolean      value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_NOT_PREPARED)
+
+    if (value)
+    {
+        CHECK_THREAD_ENABLED()
+    }
+
+    dp->pipelined = value;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathGetPipelined
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathGetPipelined
+(
+    OCI_DirPath *dp
+)
+{
+    GET_PROP
+    (
+        /* result */ boolean, FALSE,
+        /* handle */ OCI_IPC_DIRPATH, dp,
+        /* member */ pipelined
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetConvertThreads
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetConvertThreads
+(
+    OCI_DirPath *dp,
+    unsigned int value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_NOT_PREPARED)
+
+    if (value > 1)
+    {
+        CHECK_THREAD_ENABLED()
+    }
+
+    dp->nb_threads = value;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathGetConvertThreads
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathGetConvertThreads
+(
+    OCI_DirPath *dp
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_DIRPATH, dp,
+        /* member */ nb_threads
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathGetStats
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathGetStats
+(
+    OCI_DirPath      *dp,
+    OCI_DirPathStats *stats
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_PTR(OCI_IPC_VOID, stats)
+
+    *stats = dp->stats;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathResetStats
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathResetStats
+(
+    OCI_DirPath *dp
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+
+    memset(&dp->stats, 0, sizeof(dp->stats));
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathSetProgressHandler
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathSetProgressHandler
+(
+    OCI_DirPath          *dp,
+    POCI_DIRPATH_PROGRESS handler,
+    unsigned int          interval,
+    void                 *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+
+    dp->progress      = handler;
+    dp->progress_ctx  = ctx;
+    dp->progress_step = (big_uint) interval * 1000000;
+    dp->progress_last = 0;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * DirPathGetRowCount
  * --------------------------------------------------------------------------------------------- */
@@ -1592,3 +3116,20 @@ unsigned int DirPathGetErrorRow
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathGetRejectedCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathGetRejectedCount
+(
+    OCI_DirPath *dp
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_DIRPATH, dp,
+        /* member */ nb_rejected
+    )
+}
@@ -60,6 +60,23 @@ boolean DirPathSetEntry
     boolean      complete
 );
 
+boolean DirPathSetColumnData
+(
+    OCI_DirPath   *dp,
+    unsigned int   index,
+    void          *data,
+    unsigned int   size,
+    unsigned int  *lens,
+    unsigned char *nulls
+);
+
+boolean DirPathSetArrowBatch
+(
+    OCI_DirPath              *dp,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array
+);
+
 boolean DirPathReset
 (
     OCI_DirPath *dp
@@ -147,6 +164,47 @@ boolean DirPathSetConvertMode
     unsigned int mode
 );
 
+boolean DirPathSetPipelined
+(
+    OCI_DirPath *dp,
+    boolean      value
+);
+
+boolean DirPathGetPipelined
+(
+    OCI_DirPath *dp
+);
+
+boolean DirPathSetConvertThreads
+(
+    OCI_DirPath *dp,
+    unsigned int value
+);
+
+unsigned int DirPathGetConvertThreads
+(
+    OCI_DirPath *dp
+);
+
+boolean DirPathGetStats
+(
+    OCI_DirPath      *dp,
+    OCI_DirPathStats *stats
+);
+
+boolean DirPathResetStats
+(
+    OCI_DirPath *dp
+);
+
+boolean DirPathSetProgressHandler
+(
+    OCI_DirPath          *dp,
+    POCI_DIRPATH_PROGRESS handler,
+    unsigned int          interval,
+    void                 *ctx
+);
+
 unsigned int DirPathGetRowCount
 (
     OCI_DirPath *dp
@@ -167,4 +225,9 @@ unsigned int DirPathGetErrorRow
     OCI_DirPath *dp
 );
 
+unsigned int DirPathGetRejectedCount
+(
+    OCI_DirPath *dp
+);
+
 #endif /* OCILIB_DIRPATH_H_INCLUDED */
@@ -0,0 +1,793 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dirpathfile.h"
+
+#include "dirpath.h"
+#include "helpers.h"
+#include "macros.h"
+#include "memory.h"
+#include "strings.h"
+
+static const unsigned int FileLoadModeValues[] =
+{
+    OCI_DLF_DEFAULT,
+    OCI_DLF_HEADER
+};
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileReject
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathFileReject
+(
+    OCI_DirPathFile *df,
+    ub4              rec,
+    const char      *reason,
+    ub2              col
+)
+{
+    OCI_DirPath *dp = df->dp;
+
+    dp->nb_rejected++;
+
+    /* the bad file receives the rejected records as read */
+
+    if (NULL != df->bad)
+    {
+        fwrite(df->recs[rec], sizeof(char), (size_t) df->lens[rec], df->bad);
+        fputc('\n', df->bad);
+    }
+
+    /* the log file receives the rejection reasons */
+
+    if (NULL != df->log)
+    {
+        fprintf(df->log, "Record %u: %s", (unsigned int) df->nums[rec], reason);
+
+        if (col > 0)
+        {
+            const otext *name = dp->typinf->cols[dp->cols[col - 1].index].name;
+
+            fputs(" for column ", df->log);
+
+            while (NULL != name && *name)
+            {
+                fputc((char) *name++, df->log);
+            }
+        }
+
+        fputc('\n', df->log);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileFindRecord
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathFileFindRecord
+(
+    OCI_DirPathFile *df,
+    size_t           start,
+    size_t           filled,
+    size_t          *end
+)
+{
+    char   *buf      = df->buf;
+    size_t  pos      = start;
+    boolean in_quote = FALSE;
+
+    /* line feeds and enclosing characters are located with memchr() that
+       the C runtimes implement with vectorized scans */
+
+    while (pos < filled)
+    {
+        char *lf = (char *) memchr(buf + pos, '\n', filled - pos);
+
+        if (NULL == lf)
+        {
+            return FALSE;
+        }
+
+        /* a line feed inside an enclosed field does not end the record */
+
+        if (df->quote)
+        {
+            char *q = (char *) memchr(buf + pos, df->quote, (size_t) (lf - (buf + pos)));
+
+            while (NULL != q)
+            {
+                in_quote = !in_quote;
+                q        = (char *) memchr(q + 1, df->quote, (size_t) (lf - (q + 1)));
+            }
+        }
+
+        if (!in_quote)
+        {
+            *end = (size_t) (lf - buf);
+
+            return TRUE;
+        }
+
+        pos = (size_t) (lf - buf) + 1;
+    }
+
+    return FALSE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileNextField
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathFileNextField
+(
+    OCI_DirPathFile *df,
+    char            *rec,
+    ub4              len,
+    ub4             *pos,
+    char           **value,
+    ub4             *size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, df->dp
+    )
+
+    char *start = rec + *pos;
+    char *end   = rec + len;
+    char *delim = NULL;
+
+    if (df->quote && start < end && *start == df->quote)
+    {
+        /* enclosed field : doubled enclosing characters stand for a single one */
+
+        char *p  = start + 1;
+        ub4   nb = 0;
+
+        if (len + 1 > df->field_size)
+        {
+            REALLOC_BUFFER(OCI_IPC_STRING, df->field, sizeof(char), len + 1, df->field_size, len + 1)
+        }
+
+        while (p < end)
+        {
+            char *q = (char *) memchr(p, df->quote, (size_t) (end - p));
+
+            if (NULL == q)
+            {
+                memcpy(df->field + nb, p, (size_t) (end - p));
+                nb += (ub4) (end - p);
+                p   = end;
+                break;
+            }
+
+            memcpy(df->field + nb, p, (size_t) (q - p));
+            nb += (ub4) (q - p);
+
+            if (q + 1 < end && q[1] == df->quote)
+            {
+                df->field[nb++] = df->quote;
+                p = q + 2;
+            }
+            else
+            {
+                p = q + 1;
+                break;
+            }
+        }
+
+        *value = df->field;
+        *size  = nb;
+
+        delim = (char *) memchr(p, df->delim, (size_t) (end - p));
+    }
+    else
+    {
+        delim = (char *) memchr(start, df->delim, (size_t) (end - start));
+
+        *value = start;
+        *size  = (ub4) ((NULL != delim ? delim : end) - start);
+    }
+
+    /* a position beyond the record marks its last field */
+
+    *pos = (NULL != delim) ? (ub4) (delim - rec) + 1 : len + 1;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileGetValue
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathFileGetValue
+(
+    OCI_DirPathFile *df,
+    boolean          terminated,
+    char            *value,
+    ub4              size,
+    otext          **str
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, df->dp
+    )
+
+    /* values are handed over as is unless they must be widened or null terminated */
+
+    if (sizeof(otext) == sizeof(char) && !terminated)
+    {
+        *str = (otext *) value;
+    }
+    else
+    {
+        if (size + 1 > df->value_size)
+        {
+            REALLOC_BUFFER(OCI_IPC_STRING, df->value, sizeof(otext), size + 1, df->value_size, size + 1)
+        }
+
+        StringAnsiToNative(value, df->value, (int) size);
+
+        df->value[size] = 0;
+
+        *str = df->value;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileSetHeader
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathFileSetHeader
+(
+    OCI_DirPathFile *df,
+    char            *rec,
+    ub4              len
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, df->dp
+    )
+
+    OCI_DirPath *dp  = df->dp;
+    ub4          pos = 0;
+
+    /* fields are mapped to the direct path columns with the same name */
+
+    df->nb_map = 0;
+
+    while (pos <= len)
+    {
+        char  *value = NULL;
+        otext *name  = NULL;
+        ub4    size  = 0;
+
+        CHECK(DirPathFileNextField(df, rec, len, &pos, &value, &size))
+        CHECK(DirPathFileGetValue(df, TRUE, value, size, &name))
+
+        REALLOC_DATA(OCI_IPC_BUFF_ARRAY, df->map, df->nb_map, df->map_size, df->map_size + dp->nb_cols)
+
+        df->map[df->nb_map] = 0;
+
+        for (ub2 j = 0; j < dp->nb_cols; j++)
+        {
+            const otext *col_name = dp->typinf->cols[dp->cols[j].index].name;
+
+            if (NULL != col_name && 0 == ostrcasecmp(col_name, name))
+            {
+                df->map[df->nb_map] = (ub2) (j + 1);
+                break;
+            }
+        }
+
+        df->nb_map++;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileSetRow
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathFileSetRow
+(
+    OCI_DirPathFile *df,
+    ub4              row,
+    ub4              rec,
+    boolean         *set
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, df->dp
+    )
+
+    OCI_DirPath *dp     = df->dp;
+    char        *data   = df->recs[rec];
+    const ub4    len    = df->lens[rec];
+    const char  *reason = NULL;
+    ub2          col    = 0;
+    ub4          pos    = 0;
+    ub4          field  = 0;
+
+    memset(df->set, 0, (size_t) dp->nb_cols);
+
+    while (pos <= len && NULL == reason)
+    {
+        OCI_DirPathColumn *dpcol = NULL;
+
+        char  *value = NULL;
+        otext *str   = NULL;
+        ub4    size  = 0;
+
+        CHECK(DirPathFileNextField(df, data, len, &pos, &value, &size))
+
+        col = (field < df->nb_map) ? df->map[field] : 0;
+
+        field++;
+
+        if (0 == col || df->set[col - 1])
+        {
+            continue;
+        }
+
+        dpcol = &dp->cols[col - 1];
+
+        df->set[col - 1] = TRUE;
+
+        /* empty fields are loaded as nulls */
+
+        if (0 == size)
+        {
+            CHECK(DirPathSetEntry(dp, row, col, NULL, 0, TRUE))
+        }
+        else if (size > dpcol->maxsize)
+        {
+            reason = "value too long";
+        }
+        else
+        {
+            CHECK(DirPathFileGetValue(df, OCI_DDT_NUMBER == dpcol->type, value, size, &str))
+
+            if (!DirPathSetEntry(dp, row, col, str, size, TRUE))
+            {
+                reason = "invalid value";
+            }
+        }
+    }
+
+    if (NULL == reason)
+    {
+        /* columns without field are loaded as nulls */
+
+        for (ub2 j = 0; j < dp->nb_cols; j++)
+        {
+            if (!df->set[j])
+            {
+                CHECK(DirPathSetEntry(dp, row, j + 1, NULL, 0, TRUE))
+            }
+        }
+    }
+    else
+    {
+        DirPathFileReject(df, rec, reason, col);
+    }
+
+    *set = (NULL == reason);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileFlush
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathFileFlush
+(
+    OCI_DirPathFile *df
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, df->dp
+    )
+
+    OCI_DirPath *dp  = df->dp;
+    ub4          rec = 0;
+
+    memset(df->dropped, 0, (size_t) df->nb_recs);
+
+    /* records are set, converted and loaded in as many passes as needed
+       when they do not fit in a single stream */
+
+    while (rec < df->nb_recs)
+    {
+        unsigned int res    = OCI_DPR_ERROR;
+        ub4          nb_arr = 0;
+        ub4          done   = 0;
+
+        CHECK(DirPathReset(dp))
+        CHECK(DirPathSetCurrentRows(dp, dp->nb_rows))
+
+        while (rec < df->nb_recs && nb_arr < dp->nb_rows)
+        {
+            boolean set = FALSE;
+
+            /* records already rejected by a previous pass are not read again */
+
+            if (!df->dropped[rec])
+            {
+                CHECK(DirPathFileSetRow(df, nb_arr + 1, rec, &set))
+
+                df->dropped[rec] = !set;
+            }
+
+            if (set)
+            {
+                df->arr_recs[nb_arr++] = rec;
+            }
+
+            rec++;
+        }
+
+        if (0 == nb_arr)
+        {
+            break;
+        }
+
+        CHECK(DirPathSetCurrentRows(dp, nb_arr))
+
+        /* conversion runs in force mode : erred rows are skipped */
+
+        res = DirPathConvert(dp);
+
+        CHECK(OCI_DPR_COMPLETE == res || OCI_DPR_FULL == res)
+
+        memset(df->rejected, 0, (size_t) nb_arr);
+
+        for (ub4 k = 0; k < dp->nb_err; k++)
+        {
+            const ub4 i = dp->err_rows[k];
+
+            if (i < nb_arr && !df->rejected[i])
+            {
+                df->rejected[i] = TRUE;
+
+                DirPathFileReject(df, df->arr_recs[i], "conversion error", (ub2) (dp->err_cols[k] + 1));
+            }
+        }
+
+        done = (OCI_DPR_COMPLETE == res) ? nb_arr : dp->nb_converted + dp->nb_err;
+
+        if (dp->nb_converted > 0)
+        {
+            CHECK(OCI_DPR_ERROR != DirPathLoad(dp))
+
+            /* load errors are indexes of rows in the stream, that does not hold
+               the rows rejected by the conversion */
+
+            for (ub4 k = 0; k < dp->nb_err; k++)
+            {
+                for (ub4 i = 0, n = 0; i < done; i++)
+                {
+                    if (!df->rejected[i] && n++ == dp->err_rows[k])
+                    {
+                        DirPathFileReject(df, df->arr_recs[i], "rejected by the server", 0);
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            /* nothing to load */
+
+            dp->status = OCI_DPS_PREPARED;
+
+            if (OCI_DPR_FULL == res)
+            {
+                DirPathFileReject(df, df->arr_recs[0], "record too large for the stream buffer", 0);
+
+                done = 1;
+            }
+        }
+
+        /* start again from the first record that did not fit in the stream */
+
+        if (OCI_DPR_FULL == res && done < nb_arr)
+        {
+            rec = df->arr_recs[done];
+        }
+    }
+
+    df->nb_recs = 0;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathFileAddRecord
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathFileAddRecord
+(
+    OCI_DirPathFile *df,
+    char            *rec,
+    ub4              len,
+    ub4              num,
+    boolean         *header
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, df->dp
+    )
+
+    if (len > 0 && '\r' == rec[len - 1])
+    {
+        len--;
+    }
+
+    if (0 == len)
+    {
+        /* blank lines are skipped */
+    }
+    else if (*header)
+    {
+        CHECK(DirPathFileSetHeader(df, rec, len))
+
+        *header = FALSE;
+    }
+    else
+    {
+        df->recs[df->nb_recs] = rec;
+        df->lens[df->nb_recs] = len;
+        df->nums[df->nb_recs] = num;
+
+        df->nb_recs++;
+
+        if (df->nb_recs == df->dp->nb_rows)
+        {
+            CHECK(DirPathFileFlush(df))
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoadFile
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoadFile
+(
+    OCI_DirPath *dp,
+    const otext *filename,
+    const otext *badfile,
+    const otext *logfile,
+    otext        delimiter,
+    otext        quote,
+    unsigned int mode
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH, dp
+    )
+
+    OCI_DirPathFile df;
+
+    FILE   *file     = NULL;
+    ub2     cvt_mode = 0;
+    boolean header   = FALSE;
+    boolean eof      = FALSE;
+    size_t  filled   = 0;
+    ub4     num      = 0;
+
+    memset(&df, 0, sizeof(df));
+
+    CHECK_PTR(OCI_IPC_DIRPATH, dp)
+    CHECK_PTR(OCI_IPC_STRING, filename)
+    CHECK_DIRPATH_STATUS(dp, OCI_DPS_PREPARED)
+    CHECK_COMPAT(!dp->pipelined)
+    CHECK_ENUM_VALUE(mode, FileLoadModeValues, OTEXT("File load mode"))
+
+    cvt_mode = dp->cvt_mode;
+    header   = (OCI_DLF_HEADER == mode);
+
+    dp->cvt_mode    = OCI_DCM_FORCE;
+    dp->nb_rejected = 0;
+
+    df.dp    = dp;
+    df.delim = (char) delimiter;
+    df.quote = (char) quote;
+
+    /* open files */
+
+    file = OpenLocalFile(filename, "rb");
+
+    if (NULL == file)
+    {
+        THROW(ExceptionFileOpen, filename)
+    }
+
+    if (NULL != badfile)
+    {
+        df.bad = OpenLocalFile(badfile, "wb");
+
+        if (NULL == df.bad)
+        {
+            THROW(ExceptionFileOpen, badfile)
+        }
+    }
+
+    if (NULL != logfile)
+    {
+        df.log = OpenLocalFile(logfile, "w");
+
+        if (NULL == df.log)
+        {
+            THROW(ExceptionFileOpen, logfile)
+        }
+    }
+
+    /* allocate buffers */
+
+    df.buf_size = OCI_DIRPATH_FILE_BUFFER;
+
+    ALLOC_BUFFER(OCI_IPC_STRING, df.buf, sizeof(char), df.buf_size)
+
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.recs,     dp->nb_rows)
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.lens,     dp->nb_rows)
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.nums,     dp->nb_rows)
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.arr_recs, dp->nb_rows)
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.rejected, dp->nb_rows)
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.dropped,  dp->nb_rows)
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.set,      dp->nb_cols)
+
+    /* without header, fields are mapped to the columns by position */
+
+    if (!header)
+    {
+        ALLOC_DATA(OCI_IPC_BUFF_ARRAY, df.map, dp->nb_cols)
+
+        for (ub2 j = 0; j < dp->nb_cols; j++)
+        {
+            df.map[j] = (ub2) (j + 1);
+        }
+
+        df.nb_map   = dp->nb_cols;
+        df.map_size = dp->nb_cols;
+    }
+
+    /* read the file with large reads and split it into records */
+
+    while (!eof)
+    {
+        size_t start = 0;
+
+        filled += fread(df.buf + filled, sizeof(char), df.buf_size - filled, file);
+
+        eof = feof(file) || ferror(file);
+
+        while (start < filled)
+        {
+            size_t end = 0;
+
+            if (!DirPathFileFindRecord(&df, start, filled, &end))
+            {
+                if (!eof)
+                {
+                    break;
+                }
+
+                /* last record without line feed */
+
+                end = filled;
+            }
+
+            CHECK(DirPathFileAddRecord(&df, df.buf + start, (ub4) (end - start), ++num, &header))
+
+            start = (end < filled) ? end + 1 : filled;
+        }
+
+        /* records of the current batch point to the read buffer that is about to be reused */
+
+        CHECK(DirPathFileFlush(&df))
+
+        /* keep the incomplete record and grow the buffer if it does not hold it */
+
+        memmove(df.buf, df.buf + start, filled - start);
+
+        filled -= start;
+
+        if (filled == df.buf_size)
+        {
+            const size_t size = df.buf_size * 2;
+
+            REALLOC_BUFFER(OCI_IPC_STRING, df.buf, sizeof(char), size, df.buf_size, size)
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != dp)
+        {
+            if (cvt_mode > 0)
+            {
+                dp->cvt_mode = cvt_mode;
+            }
+        }
+
+        if (NULL != file)
+        {
+            fclose(file);
+        }
+
+        if (NULL != df.bad)
+        {
+            fclose(df.bad);
+        }
+
+        if (NULL != df.log)
+        {
+            fclose(df.log);
+        }
+
+        FREE(df.buf)
+        FREE(df.recs)
+        FREE(df.lens)
+        FREE(df.nums)
+        FREE(df.arr_recs)
+        FREE(df.rejected)
+        FREE(df.dropped)
+        FREE(df.set)
+        FREE(df.map)
+        FREE(df.field)
+        FREE(df.value)
+    )
+}
@@ -0,0 +1,732 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dirpathloader.h"
+
+#include "dirpath.h"
+#include "macros.h"
+#include "memory.h"
+#include "thread.h"
+#include "typeinfo.h"
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderUnitSize
+ * --------------------------------------------------------------------------------------------- */
+
+static ub4 DirPathLoaderUnitSize(OCI_DirPathColumn *col)
+{
+    /* sizes given for non binary columns are numbers of characters */
+
+    return (OCI_DDT_BINARY == col->type) ? (ub4) 1 : (ub4) sizeof(otext);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderCellSize
+ * --------------------------------------------------------------------------------------------- */
+
+static ub4 DirPathLoaderCellSize(OCI_DirPathColumn *col)
+{
+    /* non binary values are kept null terminated as numeric ones are parsed as strings */
+
+    if (OCI_DDT_BINARY == col->type)
+    {
+        return (ub4) col->maxsize;
+    }
+
+    return (ub4) ((col->maxsize + 1) * sizeof(otext));
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderRun
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathLoaderRun
+(
+    OCI_Thread *thread,
+    void       *arg
+)
+{
+    OCI_DirPathWorker *wrk = (OCI_DirPathWorker *) arg;
+    OCI_DirPathLoader *ldr = wrk->ldr;
+    OCI_DirPath       *dp  = wrk->dp;
+
+    ub4 row_from = 0;
+
+    OCI_NOT_USED(thread)
+
+    /* the buffered rows are converted and loaded in as many passes as
+       needed when they do not fit in a single stream */
+
+    while (!wrk->failed && row_from < wrk->nb_rows)
+    {
+        const ub4 nb_rows = wrk->nb_rows - row_from;
+
+        unsigned int res = OCI_DPR_ERROR;
+
+        wrk->failed = !DirPathReset(dp) || !DirPathSetCurrentRows(dp, nb_rows);
+
+        for (ub4 i = 0; i < nb_rows && !wrk->failed; i++)
+        {
+            const ub4 row  = row_from + i;
+            ub1      *data = wrk->data + (size_t) row * ldr->row_size;
+
+            for (ub2 j = 0; j < ldr->nb_cols && !wrk->failed; j++)
+            {
+                const ub4 cell  = row * ldr->nb_cols + j;
+                void     *value = wrk->nulls[cell] ? NULL : data + ldr->offsets[j];
+
+                wrk->failed = !DirPathSetEntry(dp, i + 1, j + 1, value, wrk->lens[cell], TRUE);
+            }
+        }
+
+        if (wrk->failed)
+        {
+            break;
+        }
+
+        /* contexts run in force mode : rejected rows are skipped and counted */
+
+        res = DirPathConvert(dp);
+
+        if (OCI_DPR_COMPLETE != res && OCI_DPR_FULL != res)
+        {
+            wrk->failed = TRUE;
+            break;
+        }
+
+        wrk->nb_err += dp->nb_err;
+        row_from    += (OCI_DPR_COMPLETE == res) ? nb_rows : dp->nb_converted + dp->nb_err;
+
+        if (dp->nb_converted > 0)
+        {
+            wrk->failed = (OCI_DPR_ERROR == DirPathLoad(dp));
+            wrk->nb_err += dp->nb_err;
+        }
+        else if (OCI_DPR_FULL == res)
+        {
+            /* the stream cannot hold a single row */
+
+            wrk->failed = TRUE;
+        }
+        else
+        {
+            /* all rows were rejected, there is nothing to load */
+
+            dp->status = OCI_DPS_PREPARED;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderWait
+ * --------------------------------------------------------------------------------------------- */
+
+static void DirPathLoaderWait
+(
+    OCI_DirPathWorker *wrk
+)
+{
+    if (NULL != wrk->thread)
+    {
+        ThreadJoin(wrk->thread);
+        ThreadFree(wrk->thread);
+
+        wrk->thread  = NULL;
+        wrk->nb_rows = 0;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderDispatch
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean DirPathLoaderDispatch
+(
+    OCI_DirPathLoader *ldr,
+    OCI_DirPathWorker *wrk
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+
+    wrk->thread = ThreadCreate();
+    CHECK_NULL(wrk->thread)
+
+    if (!ThreadRun(wrk->thread, DirPathLoaderRun, wrk))
+    {
+        ThreadFree(wrk->thread);
+        wrk->thread = NULL;
+
+        CHECK(FALSE)
+    }
+
+    /* rows with no explicit target go to the next context from now on */
+
+    if (wrk == &ldr->workers[ldr->idx_worker])
+    {
+        ldr->idx_worker = (ldr->idx_worker + 1) % ldr->nb_workers;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_DirPathLoader * DirPathLoaderCreate
+(
+    OCI_Connection **cons,
+    unsigned int     nb_cons,
+    const otext     *name,
+    const otext    **partitions,
+    unsigned int     nb_cols,
+    unsigned int     nb_rows
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_DirPathLoader*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_DirPathLoader *ldr = NULL;
+
+    CHECK_PTR(OCI_IPC_VOID,   cons)
+    CHECK_PTR(OCI_IPC_STRING, name)
+    CHECK_MIN(nb_cons, 1)
+    CHECK_THREAD_ENABLED()
+
+    /* allocate loader structure */
+
+    ALLOC_DATA(OCI_IPC_DIRPATH_LOADER, ldr, 1)
+
+    ldr->con     = cons[0];
+    ldr->nb_cols = (ub2) nb_cols;
+    ldr->status  = OCI_DPS_NOT_PREPARED;
+
+    /* allocate the contexts */
+
+    ALLOC_DATA(OCI_IPC_DIRPATH_LOADER, ldr->workers, nb_cons)
+
+    ldr->nb_workers = (ub4) nb_cons;
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        OCI_DirPathWorker *wrk    = &ldr->workers[i];
+        OCI_TypeInfo      *typinf = NULL;
+
+        CHECK_PTR(OCI_IPC_CONNECTION, cons[i])
+
+        wrk->ldr = ldr;
+
+        typinf = TypeInfoGet(cons[i], name, OCI_TIF_TABLE);
+        CHECK_NULL(typinf)
+
+        wrk->dp = DirPathCreate(typinf, partitions ? partitions[i] : NULL, nb_cols, nb_rows);
+        CHECK_NULL(wrk->dp)
+
+        CHECK(DirPathSetConvertMode(wrk->dp, OCI_DCM_FORCE))
+
+        /* concurrent loads into the same segments require parallel mode */
+
+        if (ldr->nb_workers > 1 && NULL == partitions)
+        {
+            CHECK(DirPathSetParallel(wrk->dp, TRUE))
+        }
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            DirPathLoaderFree(ldr);
+            ldr = NULL;
+        }
+
+        SET_RETVAL(ldr)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderFree
+(
+    OCI_DirPathLoader *ldr
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+
+    /* a load that was neither finished nor aborted is aborted */
+
+    if (OCI_DPS_PREPARED == ldr->status)
+    {
+        DirPathLoaderAbort(ldr);
+    }
+
+    for (ub4 i = 0; ldr->workers && i < ldr->nb_workers; i++)
+    {
+        OCI_DirPathWorker *wrk = &ldr->workers[i];
+
+        DirPathLoaderWait(wrk);
+
+        if (NULL != wrk->dp)
+        {
+            DirPathFree(wrk->dp);
+            wrk->dp = NULL;
+        }
+
+        FREE(wrk->data)
+        FREE(wrk->lens)
+        FREE(wrk->nulls)
+    }
+
+    FREE(ldr->workers)
+    FREE(ldr->offsets)
+
+    ErrorResetSource(NULL, ldr);
+
+    FREE(ldr)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderSetColumn
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderSetColumn
+(
+    OCI_DirPathLoader *ldr,
+    unsigned int       index,
+    const otext       *name,
+    unsigned int       maxsize,
+    const otext       *format
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+    CHECK_DIRPATH_STATUS(ldr, OCI_DPS_NOT_PREPARED)
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        CHECK(DirPathSetColumn(ldr->workers[i].dp, index, name, maxsize, format))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetContextCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoaderGetContextCount
+(
+    OCI_DirPathLoader *ldr
+)
+{
+    GET_PROP
+    (
+        /* result */ unsigned int, 0,
+        /* handle */ OCI_IPC_DIRPATH_LOADER, ldr,
+        /* member */ nb_workers
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetContext
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_DirPath * DirPathLoaderGetContext
+(
+    OCI_DirPathLoader *ldr,
+    unsigned int       index
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_DirPath*, NULL,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+    CHECK_BOUND(index, 1, ldr->nb_workers)
+
+    SET_RETVAL(ldr->workers[index - 1].dp)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderPrepare
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderPrepare
+(
+    OCI_DirPathLoader *ldr
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    OCI_DirPath *dp = NULL;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+    CHECK_DIRPATH_STATUS(ldr, OCI_DPS_NOT_PREPARED)
+
+    /* prepare all contexts. The batch size is the smallest number of rows
+       granted to a context */
+
+    ldr->nb_rows = 0;
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        dp = ldr->workers[i].dp;
+
+        CHECK(DirPathPrepare(dp))
+
+        if (0 == ldr->nb_rows || dp->nb_rows < ldr->nb_rows)
+        {
+            ldr->nb_rows = dp->nb_rows;
+        }
+    }
+
+    /* compute the layout of a buffered row */
+
+    ALLOC_DATA(OCI_IPC_BUFF_ARRAY, ldr->offsets, ldr->nb_cols)
+
+    dp = ldr->workers[0].dp;
+
+    ldr->row_size = 0;
+
+    for (ub2 j = 0; j < ldr->nb_cols; j++)
+    {
+        ldr->offsets[j] = ldr->row_size;
+        ldr->row_size  += DirPathLoaderCellSize(&dp->cols[j]);
+    }
+
+    /* allocate the rows buffers of each context */
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        OCI_DirPathWorker *wrk = &ldr->workers[i];
+
+        ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, wrk->data,  ldr->row_size, ldr->nb_rows)
+        ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, wrk->lens,  sizeof(ub4),   ldr->nb_rows * ldr->nb_cols)
+        ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, wrk->nulls, sizeof(ub1),   ldr->nb_rows * ldr->nb_cols)
+    }
+
+    ldr->status = OCI_DPS_PREPARED;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderAddRow
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderAddRow
+(
+    OCI_DirPathLoader *ldr,
+    unsigned int       target,
+    void             **values,
+    unsigned int      *sizes
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    OCI_DirPathWorker *wrk  = NULL;
+    ub1               *data = NULL;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+    CHECK_PTR(OCI_IPC_VOID, values)
+    CHECK_PTR(OCI_IPC_VOID, sizes)
+    CHECK_DIRPATH_STATUS(ldr, OCI_DPS_PREPARED)
+    CHECK_MAX(target, ldr->nb_workers)
+
+    /* values longer than their column are rejected before buffering the row */
+
+    for (ub2 j = 0; j < ldr->nb_cols; j++)
+    {
+        if (NULL != values[j])
+        {
+            CHECK_MAX(sizes[j], ldr->workers[0].dp->cols[j].maxsize)
+        }
+    }
+
+    wrk = &ldr->workers[target > 0 ? target - 1 : ldr->idx_worker];
+
+    /* a context still loading its previous batch cannot take more rows */
+
+    DirPathLoaderWait(wrk);
+
+    if (wrk->failed)
+    {
+        THROW(ExceptionDirPathLoader, (int) (wrk - ldr->workers) + 1)
+    }
+
+    /* copy the row values into the context buffer */
+
+    data = wrk->data + (size_t) wrk->nb_rows * ldr->row_size;
+
+    for (ub2 j = 0; j < ldr->nb_cols; j++)
+    {
+        OCI_DirPathColumn *col  = &wrk->dp->cols[j];
+        const ub4          cell = wrk->nb_rows * ldr->nb_cols + j;
+
+        if (NULL == values[j])
+        {
+            wrk->nulls[cell] = TRUE;
+            wrk->lens[cell]  = 0;
+        }
+        else
+        {
+            const ub4 unit = DirPathLoaderUnitSize(col);
+            const ub4 size = sizes[j];
+
+            memcpy(data + ldr->offsets[j], values[j], (size_t) size * unit);
+
+            if (OCI_DDT_BINARY != col->type)
+            {
+                memset(data + ldr->offsets[j] + (size_t) size * unit, 0, sizeof(otext));
+            }
+
+            wrk->nulls[cell] = FALSE;
+            wrk->lens[cell]  = size;
+        }
+    }
+
+    wrk->nb_rows++;
+
+    /* hand a full batch over to the context thread */
+
+    if (wrk->nb_rows == ldr->nb_rows)
+    {
+        CHECK(DirPathLoaderDispatch(ldr, wrk))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderFinish
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderFinish
+(
+    OCI_DirPathLoader *ldr
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    ub4 failed = 0;
+    ub4 aborted = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+    CHECK_DIRPATH_STATUS(ldr, OCI_DPS_PREPARED)
+
+    /* send the partially filled batches */
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        OCI_DirPathWorker *wrk = &ldr->workers[i];
+
+        if (NULL == wrk->thread && wrk->nb_rows > 0 && !wrk->failed)
+        {
+            CHECK(DirPathLoaderDispatch(ldr, wrk))
+        }
+    }
+
+    /* wait for all loads */
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        DirPathLoaderWait(&ldr->workers[i]);
+
+        if (0 == failed && ldr->workers[i].failed)
+        {
+            failed = i + 1;
+        }
+    }
+
+    /* data is saved only if all contexts succeeded. If a load failed, no context
+       has been finished yet and all of them are aborted */
+
+    aborted = failed > 0 ? 0 : ldr->nb_workers;
+
+    for (ub4 i = 0; i < ldr->nb_workers && 0 == failed; i++)
+    {
+        if (!DirPathFinish(ldr->workers[i].dp))
+        {
+            failed  = i + 1;
+            aborted = i;
+        }
+    }
+
+    /* otherwise, the contexts not yet finished are aborted */
+
+    for (ub4 i = aborted; i < ldr->nb_workers; i++)
+    {
+        DirPathAbort(ldr->workers[i].dp);
+    }
+
+    ldr->status = OCI_DPS_TERMINATED;
+
+    if (failed > 0)
+    {
+        THROW(ExceptionDirPathLoader, (int) failed)
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderAbort
+ * --------------------------------------------------------------------------------------------- */
+
+boolean DirPathLoaderAbort
+(
+    OCI_DirPathLoader *ldr
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+    CHECK_DIRPATH_STATUS(ldr, OCI_DPS_PREPARED)
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        DirPathLoaderWait(&ldr->workers[i]);
+    }
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        DirPathAbort(ldr->workers[i].dp);
+    }
+
+    ldr->status = OCI_DPS_TERMINATED;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetRowCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoaderGetRowCount
+(
+    OCI_DirPathLoader *ldr
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    unsigned int count = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        count += DirPathGetRowCount(ldr->workers[i].dp);
+    }
+
+    SET_RETVAL(count)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * DirPathLoaderGetErrorCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int DirPathLoaderGetErrorCount
+(
+    OCI_DirPathLoader *ldr
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_DIRPATH_LOADER, ldr
+    )
+
+    unsigned int count = 0;
+
+    CHECK_PTR(OCI_IPC_DIRPATH_LOADER, ldr)
+
+    for (ub4 i = 0; i < ldr->nb_workers; i++)
+    {
+        count += ldr->workers[i].nb_err;
+    }
+
+    SET_RETVAL(count)
+
+    EXIT_FUNC()
+}
@@ -0,0 +1,94 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_DIRPATHLOADER_H_INCLUDED
+#define OCILIB_DIRPATHLOADER_H_INCLUDED
+
+#include "types.h"
+
+OCI_DirPathLoader * DirPathLoaderCreate
+(
+    OCI_Connection **cons,
+    unsigned int     nb_cons,
+    const otext     *name,
+    const otext    **partitions,
+    unsigned int     nb_cols,
+    unsigned int     nb_rows
+);
+
+boolean DirPathLoaderFree
+(
+    OCI_DirPathLoader *ldr
+);
+
+boolean DirPathLoaderSetColumn
+(
+    OCI_DirPathLoader *ldr,
+    unsigned int       index,
+    const otext       *name,
+    unsigned int       maxsize,
+    const otext       *format
+);
+
+unsigned int DirPathLoaderGetContextCount
+(
+    OCI_DirPathLoader *ldr
+);
+
+OCI_DirPath * DirPathLoaderGetContext
+(
+    OCI_DirPathLoader *ldr,
+    unsigned int       index
+);
+
+boolean DirPathLoaderPrepare
+(
+    OCI_DirPathLoader *ldr
+);
+
+boolean DirPathLoaderAddRow
+(
+    OCI_DirPathLoader *ldr,
+    unsigned int       target,
+    void             **values,
+    unsigned int      *sizes
+);
+
+boolean DirPathLoaderFinish
+(
+    OCI_DirPathLoader *ldr
+);
+
+boolean DirPathLoaderAbort
+(
+    OCI_DirPathLoader *ldr
+);
+
+unsigned int DirPathLoaderGetRowCount
+(
+    OCI_DirPathLoader *ldr
+);
+
+unsigned int DirPathLoaderGetErrorCount
+(
+    OCI_DirPathLoader *ldr
+);
+
+#endif /* OCILIB_DIRPATHLOADER_H_INCLUDED */
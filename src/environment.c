@@ -368,6 +368,7 @@ OCILOBLOADFROMFILE           OCILobLoadFromFile           = NULL;
 OCILOBWRITEAPPEND            OCILobWriteAppend            = NULL;
 OCISERVERVERSION             OCIServerVersion             = NULL;
 OCIBREAK                     OCIBreak                     = NULL;
+OCIRESET                     OCIReset                     = NULL;
 OCIATTRGET                   OCIAttrGet                   = NULL;
 OCIATTRSET                   OCIAttrSet                   = NULL;
 OCIDATEASSIGN                OCIDateAssign                = NULL;
@@ -497,6 +498,7 @@ OCIDIRPATHFINISH             OCIDirPathFinish             = NULL;
 OCIDIRPATHPREPARE            OCIDirPathPrepare            = NULL;
 OCIDIRPATHLOADSTREAM         OCIDirPathLoadStream         = NULL;
 OCIDIRPATHCOLARRAYENTRYSET   OCIDirPathColArrayEntrySet   = NULL;
+OCIDIRPATHCOLARRAYROWGET     OCIDirPathColArrayRowGet     = NULL;
 OCIDIRPATHCOLARRAYRESET      OCIDirPathColArrayReset      = NULL;
 OCIDIRPATHCOLARRAYTOSTREAM   OCIDirPathColArrayToStream   = NULL;
 OCIDIRPATHSTREAMRESET        OCIDirPathStreamReset        = NULL;
@@ -530,6 +532,8 @@ OCILOBREAD2         OCILobRead2         = NULL;
 OCILOBTRIM2         OCILobTrim2         = NULL;
 OCILOBWRITE2        OCILobWrite2        = NULL;
 OCILOBWRITEAPPEND2  OCILobWriteAppend2  = NULL;
+OCILOBARRAYREAD     OCILobArrayRead     = NULL;
+OCILOBARRAYWRITE    OCILobArrayWrite    = NULL;
 
   #endif /* ORAXB8_DEFINED */
 
@@ -763,6 +767,12 @@ boolean EnvironmentInitialize
 
   #endif
 
+  #if defined(OCI_BIG_UINT_ENABLED) && (OCI_VERSION_COMPILE >= OCI_10_2)
+
+    Env.use_lob_array = TRUE;
+
+  #endif
+
   #if defined(OCI_STMT_SCROLLABLE_READONLY)
 
     Env.use_scrollable_cursors = TRUE;
@@ -864,6 +874,8 @@ boolean EnvironmentInitialize
                    OCISERVERVERSION);
         LIB_SYMBOL(Env.lib_handle, "OCIBreak",              OCIBreak,
                    OCIBREAK);
+        LIB_SYMBOL(Env.lib_handle, "OCIReset",              OCIReset,
+                   OCIRESET);
 
         LIB_SYMBOL(Env.lib_handle, "OCIBindByPos",          OCIBindByPos,
                    OCIBINDBYPOS);
@@ -938,6 +950,10 @@ boolean EnvironmentInitialize
                    OCILOBWRITE2);
         LIB_SYMBOL(Env.lib_handle, "OCILobWriteAppend2",    OCILobWriteAppend2,
                    OCILOBWRITEAPPEND2);
+        LIB_SYMBOL(Env.lib_handle, "OCILobArrayRead",       OCILobArrayRead,
+                   OCILOBARRAYREAD);
+        LIB_SYMBOL(Env.lib_handle, "OCILobArrayWrite",      OCILobArrayWrite,
+                   OCILOBARRAYWRITE);
 
   #endif
 
@@ -1247,6 +1263,8 @@ boolean EnvironmentInitialize
                    OCIDIRPATHLOADSTREAM);
         LIB_SYMBOL(Env.lib_handle, "OCIDirPathColArrayEntrySet",   OCIDirPathColArrayEntrySet,
                    OCIDIRPATHCOLARRAYENTRYSET);
+        LIB_SYMBOL(Env.lib_handle, "OCIDirPathColArrayRowGet",     OCIDirPathColArrayRowGet,
+                   OCIDIRPATHCOLARRAYROWGET);
         LIB_SYMBOL(Env.lib_handle, "OCIDirPathColArrayReset",      OCIDirPathColArrayReset,
                    OCIDIRPATHCOLARRAYRESET);
         LIB_SYMBOL(Env.lib_handle, "OCIDirPathColArrayToStream",   OCIDirPathColArrayToStream,
@@ -1364,6 +1382,11 @@ boolean EnvironmentInitialize
         Env.use_lob_ub8 = TRUE;
     }
 
+    if ((Env.version_runtime >= OCI_10_2) && OCILobArrayRead && OCILobArrayWrite)
+    {
+        Env.use_lob_array = TRUE;
+    }
+
   #endif
 
   #if defined(OCI_STMT_SCROLLABLE_READONLY)
@@ -371,6 +371,10 @@ OCI_Connection * ErrorGetConnection
             return ((OCI_Dequeue*)err->source_ptr)->typinf->con;
         case OCI_IPC_AGENT:
             return ((OCI_Agent*)err->source_ptr)->con;
+        case OCI_IPC_BATCHER:
+            return ((OCI_Batcher*)err->source_ptr)->con;
+        case OCI_IPC_DIRPATH_LOADER:
+            return ((OCI_DirPathLoader*)err->source_ptr)->con;
     }
 
     return NULL;
@@ -69,6 +69,8 @@ static const otext * TypeNames[OCI_IPC_COUNT] =
     OTEXT("Enqueue handle"),
     OTEXT("Dequeue handle"),
     OTEXT("Agent handle"),
+    OTEXT("Batcher handle"),
+    OTEXT("Direct Path loader handle"),
 
     OTEXT("Internal list handle"),
     OTEXT("Internal list item handle"),
@@ -91,7 +93,14 @@ static const otext * TypeNames[OCI_IPC_COUNT] =
     OTEXT("Internal Long handle data buffer"),
     OTEXT("Internal trace info structure"),
     OTEXT("Internal array of direct path columns"),
-    OTEXT("Internal array of batch error objects")
+    OTEXT("Internal array of batch error objects"),
+    OTEXT("Internal array of statement handles"),
+    OTEXT("Internal result cache handle"),
+    OTEXT("Internal result cache entry"),
+    OTEXT("Internal prepared statement cache handle"),
+    OTEXT("Internal statement profiler handle"),
+    OTEXT("Internal describe cache handle"),
+    OTEXT("Internal array of batcher columns")
 };
 
 #if defined(OCI_CHARSET_WIDE) && !defined(_MSC_VER)
@@ -129,7 +138,14 @@ static const otext * ErrorMessages[OCI_ERR_COUNT] =
     OTEXT("Cannot retrieve OCI environment from XA connection string '%ls'"),
     OTEXT("Cannot connect to database using XA connection string '%ls'"),
     OTEXT("Binding '%ls': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
-    OTEXT("Found %d non freed allocated bytes")
+    OTEXT("Found %d non freed allocated bytes"),
+    OTEXT("A non blocking call is still pending on the connection"),
+    OTEXT("Direct path loader context %d failed, the load has been aborted"),
+    OTEXT("Cannot open file '%ls'"),
+    OTEXT("Arrow column %d has an unsupported format"),
+    OTEXT("Cannot read or write file '%ls'"),
+    OTEXT("Binding '%ls': the value producer failed at iteration %d"),
+    OTEXT("The integer parameter value must be at most %d")
 };
 
 #else
@@ -167,7 +183,14 @@ static const otext * ErrorMessages[OCI_ERR_COUNT] =
     OTEXT("Cannot retrieve OCI environment from XA connection string '%s'"),
     OTEXT("Cannot connect to database using XA connection string '%s'"),
     OTEXT("Binding '%s': Passing non NULL host variable is not allowed when bind allocation mode is internal"),
-    OTEXT("Found %d non freed allocated bytes")
+    OTEXT("Found %d non freed allocated bytes"),
+    OTEXT("A non blocking call is still pending on the connection"),
+    OTEXT("Direct path loader context %d failed, the load has been aborted"),
+    OTEXT("Cannot open file '%s'"),
+    OTEXT("Arrow column %d has an unsupported format"),
+    OTEXT("Cannot read or write file '%s'"),
+    OTEXT("Binding '%s': the value producer failed at iteration %d"),
+    OTEXT("The integer parameter value must be at most %d")
 };
 
 #endif
@@ -790,4 +813,95 @@ void ExceptionExternalBindingNotAllowed
 )
 {
     EXCEPTION_IMPL(OCI_ERR_BIND_EXTERNAL_NOT_ALLOWED, bind)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ExceptionAsyncPending
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionAsyncPending
+(
+    OCI_Context* ctx
+)
+{
+    EXCEPTION_IMPL_NO_ARGS(OCI_ERR_ASYNC_PENDING)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ExceptionDirPathLoader
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionDirPathLoader
+(
+    OCI_Context* ctx,
+    int          index
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_DIRPATH_LOADER, index)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ExceptionFileOpen
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionFileOpen
+(
+    OCI_Context * ctx,
+    const otext * name
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_FILE_OPEN, name)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ExceptionArrowFormat
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionArrowFormat
+(
+    OCI_Context* ctx,
+    int          index
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_ARROW_FORMAT, index)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ExceptionFileIO
+* --------------------------------------------------------------------------------------------- */
+
+void ExceptionFileIO
+(
+    OCI_Context * ctx,
+    const otext * name
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_FILE_IO, name)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ExceptionBindProducer
+ * --------------------------------------------------------------------------------------------- */
+
+void ExceptionBindProducer
+(
+    OCI_Context * ctx,
+    const otext * bind,
+    int           iter
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_BIND_PRODUCER, bind, iter)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ExceptionMaximumValue
+ * --------------------------------------------------------------------------------------------- */
+
+void ExceptionMaximumValue
+(
+    OCI_Context* ctx,
+    int          max
+)
+{
+    EXCEPTION_IMPL(OCI_ERR_MAX_VALUE, max)
 }
\ No newline at end of file
@@ -220,4 +220,46 @@ void ExceptionExternalBindingNotAllowed
     const otext * bind
 );
 
+void ExceptionAsyncPending
+(
+    OCI_Context* ctx
+);
+
+void ExceptionDirPathLoader
+(
+    OCI_Context* ctx,
+    int          index
+);
+
+void ExceptionFileOpen
+(
+    OCI_Context * ctx,
+    const otext * name
+);
+
+void ExceptionArrowFormat
+(
+    OCI_Context* ctx,
+    int          index
+);
+
+void ExceptionFileIO
+(
+    OCI_Context * ctx,
+    const otext * name
+);
+
+void ExceptionBindProducer
+(
+    OCI_Context * ctx,
+    const otext * bind,
+    int           iter
+);
+
+void ExceptionMaximumValue
+(
+    OCI_Context* ctx,
+    int          max
+);
+
 #endif /* OCILIB_EXCEPTION_H_INCLUDED */
@@ -20,13 +20,371 @@
 
 #include "format.h"
 
+#include "bind.h"
 #include "exception.h"
 #include "interval.h"
 #include "macros.h"
+#include "memory.h"
 #include "number.h"
 #include "reference.h"
+#include "statement.h"
 #include "timestamp.h"
 
+/* values bound by formatted calls are stored in slots aligned on 64 bits */
+
+#define FORMAT_SLOT_SIZE(size) (((size) + sizeof(big_int) - 1) & ~(sizeof(big_int) - 1))
+
+#define FORMAT_BIND_SCALAR(type, arg_type, func)                 \
+                                                                 \
+    {                                                            \
+        const type value = (type) va_arg(*pargs, arg_type);      \
+                                                                 \
+        if (buf)                                                 \
+        {                                                        \
+            *(type *) (buf + offset) = value;                    \
+                                                                 \
+            CHECK(func(stmt, name, (type *) (buf + offset)))     \
+        }                                                        \
+                                                                 \
+        offset += (unsigned int) FORMAT_SLOT_SIZE(sizeof(type)); \
+    }                                                            \
+
+#define FORMAT_BIND_HANDLE(type, func)                                    \
+                                                                          \
+    {                                                                     \
+        type *value = (type *) va_arg(*pargs, type *);                    \
+                                                                          \
+        if (value)                                                        \
+        {                                                                 \
+            if (buf)                                                      \
+            {                                                             \
+                CHECK(func(stmt, name, value))                            \
+            }                                                             \
+        }                                                                 \
+        else                                                              \
+        {                                                                 \
+            if (buf)                                                      \
+            {                                                             \
+                CHECK(FormatBindNull(stmt, name, buf + offset))           \
+            }                                                             \
+                                                                          \
+            offset += (unsigned int) FORMAT_SLOT_SIZE(2 * sizeof(otext)); \
+        }                                                                 \
+    }                                                                     \
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatIsBindable
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean FormatIsBindable
+(
+    const otext *pf
+)
+{
+    switch (*pf)
+    {
+        case OTEXT('s'):
+        case OTEXT('t'):
+        case OTEXT('p'):
+        case OTEXT('v'):
+        case OTEXT('i'):
+        case OTEXT('u'):
+        case OTEXT('g'):
+        case OTEXT('n'):
+        {
+            return TRUE;
+        }
+        case OTEXT('l'):
+        case OTEXT('h'):
+        {
+            return (OTEXT('i') == pf[1]) || (OTEXT('u') == pf[1]);
+        }
+        default:
+        {
+            return FALSE;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatIsDdl
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean FormatIsDdl
+(
+    const otext *format
+)
+{
+    /* DDL statements cannot have bind variables : their values are always inlined */
+
+    static const otext *keywords[] =
+    {
+        OTEXT("ALTER"),   OTEXT("ANALYZE"), OTEXT("AUDIT"),    OTEXT("COMMENT"),
+        OTEXT("CREATE"),  OTEXT("DROP"),    OTEXT("GRANT"),    OTEXT("NOAUDIT"),
+        OTEXT("PURGE"),   OTEXT("RENAME"),  OTEXT("REVOKE"),   OTEXT("TRUNCATE")
+    };
+
+    otext word[16];
+    size_t len = 0;
+
+    while (OTEXT(' ') == *format || OTEXT('\t') == *format ||
+           OTEXT('\r') == *format || OTEXT('\n') == *format)
+    {
+        format++;
+    }
+
+    while (len < (size_t) (osizeof(word) - 1) &&
+           ((*format >= OTEXT('a') && *format <= OTEXT('z')) ||
+            (*format >= OTEXT('A') && *format <= OTEXT('Z'))))
+    {
+        word[len++] = *format++;
+    }
+
+    word[len] = 0;
+
+    for (int i = 0; i < (int) (sizeof(keywords) / sizeof(keywords[0])); i++)
+    {
+        if (0 == ostrcasecmp(word, keywords[i]))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatSkipValue
+ * --------------------------------------------------------------------------------------------- */
+
+static void FormatSkipValue
+(
+    const otext **ppf,
+    va_list      *pargs
+)
+{
+    switch (**ppf)
+    {
+        case OTEXT('i'):
+        case OTEXT('u'):
+        {
+            (void) va_arg(*pargs, int);
+            break;
+        }
+        case OTEXT('g'):
+        {
+            (void) va_arg(*pargs, double);
+            break;
+        }
+        case OTEXT('l'):
+        {
+            (*ppf)++;
+
+            if ((OTEXT('i') == **ppf) || (OTEXT('u') == **ppf))
+            {
+                (void) va_arg(*pargs, big_int);
+            }
+            break;
+        }
+        case OTEXT('h'):
+        {
+            /* short int must be passed as int to va_args */
+
+            (*ppf)++;
+
+            if ((OTEXT('i') == **ppf) || (OTEXT('u') == **ppf))
+            {
+                (void) va_arg(*pargs, int);
+            }
+            break;
+        }
+        default:
+        {
+            /* strings and handles */
+
+            (void) va_arg(*pargs, void *);
+            break;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatBindNull
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean FormatBindNull
+(
+    OCI_Statement *stmt,
+    const otext   *name,
+    ub1           *data
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    /* null values are bound as null strings that are converted by the server as needed */
+
+    CHECK(StatementBindString(stmt, name, (otext *) data, 1))
+    CHECK(BindSetNull(stmt->ubinds[stmt->nb_ubinds - 1]))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatBindValues
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean FormatBindValues
+(
+    OCI_Statement *stmt,
+    ub1           *buf,
+    unsigned int  *size,
+    const otext   *format,
+    va_list       *pargs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    otext        name[16];
+    unsigned int nb_binds = 0;
+    unsigned int offset   = 0;
+
+    for (const otext *pf = format; *pf; pf++)
+    {
+        if (OTEXT('%') != *pf)
+        {
+            continue;
+        }
+
+        if (OTEXT('%') == *(++pf))
+        {
+            continue;
+        }
+
+        /* values that are not bindable are inlined in the SQL text */
+
+        if (!FormatIsBindable(pf))
+        {
+            FormatSkipValue(&pf, pargs);
+            continue;
+        }
+
+        osprintf(name, (int) osizeof(name) - 1, OTEXT(":%u"), ++nb_binds);
+
+        switch (*pf)
+        {
+            case OTEXT('s'):
+            {
+                const otext *str = (const otext *) va_arg(*pargs, const otext *);
+
+                if (IS_STRING_VALID(str))
+                {
+                    const unsigned int len = (unsigned int) ostrlen(str);
+
+                    if (buf)
+                    {
+                        ostrcpy((otext *) (buf + offset), str);
+
+                        CHECK(StatementBindString(stmt, name, (otext *) (buf + offset), len))
+                    }
+
+                    offset += (unsigned int) FORMAT_SLOT_SIZE((len + 1) * sizeof(otext));
+                }
+                else
+                {
+                    if (buf)
+                    {
+                        CHECK(FormatBindNull(stmt, name, buf + offset))
+                    }
+
+                    offset += (unsigned int) FORMAT_SLOT_SIZE(2 * sizeof(otext));
+                }
+                break;
+            }
+            case OTEXT('t'):
+            {
+                FORMAT_BIND_HANDLE(OCI_Date, StatementBindDate)
+                break;
+            }
+            case OTEXT('p'):
+            {
+                FORMAT_BIND_HANDLE(OCI_Timestamp, StatementBindTimestamp)
+                break;
+            }
+            case OTEXT('v'):
+            {
+                FORMAT_BIND_HANDLE(OCI_Interval, StatementBindInterval)
+                break;
+            }
+            case OTEXT('n'):
+            {
+                FORMAT_BIND_HANDLE(OCI_Number, StatementBindNumber)
+                break;
+            }
+            case OTEXT('i'):
+            {
+                FORMAT_BIND_SCALAR(int, int, StatementBindInt)
+                break;
+            }
+            case OTEXT('u'):
+            {
+                FORMAT_BIND_SCALAR(unsigned int, unsigned int, StatementBindUnsignedInt)
+                break;
+            }
+            case OTEXT('g'):
+            {
+                FORMAT_BIND_SCALAR(double, double, StatementBindDouble)
+                break;
+            }
+            case OTEXT('l'):
+            {
+                pf++;
+
+                if (OTEXT('i') == *pf)
+                {
+                    FORMAT_BIND_SCALAR(big_int, big_int, StatementBindBigInt)
+                }
+                else
+                {
+                    FORMAT_BIND_SCALAR(big_uint, big_uint, StatementBindUnsignedBigInt)
+                }
+                break;
+            }
+            case OTEXT('h'):
+            {
+                /* short int must be passed as int to va_args */
+
+                pf++;
+
+                if (OTEXT('i') == *pf)
+                {
+                    FORMAT_BIND_SCALAR(short, int, StatementBindShort)
+                }
+                else
+                {
+                    FORMAT_BIND_SCALAR(unsigned short, unsigned int, StatementBindUnsignedShort)
+                }
+                break;
+            }
+        }
+    }
+
+    *size = offset;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ParseSqlFmt
  * --------------------------------------------------------------------------------------------- */
@@ -51,9 +409,13 @@ int FormatParseSql
     otext       *pb    = buf;
     const otext *pf    = format;
 
+    unsigned int nb_binds = 0;
+
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     CHECK_PTR(OCI_IPC_STRING,    format)
 
+    const boolean binds = stmt->con->fmt_binds && !FormatIsDdl(format);
+
     for (; *pf; pf++)
     {
         if (*pf != OTEXT('%'))
@@ -83,6 +445,28 @@ int FormatParseSql
             }
         }
 
+        /* with format binding, bindable values are replaced by bind placeholders */
+
+        if (binds && quote && FormatIsBindable(pf))
+        {
+            otext temp[16];
+
+            FormatSkipValue(&pf, pargs);
+
+            len = (int) osprintf(temp, (int) osizeof(temp) - 1, OTEXT(":%u"), ++nb_binds);
+
+            if (buf)
+            {
+                ostrcpy(pb, temp);
+
+                pb += (size_t) len;
+            }
+
+            size += len;
+
+            continue;
+        }
+
         switch (*pf)
         {
             case OTEXT('s'):
@@ -403,3 +787,70 @@ int FormatParseSql
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * FormatBindSql
+ * --------------------------------------------------------------------------------------------- */
+
+boolean FormatBindSql
+(
+    OCI_Statement *stmt,
+    const otext   *format,
+    va_list       *pargs
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    va_list first_pass_args;
+
+    unsigned int size = 0;
+    unsigned int bind_alloc_mode = OCI_UNKNOWN;
+
+    va_copy(first_pass_args, *pargs);
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_STRING,    format)
+
+    /* values of DDL statements have been inlined by FormatParseSql() */
+
+    if (FormatIsDdl(format))
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    /* first, get the size of the values storage */
+
+    CHECK(FormatBindValues(stmt, NULL, &size, format, &first_pass_args))
+
+    FREE(stmt->fmt_values)
+
+    if (size > 0)
+    {
+        ALLOC_DATA(OCI_IPC_BUFF_ARRAY, stmt->fmt_values, size)
+    }
+
+    /* values are bound from the storage owned by the statement */
+
+    bind_alloc_mode = stmt->bind_alloc_mode;
+
+    stmt->bind_alloc_mode = OCI_BAM_EXTERNAL;
+
+    CHECK(FormatBindValues(stmt, stmt->fmt_values, &size, format, pargs))
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        va_end(first_pass_args);
+
+        if (OCI_UNKNOWN != bind_alloc_mode)
+        {
+            stmt->bind_alloc_mode = bind_alloc_mode;
+        }
+    )
+}
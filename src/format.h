@@ -31,4 +31,11 @@ int FormatParseSql
     va_list      * pargs
 );
 
+boolean FormatBindSql
+(
+    OCI_Statement* stmt,
+    const otext  * format,
+    va_list      * pargs
+);
+
 #endif /* OCILIB_FORMAT_H_INCLUDED */
@@ -25,9 +25,11 @@
 #include "file.h"
 #include "interval.h"
 #include "lob.h"
+#include "memory.h"
 #include "number.h"
 #include "object.h"
 #include "reference.h"
+#include "strings.h"
 #include "timestamp.h"
 
 /* --------------------------------------------------------------------------------------------- *
@@ -229,3 +231,57 @@ boolean FreeObjectFromType
 
     return res;
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * ComputeStringHash
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ComputeStringHash
+(
+    const otext *str
+)
+{
+    unsigned int hash = 0;
+
+    for (const otext *p = str; (*p) != 0; p++)
+    {
+        hash = 31 * hash + (unsigned int) (*p);
+    }
+
+    return hash;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * OpenLocalFile
+ * --------------------------------------------------------------------------------------------- */
+
+FILE * OpenLocalFile
+(
+    const otext *name,
+    const char  *mode
+)
+{
+    FILE *file = NULL;
+
+#ifdef OCI_CHARSET_WIDE
+
+    const int len  = (int) ostrlen(name);
+    char     *path = (char *) MemoryAlloc(OCI_IPC_STRING, sizeof(char), (size_t) len + 1, TRUE);
+
+    if (NULL != path)
+    {
+        StringNativeToAnsi(name, path, len);
+
+        file = fopen(path, mode);
+
+        MemoryFree(path);
+    }
+
+#else
+
+    file = fopen(name, mode);
+
+#endif
+
+    return file;
+}
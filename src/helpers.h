@@ -41,4 +41,15 @@ boolean FreeObjectFromType
     unsigned int type
 );
 
+unsigned int ComputeStringHash
+(
+    const otext *str
+);
+
+FILE * OpenLocalFile
+(
+    const otext *name,
+    const char  *mode
+);
+
 #endif /* OCILIB_HELPERS_H_INCLUDED */
@@ -138,6 +138,7 @@ extern OCILOBLOADFROMFILE           OCILobLoadFromFile;
 extern OCILOBWRITEAPPEND            OCILobWriteAppend;
 extern OCISERVERVERSION             OCIServerVersion;
 extern OCIBREAK                     OCIBreak;
+extern OCIRESET                     OCIReset;
 extern OCIATTRGET                   OCIAttrGet;
 extern OCIATTRSET                   OCIAttrSet;
 extern OCIDATEASSIGN                OCIDateAssign;
@@ -267,6 +268,7 @@ extern OCIDIRPATHFINISH             OCIDirPathFinish;
 extern OCIDIRPATHPREPARE            OCIDirPathPrepare;
 extern OCIDIRPATHLOADSTREAM         OCIDirPathLoadStream;
 extern OCIDIRPATHCOLARRAYENTRYSET   OCIDirPathColArrayEntrySet;
+extern OCIDIRPATHCOLARRAYROWGET     OCIDirPathColArrayRowGet;
 extern OCIDIRPATHCOLARRAYRESET      OCIDirPathColArrayReset;
 extern OCIDIRPATHCOLARRAYTOSTREAM   OCIDirPathColArrayToStream;
 extern OCIDIRPATHSTREAMRESET        OCIDirPathStreamReset;
@@ -299,6 +301,8 @@ extern OCILOBREAD2         OCILobRead2;
 extern OCILOBTRIM2         OCILobTrim2;
 extern OCILOBWRITE2        OCILobWrite2;
 extern OCILOBWRITEAPPEND2  OCILobWriteAppend2;
+extern OCILOBARRAYREAD     OCILobArrayRead;
+extern OCILOBARRAYWRITE    OCILobArrayWrite;
 
     #endif
 
@@ -21,7 +21,9 @@
 #include "lob.h"
 
 #include "array.h"
+#include "callback.h"
 #include "connection.h"
+#include "helpers.h"
 #include "macros.h"
 #include "memory.h"
 #include "strings.h"
@@ -370,10 +372,34 @@ big_uint LobGetOffset
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * LobRead2
+ * LobPrepareRead
  * --------------------------------------------------------------------------------------------- */
 
-boolean LobRead2
+static void LobPrepareRead
+(
+    OCI_Lob      *lob,
+    unsigned int *char_count,
+    unsigned int *byte_count
+)
+{
+    if ((OCI_BLOB != lob->type) && ((*byte_count) == 0) && ((*char_count) > 0))
+    {
+        if (Env.nls_utf8)
+        {
+            (*byte_count) = (*char_count) * (ub4)OCI_UTF8_BYTES_PER_CHAR;
+        }
+        else
+        {
+            (*byte_count) = (*char_count) * (ub4) sizeof(dbtext);
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobCompleteRead
+ * --------------------------------------------------------------------------------------------- */
+
+static void LobCompleteRead
 (
     OCI_Lob      *lob,
     void         *buffer,
@@ -381,37 +407,151 @@ boolean LobRead2
     unsigned int *byte_count
 )
 {
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_LOB, lob
-    )
+    if (OCI_BLOB != lob->type)
+    {
+        ub4 ora_byte_count = (ub4) *byte_count;
 
-    ub1 csfrm = 0;
-    ub2 csid = 0;
+        if (!Env.use_lob_ub8 && !Env.nls_utf8)
+        {
+            ora_byte_count *= sizeof(dbtext);
+        }
 
-    CHECK_PTR(OCI_IPC_LOB, lob)
-    CHECK_PTR(OCI_IPC_INT, char_count)
-    CHECK_PTR(OCI_IPC_INT, byte_count)
+        memset(((char *) buffer) + ora_byte_count, 0, sizeof(dbtext));
 
-    if (OCI_BLOB != lob->type)
+#ifndef OCI_LOB2_API_ENABLED
+
+        if (Env.nls_utf8)
+        {
+            (*char_count) = (ub4) StringLength((const char *)buffer, sizeof(char));
+        }
+
+#endif
+
+    }
+
+    if (OCI_BLOB == lob->type)
     {
-        if (OCI_CHAR_WIDE == Env.charset)
+        lob->offset += (big_uint) (*byte_count);
+    }
+    else
+    {
+        lob->offset += (big_uint) (*char_count);
+
+        if (!Env.nls_utf8 && Env.use_wide_char_conv)
         {
-            csid = OCI_UTF16ID;
+            StringUTF16ToUTF32(buffer, buffer, (int) (*char_count));
+            (*byte_count) = (ub4) (*char_count) * (ub4) sizeof(otext);
         }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobPrepareWrite
+ * --------------------------------------------------------------------------------------------- */
+
+static void * LobPrepareWrite
+(
+    OCI_Lob      *lob,
+    void         *buffer,
+    unsigned int *char_count,
+    unsigned int *byte_count
+)
+{
+    void *obuf = NULL;
 
+    if (OCI_BLOB != lob->type)
+    {
         if (((*byte_count) == 0) && ((*char_count) > 0))
         {
             if (Env.nls_utf8)
             {
-                (*byte_count) = (*char_count) * (ub4)OCI_UTF8_BYTES_PER_CHAR;
+                (*byte_count) = (unsigned int) strlen((const char *) buffer);
+            }
+            else
+            {
+                (*byte_count) = (*char_count) * (ub4) sizeof(otext);
+            }
+        }
+
+        if (((*char_count) == 0) && ((*byte_count) > 0))
+        {
+            if (Env.nls_utf8 )
+            {
+
+#ifndef OCI_LOB2_API_ENABLED
+
+                (*char_count) = (ub4) StringLength((const char *)buffer, sizeof(char));
+
+#endif
+
             }
             else
             {
-                (*byte_count) = (*char_count) * (ub4) sizeof(dbtext);
+                (*char_count) = (*byte_count) / (ub4) sizeof(otext);
             }
         }
+
+        obuf = StringGetDBString( (otext *) buffer, (int *) byte_count);
+    }
+    else
+    {
+        obuf = buffer;
+    }
+
+    return obuf;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobCompleteWrite
+ * --------------------------------------------------------------------------------------------- */
+
+static void LobCompleteWrite
+(
+    OCI_Lob      *lob,
+    unsigned int *char_count,
+    unsigned int *byte_count
+)
+{
+    if (OCI_BLOB == lob->type)
+    {
+        lob->offset += (big_uint) (*byte_count);
+    }
+    else
+    {
+        lob->offset += (big_uint) (*char_count);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobRead2
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobRead2
+(
+    OCI_Lob      *lob,
+    void         *buffer,
+    unsigned int *char_count,
+    unsigned int *byte_count
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_LOB, lob
+    )
+
+    ub1 csfrm = 0;
+    ub2 csid = 0;
+
+    CHECK_PTR(OCI_IPC_LOB, lob)
+    CHECK_PTR(OCI_IPC_INT, char_count)
+    CHECK_PTR(OCI_IPC_INT, byte_count)
+
+    LobPrepareRead(lob, char_count, byte_count);
+
+    if ((OCI_BLOB != lob->type) && (OCI_CHAR_WIDE == Env.charset))
+    {
+        csid = OCI_UTF16ID;
     }
 
     csfrm = (OCI_NCLOB == lob->type) ? SQLCS_NCHAR : SQLCS_IMPLICIT;
@@ -459,42 +599,7 @@ boolean LobRead2
         (*byte_count)     = (ub4) size_in_out_char_byte;
     }
 
-    if (OCI_BLOB != lob->type)
-    {
-        ub4 ora_byte_count = (ub4) *byte_count;
-
-        if (!Env.use_lob_ub8 && !Env.nls_utf8)
-        {
-            ora_byte_count *= sizeof(dbtext);
-        }
-
-        memset(((char *) buffer) + ora_byte_count, 0, sizeof(dbtext));
-
-#ifndef OCI_LOB2_API_ENABLED
-
-        if (Env.nls_utf8)
-        {
-            (*char_count) = (ub4) StringLength((const char *)buffer, sizeof(char));
-        }
-
-#endif
-
-    }
-
-    if (OCI_BLOB == lob->type)
-    {
-        lob->offset += (big_uint) (*byte_count);
-    }
-    else
-    {
-        lob->offset += (big_uint) (*char_count);
-
-        if (!Env.nls_utf8 && Env.use_wide_char_conv)
-        {
-            StringUTF16ToUTF32(buffer, buffer, (int) (*char_count));
-            (*byte_count) = (ub4) (*char_count) * (ub4) sizeof(otext);
-        }
-    }
+    LobCompleteRead(lob, buffer, char_count, byte_count);
 
     SET_SUCCESS()
 
@@ -561,50 +666,13 @@ boolean LobWrite2
     CHECK_PTR(OCI_IPC_INT, char_count)
     CHECK_PTR(OCI_IPC_INT, byte_count)
 
-    if (OCI_BLOB != lob->type)
-    {
-        if (OCI_CHAR_WIDE == Env.charset)
-        {
-            csid = OCI_UTF16ID;
-        }
-
-        if (((*byte_count) == 0) && ((*char_count) > 0))
-        {
-            if (Env.nls_utf8)
-            {
-                (*byte_count) = (unsigned int) strlen((const char *) buffer);
-            }
-            else
-            {
-                (*byte_count) = (*char_count) * (ub4) sizeof(otext);
-            }
-        }
-
-        if (((*char_count) == 0) && ((*byte_count) > 0))
-        {
-            if (Env.nls_utf8 )
-            {
-
-#ifndef OCI_LOB2_API_ENABLED
-
-                (*char_count) = (ub4) StringLength((const char *)buffer, sizeof(char));
-
-#endif
-
-            }
-            else
-            {
-                (*char_count) = (*byte_count) / (ub4) sizeof(otext);
-            }
-        }
-
-        obuf = StringGetDBString( (otext *) buffer, (int *) byte_count);
-    }
-    else
+    if ((OCI_BLOB != lob->type) && (OCI_CHAR_WIDE == Env.charset))
     {
-        obuf = buffer;
+        csid = OCI_UTF16ID;
     }
 
+    obuf = LobPrepareWrite(lob, buffer, char_count, byte_count);
+
     csfrm = (OCI_NCLOB == lob->type) ? SQLCS_NCHAR : SQLCS_IMPLICIT;
 
 #ifdef OCI_LOB2_API_ENABLED
@@ -664,14 +732,7 @@ boolean LobWrite2
         }
     }
 
-    if (OCI_BLOB == lob->type)
-    {
-        lob->offset += (big_uint) (*byte_count);
-    }
-    else
-    {
-        lob->offset += (big_uint) (*char_count);
-    }
+    LobCompleteWrite(lob, char_count, byte_count);
 
     SET_SUCCESS()
 
@@ -718,6 +779,757 @@ unsigned int LobWrite
     return (NULL != ptr_count ? *ptr_count : 0);
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * LobCheckArray
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean LobCheckArray
+(
+    OCI_Lob    **lobs,
+    unsigned int count,
+    void       **buffers
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    CHECK_PTR(OCI_IPC_ARRAY, lobs)
+    CHECK_PTR(OCI_IPC_ARRAY, buffers)
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        CHECK_PTR(OCI_IPC_LOB, lobs[i])
+        CHECK_PTR(OCI_IPC_VOID, buffers[i])
+
+        if (lobs[i]->type != lobs[0]->type)
+        {
+            THROW_NO_ARGS(ExceptionTypeNotCompatible)
+        }
+
+        if (lobs[i]->con != lobs[0]->con)
+        {
+            THROW(ExceptionArgInvalidValue, OTEXT("Lob connection"), i + 1)
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobReadArray
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobReadArray
+(
+    OCI_Lob     **lobs,
+    unsigned int  count,
+    void        **buffers,
+    unsigned int *char_counts,
+    unsigned int *byte_counts
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCILobLocator **locs    = NULL;
+    ub8            *amounts = NULL;
+
+    CHECK_PTR(OCI_IPC_INT, char_counts)
+    CHECK_PTR(OCI_IPC_INT, byte_counts)
+    CHECK(LobCheckArray(lobs, count, buffers))
+
+#if defined(OCI_LOB2_API_ENABLED) && (OCI_VERSION_COMPILE >= OCI_10_2)
+
+    if (Env.use_lob_array && count > 1)
+    {
+        OCI_Connection *con      = lobs[0]->con;
+        ub1             csfrm    = 0;
+        ub2             csid     = 0;
+        ub4             nb_iters = (ub4) count;
+
+        /* amounts holds the byte counts, char counts, offsets and buffer sizes of all lobs */
+
+        ALLOC_DATA(OCI_IPC_VOID, locs, count)
+        ALLOC_DATA(OCI_IPC_VOID, amounts, count * 4)
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            LobPrepareRead(lobs[i], &char_counts[i], &byte_counts[i]);
+
+            locs[i]                = lobs[i]->handle;
+            amounts[i]             = (ub8) byte_counts[i];
+            amounts[i + count]     = (ub8) char_counts[i];
+            amounts[i + count * 2] = (ub8) lobs[i]->offset;
+            amounts[i + count * 3] = (ub8) byte_counts[i];
+        }
+
+        if ((OCI_BLOB != lobs[0]->type) && (OCI_CHAR_WIDE == Env.charset))
+        {
+            csid = OCI_UTF16ID;
+        }
+
+        csfrm = (OCI_NCLOB == lobs[0]->type) ? SQLCS_NCHAR : SQLCS_IMPLICIT;
+
+        CHECK_OCI
+        (
+            con->err,
+            OCILobArrayRead,
+            con->cxt, con->err, &nb_iters, locs,
+            amounts, amounts + count, amounts + count * 2,
+            buffers, amounts + count * 3,
+            (ub1) OCI_ONE_PIECE, (void *) NULL,
+            NULL, csid, csfrm
+        )
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            byte_counts[i] = (unsigned int) amounts[i];
+            char_counts[i] = (unsigned int) amounts[i + count];
+
+            LobCompleteRead(lobs[i], buffers[i], &char_counts[i], &byte_counts[i]);
+        }
+    }
+    else
+
+#endif
+
+    {
+        for (unsigned int i = 0; i < count; i++)
+        {
+            CHECK(LobRead2(lobs[i], buffers[i], &char_counts[i], &byte_counts[i]))
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        FREE(locs)
+        FREE(amounts)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobWriteArray
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobWriteArray
+(
+    OCI_Lob     **lobs,
+    unsigned int  count,
+    void        **buffers,
+    unsigned int *char_counts,
+    unsigned int *byte_counts
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCILobLocator **locs    = NULL;
+    void          **obufs   = NULL;
+    ub8            *amounts = NULL;
+
+    CHECK_PTR(OCI_IPC_INT, char_counts)
+    CHECK_PTR(OCI_IPC_INT, byte_counts)
+    CHECK(LobCheckArray(lobs, count, buffers))
+
+#if defined(OCI_LOB2_API_ENABLED) && (OCI_VERSION_COMPILE >= OCI_10_2)
+
+    if (Env.use_lob_array && count > 1)
+    {
+        OCI_Connection *con      = lobs[0]->con;
+        ub1             csfrm    = 0;
+        ub2             csid     = 0;
+        ub4             nb_iters = (ub4) count;
+
+        /* amounts holds the byte counts, char counts, offsets and buffer sizes of all lobs */
+
+        ALLOC_DATA(OCI_IPC_VOID, locs, count)
+        ALLOC_DATA(OCI_IPC_VOID, obufs, count)
+        ALLOC_DATA(OCI_IPC_VOID, amounts, count * 4)
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            obufs[i] = LobPrepareWrite(lobs[i], buffers[i], &char_counts[i], &byte_counts[i]);
+
+            locs[i]                = lobs[i]->handle;
+            amounts[i]             = (ub8) byte_counts[i];
+            amounts[i + count]     = (ub8) char_counts[i];
+            amounts[i + count * 2] = (ub8) lobs[i]->offset;
+            amounts[i + count * 3] = (ub8) byte_counts[i];
+        }
+
+        if ((OCI_BLOB != lobs[0]->type) && (OCI_CHAR_WIDE == Env.charset))
+        {
+            csid = OCI_UTF16ID;
+        }
+
+        csfrm = (OCI_NCLOB == lobs[0]->type) ? SQLCS_NCHAR : SQLCS_IMPLICIT;
+
+        CHECK_OCI
+        (
+            con->err,
+            OCILobArrayWrite,
+            con->cxt, con->err, &nb_iters, locs,
+            amounts, amounts + count, amounts + count * 2,
+            obufs, amounts + count * 3,
+            (ub1) OCI_ONE_PIECE, (void *) NULL,
+            NULL, csid, csfrm
+        )
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            byte_counts[i] = (unsigned int) amounts[i];
+            char_counts[i] = (unsigned int) amounts[i + count];
+
+            LobCompleteWrite(lobs[i], &char_counts[i], &byte_counts[i]);
+        }
+    }
+    else
+
+#endif
+
+    {
+        for (unsigned int i = 0; i < count; i++)
+        {
+            CHECK(LobWrite2(lobs[i], buffers[i], &char_counts[i], &byte_counts[i]))
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != obufs)
+        {
+            for (unsigned int i = 0; i < count; i++)
+            {
+                if (NULL != obufs[i] && obufs[i] != buffers[i])
+                {
+                    StringReleaseDBString((dbtext*)obufs[i]);
+                }
+            }
+        }
+
+        FREE(locs)
+        FREE(obufs)
+        FREE(amounts)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamCountChars
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int LobStreamCountChars
+(
+    const void  *buffer,
+    unsigned int size
+)
+{
+    unsigned int count = size / (unsigned int) sizeof(dbtext);
+
+    if (Env.nls_utf8)
+    {
+        const ub1 *str = (const ub1 *) buffer;
+
+        /* count UTF8 leading bytes, pieces may split multi bytes characters */
+
+        count = 0;
+
+        for (unsigned int i = 0; i < size; i++)
+        {
+            if ((str[i] & 0xC0) != 0x80)
+            {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamAllocate
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean LobStreamAllocate
+(
+    OCI_LobStream *ls,
+    unsigned int   nb_pieces
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_LOB, ls->lob
+    )
+
+    unsigned int chunk = LobGetChunkSize(ls->lob);
+    unsigned int ratio = 1;
+
+    /* pieces are a multiple of the lob chunk size. For character lobs, the chunk size is
+       expressed in characters and the buffers must hold the UTF32 translation of UTF16 pieces */
+
+    if (OCI_BLOB != ls->lob->type)
+    {
+        chunk *= (unsigned int) sizeof(dbtext);
+
+        if (Env.use_wide_char_conv)
+        {
+            ratio = (unsigned int) (sizeof(otext) / sizeof(dbtext));
+        }
+    }
+
+    ls->piece = OCI_SIZE_LOB_STREAM;
+
+    if (chunk > 0)
+    {
+        ls->piece = max(1, OCI_SIZE_LOB_STREAM / chunk) * chunk;
+    }
+
+    ls->stride = ls->piece * ratio + (unsigned int) sizeof(otext);
+
+    ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, ls->buffer, ls->stride, nb_pieces)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamPush
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobStreamPush
+(
+    OCI_LobStream *ls,
+    void          *buffer,
+    unsigned int   size
+)
+{
+    if (OCI_BLOB != ls->lob->type)
+    {
+        ls->chars += LobStreamCountChars(buffer, size);
+
+        if (Env.use_wide_char_conv)
+        {
+            const int count = (int) (size / sizeof(dbtext));
+
+            StringUTF16ToUTF32(buffer, buffer, count);
+
+            size = (unsigned int) count * (unsigned int) sizeof(otext);
+        }
+    }
+
+    ls->bytes  += size;
+    ls->stopped = !ls->sink(ls->lob, buffer, size, ls->ctx);
+
+    return !ls->stopped;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamPull
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int LobStreamPull
+(
+    OCI_LobStream *ls,
+    unsigned int   index
+)
+{
+    void              *buffer   = ls->buffer + (size_t) index * ls->stride;
+    const unsigned int max_size = ls->stride - (unsigned int) sizeof(otext);
+    unsigned int       size     = ls->source(ls->lob, buffer, max_size, ls->ctx);
+
+    if (size > max_size)
+    {
+        size = max_size;
+    }
+
+    if (OCI_BLOB != ls->lob->type)
+    {
+        size -= size % (unsigned int) sizeof(otext);
+
+        if (Env.use_wide_char_conv)
+        {
+            const int count = (int) (size / sizeof(otext));
+
+            StringUTF32ToUTF16(buffer, buffer, count);
+
+            size = (unsigned int) count * (unsigned int) sizeof(dbtext);
+        }
+
+        ls->chars += LobStreamCountChars(buffer, size);
+    }
+
+    ls->bytes += size;
+
+    return size;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamRead
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobStreamRead
+(
+    OCI_Lob      *lob,
+    big_uint      size,
+    POCI_LOB_SINK sink,
+    void         *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_LOB, lob
+    )
+
+    OCI_LobStream ls;
+
+    memset(&ls, 0, sizeof(ls));
+
+    CHECK_PTR(OCI_IPC_LOB,  lob)
+    CHECK_PTR(OCI_IPC_PROC, sink)
+
+    ls.lob  = lob;
+    ls.sink = sink;
+    ls.ctx  = ctx;
+
+    CHECK(LobStreamAllocate(&ls, 1))
+
+#ifdef OCI_LOB2_API_ENABLED
+
+    if (Env.use_lob_ub8)
+    {
+        ub8   byte_amt = (OCI_BLOB == lob->type) ? (ub8) size : 0;
+        ub8   char_amt = (OCI_BLOB == lob->type) ? 0 : (ub8) size;
+        ub1   csfrm    = (OCI_NCLOB == lob->type) ? SQLCS_NCHAR : SQLCS_IMPLICIT;
+        ub2   csid     = 0;
+        sword ret      = OCI_SUCCESS;
+
+        if ((OCI_BLOB != lob->type) && (OCI_CHAR_WIDE == Env.charset))
+        {
+            csid = OCI_UTF16ID;
+        }
+
+        /* null amounts stream the lob up to its end in a single call,
+           each piece being handed to the callback by OCI */
+
+        ret = OCILobRead2(lob->con->cxt, lob->con->err, lob->handle,
+                          &byte_amt, &char_amt, (ub8) lob->offset,
+                          (void *) ls.buffer, (ub8) ls.piece,
+                          (ub1) OCI_FIRST_PIECE, (void *) &ls,
+                          CallbackLobStreamRead, csid, csfrm);
+
+        if (OCI_FAILURE(ret) && !ls.stopped)
+        {
+            THROW(ExceptionOCI, lob->con->err, ret)
+        }
+
+        lob->offset += (OCI_BLOB == lob->type) ? ls.bytes : ls.chars;
+    }
+    else
+
+#endif
+
+    {
+        big_uint remaining = size;
+
+        for (;;)
+        {
+            unsigned int char_count = 0;
+            unsigned int byte_count = 0;
+            unsigned int count      = ls.piece;
+
+            if (OCI_BLOB != lob->type)
+            {
+                count /= Env.nls_utf8 ? OCI_UTF8_BYTES_PER_CHAR : (unsigned int) sizeof(dbtext);
+            }
+
+            if ((size > 0) && (remaining < (big_uint) count))
+            {
+                count = (unsigned int) remaining;
+            }
+
+            if (0 == count)
+            {
+                break;
+            }
+
+            if (OCI_BLOB == lob->type)
+            {
+                byte_count = count;
+            }
+            else
+            {
+                char_count = count;
+            }
+
+            CHECK(LobRead2(lob, ls.buffer, &char_count, &byte_count))
+
+            if (0 == byte_count || !sink(lob, ls.buffer, byte_count, ctx))
+            {
+                break;
+            }
+
+            if (size > 0)
+            {
+                remaining -= (OCI_BLOB == lob->type) ? byte_count : char_count;
+            }
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        FREE(ls.buffer)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamWrite
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobStreamWrite
+(
+    OCI_Lob        *lob,
+    POCI_LOB_SOURCE source,
+    void           *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_LOB, lob
+    )
+
+    OCI_LobStream ls;
+
+    memset(&ls, 0, sizeof(ls));
+
+    CHECK_PTR(OCI_IPC_LOB,  lob)
+    CHECK_PTR(OCI_IPC_PROC, source)
+
+    ls.lob    = lob;
+    ls.source = source;
+    ls.ctx    = ctx;
+
+#ifdef OCI_LOB2_API_ENABLED
+
+    if (Env.use_lob_ub8)
+    {
+        ub8          byte_amt = 0;
+        ub8          char_amt = 0;
+        ub1          csfrm    = (OCI_NCLOB == lob->type) ? SQLCS_NCHAR : SQLCS_IMPLICIT;
+        ub2          csid     = 0;
+        unsigned int size     = 0;
+
+        if ((OCI_BLOB != lob->type) && (OCI_CHAR_WIDE == Env.charset))
+        {
+            csid = OCI_UTF16ID;
+        }
+
+        /* two piece buffers : while OCI writes a piece, the next one is filled in advance
+           in order to flag the last piece without sending an empty one */
+
+        CHECK(LobStreamAllocate(&ls, 2))
+
+        size = LobStreamPull(&ls, 0);
+
+        if (size > 0)
+        {
+            ls.index   = 1;
+            ls.pending = LobStreamPull(&ls, 1);
+
+            if (0 == ls.pending)
+            {
+                byte_amt = (ub8) size;
+            }
+
+            CHECK_OCI
+            (
+                lob->con->err,
+                OCILobWrite2,
+                lob->con->cxt, lob->con->err, lob->handle,
+                &byte_amt, &char_amt, (ub8) lob->offset,
+                (void *) ls.buffer, (ub8) size,
+                (ub1) (ls.pending > 0 ? OCI_FIRST_PIECE : OCI_ONE_PIECE),
+                (void *) &ls, ls.pending > 0 ? CallbackLobStreamWrite : NULL,
+                csid, csfrm
+            )
+
+            lob->offset += (OCI_BLOB == lob->type) ? ls.bytes : ls.chars;
+        }
+    }
+    else
+
+#endif
+
+    {
+        unsigned int size = 0;
+
+        CHECK(LobStreamAllocate(&ls, 1))
+
+        while ((size = source(lob, ls.buffer, ls.stride - (unsigned int) sizeof(otext), ctx)) > 0)
+        {
+            unsigned int char_count = 0;
+            unsigned int byte_count = min(size, ls.stride - (unsigned int) sizeof(otext));
+
+            memset(ls.buffer + byte_count, 0, sizeof(otext));
+
+            CHECK(LobWrite2(lob, ls.buffer, &char_count, &byte_count))
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        FREE(ls.buffer)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobFileSink
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean LobFileSink
+(
+    OCI_Lob     *lob,
+    const void  *buffer,
+    unsigned int size,
+    void        *ctx
+)
+{
+    OCI_NOT_USED(lob)
+
+    return fwrite(buffer, sizeof(ub1), (size_t) size, (FILE *) ctx) == (size_t) size;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobFileSource
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int LobFileSource
+(
+    OCI_Lob     *lob,
+    void        *buffer,
+    unsigned int size,
+    void        *ctx
+)
+{
+    OCI_NOT_USED(lob)
+
+    return (unsigned int) fread(buffer, sizeof(ub1), (size_t) size, (FILE *) ctx);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamToFile
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobStreamToFile
+(
+    OCI_Lob     *lob,
+    big_uint     size,
+    const otext *filename
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_LOB, lob
+    )
+
+    FILE *file = NULL;
+
+    CHECK_PTR(OCI_IPC_LOB,    lob)
+    CHECK_PTR(OCI_IPC_STRING, filename)
+
+    file = OpenLocalFile(filename, "wb");
+
+    if (NULL == file)
+    {
+        THROW(ExceptionFileOpen, filename)
+    }
+
+    CHECK(LobStreamRead(lob, size, LobFileSink, file))
+
+    if (0 != ferror(file) || 0 != fflush(file))
+    {
+        THROW(ExceptionFileIO, filename)
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != file)
+        {
+            fclose(file);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * LobStreamFromFile
+ * --------------------------------------------------------------------------------------------- */
+
+boolean LobStreamFromFile
+(
+    OCI_Lob     *lob,
+    const otext *filename
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_LOB, lob
+    )
+
+    FILE *file = NULL;
+
+    CHECK_PTR(OCI_IPC_LOB,    lob)
+    CHECK_PTR(OCI_IPC_STRING, filename)
+
+    file = OpenLocalFile(filename, "rb");
+
+    if (NULL == file)
+    {
+        THROW(ExceptionFileOpen, filename)
+    }
+
+    CHECK(LobStreamWrite(lob, LobFileSource, file))
+
+    if (0 != ferror(file))
+    {
+        THROW(ExceptionFileIO, filename)
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (NULL != file)
+        {
+            fclose(file);
+        }
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * LobTruncate
  * --------------------------------------------------------------------------------------------- */
@@ -101,6 +101,65 @@ unsigned int LobWrite
     unsigned int len
 );
 
+boolean LobReadArray
+(
+    OCI_Lob     **lobs,
+    unsigned int  count,
+    void        **buffers,
+    unsigned int *char_counts,
+    unsigned int *byte_counts
+);
+
+boolean LobWriteArray
+(
+    OCI_Lob     **lobs,
+    unsigned int  count,
+    void        **buffers,
+    unsigned int *char_counts,
+    unsigned int *byte_counts
+);
+
+boolean LobStreamPush
+(
+    OCI_LobStream *ls,
+    void          *buffer,
+    unsigned int   size
+);
+
+unsigned int LobStreamPull
+(
+    OCI_LobStream *ls,
+    unsigned int   index
+);
+
+boolean LobStreamRead
+(
+    OCI_Lob      *lob,
+    big_uint      size,
+    POCI_LOB_SINK sink,
+    void         *ctx
+);
+
+boolean LobStreamWrite
+(
+    OCI_Lob        *lob,
+    POCI_LOB_SOURCE source,
+    void           *ctx
+);
+
+boolean LobStreamToFile
+(
+    OCI_Lob     *lob,
+    big_uint     size,
+    const otext *filename
+);
+
+boolean LobStreamFromFile
+(
+    OCI_Lob     *lob,
+    const otext *filename
+);
+
 boolean LobTruncate
 (
     OCI_Lob *lob,
@@ -287,6 +287,10 @@ unsigned int LongWrite
 
     /* perform write call */
 
+    CHECK_NO_ASYNC_CALL(lg->stmt->con)
+
+    lg->stmt->con->server_calls++;
+
     code = OCIStmtExecute(lg->stmt->con->cxt, lg->stmt->stmt,
                           lg->stmt->con->err, (ub4) 1, (ub4) 0,
                           (OCISnapshot *) NULL, (OCISnapshot *) NULL,
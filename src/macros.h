@@ -165,6 +165,13 @@ ExitLabel:                \
         THROW(ExceptionMinimumValue, (m)) \
     }
 
+#define CHECK_MAX(v, m)                   \
+                                          \
+    if ((v) > (m))                        \
+    {                                     \
+        THROW(ExceptionMaximumValue, (m)) \
+    }
+
 #define CHECK_COMPAT(exp)                 \
                                           \
     if (!(exp))                           \
@@ -179,6 +186,13 @@ ExitLabel:                \
         THROW(ExceptionStatementState, (v)) \
     }
 
+#define CHECK_NO_ASYNC_CALL(con)                  \
+                                              \
+    if (NULL != (con)->async_stmt)            \
+    {                                         \
+        THROW_NO_ARGS(ExceptionAsyncPending)  \
+    }
+
 #define CHECK_OBJECT_FETCHED(obj)                  \
                                                    \
     if (OCI_OBJECT_FETCHED_CLEAN == (obj)->hstate) \
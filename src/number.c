@@ -997,3 +997,269 @@ int NumberCompare
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * NumberGetFormatDigits
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean NumberGetFormatDigits
+(
+    const otext *fmt,
+    int         *nb_int,
+    int         *nb_frac,
+    boolean     *dot
+)
+{
+    *nb_int  = 0;
+    *nb_frac = 0;
+    *dot     = FALSE;
+
+    /* only formats made of digits positions and a '.' decimal point
+       do not depend on NLS settings */
+
+    for (; NULL != fmt && *fmt; fmt++)
+    {
+        if ((OTEXT('9') == *fmt || OTEXT('0') == *fmt) && *dot)
+        {
+            (*nb_frac)++;
+        }
+        else if (OTEXT('9') == *fmt || OTEXT('0') == *fmt)
+        {
+            (*nb_int)++;
+        }
+        else if (OTEXT('.') == *fmt && !*dot)
+        {
+            *dot = TRUE;
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    return (*nb_int + *nb_frac) > 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * NumberIsParsableFormat
+ * --------------------------------------------------------------------------------------------- */
+
+boolean NumberIsParsableFormat
+(
+    const otext *fmt
+)
+{
+    int     nb_int  = 0;
+    int     nb_frac = 0;
+    boolean dot     = FALSE;
+
+    return NumberGetFormatDigits(fmt, &nb_int, &nb_frac, &dot);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * NumberParseString
+ * --------------------------------------------------------------------------------------------- */
+
+boolean NumberParseString
+(
+    const otext *str,
+    const otext *fmt,
+    OCINumber   *number
+)
+{
+    /* converts a plain decimal string, with an optional exponent, to the Oracle
+       NUMBER internal format without any OCI call. FALSE is returned for any input
+       that needs OCI (NLS characters, magic numbers, rounding, overflows).
+       With a format accepted by NumberIsParsableFormat(), only strings that fit in
+       the format digits positions are converted, without blanks, '+' or exponent */
+
+    ub1 digits[OCI_NUMBER_MAX_DIGITS * 2];
+    ub1 pairs[OCI_NUMBER_MAX_DIGITS];
+
+    const otext *p = str;
+
+    boolean neg     = FALSE;
+    boolean dot     = FALSE;
+    boolean any     = FALSE;
+    boolean fmt_dot = FALSE;
+
+    int nb_digits = 0;
+    int point     = 0;
+    int exponent  = 0;
+    int lead      = 0;
+    int nb_pairs  = 0;
+    int exp100    = 0;
+    int nb_int    = 0;
+    int nb_frac   = 0;
+    int max_int   = 0;
+    int max_frac  = 0;
+    int i         = 0;
+
+    if (NULL != fmt && !NumberGetFormatDigits(fmt, &max_int, &max_frac, &fmt_dot))
+    {
+        return FALSE;
+    }
+
+    while (NULL == fmt && OTEXT(' ') == *p)
+    {
+        p++;
+    }
+
+    if (OTEXT('-') == *p || (NULL == fmt && OTEXT('+') == *p))
+    {
+        neg = (OTEXT('-') == *p++);
+    }
+
+    /* collect significant digits and the position of the decimal point */
+
+    for (; *p; p++)
+    {
+        if (*p >= OTEXT('0') && *p <= OTEXT('9'))
+        {
+            const ub1 digit = (ub1) (*p - OTEXT('0'));
+
+            any = TRUE;
+
+            if (dot)
+            {
+                nb_frac++;
+            }
+            else
+            {
+                nb_int++;
+            }
+
+            if (0 == nb_digits && 0 == digit)
+            {
+                point -= dot ? 1 : 0;
+                continue;
+            }
+
+            if (nb_digits < (int) sizeof(digits))
+            {
+                digits[nb_digits] = digit;
+            }
+            else if (0 != digit)
+            {
+                return FALSE;
+            }
+
+            nb_digits++;
+            point += dot ? 0 : 1;
+        }
+        else if (OTEXT('.') == *p && !dot)
+        {
+            dot = TRUE;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (!any)
+    {
+        return FALSE;
+    }
+
+    if (NULL != fmt && (nb_int > max_int || nb_frac > max_frac || (dot && !fmt_dot) || 0 != *p))
+    {
+        return FALSE;
+    }
+
+    if (OTEXT('e') == *p || OTEXT('E') == *p)
+    {
+        boolean neg_exp = FALSE;
+
+        p++;
+
+        if (OTEXT('-') == *p || OTEXT('+') == *p)
+        {
+            neg_exp = (OTEXT('-') == *p++);
+        }
+
+        if (*p < OTEXT('0') || *p > OTEXT('9'))
+        {
+            return FALSE;
+        }
+
+        for (; *p >= OTEXT('0') && *p <= OTEXT('9'); p++)
+        {
+            if (exponent < 1000)
+            {
+                exponent = exponent * 10 + (int) (*p - OTEXT('0'));
+            }
+        }
+
+        exponent = neg_exp ? -exponent : exponent;
+    }
+
+    while (OTEXT(' ') == *p)
+    {
+        p++;
+    }
+
+    if (0 != *p)
+    {
+        return FALSE;
+    }
+
+    nb_digits = min(nb_digits, (int) sizeof(digits));
+
+    while (nb_digits > 0 && 0 == digits[nb_digits - 1])
+    {
+        nb_digits--;
+    }
+
+    memset(number, 0, sizeof(*number));
+
+    if (0 == nb_digits)
+    {
+        number->OCINumberPart[0] = 1;
+        number->OCINumberPart[1] = 0x80;
+
+        return TRUE;
+    }
+
+    /* the value is 0.d1d2... x 10^point, base 100 digits require an even power */
+
+    point += exponent;
+    lead   = (0 != (point % 2)) ? 1 : 0;
+
+    nb_pairs = (nb_digits + lead + 1) / 2;
+    exp100   = (point + lead) / 2 - 1;
+
+    if (nb_pairs > OCI_NUMBER_MAX_DIGITS || exp100 < -65 || exp100 > 62)
+    {
+        return FALSE;
+    }
+
+    for (i = 0; i < nb_pairs; i++)
+    {
+        const int hi = i * 2 - lead;
+        const int lo = hi + 1;
+
+        pairs[i] = (ub1) (((hi >= 0 && hi < nb_digits) ? digits[hi] * 10 : 0) +
+                          ((lo >= 0 && lo < nb_digits) ? digits[lo] : 0));
+    }
+
+    /* positive values : excess 193 exponent and excess 1 digits,
+       negative values : complemented exponent and digits, terminated by 102 */
+
+    number->OCINumberPart[1] = (ub1) (neg ? (62 - exp100) : (193 + exp100));
+
+    for (i = 0; i < nb_pairs; i++)
+    {
+        number->OCINumberPart[i + 2] = (ub1) (neg ? (101 - pairs[i]) : (pairs[i] + 1));
+    }
+
+    number->OCINumberPart[0] = (ub1) (nb_pairs + 1);
+
+    if (neg && nb_pairs < OCI_NUMBER_MAX_DIGITS)
+    {
+        number->OCINumberPart[nb_pairs + 2] = 102;
+        number->OCINumberPart[0]++;
+    }
+
+    return TRUE;
+}
@@ -159,4 +159,16 @@ int NumberCompare
     OCI_Number* number2
 );
 
+boolean NumberIsParsableFormat
+(
+    const otext *fmt
+);
+
+boolean NumberParseString
+(
+    const otext *str,
+    const otext *fmt,
+    OCINumber   *number
+);
+
 #endif /* OCILIB_NUMBER_H_INCLUDED */
@@ -665,6 +665,12 @@ typedef sword (*OCIBREAK)
     OCIError *errhp
 );
 
+typedef sword (*OCIRESET)
+(
+    dvoid    *hndlp,
+    OCIError *errhp
+);
+
 typedef sword (*OCIATTRGET)
 (
     const void *trgthndlp,
@@ -1851,6 +1857,16 @@ typedef sword (*OCIDIRPATHCOLARRAYENTRYSET)
     ub1                 cflg
 );
 
+typedef sword (*OCIDIRPATHCOLARRAYROWGET)
+(
+    OCIDirPathColArray *dpca,
+    OCIError           *errhp,
+    ub4                 rownum,
+    ub1              ***cvalppp,
+    ub4               **clenpp,
+    ub1               **cflgpp
+);
+
 typedef sword (*OCIDIRPATHCOLARRAYRESET)
 (
     OCIDirPathColArray *dpca,
@@ -2038,9 +2054,9 @@ typedef sword (*OCILOBWRITE2)
     sb4              (*cbfp)
     (
         dvoid       *ctxp,
-        CONST dvoid *bufp,
-        oraub8       len,
-        ub1          piece,
+        dvoid       *bufp,
+        oraub8      *lenp,
+        ub1         *piece,
         dvoid      **changed_bufpp,
         oraub8      *changed_lenp
     ),
@@ -2072,6 +2088,60 @@ typedef sword (*OCILOBWRITEAPPEND2)
     ub1            csfrm
 );
 
+typedef sword (*OCILOBARRAYREAD)
+(
+    OCISvcCtx       *svchp,
+    OCIError        *errhp,
+    ub4             *array_iter,
+    OCILobLocator  **lobp_arr,
+    oraub8          *byte_amt_arr,
+    oraub8          *char_amt_arr,
+    oraub8          *offset_arr,
+    dvoid          **bufp_arr,
+    oraub8          *bufl_arr,
+    ub1              piece,
+    dvoid           *ctxp,
+    sb4              (*cbfp)
+    (
+        dvoid       *ctxp,
+        ub4          array_iter,
+        CONST dvoid *bufp,
+        oraub8       len,
+        ub1          piece,
+        dvoid      **changed_bufpp,
+        oraub8      *changed_lenp
+    ),
+    ub2              csid,
+    ub1              csfrm
+);
+
+typedef sword (*OCILOBARRAYWRITE)
+(
+    OCISvcCtx       *svchp,
+    OCIError        *errhp,
+    ub4             *array_iter,
+    OCILobLocator  **lobp_arr,
+    oraub8          *byte_amt_arr,
+    oraub8          *char_amt_arr,
+    oraub8          *offset_arr,
+    dvoid          **bufp_arr,
+    oraub8          *bufl_arr,
+    ub1              piece,
+    dvoid           *ctxp,
+    sb4              (*cbfp)
+    (
+        dvoid       *ctxp,
+        ub4          array_iter,
+        dvoid       *bufp,
+        oraub8      *lenp,
+        ub1         *piece,
+        dvoid      **changed_bufpp,
+        oraub8      *changed_lenp
+    ),
+    ub2              csid,
+    ub1              csfrm
+);
+
 #endif /* ORAXB8_DEFINED */
 
 /* API introduced in 10.2 */
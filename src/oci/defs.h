@@ -173,6 +173,7 @@
 /*--------------------------Attribute Types----------------------------------*/
 
 #define OCI_ATTR_OBJECT   2 /* is the environment initialized in object mode */
+#define OCI_ATTR_NONBLOCKING_MODE  3                    /* non blocking mode */
 #define OCI_ATTR_SQLCODE  4                                  /* the SQL verb */
 #define OCI_ATTR_ENV  5                            /* the environment handle */
 #define OCI_ATTR_SERVER 6                               /* the server handle */
@@ -455,6 +456,7 @@
 #define OCI_STMT_SCROLLABLE_READONLY \
                                    0x00000008 /* if result set is scrollable */
 #define OCI_DESCRIBE_ONLY          0x00000010 /* only describe the statement */
+#define OCI_COMMIT_ON_SUCCESS      0x00000020  /* commit, if successful exec */
 #define OCI_BATCH_ERRORS           0x00000080  /* batch errors in array dmls */
 #define OCI_PARSE_ONLY             0x00000100    /* only parse the statement */
 
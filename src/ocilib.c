@@ -22,6 +22,8 @@
 
 #include "agent.h"
 #include "array.h"
+#include "async.h"
+#include "batcher.h"
 #include "bind.h"
 #include "collection.h"
 #include "column.h"
@@ -29,7 +31,10 @@
 #include "database.h"
 #include "date.h"
 #include "dequeue.h"
+#include "describecache.h"
 #include "dirpath.h"
+#include "dirpathfile.h"
+#include "dirpathloader.h"
 #include "element.h"
 #include "enqueue.h"
 #include "error.h"
@@ -47,6 +52,8 @@
 #include "number.h"
 #include "object.h"
 #include "pool.h"
+#include "preparedcache.h"
+#include "profiler.h"
 #include "queue.h"
 #include "reference.h"
 #include "resultset.h"
@@ -127,6 +134,212 @@ boolean OCI_API OCI_AgentSetAddress
     CALL_IMPL(AgentSetAddress, agent, address)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+  * async
+  * --------------------------------------------------------------------------------------------- */
+
+boolean OCI_API OCI_ExecuteAsync
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(AsyncExecute, stmt)
+}
+
+boolean OCI_API OCI_FetchAsync
+(
+    OCI_Resultset* rs
+)
+{
+    CALL_IMPL(AsyncFetch, rs)
+}
+
+unsigned int OCI_API OCI_AsyncPoll
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(AsyncPoll, stmt)
+}
+
+boolean OCI_API OCI_AsyncGetResult
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(AsyncGetResult, stmt)
+}
+
+boolean OCI_API OCI_AsyncCancel
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(AsyncCancel, stmt)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+  * batcher
+  * --------------------------------------------------------------------------------------------- */
+
+OCI_Batcher* OCI_API OCI_BatcherCreate
+(
+    OCI_Connection* con,
+    const otext*    sql,
+    unsigned int    nb_cols,
+    unsigned int    max_rows
+)
+{
+    CALL_IMPL(BatcherCreate, con, sql, nb_cols, max_rows)
+}
+
+boolean OCI_API OCI_BatcherFree
+(
+    OCI_Batcher* bat
+)
+{
+    CALL_IMPL(BatcherFree, bat)
+}
+
+boolean OCI_API OCI_BatcherSetColumn
+(
+    OCI_Batcher* bat,
+    unsigned int index,
+    const otext* name,
+    unsigned int type,
+    unsigned int subtype,
+    unsigned int len
+)
+{
+    CALL_IMPL(BatcherSetColumn, bat, index, name, type, subtype, len)
+}
+
+boolean OCI_API OCI_BatcherSetFlushLimits
+(
+    OCI_Batcher* bat,
+    unsigned int max_bytes,
+    unsigned int max_delay
+)
+{
+    CALL_IMPL(BatcherSetFlushLimits, bat, max_bytes, max_delay)
+}
+
+boolean OCI_API OCI_BatcherSetErrorHandler
+(
+    OCI_Batcher*       bat,
+    POCI_BATCHER_ERROR handler
+)
+{
+    CALL_IMPL(BatcherSetErrorHandler, bat, handler)
+}
+
+boolean OCI_API OCI_BatcherSetInt
+(
+    OCI_Batcher* bat,
+    unsigned int index,
+    int          value
+)
+{
+    CALL_IMPL(BatcherSetInt, bat, index, value)
+}
+
+boolean OCI_API OCI_BatcherSetBigInt
+(
+    OCI_Batcher* bat,
+    unsigned int index,
+    big_int      value
+)
+{
+    CALL_IMPL(BatcherSetBigInt, bat, index, value)
+}
+
+boolean OCI_API OCI_BatcherSetDouble
+(
+    OCI_Batcher* bat,
+    unsigned int index,
+    double       value
+)
+{
+    CALL_IMPL(BatcherSetDouble, bat, index, value)
+}
+
+boolean OCI_API OCI_BatcherSetString
+(
+    OCI_Batcher* bat,
+    unsigned int index,
+    const otext* value
+)
+{
+    CALL_IMPL(BatcherSetString, bat, index, value)
+}
+
+boolean OCI_API OCI_BatcherSetDate
+(
+    OCI_Batcher* bat,
+    unsigned int index,
+    OCI_Date*    value
+)
+{
+    CALL_IMPL(BatcherSetDate, bat, index, value)
+}
+
+boolean OCI_API OCI_BatcherSetNull
+(
+    OCI_Batcher* bat,
+    unsigned int index
+)
+{
+    CALL_IMPL(BatcherSetNull, bat, index)
+}
+
+unsigned int OCI_API OCI_BatcherAddRow
+(
+    OCI_Batcher* bat
+)
+{
+    CALL_IMPL(BatcherAddRow, bat)
+}
+
+boolean OCI_API OCI_BatcherFlush
+(
+    OCI_Batcher* bat
+)
+{
+    CALL_IMPL(BatcherFlush, bat)
+}
+
+boolean OCI_API OCI_BatcherCheckDelay
+(
+    OCI_Batcher* bat
+)
+{
+    CALL_IMPL(BatcherCheckDelay, bat)
+}
+
+unsigned int OCI_API OCI_BatcherGetPendingRows
+(
+    OCI_Batcher* bat
+)
+{
+    CALL_IMPL(BatcherGetPendingRows, bat)
+}
+
+unsigned int OCI_API OCI_BatcherGetProcessedRows
+(
+    OCI_Batcher* bat
+)
+{
+    CALL_IMPL(BatcherGetProcessedRows, bat)
+}
+
+unsigned int OCI_API OCI_BatcherGetErrorCount
+(
+    OCI_Batcher* bat
+)
+{
+    CALL_IMPL(BatcherGetErrorCount, bat)
+}
+
 /* --------------------------------------------------------------------------------------------- *
   * bind
   * --------------------------------------------------------------------------------------------- */
@@ -215,6 +428,26 @@ unsigned int OCI_API OCI_BindGetDataSizeAtPos
     CALL_IMPL(BindGetDataSizeAtPos, bnd, position)
 }
 
+boolean OCI_API OCI_BindSetDataSizes
+(
+    OCI_Bind           *bnd,
+    const unsigned int *sizes,
+    unsigned int        count
+)
+{
+    CALL_IMPL(BindSetDataSizes, bnd, sizes, count)
+}
+
+boolean OCI_API OCI_BindGetDataSizes
+(
+    OCI_Bind     *bnd,
+    unsigned int *sizes,
+    unsigned int  count
+)
+{
+    CALL_IMPL(BindGetDataSizes, bnd, sizes, count)
+}
+
 boolean OCI_API OCI_BindSetNullAtPos
 (
     OCI_Bind   * bnd,
@@ -266,6 +499,62 @@ boolean OCI_API OCI_BindIsNull
     CALL_IMPL(BindIsNull, bnd)
 }
 
+boolean OCI_API OCI_BindSetNullBitmap
+(
+    OCI_Bind            *bnd,
+    const unsigned char *bitmap,
+    unsigned int         count
+)
+{
+    CALL_IMPL(BindSetNullBitmap, bnd, bitmap, count)
+}
+
+boolean OCI_API OCI_BindSetIndicators
+(
+    OCI_Bind    *bnd,
+    const short *inds,
+    unsigned int count
+)
+{
+    CALL_IMPL(BindSetIndicators, bnd, inds, count)
+}
+
+boolean OCI_API OCI_BindGetIndicators
+(
+    OCI_Bind    *bnd,
+    short       *inds,
+    unsigned int count
+)
+{
+    CALL_IMPL(BindGetIndicators, bnd, inds, count)
+}
+
+boolean OCI_API OCI_BindSetIndicatorArray
+(
+    OCI_Bind *bnd,
+    short    *inds
+)
+{
+    CALL_IMPL(BindSetIndicatorArray, bnd, inds)
+}
+
+boolean OCI_API OCI_BindSetDirty
+(
+    OCI_Bind* bnd
+)
+{
+    CALL_IMPL(BindSetDirty, bnd)
+}
+
+boolean OCI_API OCI_BindSetDirtyAtPos
+(
+    OCI_Bind   * bnd,
+    unsigned int position
+)
+{
+    CALL_IMPL(BindSetDirtyAtPos, bnd, position)
+}
+
 boolean OCI_API OCI_BindSetCharsetForm
 (
     OCI_Bind   * bnd,
@@ -651,6 +940,48 @@ boolean OCI_API OCI_GetAutoCommit
     CALL_IMPL(ConnectionGetAutoCommit, con)
 }
 
+boolean OCI_API OCI_SetCommitOnExecute
+(
+    OCI_Connection *con,
+    boolean         enable
+)
+{
+    CALL_IMPL(ConnectionSetCommitOnExecute, con, enable)
+}
+
+boolean OCI_API OCI_GetCommitOnExecute
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetCommitOnExecute, con)
+}
+
+boolean OCI_API OCI_SetFormatBinding
+(
+    OCI_Connection* con,
+    boolean         enable
+)
+{
+    CALL_IMPL(ConnectionSetFormatBinding, con, enable)
+}
+
+boolean OCI_API OCI_GetFormatBinding
+(
+    OCI_Connection* con
+)
+{
+    CALL_IMPL(ConnectionGetFormatBinding, con)
+}
+
+unsigned int OCI_API OCI_GetServerCalls
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetServerCalls, con)
+}
+
 boolean OCI_API OCI_IsConnected
 (
     OCI_Connection *con
@@ -954,72 +1285,243 @@ boolean OCI_API OCI_SetStatementCacheSize
     CALL_IMPL(ConnectionSetStatementCacheSize, con, value)
 }
 
-unsigned int OCI_API OCI_GetDefaultLobPrefetchSize
+boolean OCI_API OCI_SetResultCache
 (
-    OCI_Connection *con
+    OCI_Connection *con,
+    unsigned int    max_entries,
+    unsigned int    max_size,
+    unsigned int    ttl
 )
 {
-    CALL_IMPL(ConnectionGetDefaultLobPrefetchSize, con)
+    CALL_IMPL(ConnectionSetResultCache, con, max_entries, max_size, ttl)
 }
 
-boolean OCI_API OCI_SetDefaultLobPrefetchSize
+boolean OCI_API OCI_SetResultCacheSubscription
 (
-    OCI_Connection *con,
-    unsigned int    value
+    OCI_Connection   *con,
+    OCI_Subscription *sub
 )
 {
-    CALL_IMPL(ConnectionSetDefaultLobPrefetchSize, con, value)
+    CALL_IMPL(ConnectionSetResultCacheSubscription, con, sub)
 }
 
-unsigned int OCI_API OCI_GetMaxCursors
+boolean OCI_API OCI_ClearResultCache
 (
     OCI_Connection *con
 )
 {
-    CALL_IMPL(ConnectionGetMaxCursors, con)
+    CALL_IMPL(ConnectionClearResultCache, con)
 }
 
-boolean OCI_Immediate
+unsigned int OCI_API OCI_GetResultCacheHits
 (
-    OCI_Connection *con,
-    const otext    *sql,
-    ...
+    OCI_Connection *con
 )
 {
-    boolean res = FALSE;
-    va_list args;
-
-    va_start(args, sql);
-    res = ConnectionExecuteImmediate(con, sql, args);
-    va_end(args);
-
-    return res;
+    CALL_IMPL(ConnectionGetResultCacheHits, con)
 }
 
-boolean OCI_ImmediateFmt
+unsigned int OCI_API OCI_GetResultCacheMisses
 (
-    OCI_Connection *con,
-    const otext    *sql,
-    ...
+    OCI_Connection *con
 )
 {
-    boolean res = FALSE;
-    va_list args;
-
-    va_start(args, sql);
-    res = ConnectionExecuteImmediateFmt(con, sql, args);
-    va_end(args);
-
-    return res;
+    CALL_IMPL(ConnectionGetResultCacheMisses, con)
 }
 
-/* --------------------------------------------------------------------------------------------- *
- * date
- * --------------------------------------------------------------------------------------------- */
-
-OCI_Date* OCI_API OCI_DateCreate
+boolean OCI_API OCI_SetPreparedCacheSize
 (
-    OCI_Connection* con
+    OCI_Connection *con,
+    unsigned int    size
+)
+{
+    CALL_IMPL(PreparedCacheSetSize, con, size)
+}
+
+unsigned int OCI_API OCI_GetPreparedCacheSize
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(PreparedCacheGetSize, con)
+}
+
+unsigned int OCI_API OCI_GetPreparedCacheHits
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(PreparedCacheGetHits, con)
+}
+
+unsigned int OCI_API OCI_GetPreparedCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(PreparedCacheGetMisses, con)
+}
+
+boolean OCI_API OCI_SetProfiling
+(
+    OCI_Connection *con,
+    boolean         value
+)
+{
+    CALL_IMPL(ProfilerSetEnabled, con, value)
+}
+
+boolean OCI_API OCI_GetProfiling
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ProfilerGetEnabled, con)
+}
+
+boolean OCI_API OCI_ClearProfiles
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ProfilerClear, con)
+}
+
+unsigned int OCI_API OCI_GetProfileCount
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ProfilerGetCount, con)
+}
+
+boolean OCI_API OCI_GetProfileInfo
+(
+    OCI_Connection  *con,
+    unsigned int     index,
+    OCI_ProfileInfo *info
+)
+{
+    CALL_IMPL(ProfilerGetInfo, con, index, info)
+}
+
+boolean OCI_API OCI_ProfilesToJson
+(
+    OCI_Connection *con,
+    unsigned int   *size,
+    otext          *str
+)
+{
+    CALL_IMPL(ProfilerToJson, con, size, str)
+}
+
+boolean OCI_API OCI_SetDescribeCacheSize
+(
+    OCI_Connection *con,
+    unsigned int    size
+)
+{
+    CALL_IMPL(DescribeCacheSetSize, con, size)
+}
+
+unsigned int OCI_API OCI_GetDescribeCacheSize
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(DescribeCacheGetSize, con)
+}
+
+unsigned int OCI_API OCI_GetDescribeCacheHits
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(DescribeCacheGetHits, con)
+}
+
+unsigned int OCI_API OCI_GetDescribeCacheMisses
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(DescribeCacheGetMisses, con)
+}
+
+boolean OCI_API OCI_ClearDescribeCache
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(DescribeCacheClear, con)
+}
+
+unsigned int OCI_API OCI_GetDefaultLobPrefetchSize
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetDefaultLobPrefetchSize, con)
+}
+
+boolean OCI_API OCI_SetDefaultLobPrefetchSize
+(
+    OCI_Connection *con,
+    unsigned int    value
+)
+{
+    CALL_IMPL(ConnectionSetDefaultLobPrefetchSize, con, value)
+}
+
+unsigned int OCI_API OCI_GetMaxCursors
+(
+    OCI_Connection *con
+)
+{
+    CALL_IMPL(ConnectionGetMaxCursors, con)
+}
+
+boolean OCI_Immediate
+(
+    OCI_Connection *con,
+    const otext    *sql,
+    ...
+)
+{
+    boolean res = FALSE;
+    va_list args;
+
+    va_start(args, sql);
+    res = ConnectionExecuteImmediate(con, sql, args);
+    va_end(args);
+
+    return res;
+}
+
+boolean OCI_ImmediateFmt
+(
+    OCI_Connection *con,
+    const otext    *sql,
+    ...
+)
+{
+    boolean res = FALSE;
+    va_list args;
+
+    va_start(args, sql);
+    res = ConnectionExecuteImmediateFmt(con, sql, args);
+    va_end(args);
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * date
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Date* OCI_API OCI_DateCreate
+(
+    OCI_Connection* con
 )
 {
     CALL_IMPL(DateCreate, con)
@@ -1452,215 +1954,427 @@ OCI_DirPath* OCI_API OCI_DirPathCreate
     unsigned int  nb_rows
 )
 {
-    CALL_IMPL(DirPathCreate, typinf, partition, nb_cols, nb_rows)
+    CALL_IMPL(DirPathCreate, typinf, partition, nb_cols, nb_rows)
+}
+
+boolean OCI_API OCI_DirPathFree
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathFree, dp)
+}
+
+boolean OCI_API OCI_DirPathSetColumn
+(
+    OCI_DirPath* dp,
+    unsigned int index,
+    const otext* name,
+    unsigned int maxsize,
+    const otext* format
+)
+{
+    CALL_IMPL(DirPathSetColumn, dp, index, name, maxsize, format)
+}
+
+boolean OCI_API OCI_DirPathPrepare
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathPrepare, dp)
+}
+
+boolean OCI_API OCI_DirPathSetEntry
+(
+    OCI_DirPath* dp,
+    unsigned int row,
+    unsigned int index,
+    void       * value,
+    unsigned     size,
+    boolean      complete
+)
+{
+    CALL_IMPL(DirPathSetEntry, dp, row, index, value, size, complete)
+}
+
+unsigned int OCI_API OCI_DirPathConvert
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathConvert, dp)
+}
+
+unsigned int OCI_API OCI_DirPathLoad
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathLoad, dp)
+}
+
+boolean OCI_API OCI_DirPathSetColumnData
+(
+    OCI_DirPath*   dp,
+    unsigned int   index,
+    void*          data,
+    unsigned int   size,
+    unsigned int*  lens,
+    unsigned char* nulls
+)
+{
+    CALL_IMPL(DirPathSetColumnData, dp, index, data, size, lens, nulls)
+}
+
+boolean OCI_API OCI_DirPathSetArrowBatch
+(
+    OCI_DirPath*              dp,
+    const struct ArrowSchema* schema,
+    const struct ArrowArray*  array
+)
+{
+    CALL_IMPL(DirPathSetArrowBatch, dp, schema, array)
+}
+
+boolean OCI_API OCI_DirPathReset
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathReset, dp)
+}
+
+boolean OCI_API OCI_DirPathFinish
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathFinish, dp)
+}
+
+boolean OCI_API OCI_DirPathAbort
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathAbort, dp)
+}
+
+boolean OCI_API OCI_DirPathSave
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathSave, dp)
+}
+
+boolean OCI_API OCI_DirPathFlushRow
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathFlushRow, dp)
+}
+
+boolean OCI_API OCI_DirPathSetCurrentRows
+(
+    OCI_DirPath* dp,
+    unsigned int nb_rows
+)
+{
+    CALL_IMPL(DirPathSetCurrentRows, dp, nb_rows)
+}
+
+unsigned int OCI_API OCI_DirPathGetCurrentRows
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathGetCurrentRows, dp)
+}
+
+unsigned int OCI_API OCI_DirPathGetMaxRows
+(
+    OCI_DirPath* dp
+)
+{
+    CALL_IMPL(DirPathGetMaxRows, dp)
+}
+
+boolean OCI_API OCI_DirPathSetDateFormat
+(
+    OCI_DirPath* dp,
+    const otext* format
+)
+{
+    CALL_IMPL(DirPathSetDateFormat, dp, format)
+}
+
+boolean OCI_API OCI_DirPathSetParallel
+(
+    OCI_DirPath* dp,
+    boolean      value
+)
+{
+    CALL_IMPL(DirPathSetParallel, dp, value)
+}
+
+boolean OCI_API OCI_DirPathSetNoLog
+(
+    OCI_DirPath* dp,
+    boolean      value
+)
+{
+    CALL_IMPL(DirPathSetNoLog, dp, value)
+}
+
+boolean OCI_API OCI_DirPathSetCacheSize
+(
+    OCI_DirPath* dp,
+    unsigned int size
+)
+{
+    CALL_IMPL(DirPathSetCacheSize, dp, size)
+}
+
+boolean OCI_API OCI_DirPathSetBufferSize
+(
+    OCI_DirPath* dp,
+    unsigned int size
+)
+{
+    CALL_IMPL(DirPathSetBufferSize, dp, size)
+}
+
+boolean OCI_API OCI_DirPathSetConvertMode
+(
+    OCI_DirPath* dp,
+    unsigned int mode
+)
+{
+    CALL_IMPL(DirPathSetConvertMode, dp, mode)
+}
+
+boolean OCI_API OCI_DirPathSetPipelined
+(
+    OCI_DirPath* dp,
+    boolean      value
+)
+{
+    CALL_IMPL(DirPathSetPipelined, dp, value)
 }
 
-boolean OCI_API OCI_DirPathFree
+boolean OCI_API OCI_DirPathGetPipelined
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathFree, dp)
+    CALL_IMPL(DirPathGetPipelined, dp)
 }
 
-boolean OCI_API OCI_DirPathSetColumn
+boolean OCI_API OCI_DirPathSetConvertThreads
 (
     OCI_DirPath* dp,
-    unsigned int index,
-    const otext* name,
-    unsigned int maxsize,
-    const otext* format
+    unsigned int value
 )
 {
-    CALL_IMPL(DirPathSetColumn, dp, index, name, maxsize, format)
+    CALL_IMPL(DirPathSetConvertThreads, dp, value)
 }
 
-boolean OCI_API OCI_DirPathPrepare
+unsigned int OCI_API OCI_DirPathGetConvertThreads
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathPrepare, dp)
+    CALL_IMPL(DirPathGetConvertThreads, dp)
 }
 
-boolean OCI_API OCI_DirPathSetEntry
+boolean OCI_API OCI_DirPathGetStats
 (
-    OCI_DirPath* dp,
-    unsigned int row,
-    unsigned int index,
-    void       * value,
-    unsigned     size,
-    boolean      complete
+    OCI_DirPath*      dp,
+    OCI_DirPathStats* stats
 )
 {
-    CALL_IMPL(DirPathSetEntry, dp, row, index, value, size, complete)
+    CALL_IMPL(DirPathGetStats, dp, stats)
 }
 
-unsigned int OCI_API OCI_DirPathConvert
+boolean OCI_API OCI_DirPathResetStats
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathConvert, dp)
+    CALL_IMPL(DirPathResetStats, dp)
 }
 
-unsigned int OCI_API OCI_DirPathLoad
+boolean OCI_API OCI_DirPathSetProgressHandler
 (
-    OCI_DirPath* dp
+    OCI_DirPath*          dp,
+    POCI_DIRPATH_PROGRESS handler,
+    unsigned int          interval,
+    void*                 ctx
 )
 {
-    CALL_IMPL(DirPathLoad, dp)
+    CALL_IMPL(DirPathSetProgressHandler, dp, handler, interval, ctx)
 }
 
-boolean OCI_API OCI_DirPathReset
+unsigned int OCI_API OCI_DirPathGetRowCount
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathReset, dp)
+    CALL_IMPL(DirPathGetRowCount, dp)
 }
 
-boolean OCI_API OCI_DirPathFinish
+unsigned int OCI_API OCI_DirPathGetAffectedRows
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathFinish, dp)
+    CALL_IMPL(DirPathGetAffectedRows, dp)
 }
 
-boolean OCI_API OCI_DirPathAbort
+unsigned int OCI_API OCI_DirPathGetErrorColumn
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathAbort, dp)
+    CALL_IMPL(DirPathGetErrorColumn, dp)
 }
 
-boolean OCI_API OCI_DirPathSave
+unsigned int OCI_API OCI_DirPathGetErrorRow
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathSave, dp)
+    CALL_IMPL(DirPathGetErrorRow, dp)
 }
 
-boolean OCI_API OCI_DirPathFlushRow
+unsigned int OCI_API OCI_DirPathGetRejectedCount
 (
     OCI_DirPath* dp
 )
 {
-    CALL_IMPL(DirPathFlushRow, dp)
+    CALL_IMPL(DirPathGetRejectedCount, dp)
 }
 
-boolean OCI_API OCI_DirPathSetCurrentRows
+boolean OCI_API OCI_DirPathLoadFile
 (
     OCI_DirPath* dp,
-    unsigned int nb_rows
+    const otext* filename,
+    const otext* badfile,
+    const otext* logfile,
+    otext        delimiter,
+    otext        quote,
+    unsigned int mode
 )
 {
-    CALL_IMPL(DirPathSetCurrentRows, dp, nb_rows)
+    CALL_IMPL(DirPathLoadFile, dp, filename, badfile, logfile, delimiter, quote, mode)
 }
 
-unsigned int OCI_API OCI_DirPathGetCurrentRows
-(
-    OCI_DirPath* dp
-)
-{
-    CALL_IMPL(DirPathGetCurrentRows, dp)
-}
+/* --------------------------------------------------------------------------------------------- *
+ * direct path loader
+ * --------------------------------------------------------------------------------------------- */
 
-unsigned int OCI_API OCI_DirPathGetMaxRows
+OCI_DirPathLoader* OCI_API OCI_DirPathLoaderCreate
 (
-    OCI_DirPath* dp
+    OCI_Connection** cons,
+    unsigned int     nb_cons,
+    const otext*     name,
+    const otext**    partitions,
+    unsigned int     nb_cols,
+    unsigned int     nb_rows
 )
 {
-    CALL_IMPL(DirPathGetMaxRows, dp)
+    CALL_IMPL(DirPathLoaderCreate, cons, nb_cons, name, partitions, nb_cols, nb_rows)
 }
 
-boolean OCI_API OCI_DirPathSetDateFormat
+boolean OCI_API OCI_DirPathLoaderFree
 (
-    OCI_DirPath* dp,
-    const otext* format
+    OCI_DirPathLoader* ldr
 )
 {
-    CALL_IMPL(DirPathSetDateFormat, dp, format)
+    CALL_IMPL(DirPathLoaderFree, ldr)
 }
 
-boolean OCI_API OCI_DirPathSetParallel
+boolean OCI_API OCI_DirPathLoaderSetColumn
 (
-    OCI_DirPath* dp,
-    boolean      value
+    OCI_DirPathLoader* ldr,
+    unsigned int       index,
+    const otext*       name,
+    unsigned int       maxsize,
+    const otext*       format
 )
 {
-    CALL_IMPL(DirPathSetParallel, dp, value)
+    CALL_IMPL(DirPathLoaderSetColumn, ldr, index, name, maxsize, format)
 }
 
-boolean OCI_API OCI_DirPathSetNoLog
+unsigned int OCI_API OCI_DirPathLoaderGetContextCount
 (
-    OCI_DirPath* dp,
-    boolean      value
+    OCI_DirPathLoader* ldr
 )
 {
-    CALL_IMPL(DirPathSetNoLog, dp, value)
+    CALL_IMPL(DirPathLoaderGetContextCount, ldr)
 }
 
-boolean OCI_API OCI_DirPathSetCacheSize
+OCI_DirPath* OCI_API OCI_DirPathLoaderGetContext
 (
-    OCI_DirPath* dp,
-    unsigned int size
+    OCI_DirPathLoader* ldr,
+    unsigned int       index
 )
 {
-    CALL_IMPL(DirPathSetCacheSize, dp, size)
+    CALL_IMPL(DirPathLoaderGetContext, ldr, index)
 }
 
-boolean OCI_API OCI_DirPathSetBufferSize
+boolean OCI_API OCI_DirPathLoaderPrepare
 (
-    OCI_DirPath* dp,
-    unsigned int size
+    OCI_DirPathLoader* ldr
 )
 {
-    CALL_IMPL(DirPathSetBufferSize, dp, size)
+    CALL_IMPL(DirPathLoaderPrepare, ldr)
 }
 
-boolean OCI_API OCI_DirPathSetConvertMode
+boolean OCI_API OCI_DirPathLoaderAddRow
 (
-    OCI_DirPath* dp,
-    unsigned int mode
+    OCI_DirPathLoader* ldr,
+    unsigned int       target,
+    void**             values,
+    unsigned int*      sizes
 )
 {
-    CALL_IMPL(DirPathSetConvertMode, dp, mode)
+    CALL_IMPL(DirPathLoaderAddRow, ldr, target, values, sizes)
 }
 
-unsigned int OCI_API OCI_DirPathGetRowCount
+boolean OCI_API OCI_DirPathLoaderFinish
 (
-    OCI_DirPath* dp
+    OCI_DirPathLoader* ldr
 )
 {
-    CALL_IMPL(DirPathGetRowCount, dp)
+    CALL_IMPL(DirPathLoaderFinish, ldr)
 }
 
-unsigned int OCI_API OCI_DirPathGetAffectedRows
+boolean OCI_API OCI_DirPathLoaderAbort
 (
-    OCI_DirPath* dp
+    OCI_DirPathLoader* ldr
 )
 {
-    CALL_IMPL(DirPathGetAffectedRows, dp)
+    CALL_IMPL(DirPathLoaderAbort, ldr)
 }
 
-unsigned int OCI_API OCI_DirPathGetErrorColumn
+unsigned int OCI_API OCI_DirPathLoaderGetRowCount
 (
-    OCI_DirPath* dp
+    OCI_DirPathLoader* ldr
 )
 {
-    CALL_IMPL(DirPathGetErrorColumn, dp)
+    CALL_IMPL(DirPathLoaderGetRowCount, ldr)
 }
 
-unsigned int OCI_API OCI_DirPathGetErrorRow
+unsigned int OCI_API OCI_DirPathLoaderGetErrorCount
 (
-    OCI_DirPath* dp
+    OCI_DirPathLoader* ldr
 )
 {
-    CALL_IMPL(DirPathGetErrorRow, dp)
+    CALL_IMPL(DirPathLoaderGetErrorCount, ldr)
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -3192,6 +3906,70 @@ boolean OCI_API OCI_LobWrite2
     CALL_IMPL(LobWrite2, lob, buffer, char_count, byte_count);
 }
 
+boolean OCI_API OCI_LobArrayRead
+(
+    OCI_Lob**     lobs,
+    unsigned int  count,
+    void**        buffers,
+    unsigned int* char_counts,
+    unsigned int* byte_counts
+)
+{
+    CALL_IMPL(LobReadArray, lobs, count, buffers, char_counts, byte_counts);
+}
+
+boolean OCI_API OCI_LobArrayWrite
+(
+    OCI_Lob**     lobs,
+    unsigned int  count,
+    void**        buffers,
+    unsigned int* char_counts,
+    unsigned int* byte_counts
+)
+{
+    CALL_IMPL(LobWriteArray, lobs, count, buffers, char_counts, byte_counts);
+}
+
+boolean OCI_API OCI_LobStreamRead
+(
+    OCI_Lob*      lob,
+    big_uint      size,
+    POCI_LOB_SINK sink,
+    void*         ctx
+)
+{
+    CALL_IMPL(LobStreamRead, lob, size, sink, ctx);
+}
+
+boolean OCI_API OCI_LobStreamWrite
+(
+    OCI_Lob*        lob,
+    POCI_LOB_SOURCE source,
+    void*           ctx
+)
+{
+    CALL_IMPL(LobStreamWrite, lob, source, ctx);
+}
+
+boolean OCI_API OCI_LobStreamToFile
+(
+    OCI_Lob*     lob,
+    big_uint     size,
+    const otext* filename
+)
+{
+    CALL_IMPL(LobStreamToFile, lob, size, filename);
+}
+
+boolean OCI_API OCI_LobStreamFromFile
+(
+    OCI_Lob*     lob,
+    const otext* filename
+)
+{
+    CALL_IMPL(LobStreamFromFile, lob, filename);
+}
+
 boolean OCI_API OCI_LobTruncate
 (
     OCI_Lob* lob,
@@ -4479,6 +5257,26 @@ boolean OCI_API OCI_PoolSetStatementCacheSize
     CALL_IMPL(PoolSetStatementCacheSize, pool, value);
 }
 
+boolean OCI_API OCI_PoolSetResultCache
+(
+    OCI_Pool    *pool,
+    unsigned int max_entries,
+    unsigned int max_size,
+    unsigned int ttl
+)
+{
+    CALL_IMPL(PoolSetResultCache, pool, max_entries, max_size, ttl);
+}
+
+boolean OCI_API OCI_PoolSetResultCacheSubscription
+(
+    OCI_Pool         *pool,
+    OCI_Subscription *sub
+)
+{
+    CALL_IMPL(PoolSetResultCacheSubscription, pool, sub);
+}
+
 /* --------------------------------------------------------------------------------------------- *
  *  queue
  * --------------------------------------------------------------------------------------------- */
@@ -5016,6 +5814,26 @@ unsigned int OCI_API OCI_GetRaw2
     CALL_IMPL(ResultsetGetRaw2, rs, name, buffer, len);
 }
 
+const void * OCI_API OCI_GetRawBuffer
+(
+    OCI_Resultset* rs,
+    unsigned int   index,
+    unsigned int * size
+)
+{
+    CALL_IMPL(ResultsetGetRawBuffer, rs, index, size);
+}
+
+const void * OCI_API OCI_GetRawBuffer2
+(
+    OCI_Resultset* rs,
+    const otext  * name,
+    unsigned int * size
+)
+{
+    CALL_IMPL(ResultsetGetRawBuffer2, rs, name, size);
+}
+
 double OCI_API OCI_GetDouble
 (
     OCI_Resultset* rs,
@@ -5088,6 +5906,46 @@ OCI_Timestamp* OCI_API OCI_GetTimestamp2
     CALL_IMPL(ResultsetGetTimestamp2, rs, name);
 }
 
+big_int OCI_API OCI_GetEpoch
+(
+    OCI_Resultset* rs,
+    unsigned int   index,
+    unsigned int   unit
+)
+{
+    CALL_IMPL(ResultsetGetEpoch, rs, index, unit);
+}
+
+big_int OCI_API OCI_GetEpoch2
+(
+    OCI_Resultset* rs,
+    const otext  * name,
+    unsigned int   unit
+)
+{
+    CALL_IMPL(ResultsetGetEpoch2, rs, name, unit);
+}
+
+boolean OCI_API OCI_GetTm
+(
+    OCI_Resultset* rs,
+    unsigned int   index,
+    struct tm    * value
+)
+{
+    CALL_IMPL(ResultsetGetTm, rs, index, value);
+}
+
+boolean OCI_API OCI_GetTm2
+(
+    OCI_Resultset* rs,
+    const otext  * name,
+    struct tm    * value
+)
+{
+    CALL_IMPL(ResultsetGetTm2, rs, name, value);
+}
+
 OCI_Interval* OCI_API OCI_GetInterval
 (
     OCI_Resultset* rs,
@@ -5305,6 +6163,24 @@ boolean OCI_API OCI_StatementFree
     CALL_IMPL(StatementFree, stmt);
 }
 
+OCI_Statement* OCI_API OCI_StatementAcquire
+(
+    OCI_Connection* con,
+    const otext*    sql,
+    const otext*    binds
+)
+{
+    CALL_IMPL(PreparedCacheAcquire, con, sql, binds);
+}
+
+boolean OCI_API OCI_StatementRelease
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(PreparedCacheRelease, stmt);
+}
+
 boolean OCI_API OCI_ReleaseResultsets
 (
     OCI_Statement* stmt
@@ -5459,6 +6335,23 @@ boolean OCI_API OCI_IsRebindingAllowed
     CALL_IMPL(StatementIsRebindingAllowed, stmt);
 }
 
+boolean OCI_API OCI_SetBindDirtyTracking
+(
+    OCI_Statement* stmt,
+    boolean        value
+)
+{
+    CALL_IMPL(StatementSetBindDirtyTracking, stmt, value);
+}
+
+boolean OCI_API OCI_GetBindDirtyTracking
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(StatementGetBindDirtyTracking, stmt);
+}
+
 boolean OCI_API OCI_BindBoolean
 (
     OCI_Statement* stmt,
@@ -5747,6 +6640,39 @@ boolean OCI_API OCI_BindArrayOfTimestamps
     CALL_IMPL(StatementBindArrayOfTimestamps, stmt, name, data, type, nbelem);
 }
 
+boolean OCI_API OCI_BindArrayOfEpochs
+(
+    OCI_Statement* stmt,
+    const otext  * name,
+    big_int      * data,
+    unsigned int   unit,
+    unsigned int   nbelem
+)
+{
+    CALL_IMPL(StatementBindArrayOfEpochs, stmt, name, data, unit, nbelem);
+}
+
+boolean OCI_API OCI_BindArrayOfTms
+(
+    OCI_Statement* stmt,
+    const otext  * name,
+    struct tm    * data,
+    unsigned int   nbelem
+)
+{
+    CALL_IMPL(StatementBindArrayOfTms, stmt, name, data, nbelem);
+}
+
+boolean OCI_API OCI_BindArrowBatch
+(
+    OCI_Statement*            stmt,
+    const struct ArrowSchema* schema,
+    const struct ArrowArray*  array
+)
+{
+    CALL_IMPL(StatementBindArrowBatch, stmt, schema, array);
+}
+
 boolean OCI_API OCI_BindInterval
 (
     OCI_Statement* stmt,
@@ -5900,6 +6826,20 @@ boolean OCI_API OCI_BindLong
     CALL_IMPL(StatementBindLong, stmt, name, data, size);
 }
 
+boolean OCI_API OCI_BindStream
+(
+    OCI_Statement    * stmt,
+    const otext      * name,
+    unsigned int       type,
+    unsigned int       subtype,
+    unsigned int       len,
+    POCI_BIND_PRODUCER producer,
+    void             * ctx
+)
+{
+    CALL_IMPL(StatementBindStream, stmt, name, type, subtype, len, producer, ctx);
+}
+
 boolean OCI_API OCI_RegisterNumber
 (
     OCI_Statement* stmt,
@@ -6214,6 +7154,40 @@ unsigned int OCI_API OCI_GetLongMode
     CALL_IMPL(StatementGetLongMode, stmt);
 }
 
+boolean OCI_API OCI_SetLobMode
+(
+    OCI_Statement* stmt,
+    unsigned int   mode
+)
+{
+    CALL_IMPL(StatementSetLobMode, stmt, mode);
+}
+
+unsigned int OCI_API OCI_GetLobMode
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(StatementGetLobMode, stmt);
+}
+
+boolean OCI_API OCI_SetLobInlineSize
+(
+    OCI_Statement* stmt,
+    unsigned int   size
+)
+{
+    CALL_IMPL(StatementSetLobInlineSize, stmt, size);
+}
+
+unsigned int OCI_API OCI_GetLobInlineSize
+(
+    OCI_Statement* stmt
+)
+{
+    CALL_IMPL(StatementGetLobInlineSize, stmt);
+}
+
 OCI_Connection* OCI_API OCI_StatementGetConnection
 (
     OCI_Statement* stmt
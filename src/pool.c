@@ -23,6 +23,7 @@
 #include "connection.h"
 #include "list.h"
 #include "macros.h"
+#include "resultcache.h"
 #include "strings.h"
 
 static unsigned int PoolTypeValues[] =
@@ -107,6 +108,16 @@ boolean PoolDispose
     pool->handle = NULL;
     pool->authp  = NULL;
 
+    /* free result cache */
+
+    if (NULL != pool->rcache)
+    {
+        ListForEachWithParam(Env.cons, pool->rcache, (POCI_LIST_FOR_EACH_WITH_PARAM) ResultCacheReleaseConnection);
+        ResultCacheFree(pool->rcache);
+
+        pool->rcache = NULL;
+    }
+
     /* free strings */
 
     FREE(pool->name)
@@ -898,3 +909,76 @@ unsigned int PoolGetStatementCacheSize
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolSetResultCache
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolSetResultCache
+(
+    OCI_Pool    *pool,
+    unsigned int max_entries,
+    unsigned int max_size,
+    unsigned int ttl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    OCI_Subscription *sub = NULL;
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+
+    /* drop the current cache, keeping its invalidation subscription */
+
+    if (NULL != pool->rcache)
+    {
+        sub = pool->rcache->sub;
+
+        ListForEachWithParam(Env.cons, pool->rcache, (POCI_LIST_FOR_EACH_WITH_PARAM) ResultCacheReleaseConnection);
+        ResultCacheFree(pool->rcache);
+
+        pool->rcache = NULL;
+    }
+
+    if (max_entries > 0)
+    {
+        pool->rcache = ResultCacheCreate(max_entries, max_size, ttl);
+        CHECK_NULL(pool->rcache)
+
+        pool->rcache->sub = sub;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PoolSetResultCacheSubscription
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PoolSetResultCacheSubscription
+(
+    OCI_Pool         *pool,
+    OCI_Subscription *sub
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_POOL, pool
+    )
+
+    CHECK_PTR(OCI_IPC_POOL, pool)
+    CHECK_NULL(pool->rcache)
+
+    CHECK(ResultCacheSetSubscription(pool->rcache, sub))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
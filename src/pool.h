@@ -109,4 +109,18 @@ unsigned int PoolGetStatementCacheSize
     OCI_Pool *pool
 );
 
+boolean PoolSetResultCache
+(
+    OCI_Pool    *pool,
+    unsigned int max_entries,
+    unsigned int max_size,
+    unsigned int ttl
+);
+
+boolean PoolSetResultCacheSubscription
+(
+    OCI_Pool         *pool,
+    OCI_Subscription *sub
+);
+
 #endif /* OCILIB_POOL_H_INCLUDED */
@@ -0,0 +1,671 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "preparedcache.h"
+
+#include "exception.h"
+#include "helpers.h"
+#include "macros.h"
+#include "memory.h"
+#include "resultcache.h"
+#include "statement.h"
+
+#define PCACHE_MIN_BUCKETS 16
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheGetBindSpec
+ * --------------------------------------------------------------------------------------------- */
+
+static const otext * PreparedCacheGetBindSpec(OCI_Bind *bnd)
+{
+    /* bind types are described with the OCI_ExecuteStmtFmt() specifiers */
+
+    switch (bnd->type)
+    {
+        case OCI_CDT_NUMERIC:
+        {
+            switch (bnd->subtype)
+            {
+                case OCI_NUM_SHORT:   return OTEXT("%hi");
+                case OCI_NUM_USHORT:  return OTEXT("%hu");
+                case OCI_NUM_INT:     return OTEXT("%i");
+                case OCI_NUM_UINT:    return OTEXT("%u");
+                case OCI_NUM_BIGINT:  return OTEXT("%li");
+                case OCI_NUM_BIGUINT: return OTEXT("%lu");
+                case OCI_NUM_DOUBLE:  return OTEXT("%g");
+                case OCI_NUM_NUMBER:  return OTEXT("%n");
+                default:              return NULL;
+            }
+        }
+        case OCI_CDT_TEXT:      return OTEXT("%s");
+        case OCI_CDT_DATETIME:  return OTEXT("%t");
+        case OCI_CDT_TIMESTAMP: return OTEXT("%p");
+        case OCI_CDT_INTERVAL:  return OTEXT("%v");
+        default:                return NULL;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheBuildSignature
+ * --------------------------------------------------------------------------------------------- */
+
+static otext * PreparedCacheBuildSignature(OCI_Statement *stmt)
+{
+    otext *sign = NULL;
+    size_t size = 16;
+
+    /* canonical form : "[array size]name spec,name spec..." in binding order.
+       NULL is returned for binds that cannot be described */
+
+    for (ub4 i = 0; i < stmt->nb_ubinds; i++)
+    {
+        OCI_Bind *bnd = stmt->ubinds[i];
+
+        if (NULL == PreparedCacheGetBindSpec(bnd))
+        {
+            return NULL;
+        }
+
+        size += ostrlen(bnd->name) + 6;
+    }
+
+    sign = (otext *) MemoryAlloc(OCI_IPC_STRING, sizeof(otext), size, TRUE);
+
+    if (NULL != sign)
+    {
+        /* the array size only matters when there are binds */
+
+        osprintf(sign, (int) size, OTEXT("[%u]"), stmt->nb_ubinds > 0 ? (unsigned int) stmt->nb_iters_init : 1);
+
+        for (ub4 i = 0; i < stmt->nb_ubinds; i++)
+        {
+            OCI_Bind *bnd = stmt->ubinds[i];
+
+            if (i > 0)
+            {
+                ostrcat(sign, OTEXT(","));
+            }
+
+            ostrcat(sign, bnd->name);
+            ostrcat(sign, OTEXT(" "));
+            ostrcat(sign, PreparedCacheGetBindSpec(bnd));
+        }
+    }
+
+    return sign;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheParseSignature
+ * --------------------------------------------------------------------------------------------- */
+
+static otext * PreparedCacheParseSignature(const otext *str, otext *token)
+{
+    unsigned int nb_iters = 1;
+
+    const otext *p = str;
+
+    otext *sign = NULL;
+    size_t size = 16 + (NULL != str ? ostrlen(str) : 0);
+    size_t len  = 0;
+
+    /* turns a signature given by the program into the canonical form built
+       by PreparedCacheBuildSignature(). If it is malformed, NULL is returned
+       and token is set to the unexpected character */
+
+    *token = 0;
+
+    while (NULL != p && OTEXT(' ') == *p)
+    {
+        p++;
+    }
+
+    if (NULL != p && OTEXT('[') == *p)
+    {
+        nb_iters = 0;
+
+        for (p++; *p >= OTEXT('0') && *p <= OTEXT('9'); p++)
+        {
+            nb_iters = nb_iters * 10 + (unsigned int) (*p - OTEXT('0'));
+        }
+
+        if (0 == nb_iters || OTEXT(']') != *p++)
+        {
+            *token = OTEXT('[');
+            return NULL;
+        }
+    }
+
+    sign = (otext *) MemoryAlloc(OCI_IPC_STRING, sizeof(otext), size, TRUE);
+
+    if (NULL == sign)
+    {
+        return NULL;
+    }
+
+    osprintf(sign, (int) size, OTEXT("[%u]"), nb_iters);
+
+    len = ostrlen(sign);
+
+    while (NULL != p && *p)
+    {
+        /* name, then specifier, separated by blanks */
+
+        while (OTEXT(' ') == *p)
+        {
+            p++;
+        }
+
+        if (0 == *p)
+        {
+            break;
+        }
+
+        if (len > 3 && OTEXT(']') != sign[len - 1])
+        {
+            sign[len++] = OTEXT(',');
+        }
+
+        while (*p && OTEXT(' ') != *p && OTEXT(',') != *p)
+        {
+            sign[len++] = *p++;
+        }
+
+        while (OTEXT(' ') == *p)
+        {
+            p++;
+        }
+
+        if (OTEXT('%') != *p)
+        {
+            *token = *p ? *p : OTEXT(',');
+            MemoryFree(sign);
+            return NULL;
+        }
+
+        sign[len++] = OTEXT(' ');
+
+        while (*p && OTEXT(' ') != *p && OTEXT(',') != *p)
+        {
+            sign[len++] = *p++;
+        }
+
+        while (OTEXT(' ') == *p)
+        {
+            p++;
+        }
+
+        if (OTEXT(',') == *p)
+        {
+            p++;
+        }
+        else if (0 != *p)
+        {
+            *token = *p;
+            MemoryFree(sign);
+            return NULL;
+        }
+    }
+
+    sign[len] = 0;
+
+    /* the array size only matters when there are binds */
+
+    if (OTEXT(']') == sign[len - 1])
+    {
+        osprintf(sign, (int) size, OTEXT("[%u]"), 1);
+    }
+
+    return sign;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheUnlink
+ * --------------------------------------------------------------------------------------------- */
+
+static void PreparedCacheUnlink(OCI_PreparedCache *cache, OCI_Statement *stmt)
+{
+    OCI_Statement **link = &cache->buckets[stmt->pc_hash % cache->nb_buckets];
+
+    while (NULL != *link && *link != stmt)
+    {
+        link = &(*link)->pc_chain;
+    }
+
+    if (NULL != *link)
+    {
+        *link = stmt->pc_chain;
+    }
+
+    if (NULL != stmt->pc_prev)
+    {
+        stmt->pc_prev->pc_next = stmt->pc_next;
+    }
+    else
+    {
+        cache->head = stmt->pc_next;
+    }
+
+    if (NULL != stmt->pc_next)
+    {
+        stmt->pc_next->pc_prev = stmt->pc_prev;
+    }
+    else
+    {
+        cache->tail = stmt->pc_prev;
+    }
+
+    stmt->pc_prev  = NULL;
+    stmt->pc_next  = NULL;
+    stmt->pc_chain = NULL;
+    stmt->pc_idle  = FALSE;
+
+    MemoryFree(stmt->pc_sign);
+    stmt->pc_sign = NULL;
+
+    cache->count--;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheResize
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean PreparedCacheResize(OCI_PreparedCache *cache, unsigned int size)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_Statement **buckets = NULL;
+
+    const unsigned int nb_buckets = size > PCACHE_MIN_BUCKETS ? size : PCACHE_MIN_BUCKETS;
+
+    if (nb_buckets == cache->nb_buckets)
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    ALLOC_DATA(OCI_IPC_PCACHE, buckets, nb_buckets)
+
+    /* rehash idle statements, most recently released ones first in their bucket */
+
+    for (OCI_Statement *item = cache->tail; NULL != item; item = item->pc_prev)
+    {
+        const unsigned int index = item->pc_hash % nb_buckets;
+
+        item->pc_chain = buckets[index];
+        buckets[index] = item;
+    }
+
+    FREE(cache->buckets)
+
+    cache->buckets    = buckets;
+    cache->nb_buckets = nb_buckets;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheEvict
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean PreparedCacheEvict(OCI_PreparedCache *cache, unsigned int size)
+{
+    boolean res = TRUE;
+
+    /* StatementFree() unlinks the statement from the cache */
+
+    while (cache->count > size && NULL != cache->tail)
+    {
+        res = StatementFree(cache->tail) && res;
+    }
+
+    return res;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheSetSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PreparedCacheSetSize
+(
+    OCI_Connection *con,
+    unsigned int    size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    if (NULL == con->pcache)
+    {
+        if (0 == size)
+        {
+            SET_SUCCESS()
+            JUMP_EXIT()
+        }
+
+        ALLOC_DATA(OCI_IPC_PCACHE, con->pcache, 1)
+    }
+
+    CHECK(PreparedCacheEvict(con->pcache, size))
+
+    if (0 == size)
+    {
+        FREE(con->pcache->buckets)
+        FREE(con->pcache)
+    }
+    else
+    {
+        CHECK(PreparedCacheResize(con->pcache, size))
+
+        con->pcache->max_size = size;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheGetSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int PreparedCacheGetSize
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->pcache ? con->pcache->max_size : 0)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheGetHits
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int PreparedCacheGetHits
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->pcache ? con->pcache->hits : 0)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheGetMisses
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int PreparedCacheGetMisses
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->pcache ? con->pcache->misses : 0)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheAcquire
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_Statement * PreparedCacheAcquire
+(
+    OCI_Connection *con,
+    const otext    *sql,
+    const otext    *binds
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_Statement*, NULL,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    otext *sign  = NULL;
+    otext  token = 0;
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_STRING,     sql)
+
+    OCI_PreparedCache *cache = con->pcache;
+    OCI_Statement     *stmt  = NULL;
+
+    const unsigned int hash = ComputeStringHash(sql);
+
+    if (NULL != cache)
+    {
+        sign = PreparedCacheParseSignature(binds, &token);
+
+        if (NULL == sign)
+        {
+            if (0 != token)
+            {
+                THROW(ExceptionParsingToken, token)
+            }
+
+            CHECK(FALSE)
+        }
+
+        /* look for an idle statement prepared with the same SQL text and bind signature */
+
+        for (OCI_Statement *item = cache->buckets[hash % cache->nb_buckets]; NULL != item; item = item->pc_chain)
+        {
+            if (item->pc_hash == hash && 0 == ostrcmp(item->sql, sql) &&
+                0 == ostrcasecmp(item->pc_sign, sign))
+            {
+                stmt = item;
+                break;
+            }
+        }
+
+        if (NULL != stmt)
+        {
+            PreparedCacheUnlink(cache, stmt);
+
+            cache->hits++;
+        }
+        else
+        {
+            cache->misses++;
+        }
+    }
+
+    if (NULL == stmt)
+    {
+        stmt = StatementCreate(con);
+        CHECK_NULL(stmt)
+
+        if (!StatementPrepare(stmt, sql))
+        {
+            StatementFree(stmt);
+
+            JUMP_EXIT()
+        }
+
+        stmt->pc_hash = hash;
+    }
+
+    /* binds are kept between executions, so they can be updated in place */
+
+    stmt->bind_reuse = TRUE;
+
+    SET_RETVAL(stmt)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        MemoryFree(sign);
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheRelease
+ * --------------------------------------------------------------------------------------------- */
+
+boolean PreparedCacheRelease
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_OBJECT_FETCHED(stmt)
+
+    OCI_PreparedCache *cache = stmt->con->pcache;
+
+    if (stmt->pc_idle)
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    /* statements that cannot be reused are just freed */
+
+    if (NULL == cache || NULL == stmt->sql || !(stmt->status & OCI_STMT_PREPARED))
+    {
+        CHECK(StatementFree(stmt))
+
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    CHECK(ResultCacheReleasePending(stmt))
+
+    /* statements with binds that cannot be described by a signature are not reused */
+
+    stmt->pc_sign = PreparedCacheBuildSignature(stmt);
+
+    if (NULL == stmt->pc_sign)
+    {
+        CHECK(StatementFree(stmt))
+
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    /* the statement may have been prepared again with another SQL text */
+
+    stmt->pc_hash = ComputeStringHash(stmt->sql);
+
+    /* insert it as the most recently used idle statement */
+
+    const unsigned int index = stmt->pc_hash % cache->nb_buckets;
+
+    stmt->pc_chain        = cache->buckets[index];
+    cache->buckets[index] = stmt;
+
+    stmt->pc_prev = NULL;
+    stmt->pc_next = cache->head;
+    stmt->pc_idle = TRUE;
+
+    if (NULL != cache->head)
+    {
+        cache->head->pc_prev = stmt;
+    }
+    else
+    {
+        cache->tail = stmt;
+    }
+
+    cache->head = stmt;
+    cache->count++;
+
+    CHECK(PreparedCacheEvict(cache, cache->max_size))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheRemove
+ * --------------------------------------------------------------------------------------------- */
+
+void PreparedCacheRemove
+(
+    OCI_Statement *stmt
+)
+{
+    if (NULL != stmt && stmt->pc_idle && NULL != stmt->con->pcache)
+    {
+        PreparedCacheUnlink(stmt->con->pcache, stmt);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * PreparedCacheClear
+ * --------------------------------------------------------------------------------------------- */
+
+void PreparedCacheClear
+(
+    OCI_Connection *con
+)
+{
+    OCI_PreparedCache *cache = con ? con->pcache : NULL;
+
+    /* idle statements are disposed with the other connection statements */
+
+    while (NULL != cache && NULL != cache->head)
+    {
+        PreparedCacheUnlink(cache, cache->head);
+    }
+}
@@ -0,0 +1,683 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiler.h"
+
+#include "helpers.h"
+#include "list.h"
+#include "macros.h"
+#include "memory.h"
+
+static const otext * PhaseNames[OCI_PROFILE_PHASES] =
+{
+    OTEXT("prepare"),
+    OTEXT("execute"),
+    OTEXT("fetch"),
+    OTEXT("convert")
+};
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerDetach
+ * --------------------------------------------------------------------------------------------- */
+
+static void ProfilerDetach(void *data)
+{
+    ((OCI_Statement *) data)->prof = NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerFreeEntries
+ * --------------------------------------------------------------------------------------------- */
+
+static void ProfilerFreeEntries(OCI_Profiler *prof)
+{
+    while (NULL != prof->head)
+    {
+        OCI_ProfileEntry *entry = prof->head;
+
+        prof->head = entry->next;
+
+        FREE(entry->sql)
+        FREE(entry->sql_id)
+        FREE(entry)
+    }
+
+    prof->tail  = NULL;
+    prof->count = 0;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerGetEntry
+ * --------------------------------------------------------------------------------------------- */
+
+static OCI_ProfileEntry * ProfilerGetEntry(OCI_Statement *stmt)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_ProfileEntry*, NULL,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_Profiler     *prof  = stmt->con->profiler;
+    OCI_ProfileEntry *entry = NULL;
+
+    const unsigned int hash = ComputeStringHash(stmt->sql);
+
+    for (OCI_ProfileEntry *item = prof->head; NULL != item; item = item->next)
+    {
+        if (item->hash == hash && 0 == ostrcmp(item->sql, stmt->sql))
+        {
+            entry = item;
+            break;
+        }
+    }
+
+    if (NULL == entry)
+    {
+        ALLOC_DATA(OCI_IPC_PROFILER, entry, 1)
+
+        entry->sql  = ostrdup(stmt->sql);
+        entry->hash = hash;
+
+        if (NULL != prof->tail)
+        {
+            prof->tail->next = entry;
+        }
+        else
+        {
+            prof->head = entry;
+        }
+
+        prof->tail = entry;
+        prof->count++;
+    }
+
+    SET_RETVAL(entry)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            FREE(entry)
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerUpdatePhase
+ * --------------------------------------------------------------------------------------------- */
+
+void ProfilerUpdatePhase
+(
+    OCI_ProfilePhase *phase,
+    big_uint          elapsed
+)
+{
+    /* slot 0 : less than 1 microsecond, slot i : [2^(i-1), 2^i) microseconds */
+
+    big_uint     usecs = elapsed / 1000;
+    unsigned int slot  = 0;
+
+    while (usecs > 0 && slot < OCI_PROFILE_BUCKETS - 1)
+    {
+        usecs >>= 1;
+        slot++;
+    }
+
+    if (0 == phase->count || elapsed < phase->min)
+    {
+        phase->min = elapsed;
+    }
+
+    if (elapsed > phase->max)
+    {
+        phase->max = elapsed;
+    }
+
+    phase->count++;
+    phase->total += elapsed;
+    phase->histogram[slot]++;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerAddTiming
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ProfilerAddTiming
+(
+    OCI_Statement *stmt,
+    unsigned int   phase,
+    big_uint       elapsed,
+    big_uint       rows,
+    big_uint       bytes
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    /* statements without SQL text (ref cursors, implicit results) are not profiled */
+
+    if (NULL == stmt->con->profiler || !IS_STRING_VALID(stmt->sql))
+    {
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    if (NULL == stmt->prof)
+    {
+        stmt->prof = ProfilerGetEntry(stmt);
+        CHECK_NULL(stmt->prof)
+    }
+
+    OCI_ProfileEntry *entry = stmt->prof;
+
+    /* SQL identifier is only recorded once retrieved by the program */
+
+    if (NULL == entry->sql_id && NULL != stmt->sql_id)
+    {
+        entry->sql_id = ostrdup(stmt->sql_id);
+    }
+
+    ProfilerUpdatePhase(&entry->phases[phase], elapsed);
+
+    entry->rows  += rows;
+    entry->bytes += bytes;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerFetchedBytes
+ * --------------------------------------------------------------------------------------------- */
+
+static big_uint ProfilerFetchedBytes(OCI_Resultset *rs, ub4 rows)
+{
+    big_uint bytes = 0;
+
+    for (ub4 i = 0; i < rs->nb_defs; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+
+        for (ub4 j = 0; j < rows && j < def->buf.count; j++)
+        {
+            if (NULL != def->buf.inds && OCI_IND_NULL == def->buf.inds[j])
+            {
+                continue;
+            }
+
+            if (NULL == def->buf.lens)
+            {
+                bytes += def->col.bufsize;
+            }
+            else if (sizeof(ub2) == def->buf.sizelen)
+            {
+                bytes += ((ub2 *) def->buf.lens)[j];
+            }
+            else
+            {
+                bytes += ((ub4 *) def->buf.lens)[j];
+            }
+        }
+    }
+
+    return bytes;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerAppend
+ * --------------------------------------------------------------------------------------------- */
+
+static void ProfilerAppend
+(
+    otext        *str,
+    unsigned int  max,
+    unsigned int *len,
+    const otext  *text,
+    boolean       escape
+)
+{
+    otext tmp[8];
+
+    for (const otext *p = text; (*p) != 0; p++)
+    {
+        const otext *out = tmp;
+
+        tmp[0] = *p;
+        tmp[1] = 0;
+
+        if (escape)
+        {
+            switch (*p)
+            {
+                case OTEXT('"'):  out = OTEXT("\\\""); break;
+                case OTEXT('\\'): out = OTEXT("\\\\"); break;
+                case OTEXT('\n'): out = OTEXT("\\n");  break;
+                case OTEXT('\r'): out = OTEXT("\\r");  break;
+                case OTEXT('\t'): out = OTEXT("\\t");  break;
+                default:
+                {
+                    if ((unsigned int) (*p) < 0x20)
+                    {
+                        osprintf(tmp, (int) (sizeof(tmp) / sizeof(otext)), OTEXT("\\u%04x"),
+                                 (unsigned int) (*p));
+                    }
+                }
+            }
+        }
+
+        for (; (*out) != 0; out++)
+        {
+            if (NULL != str && *len < max)
+            {
+                str[*len] = *out;
+            }
+
+            (*len)++;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerAppendNumber
+ * --------------------------------------------------------------------------------------------- */
+
+static void ProfilerAppendNumber
+(
+    otext        *str,
+    unsigned int  max,
+    unsigned int *len,
+    const otext  *name,
+    big_uint      value
+)
+{
+    otext tmp[32];
+
+    osprintf(tmp, (int) (sizeof(tmp) / sizeof(otext)), OTEXT("%llu"), value);
+
+    ProfilerAppend(str, max, len, OTEXT("\""), FALSE);
+    ProfilerAppend(str, max, len, name, FALSE);
+    ProfilerAppend(str, max, len, OTEXT("\":"), FALSE);
+    ProfilerAppend(str, max, len, tmp, FALSE);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerClock
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint ProfilerClock
+(
+    void
+)
+{
+#ifdef _WINDOWS
+
+    LARGE_INTEGER freq, count;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+
+    return (big_uint) (count.QuadPart / freq.QuadPart) * 1000000000 +
+           (big_uint) (count.QuadPart % freq.QuadPart) * 1000000000 / freq.QuadPart;
+
+#else
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (big_uint) ts.tv_sec * 1000000000 + (big_uint) ts.tv_nsec;
+
+#endif
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerStart
+ * --------------------------------------------------------------------------------------------- */
+
+big_uint ProfilerStart
+(
+    OCI_Connection *con
+)
+{
+    /* 0 means "not profiled" to ProfilerRecord() */
+
+    if (NULL == con->profiler || !con->profiler->enabled)
+    {
+        return 0;
+    }
+
+    return ProfilerClock();
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerRecord
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ProfilerRecord
+(
+    OCI_Statement *stmt,
+    unsigned int   phase,
+    big_uint       start,
+    big_uint       rows,
+    big_uint       bytes
+)
+{
+    if (0 == start)
+    {
+        return TRUE;
+    }
+
+    return ProfilerAddTiming(stmt, phase, ProfilerClock() - start, rows, bytes);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerRecordFetch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ProfilerRecordFetch
+(
+    OCI_Resultset *rs,
+    big_uint       start,
+    big_uint       fetched,
+    ub4            rows
+)
+{
+    if (0 == start)
+    {
+        return TRUE;
+    }
+
+    /* the fetch phase ends with the round trip, the rest is client side processing */
+
+    const big_uint now = ProfilerClock();
+
+    return ProfilerAddTiming(rs->stmt, OCI_PROFILE_FETCH, fetched - start, 0, 0) &&
+           ProfilerAddTiming(rs->stmt, OCI_PROFILE_CONVERT, now - fetched, rows,
+                             ProfilerFetchedBytes(rs, rows));
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerSetEnabled
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ProfilerSetEnabled
+(
+    OCI_Connection *con,
+    boolean         value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* collected statistics are kept when profiling is stopped */
+
+    if (value)
+    {
+        ALLOC_DATA(OCI_IPC_PROFILER, con->profiler, 1)
+    }
+
+    if (NULL != con->profiler)
+    {
+        con->profiler->enabled = value;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerGetEnabled
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ProfilerGetEnabled
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->profiler && con->profiler->enabled)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerClear
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ProfilerClear
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    if (NULL != con->profiler)
+    {
+        /* statements may still point to the entries being freed */
+
+        ListForEach(con->stmts, ProfilerDetach);
+
+        ProfilerFreeEntries(con->profiler);
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerGetCount
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ProfilerGetCount
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    SET_RETVAL(NULL != con->profiler ? con->profiler->count : 0)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerGetInfo
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ProfilerGetInfo
+(
+    OCI_Connection  *con,
+    unsigned int     index,
+    OCI_ProfileInfo *info
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_VOID,       info)
+    CHECK_BOUND(index, 1, ProfilerGetCount(con))
+
+    OCI_ProfileEntry *entry = con->profiler->head;
+
+    for (unsigned int i = 1; i < index; i++)
+    {
+        entry = entry->next;
+    }
+
+    info->sql    = entry->sql;
+    info->sql_id = entry->sql_id;
+    info->hash   = entry->hash;
+    info->rows   = entry->rows;
+    info->bytes  = entry->bytes;
+
+    memcpy(info->phases, entry->phases, sizeof(info->phases));
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerToJson
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ProfilerToJson
+(
+    OCI_Connection *con,
+    unsigned int   *size,
+    otext          *str
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+    CHECK_PTR(OCI_IPC_VOID,       size)
+
+    const unsigned int max = *size;
+
+    unsigned int len = 0;
+
+    ProfilerAppend(str, max, &len, OTEXT("{\"statements\":["), FALSE);
+
+    for (OCI_ProfileEntry *entry = con->profiler ? con->profiler->head : NULL; NULL != entry; entry = entry->next)
+    {
+        ProfilerAppend(str, max, &len, OTEXT("{\"sql\":\""), FALSE);
+        ProfilerAppend(str, max, &len, entry->sql, TRUE);
+        ProfilerAppend(str, max, &len, OTEXT("\",\"sql_id\":"), FALSE);
+
+        if (NULL != entry->sql_id)
+        {
+            ProfilerAppend(str, max, &len, OTEXT("\""), FALSE);
+            ProfilerAppend(str, max, &len, entry->sql_id, TRUE);
+            ProfilerAppend(str, max, &len, OTEXT("\""), FALSE);
+        }
+        else
+        {
+            ProfilerAppend(str, max, &len, OTEXT("null"), FALSE);
+        }
+
+        ProfilerAppend(str, max, &len, OTEXT(","), FALSE);
+        ProfilerAppendNumber(str, max, &len, OTEXT("hash"), entry->hash);
+        ProfilerAppend(str, max, &len, OTEXT(","), FALSE);
+        ProfilerAppendNumber(str, max, &len, OTEXT("rows"), entry->rows);
+        ProfilerAppend(str, max, &len, OTEXT(","), FALSE);
+        ProfilerAppendNumber(str, max, &len, OTEXT("bytes"), entry->bytes);
+
+        for (unsigned int i = 0; i < OCI_PROFILE_PHASES; i++)
+        {
+            const OCI_ProfilePhase *phase = &entry->phases[i];
+
+            ProfilerAppend(str, max, &len, OTEXT(",\""), FALSE);
+            ProfilerAppend(str, max, &len, PhaseNames[i], FALSE);
+            ProfilerAppend(str, max, &len, OTEXT("\":{"), FALSE);
+            ProfilerAppendNumber(str, max, &len, OTEXT("count"), phase->count);
+            ProfilerAppend(str, max, &len, OTEXT(","), FALSE);
+            ProfilerAppendNumber(str, max, &len, OTEXT("total_ns"), phase->total);
+            ProfilerAppend(str, max, &len, OTEXT(","), FALSE);
+            ProfilerAppendNumber(str, max, &len, OTEXT("min_ns"), phase->min);
+            ProfilerAppend(str, max, &len, OTEXT(","), FALSE);
+            ProfilerAppendNumber(str, max, &len, OTEXT("max_ns"), phase->max);
+            ProfilerAppend(str, max, &len, OTEXT(",\"histogram\":["), FALSE);
+
+            for (unsigned int j = 0; j < OCI_PROFILE_BUCKETS; j++)
+            {
+                otext tmp[16];
+
+                osprintf(tmp, (int) (sizeof(tmp) / sizeof(otext)), j > 0 ? OTEXT(",%u") : OTEXT("%u"),
+                         phase->histogram[j]);
+
+                ProfilerAppend(str, max, &len, tmp, FALSE);
+            }
+
+            ProfilerAppend(str, max, &len, OTEXT("]}"), FALSE);
+        }
+
+        ProfilerAppend(str, max, &len, NULL != entry->next ? OTEXT("},") : OTEXT("}"), FALSE);
+    }
+
+    ProfilerAppend(str, max, &len, OTEXT("]}"), FALSE);
+
+    if (NULL != str)
+    {
+        str[len < max ? len : max] = 0;
+    }
+
+    *size = len;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ProfilerFree
+ * --------------------------------------------------------------------------------------------- */
+
+void ProfilerFree
+(
+    OCI_Connection *con
+)
+{
+    if (NULL != con && NULL != con->profiler)
+    {
+        ProfilerFreeEntries(con->profiler);
+
+        FREE(con->profiler)
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_PROFILER_H_INCLUDED
+#define OCILIB_PROFILER_H_INCLUDED
+
+#include "types.h"
+
+big_uint ProfilerClock
+(
+    void
+);
+
+big_uint ProfilerStart
+(
+    OCI_Connection *con
+);
+
+void ProfilerUpdatePhase
+(
+    OCI_ProfilePhase *phase,
+    big_uint          elapsed
+);
+
+boolean ProfilerRecord
+(
+    OCI_Statement *stmt,
+    unsigned int   phase,
+    big_uint       start,
+    big_uint       rows,
+    big_uint       bytes
+);
+
+boolean ProfilerRecordFetch
+(
+    OCI_Resultset *rs,
+    big_uint       start,
+    big_uint       fetched,
+    ub4            rows
+);
+
+boolean ProfilerSetEnabled
+(
+    OCI_Connection *con,
+    boolean         value
+);
+
+boolean ProfilerGetEnabled
+(
+    OCI_Connection *con
+);
+
+boolean ProfilerClear
+(
+    OCI_Connection *con
+);
+
+unsigned int ProfilerGetCount
+(
+    OCI_Connection *con
+);
+
+boolean ProfilerGetInfo
+(
+    OCI_Connection  *con,
+    unsigned int     index,
+    OCI_ProfileInfo *info
+);
+
+boolean ProfilerToJson
+(
+    OCI_Connection *con,
+    unsigned int   *size,
+    otext          *str
+);
+
+void ProfilerFree
+(
+    OCI_Connection *con
+);
+
+#endif /* OCILIB_PROFILER_H_INCLUDED */
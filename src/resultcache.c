@@ -0,0 +1,1289 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "resultcache.h"
+
+#include "define.h"
+#include "list.h"
+#include "macros.h"
+#include "memory.h"
+#include "mutex.h"
+#include "statement.h"
+#include "strings.h"
+
+#define RCACHE_MIN_BUCKETS 16
+
+#define ACQUIRE_LOCK()                        \
+                                              \
+    if (NULL != cache->mutex)                 \
+    {                                         \
+        CHECK(MutexAcquire(cache->mutex))     \
+        locked = TRUE;                        \
+    }
+
+#define RELEASE_LOCK()                        \
+                                              \
+    if (locked)                               \
+    {                                         \
+        MutexRelease(cache->mutex);           \
+        locked = FALSE;                       \
+    }
+
+typedef struct ResultCacheNotifyParams
+{
+    OCI_Subscription *sub;
+    const otext      *objname;
+} ResultCacheNotifyParams;
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheHash
+ * --------------------------------------------------------------------------------------------- */
+
+static unsigned int ResultCacheHash(const ub1 *key, unsigned int size)
+{
+    /* FNV-1a */
+
+    unsigned int hash = 2166136261u;
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        hash ^= key[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheKeyAppend
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultCacheKeyAppend
+(
+    OCI_ResultCacheEntry *entry,
+    unsigned int         *allocated,
+    const void           *data,
+    unsigned int          size
+)
+{
+    if (entry->key_size + size > *allocated)
+    {
+        unsigned int new_size = (*allocated) * 2;
+
+        if (new_size < entry->key_size + size)
+        {
+            new_size = entry->key_size + size;
+        }
+
+        entry->key = MemoryRealloc(entry->key, OCI_IPC_BUFF_ARRAY, 1, new_size, FALSE);
+
+        if (NULL == entry->key)
+        {
+            entry->key_size = *allocated = 0;
+
+            return FALSE;
+        }
+
+        *allocated = new_size;
+    }
+
+    if (size > 0)
+    {
+        memcpy(entry->key + entry->key_size, data, size);
+
+        entry->key_size += size;
+    }
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheBuildKey
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultCacheBuildKey
+(
+    OCI_Statement        *stmt,
+    OCI_ResultCacheEntry *entry,
+    boolean              *cacheable
+)
+{
+    unsigned int allocated = 0;
+
+    *cacheable = FALSE;
+
+    if (!ResultCacheKeyAppend(entry, &allocated, stmt->sql,
+                              (unsigned int) ((ostrlen(stmt->sql) + 1) * sizeof(otext))))
+    {
+        return FALSE;
+    }
+
+    for (ub2 i = 0; i < stmt->nb_ubinds; i++)
+    {
+        OCI_Bind *bnd = stmt->ubinds[i];
+
+        const ub1   *data = (const ub1 *) bnd->buffer.data;
+        unsigned int size = 0;
+
+        /* only scalar binds with a value fully held by the bind buffer can be part of the key */
+
+        if (bnd->is_array || NULL == data || NULL != bnd->producer)
+        {
+            return TRUE;
+        }
+
+        switch (bnd->type)
+        {
+            case OCI_CDT_TEXT:
+            {
+                while ((size + sizeof(dbtext)) <= (unsigned int) bnd->size &&
+                       *((const dbtext *) (data + size)) != 0)
+                {
+                    size += (unsigned int) sizeof(dbtext);
+                }
+                break;
+            }
+            case OCI_CDT_RAW:
+            {
+                size = (unsigned int) *(ub2*) bnd->buffer.lens;
+
+                if (size > (unsigned int) bnd->size)
+                {
+                    size = (unsigned int) bnd->size;
+                }
+                break;
+            }
+            case OCI_CDT_NUMERIC:
+            {
+                size = (unsigned int) bnd->size;
+                break;
+            }
+            case OCI_CDT_DATETIME:
+            {
+                size = (unsigned int) bnd->size;
+                break;
+            }
+            default:
+            {
+                return TRUE;
+            }
+        }
+
+        if (bnd->buffer.inds && OCI_IND_NULL == bnd->buffer.inds[0])
+        {
+            size = 0;
+        }
+
+        const ub1 header[] = { bnd->type, bnd->subtype, (ub1) (bnd->code & 0xFF), (ub1) (size == 0) };
+
+        if (!ResultCacheKeyAppend(entry, &allocated, bnd->name,
+                                  (unsigned int) ((ostrlen(bnd->name) + 1) * sizeof(otext))) ||
+            !ResultCacheKeyAppend(entry, &allocated, header, (unsigned int) sizeof(header))   ||
+            !ResultCacheKeyAppend(entry, &allocated, &size,  (unsigned int) sizeof(size))     ||
+            !ResultCacheKeyAppend(entry, &allocated, data,   size))
+        {
+            return FALSE;
+        }
+    }
+
+    entry->hash = ResultCacheHash(entry->key, entry->key_size);
+
+    *cacheable = TRUE;
+
+    return TRUE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheEntryFree
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheEntryFree(OCI_ResultCacheEntry *entry)
+{
+    if (NULL != entry->cols)
+    {
+        for (ub4 i = 0; i < entry->nb_cols; i++)
+        {
+            FREE(entry->cols[i].name)
+        }
+    }
+
+    if (NULL != entry->bufs)
+    {
+        for (ub4 i = 0; i < entry->nb_cols; i++)
+        {
+            FREE(entry->bufs[i].data)
+            FREE(entry->bufs[i].inds)
+            FREE(entry->bufs[i].lens)
+        }
+    }
+
+    if (NULL != entry->deps)
+    {
+        for (ub4 i = 0; i < entry->nb_deps; i++)
+        {
+            FREE(entry->deps[i])
+        }
+    }
+
+    FREE(entry->cols)
+    FREE(entry->bufs)
+    FREE(entry->deps)
+    FREE(entry->key)
+    FREE(entry->sql)
+    FREE(entry)
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheFind
+ * --------------------------------------------------------------------------------------------- */
+
+static OCI_ResultCacheEntry * ResultCacheFind(OCI_ResultCache *cache, OCI_ResultCacheEntry *key)
+{
+    OCI_ResultCacheEntry *entry = cache->buckets[key->hash % cache->nb_buckets];
+
+    while (NULL != entry)
+    {
+        if (entry->hash == key->hash && entry->key_size == key->key_size &&
+            memcmp(entry->key, key->key, key->key_size) == 0)
+        {
+            break;
+        }
+
+        entry = entry->chain;
+    }
+
+    return entry;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheUnlink
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheUnlink(OCI_ResultCache *cache, OCI_ResultCacheEntry *entry)
+{
+    if (NULL != entry->prev)
+    {
+        entry->prev->next = entry->next;
+    }
+    else
+    {
+        cache->head = entry->next;
+    }
+
+    if (NULL != entry->next)
+    {
+        entry->next->prev = entry->prev;
+    }
+    else
+    {
+        cache->tail = entry->prev;
+    }
+
+    entry->prev = entry->next = NULL;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheLinkHead
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheLinkHead(OCI_ResultCache *cache, OCI_ResultCacheEntry *entry)
+{
+    entry->prev = NULL;
+    entry->next = cache->head;
+
+    if (NULL != cache->head)
+    {
+        cache->head->prev = entry;
+    }
+
+    cache->head = entry;
+
+    if (NULL == cache->tail)
+    {
+        cache->tail = entry;
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheRemove
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheRemove(OCI_ResultCache *cache, OCI_ResultCacheEntry *entry)
+{
+    OCI_ResultCacheEntry **link = &cache->buckets[entry->hash % cache->nb_buckets];
+
+    while (NULL != *link && *link != entry)
+    {
+        link = &(*link)->chain;
+    }
+
+    if (NULL != *link)
+    {
+        *link = entry->chain;
+    }
+
+    ResultCacheUnlink(cache, entry);
+
+    cache->count--;
+    cache->size -= entry->size;
+
+    ResultCacheEntryFree(entry);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheFlush
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheFlush(OCI_ResultCache *cache)
+{
+    while (NULL != cache->head)
+    {
+        ResultCacheRemove(cache, cache->head);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheDependsOn
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultCacheDependsOn(OCI_ResultCacheEntry *entry, const otext *objname)
+{
+    /* without the tables registered by the server for the query, we cannot tell
+       whether the entry depends on the object : it is considered stale */
+
+    if (0 == entry->nb_deps)
+    {
+        return TRUE;
+    }
+
+    for (ub4 i = 0; i < entry->nb_deps; i++)
+    {
+        if (0 == ostrcasecmp(entry->deps[i], objname))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheInvalidate
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultCacheInvalidate(OCI_ResultCache *cache, ResultCacheNotifyParams *params)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RCACHE, cache
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_RCACHE, cache)
+
+    if (params->sub == cache->sub)
+    {
+        ACQUIRE_LOCK()
+
+        cache->generation++;
+
+        if (NULL != params->objname)
+        {
+            OCI_ResultCacheEntry *entry = cache->head;
+
+            while (NULL != entry)
+            {
+                OCI_ResultCacheEntry *next = entry->next;
+
+                if (ResultCacheDependsOn(entry, params->objname))
+                {
+                    ResultCacheRemove(cache, entry);
+                }
+
+                entry = next;
+            }
+        }
+        else
+        {
+            /* database events : we cannot tell which entries are stale */
+
+            ResultCacheFlush(cache);
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        RELEASE_LOCK()
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheNotifyConnection
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheNotifyConnection(OCI_Connection *con, ResultCacheNotifyParams *params)
+{
+    if (NULL != con && NULL != con->rcache)
+    {
+        ResultCacheInvalidate(con->rcache, params);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheNotifyPool
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheNotifyPool(OCI_Pool *pool, ResultCacheNotifyParams *params)
+{
+    if (NULL != pool && NULL != pool->rcache)
+    {
+        ResultCacheInvalidate(pool->rcache, params);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheDetachConnection
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheDetachConnection(OCI_Connection *con, OCI_Subscription *sub)
+{
+    if (NULL != con && NULL != con->rcache && con->rcache->sub == sub)
+    {
+        ResultCacheSetSubscription(con->rcache, NULL);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheDetachPool
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheDetachPool(OCI_Pool *pool, OCI_Subscription *sub)
+{
+    if (NULL != pool && NULL != pool->rcache && pool->rcache->sub == sub)
+    {
+        ResultCacheSetSubscription(pool->rcache, NULL);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheReleaseStatement
+ * --------------------------------------------------------------------------------------------- */
+
+static void ResultCacheReleaseStatement(OCI_Statement *stmt, OCI_ResultCache *cache)
+{
+    if (NULL != stmt && NULL != stmt->rc_pending && stmt->rc_pending->cache == cache)
+    {
+        ResultCacheReleasePending(stmt);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheBuildResultset
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultCacheBuildResultset
+(
+    OCI_Statement        *stmt,
+    OCI_ResultCacheEntry *entry
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_Resultset *rs = NULL;
+
+    const ub4 count = entry->nb_rows > 0 ? entry->nb_rows : 1;
+
+    CHECK(StatementReleaseResultsets(stmt))
+
+    ALLOC_DATA(OCI_IPC_RESULTSET_ARRAY, stmt->rsts, 1)
+
+    stmt->nb_rs  = 1;
+    stmt->cur_rs = 0;
+
+    ALLOC_DATA(OCI_IPC_RESULTSET, rs, 1)
+
+    stmt->rsts[0] = rs;
+
+    /* the whole content is already available : no server fetch will be performed */
+
+    rs->stmt         = stmt;
+    rs->bof          = TRUE;
+    rs->eof          = FALSE;
+    rs->fetch_size   = count;
+    rs->fetch_status = OCI_NO_DATA;
+    rs->row_count    = entry->nb_rows;
+    rs->row_fetched  = entry->nb_rows;
+    rs->row_cur      = 0;
+    rs->row_abs      = 0;
+    rs->from_cache   = TRUE;
+
+    ALLOC_DATA(OCI_IPC_DEFINE, rs->defs, entry->nb_cols)
+
+    for (ub4 i = 0; i < entry->nb_cols; i++)
+    {
+        OCI_Define *def = &rs->defs[i];
+        OCI_Buffer *buf = &entry->bufs[i];
+
+        def->rs          = rs;
+        def->col         = entry->cols[i];
+        def->col.name    = ostrdup(entry->cols[i].name);
+        def->buf.count   = count;
+        def->buf.sizelen = sizeof(ub2);
+
+        rs->nb_defs++;
+
+        CHECK(DefineAlloc(def))
+
+        if (entry->nb_rows > 0)
+        {
+            memcpy(def->buf.data, buf->data, (size_t) def->col.bufsize * entry->nb_rows);
+            memcpy(def->buf.inds, buf->inds, sizeof(OCIInd) * entry->nb_rows);
+            memcpy(def->buf.lens, buf->lens, sizeof(ub2) * entry->nb_rows);
+        }
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheGetDependencies
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultCacheGetDependencies
+(
+    OCI_Statement        *stmt,
+    OCI_ResultCacheEntry *entry
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+#if OCI_VERSION_COMPILE >= OCI_10_2
+
+    OCIColl *tables    = NULL;
+    sb4      nb_tables = 0;
+
+    /* tables registered by the server when the query was executed with the subscription
+       (base tables of views and synonyms included) */
+
+    CHECK_ATTRIB_GET
+    (
+        OCI_HTYPE_STMT, OCI_ATTR_CHNF_TABLENAMES,
+        stmt->stmt, &tables, NULL,
+        stmt->con->err
+    )
+
+    if (NULL != tables)
+    {
+        CHECK_OCI(stmt->con->err, OCICollSize, Env.env, stmt->con->err, tables, &nb_tables)
+    }
+
+    if (nb_tables > 0)
+    {
+        ALLOC_DATA(OCI_IPC_STRING, entry->deps, nb_tables)
+
+        for (sb4 i = 0; i < nb_tables; i++)
+        {
+            OCIString **table  = NULL;
+            boolean     exists = FALSE;
+            unsigned int size  = 0;
+
+            CHECK_OCI
+            (
+                stmt->con->err,
+                OCICollGetElem,
+                Env.env, stmt->con->err, tables, i, &exists,
+                (void**) (void*) &table, (void**) NULL
+            )
+
+            if (exists && NULL != table)
+            {
+                CHECK_NULL(StringFromStringPtr(Env.env, *table, &entry->deps[entry->nb_deps], &size))
+
+                entry->nb_deps++;
+            }
+        }
+    }
+
+#else
+
+    OCI_NOT_USED(stmt)
+    OCI_NOT_USED(entry)
+
+#endif
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheCommit
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultCacheCommit
+(
+    OCI_ResultCacheEntry *entry
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RCACHE_ENTRY, entry
+    )
+
+    OCI_ResultCache *cache  = entry->cache;
+    boolean          locked = FALSE;
+
+    ACQUIRE_LOCK()
+
+    /* the entry is discarded if an invalidation occurred while it was fetched */
+
+    if (entry->generation == cache->generation)
+    {
+        OCI_ResultCacheEntry *prev = ResultCacheFind(cache, entry);
+
+        if (NULL != prev)
+        {
+            ResultCacheRemove(cache, prev);
+        }
+
+        const unsigned int index = entry->hash % cache->nb_buckets;
+
+        entry->chain          = cache->buckets[index];
+        cache->buckets[index] = entry;
+
+        ResultCacheLinkHead(cache, entry);
+
+        cache->count++;
+        cache->size += entry->size;
+
+        /* evict least recently used entries */
+
+        while (cache->tail != entry && (cache->count > cache->max_entries ||
+               (cache->max_size > 0 && cache->size > cache->max_size)))
+        {
+            ResultCacheRemove(cache, cache->tail);
+        }
+
+        entry = NULL;
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        RELEASE_LOCK()
+
+        if (NULL != entry)
+        {
+            ResultCacheEntryFree(entry);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_ResultCache * ResultCacheCreate
+(
+    unsigned int max_entries,
+    unsigned int max_size,
+    unsigned int ttl
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_ResultCache*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_ResultCache *cache = NULL;
+
+    ALLOC_DATA(OCI_IPC_RCACHE, cache, 1)
+
+    cache->max_entries = max_entries;
+    cache->max_size    = max_size;
+    cache->ttl         = ttl;
+    cache->nb_buckets  = max_entries > RCACHE_MIN_BUCKETS ? max_entries : RCACHE_MIN_BUCKETS;
+
+    ALLOC_DATA(OCI_IPC_RCACHE_ENTRY, cache->buckets, cache->nb_buckets)
+
+    /* create a mutex on multi threaded environments */
+
+    if (LIB_THREADED)
+    {
+        cache->mutex = MutexCreateInternal();
+        CHECK_NULL(cache->mutex)
+    }
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            ResultCacheFree(cache);
+            cache = NULL;
+        }
+
+        SET_RETVAL(cache)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheFree
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultCacheFree
+(
+    OCI_ResultCache *cache
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RCACHE, cache
+    )
+
+    CHECK_PTR(OCI_IPC_RCACHE, cache)
+
+    if (NULL != cache->buckets)
+    {
+        ResultCacheFlush(cache);
+    }
+
+    if (NULL != cache->mutex)
+    {
+        MutexFree(cache->mutex);
+    }
+
+    FREE(cache->buckets)
+    FREE(cache)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheClear
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultCacheClear
+(
+    OCI_ResultCache *cache
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RCACHE, cache
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_RCACHE, cache)
+
+    ACQUIRE_LOCK()
+
+    cache->generation++;
+
+    ResultCacheFlush(cache);
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        RELEASE_LOCK()
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheSetSubscription
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultCacheSetSubscription
+(
+    OCI_ResultCache  *cache,
+    OCI_Subscription *sub
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RCACHE, cache
+    )
+
+    CHECK_PTR(OCI_IPC_RCACHE, cache)
+
+    /* invalidation requires object change notifications */
+
+    if (NULL != sub && !(sub->type & OCI_CNT_OBJECTS))
+    {
+        THROW(ExceptionArgInvalidValue, OTEXT("Subscription type"), sub->type)
+    }
+
+    /* entries cached so far have not been registered against the new subscription */
+
+    CHECK(ResultCacheClear(cache))
+
+    cache->sub = sub;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheGet
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_ResultCache * ResultCacheGet
+(
+    OCI_Connection *con
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_ResultCache*, NULL,
+        /* context */ OCI_IPC_CONNECTION, con
+    )
+
+    CHECK_PTR(OCI_IPC_CONNECTION, con)
+
+    /* a connection own cache takes precedence over its pool cache */
+
+    if (NULL != con->rcache)
+    {
+        SET_RETVAL(con->rcache)
+    }
+    else if (NULL != con->pool)
+    {
+        SET_RETVAL(con->pool->rcache)
+    }
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheGetHits
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ResultCacheGetHits
+(
+    OCI_ResultCache *cache
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_RCACHE, cache
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_RCACHE, cache)
+
+    ACQUIRE_LOCK()
+
+    SET_RETVAL(cache->hits)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        RELEASE_LOCK()
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheGetMisses
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int ResultCacheGetMisses
+(
+    OCI_ResultCache *cache
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ unsigned int, 0,
+        /* context */ OCI_IPC_RCACHE, cache
+    )
+
+    boolean locked = FALSE;
+
+    CHECK_PTR(OCI_IPC_RCACHE, cache)
+
+    ACQUIRE_LOCK()
+
+    SET_RETVAL(cache->misses)
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        RELEASE_LOCK()
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheLookup
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultCacheLookup
+(
+    OCI_Statement *stmt,
+    ub4            mode,
+    boolean       *hit
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    OCI_ResultCacheEntry *entry     = NULL;
+    OCI_ResultCache      *cache     = NULL;
+    OCI_Subscription     *sub       = NULL;
+    boolean               cacheable = FALSE;
+    boolean               locked    = FALSE;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_BOOLEAN,   hit)
+
+    *hit = FALSE;
+
+    /* discard any incomplete entry from a previous execution */
+
+    CHECK(ResultCacheReleasePending(stmt))
+
+    cache = ResultCacheGet(stmt->con);
+
+    /* only plain forward only queries with scalar input binds are cached */
+
+    if (NULL != cache && OCI_CST_SELECT == stmt->type && OCI_DEFAULT == mode &&
+        0 == stmt->nb_rbinds && !stmt->bind_array && NULL != stmt->sql)
+    {
+        ALLOC_DATA(OCI_IPC_RCACHE_ENTRY, entry, 1)
+
+        CHECK(ResultCacheBuildKey(stmt, entry, &cacheable))
+    }
+
+    if (cacheable)
+    {
+        ACQUIRE_LOCK()
+
+        OCI_ResultCacheEntry *found = ResultCacheFind(cache, entry);
+
+        if (NULL != found && cache->ttl > 0 &&
+            difftime(time(NULL), found->created) >= (double) cache->ttl)
+        {
+            ResultCacheRemove(cache, found);
+            found = NULL;
+        }
+
+        if (NULL != found)
+        {
+            ResultCacheUnlink(cache, found);
+            ResultCacheLinkHead(cache, found);
+
+            cache->hits++;
+
+            CHECK(ResultCacheBuildResultset(stmt, found))
+
+            *hit = TRUE;
+        }
+        else
+        {
+            cache->misses++;
+
+            /* the entry is filled by the fetches and committed once the resultset is exhausted */
+
+            entry->cache      = cache;
+            entry->generation = cache->generation;
+            entry->created    = time(NULL);
+            entry->sql        = ostrdup(stmt->sql);
+
+            CHECK_NULL(entry->sql)
+
+            stmt->rc_pending = entry;
+            entry            = NULL;
+            sub              = cache->sub;
+        }
+
+        RELEASE_LOCK()
+    }
+
+#if OCI_VERSION_COMPILE >= OCI_10_2
+
+    /* register the query against the invalidation subscription */
+
+    if (NULL != sub && NULL != sub->subhp)
+    {
+        CHECK_ATTRIB_SET
+        (
+            OCI_HTYPE_STMT, OCI_ATTR_CHNF_REGHANDLE,
+            stmt->stmt, sub->subhp, 0,
+            stmt->con->err
+        )
+    }
+
+#else
+
+    OCI_NOT_USED(sub)
+
+#endif
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        RELEASE_LOCK()
+
+        if (NULL != entry)
+        {
+            ResultCacheEntryFree(entry);
+        }
+
+        if (FAILURE && NULL != stmt)
+        {
+            ResultCacheReleasePending(stmt);
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheStore
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultCacheStore
+(
+    OCI_Resultset *rs,
+    ub4            rows
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+
+    OCI_Statement        *stmt  = rs->stmt;
+    OCI_ResultCacheEntry *entry = stmt->rc_pending;
+    boolean               keep  = (NULL != entry);
+
+    /* capture columns description on first fetch */
+
+    if (keep && NULL == entry->cols)
+    {
+        for (ub4 i = 0; i < rs->nb_defs && keep; i++)
+        {
+            const OCI_Column *col = &rs->defs[i].col;
+
+            /* only values fully held by the define buffers can be copied */
+
+            keep = (OCI_UNKNOWN == col->handletype) &&
+                   (OCI_CDT_TEXT    == col->datatype || OCI_CDT_NUMERIC == col->datatype ||
+                    OCI_CDT_RAW     == col->datatype || OCI_CDT_DATETIME == col->datatype);
+        }
+
+        if (keep && NULL != entry->cache->sub)
+        {
+            CHECK(ResultCacheGetDependencies(stmt, entry))
+        }
+
+        if (keep)
+        {
+            ALLOC_DATA(OCI_IPC_COLUMN, entry->cols, rs->nb_defs)
+            ALLOC_DATA(OCI_IPC_DEFINE, entry->bufs, rs->nb_defs)
+
+            entry->nb_cols = rs->nb_defs;
+            entry->size    = sizeof(*entry) + entry->key_size +
+                             (sizeof(OCI_Column) + sizeof(OCI_Buffer)) * entry->nb_cols;
+
+            for (ub4 i = 0; i < entry->nb_cols; i++)
+            {
+                entry->cols[i]      = rs->defs[i].col;
+                entry->cols[i].name = ostrdup(rs->defs[i].col.name);
+            }
+        }
+    }
+
+    /* append fetched rows */
+
+    if (keep && rows > 0)
+    {
+        const ub4 needed = entry->nb_rows + rows;
+
+        if (needed > entry->allocated)
+        {
+            ub4 allocated = entry->allocated * 2;
+
+            if (allocated < needed)
+            {
+                allocated = needed;
+            }
+
+            for (ub4 i = 0; i < entry->nb_cols; i++)
+            {
+                OCI_Buffer *buf = &entry->bufs[i];
+
+                buf->data = MemoryRealloc(buf->data, OCI_IPC_BUFF_ARRAY,
+                                          entry->cols[i].bufsize, allocated, FALSE);
+                CHECK_NULL(buf->data)
+
+                buf->inds = MemoryRealloc(buf->inds, OCI_IPC_INDICATOR_ARRAY,
+                                          sizeof(OCIInd), allocated, FALSE);
+                CHECK_NULL(buf->inds)
+
+                buf->lens = MemoryRealloc(buf->lens, OCI_IPC_LEN_ARRAY,
+                                          sizeof(ub2), allocated, FALSE);
+                CHECK_NULL(buf->lens)
+            }
+
+            entry->allocated = allocated;
+        }
+
+        for (ub4 i = 0; i < entry->nb_cols; i++)
+        {
+            OCI_Buffer *buf = &entry->bufs[i];
+            OCI_Define *def = &rs->defs[i];
+
+            const size_t bufsize = (size_t) entry->cols[i].bufsize;
+
+            memcpy(((ub1 *) buf->data) + bufsize * entry->nb_rows, def->buf.data, bufsize * rows);
+            memcpy(buf->inds + entry->nb_rows, def->buf.inds, sizeof(OCIInd) * rows);
+            memcpy(((ub2 *) buf->lens) + entry->nb_rows, def->buf.lens, sizeof(ub2) * rows);
+
+            entry->size += (bufsize + sizeof(OCIInd) + sizeof(ub2)) * rows;
+        }
+
+        entry->nb_rows = needed;
+
+        /* results larger than the cache itself are not kept */
+
+        keep = (0 == entry->cache->max_size) || (entry->size <= entry->cache->max_size);
+    }
+
+    if (!keep)
+    {
+        CHECK(ResultCacheReleasePending(stmt))
+    }
+    else if (OCI_NO_DATA == rs->fetch_status)
+    {
+        stmt->rc_pending = NULL;
+
+        CHECK(ResultCacheCommit(entry))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheReleasePending
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultCacheReleasePending
+(
+    OCI_Statement *stmt
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    if (NULL != stmt->rc_pending)
+    {
+        ResultCacheEntryFree(stmt->rc_pending);
+
+        stmt->rc_pending = NULL;
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheReleaseConnection
+ * --------------------------------------------------------------------------------------------- */
+
+void ResultCacheReleaseConnection
+(
+    OCI_Connection  *con,
+    OCI_ResultCache *cache
+)
+{
+    if (NULL != con && NULL != con->stmts && NULL != cache)
+    {
+        ListForEachWithParam(con->stmts, cache, (POCI_LIST_FOR_EACH_WITH_PARAM) ResultCacheReleaseStatement);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheNotify
+ * --------------------------------------------------------------------------------------------- */
+
+void ResultCacheNotify
+(
+    OCI_Subscription *sub,
+    const otext      *objname
+)
+{
+    ResultCacheNotifyParams params;
+
+    params.sub     = sub;
+    params.objname = objname;
+
+    ListForEachWithParam(Env.cons,  &params, (POCI_LIST_FOR_EACH_WITH_PARAM) ResultCacheNotifyConnection);
+    ListForEachWithParam(Env.pools, &params, (POCI_LIST_FOR_EACH_WITH_PARAM) ResultCacheNotifyPool);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultCacheDetachSubscription
+ * --------------------------------------------------------------------------------------------- */
+
+void ResultCacheDetachSubscription
+(
+    OCI_Subscription *sub
+)
+{
+    ListForEachWithParam(Env.cons,  sub, (POCI_LIST_FOR_EACH_WITH_PARAM) ResultCacheDetachConnection);
+    ListForEachWithParam(Env.pools, sub, (POCI_LIST_FOR_EACH_WITH_PARAM) ResultCacheDetachPool);
+}
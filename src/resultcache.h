@@ -0,0 +1,99 @@
+/*
+ * OCILIB - C Driver for Oracle (C Wrapper for Oracle OCI)
+ *
+ * Website: http://www.ocilib.net
+ *
+ * Copyright (c) 2007-2020 Vincent ROGIER <vince.rogier@ocilib.net>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCILIB_RESULTCACHE_H_INCLUDED
+#define OCILIB_RESULTCACHE_H_INCLUDED
+
+#include "types.h"
+
+OCI_ResultCache * ResultCacheCreate
+(
+    unsigned int max_entries,
+    unsigned int max_size,
+    unsigned int ttl
+);
+
+boolean ResultCacheFree
+(
+    OCI_ResultCache *cache
+);
+
+boolean ResultCacheClear
+(
+    OCI_ResultCache *cache
+);
+
+boolean ResultCacheSetSubscription
+(
+    OCI_ResultCache  *cache,
+    OCI_Subscription *sub
+);
+
+OCI_ResultCache * ResultCacheGet
+(
+    OCI_Connection *con
+);
+
+unsigned int ResultCacheGetHits
+(
+    OCI_ResultCache *cache
+);
+
+unsigned int ResultCacheGetMisses
+(
+    OCI_ResultCache *cache
+);
+
+boolean ResultCacheLookup
+(
+    OCI_Statement *stmt,
+    ub4            mode,
+    boolean       *hit
+);
+
+boolean ResultCacheStore
+(
+    OCI_Resultset *rs,
+    ub4            rows
+);
+
+boolean ResultCacheReleasePending
+(
+    OCI_Statement *stmt
+);
+
+void ResultCacheReleaseConnection
+(
+    OCI_Connection  *con,
+    OCI_ResultCache *cache
+);
+
+void ResultCacheNotify
+(
+    OCI_Subscription *sub,
+    const otext      *objname
+);
+
+void ResultCacheDetachSubscription
+(
+    OCI_Subscription *sub
+);
+
+#endif /* OCILIB_RESULTCACHE_H_INCLUDED */
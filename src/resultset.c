@@ -24,6 +24,7 @@
 #include "column.h"
 #include "date.h"
 #include "define.h"
+#include "describecache.h"
 #include "error.h"
 #include "exception.h"
 #include "file.h"
@@ -37,6 +38,8 @@
 #include "number.h"
 #include "object.h"
 #include "reference.h"
+#include "profiler.h"
+#include "resultcache.h"
 #include "statement.h"
 #include "strings.h"
 #include "timestamp.h"
@@ -47,6 +50,14 @@ static unsigned int SeekModeValues[] =
     OCI_SFD_RELATIVE
 };
 
+static unsigned int EpochUnitValues[] =
+{
+    OCI_DTM_EPOCH,
+    OCI_DTM_EPOCH_MILLI,
+    OCI_DTM_EPOCH_MICRO,
+    OCI_DTM_EPOCH_NANO
+};
+
 #define MATCHING_TYPE(def, type) \
                                  \
     ((def) && DefineIsDataNotNull(def) && ((type) == (def)->col.datatype))
@@ -173,6 +184,10 @@ OCI_Resultset * ResultsetCreate
 
     if (OCI_CST_SELECT == stmt->type)
     {
+        /* columns previously described for the same SQL text on this connection */
+
+        const OCI_Column *cols = DescribeCacheLookup(stmt, nb);
+
         /* Compute columns information */
 
         for (i = 0; i < nb; i++)
@@ -186,15 +201,23 @@ OCI_Resultset * ResultsetCreate
 
             rs->nb_defs++;
 
-            /* get column description */
+            if (NULL != cols)
+            {
+                def->col      = cols[i];
+                def->col.name = ostrdup(cols[i].name);
+            }
+            else
+            {
+                /* get column description */
 
-            CHECK(ColumnRetrieveInfo(&def->col, rs->stmt->con,
-                                     rs->stmt, rs->stmt->stmt,
-                                     i + 1, OCI_DESC_RESULTSET))
+                CHECK(ColumnRetrieveInfo(&def->col, rs->stmt->con,
+                                         rs->stmt, rs->stmt->stmt,
+                                         i + 1, OCI_DESC_RESULTSET))
 
-            /* mapping to OCILIB internal types */
+                /* mapping to OCILIB internal types */
 
-            CHECK(ColumnMapInfo(&def->col, rs->stmt))
+                CHECK(ColumnMapInfo(&def->col, rs->stmt))
+            }
 
 #if defined(OCI_STMT_SCROLLABLE_READONLY)
 
@@ -210,6 +233,11 @@ OCI_Resultset * ResultsetCreate
 
         }
 
+        if (NULL == cols)
+        {
+            CHECK(DescribeCacheStore(rs))
+        }
+
         /* allocation internal buffers if needed */
 
         if (!(rs->stmt->exec_mode & OCI_DESCRIBE_ONLY) && !(rs->stmt->exec_mode & OCI_PARSE_ONLY))
@@ -484,6 +512,10 @@ boolean ResultsetFetchPieces
 
         /* fetch data */
 
+        CHECK_NO_ASYNC_CALL(rs->stmt->con)
+
+        rs->stmt->con->server_calls++;
+
 #if defined(OCI_STMT_SCROLLABLE_READONLY)
 
         if (Env.use_scrollable_cursors)
@@ -603,30 +635,16 @@ boolean ResultsetClearFetchedObjectInstances(OCI_Resultset *rs)
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * ResultsetFetchData
+ * ResultsetFetchCall
  * --------------------------------------------------------------------------------------------- */
 
-boolean ResultsetFetchData
+void ResultsetFetchCall
 (
     OCI_Resultset *rs,
     int            mode,
     int            offset
 )
 {
-    ENTER_FUNC
-    (
-        /* returns */ boolean, FALSE,
-        /* context */ OCI_IPC_RESULTSET, rs
-    )
-
-    CHECK_PTR(OCI_IPC_RESULTSET, rs)
-
-    /* let's initialize the success flag to FALSE until the process completes */
-
-    CHECK(ResultsetClearFetchedObjectInstances(rs))
-
-    /* internal fetch */
-
 #if defined(OCI_STMT_SCROLLABLE_READONLY)
 
     if (Env.use_scrollable_cursors)
@@ -644,9 +662,33 @@ boolean ResultsetFetchData
                                         rs->fetch_size, (ub2) OCI_FETCH_NEXT,
                                         (ub4) OCI_DEFAULT);
     }
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetFetchComplete
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultsetFetchComplete
+(
+    OCI_Resultset *rs,
+    int            mode,
+    int            offset
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
 
     if (OCI_ERROR == rs->fetch_status)
     {
+        /* the cached select list may not match the server one anymore */
+
+        DescribeCacheRemove(rs->stmt);
+
         /* failure */
         THROW(ExceptionOCI, rs->stmt->con->err, rs->fetch_status)
     }
@@ -709,6 +751,13 @@ boolean ResultsetFetchData
         rs->row_fetched = row_fetched;
     }
 
+    /* feed the result cache entry being built if any */
+
+    if (NULL != rs->stmt->rc_pending)
+    {
+        CHECK(ResultCacheStore(rs, row_fetched))
+    }
+
     /* so far, no OCI error occurred, let's clear the error flag */
 
     /* check if internal fetch was successful */
@@ -733,6 +782,51 @@ boolean ResultsetFetchData
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetFetchData
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultsetFetchData
+(
+    OCI_Resultset *rs,
+    int            mode,
+    int            offset
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+
+    /* let's initialize the success flag to FALSE until the process completes */
+
+    CHECK(ResultsetClearFetchedObjectInstances(rs))
+
+    /* internal fetch */
+
+    CHECK_NO_ASYNC_CALL(rs->stmt->con)
+
+    rs->stmt->con->server_calls++;
+
+    const big_uint start = ProfilerStart(rs->stmt->con);
+
+    ResultsetFetchCall(rs, mode, offset);
+
+    const big_uint fetched = start ? ProfilerClock() : 0;
+
+    const boolean res = ResultsetFetchComplete(rs, mode, offset);
+
+    CHECK(ProfilerRecordFetch(rs, start, fetched, res ? rs->row_fetched : 0))
+    CHECK(res)
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ResultsetFetchCustom
  * --------------------------------------------------------------------------------------------- */
@@ -1763,6 +1857,8 @@ const otext * ResultsetGetString
     {
         void *data = NULL;
 
+        CHECK(DefineCheckInlineLob(def))
+
         if (OCI_CDT_TEXT == def->col.datatype)
         {
             result = (otext *)DefineGetData(def);
@@ -1985,6 +2081,8 @@ unsigned int ResultsetGetRaw
 
     if (MATCHING_TYPE(def, OCI_CDT_RAW))
     {
+        CHECK(DefineCheckInlineLob(def))
+
         unsigned int size = (unsigned int)(ub2)((ub2*)def->buf.lens)[def->rs->row_cur - 1];
 
         result = size < len ? size : len;
@@ -2032,6 +2130,8 @@ unsigned int ResultsetGetRaw2
 
     if (MATCHING_TYPE(def, OCI_CDT_RAW))
     {
+        CHECK(DefineCheckInlineLob(def))
+
         unsigned int size = (unsigned int)(ub2)((ub2*)def->buf.lens)[def->rs->row_cur - 1];
 
         result = size < len ? size : len;
@@ -2047,6 +2147,78 @@ unsigned int ResultsetGetRaw2
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetGetRawBuffer
+ * --------------------------------------------------------------------------------------------- */
+
+const void * ResultsetGetRawBuffer
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int  *size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ const void *, NULL,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_PTR(OCI_IPC_VOID,      size)
+    CHECK_BOUND(index, 1, rs->nb_defs)
+
+    OCI_Define*def = DefineGet(rs, index);
+    CHECK_NULL(def)
+
+    const void *result = NULL;
+
+    *size = 0;
+
+    if (MATCHING_TYPE(def, OCI_CDT_RAW))
+    {
+        /* unlike ResultsetGetRaw(), the internal fetch buffer is returned as is.
+           It remains valid until the next fetch */
+
+        CHECK(DefineCheckInlineLob(def))
+
+        *size  = (unsigned int)(ub2)((ub2*)def->buf.lens)[def->rs->row_cur - 1];
+        result = DefineGetData(def);
+    }
+
+    SET_RETVAL(result)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetGetRawBuffer2
+ * --------------------------------------------------------------------------------------------- */
+
+const void * ResultsetGetRawBuffer2
+(
+    OCI_Resultset *rs,
+    const otext   *name,
+    unsigned int  *size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ const void *, NULL,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_PTR(OCI_IPC_STRING,    name)
+
+    const int index = DefineGetIndex(rs, name);
+    CHECK(index >= 0)
+
+    SET_RETVAL(ResultsetGetRawBuffer(rs, (unsigned int)index, size))
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ResultsetGetDouble
  * --------------------------------------------------------------------------------------------- */
@@ -2164,6 +2336,233 @@ OCI_Timestamp * ResultsetGetTimestamp2
     GET_BY_NAME(rs, name, ResultsetGetTimestamp, OCI_Timestamp*, NULL)
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetGetNativeDate
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean ResultsetGetNativeDate
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    OCIDate       *date,
+    ub4           *fsec,
+    sb4           *offset
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    OCI_Define *def = NULL;
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_BOUND(index, 1, rs->nb_defs)
+
+    def = DefineGet(rs, index);
+    CHECK_NULL(def)
+
+    *fsec   = 0;
+    *offset = 0;
+
+    /* decode fetched buffers directly, without any OCI_Date or OCI_Timestamp wrapper */
+
+    if (MATCHING_TYPE(def, OCI_CDT_DATETIME))
+    {
+        if (SQLT_DAT == def->col.libcode)
+        {
+            DateWireToOCIDate((ub1 *) DefineGetData(def), date);
+        }
+        else
+        {
+            *date = *((OCIDate *) DefineGetData(def));
+        }
+
+        SET_SUCCESS()
+    }
+
+#if OCI_VERSION_COMPILE >= OCI_9_0
+
+    else if (MATCHING_TYPE(def, OCI_CDT_TIMESTAMP))
+    {
+        OCIDateTime *tmsp = (OCIDateTime *) DefineGetData(def);
+
+        CHECK_OCI
+        (
+            rs->stmt->con->err,
+            OCIDateTimeGetDate,
+            (dvoid *) rs->stmt->con->env, rs->stmt->con->err, tmsp,
+            &date->OCIDateYYYY, &date->OCIDateMM, &date->OCIDateDD
+        )
+
+        CHECK_OCI
+        (
+            rs->stmt->con->err,
+            OCIDateTimeGetTime,
+            (dvoid *) rs->stmt->con->env, rs->stmt->con->err, tmsp,
+            &date->OCIDateTime.OCITimeHH, &date->OCIDateTime.OCITimeMI,
+            &date->OCIDateTime.OCITimeSS, fsec
+        )
+
+        if (OCI_TIMESTAMP != def->col.subtype)
+        {
+            sb1 hour = 0;
+            sb1 min  = 0;
+
+            CHECK_OCI
+            (
+                rs->stmt->con->err,
+                OCIDateTimeGetTimeZoneOffset,
+                (dvoid *) rs->stmt->con->env, rs->stmt->con->err, tmsp,
+                &hour, &min
+            )
+
+            *offset = (sb4) hour * 3600 + (sb4) min * 60;
+        }
+
+        SET_SUCCESS()
+    }
+
+#endif
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetGetEpoch
+ * --------------------------------------------------------------------------------------------- */
+
+big_int ResultsetGetEpoch
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    unsigned int   unit
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ big_int, 0,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    OCIDate date;
+    ub4     fsec   = 0;
+    sb4     offset = 0;
+    big_int value  = 0;
+
+    CHECK_ENUM_VALUE(unit, EpochUnitValues, OTEXT("Epoch unit"))
+
+    if (ResultsetGetNativeDate(rs, index, &date, &fsec, &offset))
+    {
+        /* time zone aware values are returned relative to UTC */
+
+        value = DateEpochJoin(DateOCIDateToEpoch(&date) - offset, fsec, unit);
+    }
+
+    SET_RETVAL(value)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetGetEpoch2
+ * --------------------------------------------------------------------------------------------- */
+
+big_int ResultsetGetEpoch2
+(
+    OCI_Resultset *rs,
+    const otext   *name,
+    unsigned int   unit
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ big_int, 0,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_PTR(OCI_IPC_STRING,    name)
+
+    const int index = DefineGetIndex(rs, name);
+    CHECK(index >= 0)
+
+    OCI_Error *err = ErrorGet(TRUE, TRUE);
+
+    const big_int value = ResultsetGetEpoch(rs, (unsigned int) index, unit);
+
+    CHECK_ERROR(err)
+
+    SET_RETVAL(value)
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetGetTm
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultsetGetTm
+(
+    OCI_Resultset *rs,
+    unsigned int   index,
+    struct tm     *value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    OCIDate date;
+    ub4     fsec   = 0;
+    sb4     offset = 0;
+
+    CHECK_PTR(OCI_IPC_TM, value)
+
+    /* struct tm values are given in the time zone of the fetched value */
+
+    CHECK(ResultsetGetNativeDate(rs, index, &date, &fsec, &offset))
+
+    DateOCIDateToTm(&date, value);
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ResultsetGetTm2
+ * --------------------------------------------------------------------------------------------- */
+
+boolean ResultsetGetTm2
+(
+    OCI_Resultset *rs,
+    const otext   *name,
+    struct tm     *value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_RESULTSET, rs
+    )
+
+    CHECK_PTR(OCI_IPC_RESULTSET, rs)
+    CHECK_PTR(OCI_IPC_STRING,    name)
+
+    const int index = DefineGetIndex(rs, name);
+    CHECK(index >= 0)
+
+    CHECK(ResultsetGetTm(rs, (unsigned int) index, value))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * ResultsetGetInterval
  * --------------------------------------------------------------------------------------------- */
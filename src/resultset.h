@@ -39,6 +39,25 @@ boolean ResultsetFree
     OCI_Resultset* rs
 );
 
+boolean ResultsetClearFetchedObjectInstances
+(
+    OCI_Resultset* rs
+);
+
+void ResultsetFetchCall
+(
+    OCI_Resultset* rs,
+    int            mode,
+    int            offset
+);
+
+boolean ResultsetFetchComplete
+(
+    OCI_Resultset* rs,
+    int            mode,
+    int            offset
+);
+
 boolean ResultsetFetchPrev
 (
     OCI_Resultset* rs
@@ -232,6 +251,20 @@ unsigned int ResultsetGetRaw2
     unsigned int   len
 );
 
+const void * ResultsetGetRawBuffer
+(
+    OCI_Resultset* rs,
+    unsigned int   index,
+    unsigned int * size
+);
+
+const void * ResultsetGetRawBuffer2
+(
+    OCI_Resultset* rs,
+    const otext  * name,
+    unsigned int * size
+);
+
 double ResultsetGetDouble
 (
     OCI_Resultset* rs,
@@ -280,6 +313,34 @@ OCI_Timestamp* ResultsetGetTimestamp2
     const otext  * name
 );
 
+big_int ResultsetGetEpoch
+(
+    OCI_Resultset* rs,
+    unsigned int   index,
+    unsigned int   unit
+);
+
+big_int ResultsetGetEpoch2
+(
+    OCI_Resultset* rs,
+    const otext  * name,
+    unsigned int   unit
+);
+
+boolean ResultsetGetTm
+(
+    OCI_Resultset* rs,
+    unsigned int   index,
+    struct tm    * value
+);
+
+boolean ResultsetGetTm2
+(
+    OCI_Resultset* rs,
+    const otext  * name,
+    struct tm    * value
+);
+
 OCI_Interval* ResultsetGetInterval
 (
     OCI_Resultset* rs,
@@ -20,10 +20,13 @@
 
 #include "statement.h"
 
+#include "arrow.h"
+#include "async.h"
 #include "bind.h"
 #include "collection.h"
 #include "connection.h"
 #include "date.h"
+#include "describecache.h"
 #include "error.h"
 #include "exception.h"
 #include "file.h"
@@ -37,7 +40,10 @@
 #include "memory.h"
 #include "number.h"
 #include "object.h"
+#include "preparedcache.h"
+#include "profiler.h"
 #include "reference.h"
+#include "resultcache.h"
 #include "resultset.h"
 #include "strings.h"
 #include "timestamp.h"
@@ -96,6 +102,20 @@ static unsigned int LongModeValues[] =
     OCI_LONG_IMPLICIT
 };
 
+static unsigned int LobModeValues[] =
+{
+    OCI_LOB_LOCATOR,
+    OCI_LOB_INLINE
+};
+
+static unsigned int EpochUnitValues[] =
+{
+    OCI_DTM_EPOCH,
+    OCI_DTM_EPOCH_MILLI,
+    OCI_DTM_EPOCH_MICRO,
+    OCI_DTM_EPOCH_NANO
+};
+
 #define CHECK_BIND(stmt, name, data, type, ext_only)                         \
                                                                              \
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)                                       \
@@ -264,6 +284,10 @@ boolean StatementFreeAllBinds
     stmt->nb_ubinds = 0;
     stmt->nb_rbinds = 0;
 
+    /* free values bound by formatted calls */
+
+    FREE(stmt->fmt_values)
+
     SET_SUCCESS()
 
     EXIT_FUNC()
@@ -318,6 +342,10 @@ boolean StatementReset
 
     CHECK(StatementReleaseResultsets(stmt))
 
+    /* discard any incomplete result cache entry */
+
+    CHECK(ResultCacheReleasePending(stmt))
+
     /* free in/out binds */
 
     CHECK(StatementFreeAllBinds(stmt))
@@ -376,6 +404,7 @@ boolean StatementReset
     stmt->sql_id = NULL;
     stmt->map    = NULL;
     stmt->batch  = NULL;
+    stmt->prof   = NULL;
 
     stmt->nb_rs   = 0;
     stmt->nb_stmt = 0;
@@ -451,7 +480,7 @@ boolean StatementBindCheck
         }
 
         /* OCI_Date binds */
-        else if (OCI_CDT_DATETIME == bnd->type)
+        else if ((OCI_CDT_DATETIME == bnd->type) && (0 == bnd->subtype))
         {
             OCI_Date *src_date = OCI_BIND_GET_HANDLE(src, OCI_Date, index);
             OCIDate  *dst_date = OCI_BIND_GET_BUFFER(dst, OCIDate, index);
@@ -468,6 +497,59 @@ boolean StatementBindCheck
             }
         }
 
+        /* epoch and struct tm binds are encoded without any intermediate OCI_Date */
+        else if (OCI_CDT_DATETIME == bnd->type)
+        {
+            if (bnd->buffer.inds[index] != OCI_IND_NULL)
+            {
+                OCIDate date;
+                boolean valid = FALSE;
+                ub4     fsec  = 0;
+
+                if (OCI_DTM_TM == bnd->subtype)
+                {
+                    valid = DateTmToOCIDate(OCI_BIND_GET_SCALAR(src, struct tm, index), &date);
+                }
+                else
+                {
+                    big_int value = 0;
+
+                    DateEpochSplit(*OCI_BIND_GET_SCALAR(src, big_int, index), bnd->subtype, &value, &fsec);
+
+                    valid = DateEpochToOCIDate(value, &date);
+                }
+
+                if (!valid)
+                {
+                    THROW(ExceptionOutOfBounds, (int) index + 1)
+                }
+
+                if (SQLT_DAT == bnd->code)
+                {
+                    DateOCIDateToWire(&date, dst + (size_t) index * OCI_DATE_WIRE_SIZE);
+                }
+
+#if OCI_VERSION_COMPILE >= OCI_9_0
+
+                else
+                {
+                    CHECK_OCI
+                    (
+                        bnd->stmt->con->err,
+                        OCIDateTimeConstruct,
+                        (dvoid *) bnd->stmt->con->env, bnd->stmt->con->err,
+                        *OCI_BIND_GET_BUFFER(dst, OCIDateTime *, index),
+                        date.OCIDateYYYY, date.OCIDateMM, date.OCIDateDD,
+                        date.OCIDateTime.OCITimeHH, date.OCIDateTime.OCITimeMI,
+                        date.OCIDateTime.OCITimeSS, fsec, (OraText *) NULL, (size_t) 0
+                    )
+                }
+
+#endif
+
+            }
+        }
+
         /* String binds that may required conversion on systems where wchar_t is UTF32 */
         else if (OCI_CDT_TEXT == bnd->type)
         {
@@ -477,7 +559,21 @@ boolean StatementBindCheck
                 const size_t src_offset = index * max_chars * sizeof(otext);
                 const size_t dst_offset = index * max_chars * sizeof(dbtext);
 
-                StringUTF32ToUTF16(src + src_offset, dst + dst_offset, max_chars - 1);
+                const otext *src_str = (const otext *) (src + src_offset);
+                dbtext      *dst_str = (dbtext *) (dst + dst_offset);
+
+                int len = 0;
+
+                /* only convert the actual string length, not the whole buffer */
+
+                while (len < max_chars - 1 && src_str[len] != 0)
+                {
+                    len++;
+                }
+
+                StringUTF32ToUTF16(src_str, dst_str, len);
+
+                dst_str[len] = 0;
             }
         }
 
@@ -585,7 +681,7 @@ boolean StatementBindUpdate
     }
 
     /* OCI_Date binds */
-    else if (OCI_CDT_DATETIME == bnd->type)
+    else if ((OCI_CDT_DATETIME == bnd->type) && (0 == bnd->subtype))
     {
         OCIDate  *src_date = OCI_BIND_GET_BUFFER(src, OCIDate, index);
         OCI_Date *dst_date = OCI_BIND_GET_HANDLE(dst, OCI_Date, index);
@@ -602,6 +698,56 @@ boolean StatementBindUpdate
         }
     }
 
+    /* epoch and struct tm binds */
+    else if (OCI_CDT_DATETIME == bnd->type)
+    {
+        if (bnd->buffer.inds[index] != OCI_IND_NULL)
+        {
+            OCIDate date;
+            ub4     fsec = 0;
+
+            if (SQLT_DAT == bnd->code)
+            {
+                DateWireToOCIDate(src + (size_t) index * OCI_DATE_WIRE_SIZE, &date);
+            }
+
+#if OCI_VERSION_COMPILE >= OCI_9_0
+
+            else
+            {
+                OCIDateTime *src_tmsp = *OCI_BIND_GET_BUFFER(src, OCIDateTime *, index);
+
+                CHECK_OCI
+                (
+                    bnd->stmt->con->err,
+                    OCIDateTimeGetDate,
+                    (dvoid *) bnd->stmt->con->env, bnd->stmt->con->err, src_tmsp,
+                    &date.OCIDateYYYY, &date.OCIDateMM, &date.OCIDateDD
+                )
+
+                CHECK_OCI
+                (
+                    bnd->stmt->con->err,
+                    OCIDateTimeGetTime,
+                    (dvoid *) bnd->stmt->con->env, bnd->stmt->con->err, src_tmsp,
+                    &date.OCIDateTime.OCITimeHH, &date.OCIDateTime.OCITimeMI,
+                    &date.OCIDateTime.OCITimeSS, &fsec
+                )
+            }
+
+#endif
+
+            if (OCI_DTM_TM == bnd->subtype)
+            {
+                DateOCIDateToTm(&date, OCI_BIND_GET_SCALAR(dst, struct tm, index));
+            }
+            else
+            {
+                *OCI_BIND_GET_SCALAR(dst, big_int, index) = DateEpochJoin(DateOCIDateToEpoch(&date), fsec, bnd->subtype);
+            }
+        }
+    }
+
     /* String binds that may required conversion on systems where wchar_t is UTF32 */
     else if (OCI_CDT_TEXT == bnd->type)
     {
@@ -654,6 +800,14 @@ boolean StatementBindCheckAll
     {
         OCI_Bind *bnd = stmt->ubinds[i];
 
+        /* values of streaming binds are provided by their producer at execute time */
+
+        if (NULL != bnd->producer)
+        {
+            bnd->failed_iter = 0;
+            continue;
+        }
+
         if (OCI_CDT_CURSOR == bnd->type)
         {
             OCI_Statement *bnd_stmt = (OCI_Statement *) bnd->buffer.data;
@@ -678,17 +832,31 @@ boolean StatementBindCheckAll
             CHECK(StatementSetFetchSize(stmt, stmt->fetch_size))
         }
 
-        if ((bnd->direction & OCI_BDM_IN) ||
+        /* with dirty tracking, only elements modified since the last execution are processed */
+
+        ub4 lo = 0;
+        ub4 hi = UB4MAXVAL;
+
+        if (stmt->bind_tracking)
+        {
+            lo = bnd->dirty_lo;
+            hi = bnd->dirty_hi;
+        }
+
+        if ((lo < hi) &&
+            ((bnd->direction & OCI_BDM_IN) ||
             (bnd->alloc &&
              (OCI_CDT_DATETIME != bnd->type) &&
              (OCI_CDT_TEXT != bnd->type) &&
-             (OCI_CDT_NUMERIC != bnd->type || SQLT_VNU == bnd->code)))
+             (OCI_CDT_NUMERIC != bnd->type || SQLT_VNU == bnd->code))))
         {
             /* for strings, re-initialize length array with buffer default size */
 
             if (OCI_CDT_TEXT == bnd->type)
             {
-                for (j = 0; j < bnd->buffer.count; j++)
+                const ub4 count = min(hi, bnd->buffer.count);
+
+                for (j = lo; j < count; j++)
                 {
                     *(ub2*)(((ub1 *)bnd->buffer.lens) + (sizeof(ub2) * (size_t) j)) = (ub2) bnd->size;
                 }
@@ -700,9 +868,9 @@ boolean StatementBindCheckAll
             {
                 if (bnd->is_array)
                 {
-                    const ub4 count = IS_PLSQL_STMT(stmt->type) ? bnd->nbelem : stmt->nb_iters;
+                    const ub4 count = min(hi, IS_PLSQL_STMT(stmt->type) ? bnd->nbelem : stmt->nb_iters);
 
-                    for (j = 0; j < count; j++)
+                    for (j = lo; j < count; j++)
                     {
                         CHECK(StatementBindCheck(bnd, (ub1*)bnd->input, (ub1*)bnd->buffer.data, j))
                     }
@@ -713,6 +881,14 @@ boolean StatementBindCheckAll
                 }
             }
         }
+
+        /* values are now marshalled unless the server can overwrite them (PL/SQL output binds) */
+
+        if (!IS_PLSQL_STMT(stmt->type) || !(bnd->direction & OCI_BDM_OUT))
+        {
+            bnd->dirty_lo = 0;
+            bnd->dirty_hi = 0;
+        }
     }
 
     SET_SUCCESS()
@@ -975,6 +1151,8 @@ OCI_Statement * StatementInitialize
     stmt->bind_reuse      = FALSE;
     stmt->bind_mode       = OCI_BIND_BY_NAME;
     stmt->long_mode       = OCI_LONG_EXPLICIT;
+    stmt->lob_mode        = OCI_LOB_LOCATOR;
+    stmt->lob_inline_size = OCI_SIZE_LOB_INLINE;
     stmt->bind_alloc_mode = OCI_BAM_EXTERNAL;
     stmt->fetch_size      = OCI_FETCH_SIZE;
     stmt->prefetch_size   = OCI_PREFETCH_SIZE;
@@ -1253,11 +1431,14 @@ boolean StatementPrepareInternal
     int dbsize = -1;
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_NO_ASYNC_CALL(stmt->con)
 
     /* reset statement */
 
     CHECK(StatementReset(stmt))
 
+    const big_uint start = ProfilerStart(stmt->con);
+
     /* store SQL */
 
     stmt->sql = ostrdup(sql);
@@ -1326,6 +1507,8 @@ boolean StatementPrepareInternal
     CHECK(StatementSetPrefetchSize(stmt, stmt->prefetch_size))
     CHECK(StatementSetFetchSize(stmt, stmt->fetch_size))
 
+    CHECK(ProfilerRecord(stmt, OCI_PROFILE_PREPARE, start, 0, 0))
+
     SET_SUCCESS()
 
     CLEANUP_AND_EXIT_FUNC
@@ -1335,13 +1518,15 @@ boolean StatementPrepareInternal
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * StatementExecuteInternal
+ * StatementExecuteBegin
  * --------------------------------------------------------------------------------------------- */
 
-boolean StatementExecuteInternal
+boolean StatementExecuteBegin
 (
     OCI_Statement *stmt,
-    ub4            mode
+    ub4           *mode,
+    ub4           *iters,
+    boolean       *cached
 )
 {
     ENTER_FUNC
@@ -1351,24 +1536,26 @@ boolean StatementExecuteInternal
     )
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_NO_ASYNC_CALL(stmt->con)
 
-    ub4 iters = 0;
+    *iters  = 0;
+    *cached = FALSE;
 
     /* set up iterations and mode values for execution */
 
     if (OCI_CST_SELECT == stmt->type)
     {
-        mode |= stmt->exec_mode;
+        *mode |= stmt->exec_mode;
     }
     else
     {
-        iters = stmt->nb_iters;
+        *iters = stmt->nb_iters;
 
         /* for array DML, use batch error mode */
 
-        if (iters > 1)
+        if (*iters > 1)
         {
-            mode = mode | OCI_BATCH_ERRORS;
+            *mode = *mode | OCI_BATCH_ERRORS;
         }
     }
 
@@ -1378,8 +1565,12 @@ boolean StatementExecuteInternal
 
     /* check bind objects for updating their null indicator status */
 
+    const big_uint start = ProfilerStart(stmt->con);
+
     CHECK(StatementBindCheckAll(stmt))
 
+    CHECK(ProfilerRecord(stmt, OCI_PROFILE_CONVERT, start, 0, 0))
+
     /* check current resultsets */
 
     if (stmt->rsts)
@@ -1388,7 +1579,7 @@ boolean StatementExecuteInternal
            So, if we got ones here, it means the same SQL order
            is re-executed */
 
-        if (OCI_CST_SELECT == stmt->type)
+        if (OCI_CST_SELECT == stmt->type && stmt->rsts[0] && !stmt->rsts[0]->from_cache)
         {
             /* just reinitialize the current resultset */
 
@@ -1403,11 +1594,52 @@ boolean StatementExecuteInternal
         }
     }
 
-    /* Oracle execute call */
+    /* check if the result can be served from the client side result cache */
+
+    CHECK(ResultCacheLookup(stmt, *mode, cached))
+
+    if (*cached)
+    {
+        stmt->status |= OCI_STMT_PARSED;
+        stmt->status |= OCI_STMT_DESCRIBED;
+        stmt->status |= OCI_STMT_EXECUTED;
+
+        SET_SUCCESS()
+        JUMP_EXIT()
+    }
+
+    /* in auto commit mode, let the execute call commit on success if requested */
+
+    if (stmt->con->autocom && stmt->con->commit_exec && !(*mode & (OCI_PARSE_ONLY | OCI_DESCRIBE_ONLY)))
+    {
+        *mode |= OCI_COMMIT_ON_SUCCESS;
+    }
+
+    stmt->con->server_calls++;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteEnd
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementExecuteEnd
+(
+    OCI_Statement *stmt,
+    ub4            mode,
+    sword          ret
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
 
-    const sword ret = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err, 
-                                     iters, (ub4)0, (OCISnapshot *)NULL, 
-                                     (OCISnapshot *)NULL, mode);
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
 
     /* check result */
 
@@ -1452,16 +1684,9 @@ boolean StatementExecuteInternal
             stmt->status |= OCI_STMT_DESCRIBED;
             stmt->status |= OCI_STMT_EXECUTED;
 
-#if OCI_VERSION_COMPILE >= OCI_12_2
-
-            if (ConnectionIsVersionSupported(stmt->con, OCI_12_2))
-            {
-                unsigned int size_id = 0;
-
-                StringGetAttribute(stmt->con, stmt->stmt, OCI_HTYPE_STMT, OCI_ATTR_SQL_ID, &stmt->sql_id, &size_id);
-            }
+            /* SQL identifier is retrieved on demand */
 
-#endif
+            FREE(stmt->sql_id)
 
             /* reset binds indicators */
 
@@ -1469,7 +1694,7 @@ boolean StatementExecuteInternal
 
             /* commit if necessary */
 
-            if (stmt->con->autocom)
+            if (stmt->con->autocom && !(mode & OCI_COMMIT_ON_SUCCESS))
             {
                 CHECK(ConnectionCommit(stmt->con))
             }
@@ -1478,10 +1703,20 @@ boolean StatementExecuteInternal
 
             CHECK(StatementCheckImplicitResultsets(stmt))
 
+            /* DDL and session changes may alter the select list of cached queries */
+
+            if (OCI_CST_CREATE == stmt->type || OCI_CST_DROP == stmt->type || OCI_CST_ALTER == stmt->type)
+            {
+                CHECK(DescribeCacheClear(stmt->con))
+            }
         }
     }
     else
     {
+        /* the cached select list may not match the server one anymore */
+
+        DescribeCacheRemove(stmt);
+
         /* get parse error position type */
 
         /* (one of the rare OCI call not enclosed with a OCI_CALL macro ...) */
@@ -1490,6 +1725,18 @@ boolean StatementExecuteInternal
                    (dvoid *)&stmt->err_pos, (ub4 *)NULL,
                    (ub4)OCI_ATTR_PARSE_ERROR_OFFSET, stmt->con->err);
 
+        /* a failed streaming bind producer is reported instead of the resulting OCI error */
+
+        for (ub4 i = 0; i < stmt->nb_ubinds; i++)
+        {
+            const OCI_Bind *bnd = stmt->ubinds[i];
+
+            if (NULL != bnd->producer && bnd->failed_iter > 0)
+            {
+                THROW(ExceptionBindProducer, bnd->name, (int) bnd->failed_iter)
+            }
+        }
+
         /* raise exception */
 
         THROW(ExceptionOCI, stmt->con->err, ret)
@@ -1500,6 +1747,56 @@ boolean StatementExecuteInternal
     EXIT_FUNC()
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementExecuteInternal
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementExecuteInternal
+(
+    OCI_Statement *stmt,
+    ub4            mode
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    ub4     iters  = 0;
+    boolean cached = FALSE;
+
+    const big_uint start = ProfilerStart(stmt->con);
+
+    CHECK(StatementExecuteBegin(stmt, &mode, &iters, &cached))
+
+    if (!cached)
+    {
+        /* Oracle execute call */
+
+        const sword ret = OCIStmtExecute(stmt->con->cxt, stmt->stmt, stmt->con->err,
+                                         iters, (ub4)0, (OCISnapshot *)NULL,
+                                         (OCISnapshot *)NULL, mode);
+
+        CHECK(StatementExecuteEnd(stmt, mode, ret))
+    }
+
+    /* rows of queries are accounted by fetches */
+
+    if (0 != start)
+    {
+        const big_uint rows = OCI_CST_SELECT != stmt->type ? StatementGetAffectedRows(stmt) : 0;
+
+        CHECK(ProfilerRecord(stmt, OCI_PROFILE_EXECUTE, start, rows, 0))
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * StatementCreate
  * --------------------------------------------------------------------------------------------- */
@@ -1545,6 +1842,9 @@ boolean StatementFree
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     CHECK_OBJECT_FETCHED(stmt)
 
+    PreparedCacheRemove(stmt);
+    AsyncCancel(stmt);
+
     StatementDispose(stmt);
     ListRemove(stmt->con->stmts, stmt);
 
@@ -1847,12 +2147,14 @@ boolean StatementPrepareFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
     CHECK_PTR(OCI_IPC_STRING,    sql)
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -1871,6 +2173,13 @@ boolean StatementPrepareFmt
             /* parse buffer */
 
             CHECK(StatementPrepareInternal(stmt, sql_fmt))
+
+            /* bind values replaced by placeholders */
+
+            if (stmt->con->fmt_binds)
+            {
+                CHECK(FormatBindSql(stmt, sql, &bind_pass_args))
+            }
         }
     }
 
@@ -1880,6 +2189,7 @@ boolean StatementPrepareFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -1904,6 +2214,7 @@ boolean StatementExecuteStmtFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     otext* sql_fmt = NULL;
 
@@ -1912,6 +2223,7 @@ boolean StatementExecuteStmtFmt
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -1931,6 +2243,13 @@ boolean StatementExecuteStmtFmt
             /* prepare and execute SQL buffer */
 
             CHECK(StatementPrepareInternal(stmt, sql_fmt))
+
+            /* bind values replaced by placeholders */
+
+            if (stmt->con->fmt_binds)
+            {
+                CHECK(FormatBindSql(stmt, sql, &bind_pass_args))
+            }
             CHECK(StatementExecuteInternal(stmt, OCI_DEFAULT))
         }
     }
@@ -1941,6 +2260,7 @@ boolean StatementExecuteStmtFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -1965,6 +2285,7 @@ boolean StatementParseFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     otext* sql_fmt = NULL;
 
@@ -1973,6 +2294,7 @@ boolean StatementParseFmt
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -1991,6 +2313,13 @@ boolean StatementParseFmt
             /* prepare and execute SQL buffer */
 
             CHECK(StatementPrepareInternal(stmt, sql_fmt))
+
+            /* bind values replaced by placeholders */
+
+            if (stmt->con->fmt_binds)
+            {
+                CHECK(FormatBindSql(stmt, sql, &bind_pass_args))
+            }
             CHECK(StatementExecuteInternal(stmt, OCI_PARSE_ONLY))
         }
     }
@@ -2001,6 +2330,7 @@ boolean StatementParseFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -2025,6 +2355,7 @@ boolean StatementDescribeFmt
 
     va_list first_pass_args;
     va_list second_pass_args;
+    va_list bind_pass_args;
 
     otext* sql_fmt = NULL;
 
@@ -2033,6 +2364,7 @@ boolean StatementDescribeFmt
 
     va_copy(first_pass_args,  args);
     va_copy(second_pass_args, args);
+    va_copy(bind_pass_args,   args);
 
     /* first, get buffer size */
 
@@ -2051,6 +2383,13 @@ boolean StatementDescribeFmt
             /* prepare and execute SQL buffer */
 
             CHECK(StatementPrepareInternal(stmt, sql_fmt))
+
+            /* bind values replaced by placeholders */
+
+            if (stmt->con->fmt_binds)
+            {
+                CHECK(FormatBindSql(stmt, sql, &bind_pass_args))
+            }
             CHECK(StatementExecuteInternal(stmt, OCI_DESCRIBE_ONLY))
         }
     }
@@ -2061,6 +2400,7 @@ boolean StatementDescribeFmt
     (
         va_end(first_pass_args);
         va_end(second_pass_args);
+        va_end(bind_pass_args);
 
         FREE(sql_fmt)
     )
@@ -2096,6 +2436,13 @@ boolean StatementSetBindArraySize
     }
     else
     {
+        /* elements added to the arrays have not been marshalled yet */
+
+        for (ub4 i = 0; i < stmt->nb_ubinds; i++)
+        {
+            BindMarkDirty(stmt->ubinds[i], stmt->nb_iters, UB4MAXVAL);
+        }
+
         stmt->nb_iters   = size;
         stmt->bind_array = TRUE;
 
@@ -2162,6 +2509,58 @@ boolean StatementIsRebindingAllowed
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementSetBindDirtyTracking
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementSetBindDirtyTracking
+(
+    OCI_Statement *stmt,
+    boolean        value
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+    /* changes made before enabling tracking are unknown */
+
+    if (value && !stmt->bind_tracking)
+    {
+        for (ub4 i = 0; i < stmt->nb_ubinds; i++)
+        {
+            BindMarkDirty(stmt->ubinds[i], 0, UB4MAXVAL);
+        }
+    }
+
+    stmt->bind_tracking = value;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementGetBindDirtyTracking
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementGetBindDirtyTracking
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        /* result */ boolean, FALSE,
+        /* handle */ OCI_IPC_STATEMENT, stmt,
+        /* member */ bind_tracking
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
 * OCI_BindBoolean
 * --------------------------------------------------------------------------------------------- */
@@ -2848,10 +3247,319 @@ boolean StatementBindArrayOfTimestamps
 }
 
 /* --------------------------------------------------------------------------------------------- *
- * StatementBindInterval
+ * StatementBindArrayOfEpochs
  * --------------------------------------------------------------------------------------------- */
 
-boolean StatementBindInterval
+boolean StatementBindArrayOfEpochs
+(
+    OCI_Statement *stmt,
+    const otext   *name,
+    big_int       *data,
+    unsigned int   unit,
+    unsigned int   nbelem
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    CHECK_BIND(stmt, name, data, OCI_IPC_BIGINT, TRUE)
+    CHECK_ENUM_VALUE(unit, EpochUnitValues, OTEXT("Epoch unit"))
+
+    if (OCI_DTM_EPOCH != unit)
+    {
+        /* fractional seconds require a TIMESTAMP descriptor per element */
+
+        CHECK_TIMESTAMP_ENABLED(stmt->con)
+
+#if OCI_VERSION_COMPILE >= OCI_9_0
+
+        BIND_DATA(sizeof(OCIDateTime *), OCI_CDT_DATETIME, SQLT_TIMESTAMP, unit, NULL, nbelem)
+
+#endif
+
+    }
+    else
+    {
+        BIND_DATA(OCI_DATE_WIRE_SIZE, OCI_CDT_DATETIME, SQLT_DAT, unit, NULL, nbelem)
+    }
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementBindArrayOfTms
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementBindArrayOfTms
+(
+    OCI_Statement *stmt,
+    const otext   *name,
+    struct tm     *data,
+    unsigned int   nbelem
+)
+{
+    BIND_CALL_NULL_FORBIDDEN
+    (
+        OCI_IPC_TM, OCI_DATE_WIRE_SIZE, OCI_CDT_DATETIME, SQLT_DAT, OCI_DTM_TM, NULL, nbelem
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementBindArrowColumn
+ * --------------------------------------------------------------------------------------------- */
+
+static boolean StatementBindArrowColumn
+(
+    OCI_Statement            *stmt,
+    unsigned int              index,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array,
+    ub4                       first
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    otext        name[OCI_SIZE_OBJ_NAME + 2];
+    OCI_Bind    *bnd    = NULL;
+    void        *buffer = NULL;
+    unsigned int unit   = 0;
+    ub4          len    = 1;
+
+    const unsigned int type  = ArrowGetType(schema, &unit);
+    const ub4          count = stmt->nb_iters;
+
+    if (OCI_ARW_UNKNOWN == type || NULL == array->buffers)
+    {
+        THROW(ExceptionArrowFormat, (int) index)
+    }
+
+    /* columns are bound by name, or by position for statements binding by position */
+
+    if (OCI_BIND_BY_POS == stmt->bind_mode || NULL == schema->name || 0 == schema->name[0])
+    {
+        osprintf(name, (int) osizeof(name), OTEXT(":%u"), index);
+    }
+    else
+    {
+        const int size = (int) min(strlen(schema->name), OCI_SIZE_OBJ_NAME);
+
+        name[0] = OTEXT(':');
+
+        StringAnsiToNative(schema->name, name + 1, size);
+
+        name[size + 1] = 0;
+    }
+
+    /* fixed size values are bound in place, variable size ones are copied to an
+       array of fixed size elements owned by the bind */
+
+    void *values = (void *) ArrowGetValue(array, ArrowGetValueSize(type), first);
+
+    switch (type)
+    {
+        case OCI_ARW_INT16:
+        {
+            CHECK(StatementBindArrayOfShorts(stmt, name, (short *) values, 0))
+            break;
+        }
+        case OCI_ARW_UINT16:
+        {
+            CHECK(StatementBindArrayOfUnsignedShorts(stmt, name, (unsigned short *) values, 0))
+            break;
+        }
+        case OCI_ARW_INT32:
+        {
+            CHECK(StatementBindArrayOfInts(stmt, name, (int *) values, 0))
+            break;
+        }
+        case OCI_ARW_UINT32:
+        {
+            CHECK(StatementBindArrayOfUnsignedInts(stmt, name, (unsigned int *) values, 0))
+            break;
+        }
+        case OCI_ARW_INT64:
+        {
+            CHECK(StatementBindArrayOfBigInts(stmt, name, (big_int *) values, 0))
+            break;
+        }
+        case OCI_ARW_UINT64:
+        {
+            CHECK(StatementBindArrayOfUnsignedBigInts(stmt, name, (big_uint *) values, 0))
+            break;
+        }
+        case OCI_ARW_FLOAT:
+        {
+            CHECK(StatementBindArrayOfFloats(stmt, name, (float *) values, 0))
+            break;
+        }
+        case OCI_ARW_DOUBLE:
+        {
+            CHECK(StatementBindArrayOfDoubles(stmt, name, (double *) values, 0))
+            break;
+        }
+        case OCI_ARW_TIMESTAMP:
+        {
+            CHECK(StatementBindArrayOfEpochs(stmt, name, (big_int *) values, unit, 0))
+            break;
+        }
+        case OCI_ARW_UTF8:
+        case OCI_ARW_BINARY:
+        {
+            const char *data = NULL;
+            ub4         size = 0;
+
+            for (ub4 i = 0; i < count; i++)
+            {
+                ArrowGetBytes(array, first + i, &data, &size);
+
+                len = max(len, size);
+            }
+
+            if (OCI_ARW_UTF8 == type)
+            {
+                ALLOC_BUFFER(OCI_IPC_STRING, buffer, sizeof(otext), (size_t) (len + 1) * count)
+
+                /* UTF-8 values never have more characters than bytes */
+
+                for (ub4 i = 0; i < count; i++)
+                {
+                    otext *str = ((otext *) buffer) + (size_t) (len + 1) * i;
+
+                    ArrowGetBytes(array, first + i, &data, &size);
+
+                    StringUTF8ToNative(data, size, str);
+                }
+
+                CHECK(StatementBindArrayOfStrings(stmt, name, (otext *) buffer, len, 0))
+            }
+            else
+            {
+                ALLOC_BUFFER(OCI_IPC_BUFF_ARRAY, buffer, len, count)
+
+                for (ub4 i = 0; i < count; i++)
+                {
+                    ArrowGetBytes(array, first + i, &data, &size);
+
+                    memcpy(((ub1 *) buffer) + (size_t) len * i, data, size);
+                }
+
+                CHECK(StatementBindArrayOfRaws(stmt, name, buffer, len, 0))
+            }
+
+            break;
+        }
+    }
+
+    bnd = StatementGetBind2(stmt, name);
+    CHECK_NULL(bnd)
+
+    if (NULL != buffer)
+    {
+        /* a previous buffer of a rebound column is not used anymore */
+
+        FREE(bnd->ext_buffer)
+
+        bnd->ext_buffer = buffer;
+        buffer          = NULL;
+    }
+
+    /* validity bitmap to null indicators and raw sizes */
+
+    for (ub4 i = 0; i < count; i++)
+    {
+        bnd->buffer.inds[i] = ArrowIsNull(array, first + i) ? OCI_IND_NULL : OCI_IND_NOTNULL;
+
+        if (OCI_ARW_BINARY == type)
+        {
+            const char *data = NULL;
+            ub4         size = 0;
+
+            ArrowGetBytes(array, first + i, &data, &size);
+
+            CHECK(BindSetDataSizeAtPos(bnd, i + 1, size))
+        }
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        FREE(buffer)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementBindArrowBatch
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementBindArrowBatch
+(
+    OCI_Statement            *stmt,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    unsigned int bind_alloc_mode = OCI_UNKNOWN;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_VOID, schema)
+    CHECK_PTR(OCI_IPC_VOID, array)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+    if (!ArrowIsBatch(schema, array) || 0 == schema->n_children)
+    {
+        THROW(ExceptionArgInvalidValue, OTEXT("Arrow batch columns"), (unsigned int) schema->n_children)
+    }
+
+    CHECK_MIN(array->length, 1)
+
+    /* the batch rows are the elements of the array binds */
+
+    CHECK(StatementSetBindArraySize(stmt, (unsigned int) array->length))
+
+    /* columns are bound from the Arrow buffers or from buffers owned by the binds */
+
+    bind_alloc_mode = stmt->bind_alloc_mode;
+
+    stmt->bind_alloc_mode = OCI_BAM_EXTERNAL;
+
+    for (int64_t i = 0; i < schema->n_children; i++)
+    {
+        CHECK(StatementBindArrowColumn(stmt, (unsigned int) i + 1, schema->children[i],
+                                       array->children[i], (ub4) array->offset))
+    }
+
+    SET_SUCCESS()
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (OCI_UNKNOWN != bind_alloc_mode)
+        {
+            stmt->bind_alloc_mode = bind_alloc_mode;
+        }
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementBindInterval
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementBindInterval
 (
     OCI_Statement *stmt,
     const otext   *name,
@@ -3195,6 +3903,123 @@ boolean StatementBindLong
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementBindStream
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementBindStream
+(
+    OCI_Statement     *stmt,
+    const otext       *name,
+    unsigned int       type,
+    unsigned int       subtype,
+    unsigned int       len,
+    POCI_BIND_PRODUCER producer,
+    void              *ctx
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    unsigned int code = 0;
+    unsigned int size = 0;
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_PTR(OCI_IPC_STRING,    name)
+    CHECK_PTR(OCI_IPC_PROC,      producer)
+    CHECK_STMT_STATUS(stmt, OCI_STMT_PREPARED)
+
+    switch (type)
+    {
+        case OCI_CDT_NUMERIC:
+        {
+            if (OCI_NUM_BIGINT & subtype)
+            {
+                code = SQLT_VNU;
+                size = sizeof(OCINumber);
+            }
+            else if (OCI_NUM_DOUBLE == subtype)
+            {
+                code = SQLT_FLT;
+                size = sizeof(double);
+
+#if OCI_VERSION_COMPILE >= OCI_10_1
+
+                if (ConnectionIsVersionSupported(stmt->con, OCI_10_1))
+                {
+                    code = SQLT_BDOUBLE;
+                }
+
+#endif
+            }
+            else if (OCI_NUM_FLOAT == subtype)
+            {
+                code = SQLT_FLT;
+                size = sizeof(float);
+
+#if OCI_VERSION_COMPILE >= OCI_10_1
+
+                if (ConnectionIsVersionSupported(stmt->con, OCI_10_1))
+                {
+                    code = SQLT_BFLOAT;
+                }
+
+#endif
+            }
+            else if (OCI_NUM_SHORT & subtype)
+            {
+                code = (OCI_NUM_UNSIGNED & subtype) ? SQLT_UIN : SQLT_INT;
+                size = sizeof(short);
+            }
+            else if (OCI_NUM_INT & subtype)
+            {
+                code = (OCI_NUM_UNSIGNED & subtype) ? SQLT_UIN : SQLT_INT;
+                size = sizeof(int);
+            }
+            else
+            {
+                THROW(ExceptionArgInvalidValue, OTEXT("Numeric subtype"), subtype)
+            }
+            break;
+        }
+        case OCI_CDT_TEXT:
+        {
+            CHECK_MIN(len, 1)
+
+            code = SQLT_CHR;
+            size = len * (ub4) sizeof(dbtext);
+            break;
+        }
+        case OCI_CDT_RAW:
+        {
+            CHECK_MIN(len, 1)
+
+            code = SQLT_BIN;
+            size = len;
+            break;
+        }
+        case OCI_CDT_DATETIME:
+        {
+            code = SQLT_ODT;
+            size = sizeof(OCIDate);
+            break;
+        }
+        default:
+        {
+            THROW(ExceptionDatatypeNotSupported, (int) type)
+        }
+    }
+
+    CHECK_NULL(BindCreateStream(stmt, name, size, (ub1) type, code, subtype, producer, ctx))
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
 /* --------------------------------------------------------------------------------------------- *
 * OCI_RegisterNumber
 * --------------------------------------------------------------------------------------------- */
@@ -3967,6 +4792,91 @@ unsigned int StatementGetLongMode
     )
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StatementSetLobMode
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementSetLobMode
+(
+    OCI_Statement *stmt,
+    unsigned int   mode
+)
+{
+    SET_PROP_ENUM
+    (
+        /* handle */ OCI_IPC_STATEMENT, stmt,
+        /* member */ lob_mode, ub1,
+        /* value  */ mode, LobModeValues, OTEXT("Lob Mode")
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementGetLobMode
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int StatementGetLobMode
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        unsigned int, OCI_UNKNOWN,
+        OCI_IPC_STATEMENT, stmt,
+        lob_mode
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementSetLobInlineSize
+ * --------------------------------------------------------------------------------------------- */
+
+boolean StatementSetLobInlineSize
+(
+    OCI_Statement *stmt,
+    unsigned int   size
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ boolean, FALSE,
+        /* context */ OCI_IPC_STATEMENT, stmt
+    )
+
+    const ub2 char_size = (ub2) (Env.nls_utf8 ? OCI_UTF8_BYTES_PER_CHAR : sizeof(otext));
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+    CHECK_MIN(size, 1)
+
+    /* inline buffers lengths are returned by OCI as ub2 values, including the
+       string terminator for CLOBs */
+
+    CHECK_MAX(size, (unsigned int) (UB2MAXVAL / char_size - 1))
+
+    stmt->lob_inline_size = size;
+
+    SET_SUCCESS()
+
+    EXIT_FUNC()
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * StatementGetLobInlineSize
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int StatementGetLobInlineSize
+(
+    OCI_Statement *stmt
+)
+{
+    GET_PROP
+    (
+        unsigned int, 0,
+        OCI_IPC_STATEMENT, stmt,
+        lob_inline_size
+    )
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * StatementGetConnection
  * --------------------------------------------------------------------------------------------- */
@@ -4010,12 +4920,32 @@ const otext* StatementGetSqlIdentifier
     OCI_Statement *stmt
 )
 {
-    GET_PROP
+    ENTER_FUNC
     (
-        const otext*, NULL,
-        OCI_IPC_STATEMENT, stmt,
-        sql_id
+        /* returns */ const otext*, NULL,
+        /* context */ OCI_IPC_STATEMENT, stmt
     )
+
+    CHECK_PTR(OCI_IPC_STATEMENT, stmt)
+
+#if OCI_VERSION_COMPILE >= OCI_12_2
+
+    /* the attribute is only retrieved when requested for the last execution */
+
+    if (NULL == stmt->sql_id && (stmt->status & OCI_STMT_EXECUTED) &&
+        ConnectionIsVersionSupported(stmt->con, OCI_12_2))
+    {
+        unsigned int size_id = 0;
+
+        CHECK(StringGetAttribute(stmt->con, stmt->stmt, OCI_HTYPE_STMT,
+                                 OCI_ATTR_SQL_ID, &stmt->sql_id, &size_id))
+    }
+
+#endif
+
+    SET_RETVAL(stmt->sql_id)
+
+    EXIT_FUNC()
 }
 
 /* --------------------------------------------------------------------------------------------- *
@@ -4054,12 +4984,21 @@ unsigned int StatementGetAffectedRows
 
     CHECK_PTR(OCI_IPC_STATEMENT, stmt)
 
-    CHECK_ATTRIB_GET
-    (
-        OCI_HTYPE_STMT, OCI_ATTR_ROW_COUNT,
-        stmt->stmt, &count, NULL,
-        stmt->con->err
-    )
+    if (stmt->rsts && stmt->rsts[0] && stmt->rsts[0]->from_cache)
+    {
+        /* no server execution took place */
+
+        count = stmt->rsts[0]->row_count;
+    }
+    else
+    {
+        CHECK_ATTRIB_GET
+        (
+            OCI_HTYPE_STMT, OCI_ATTR_ROW_COUNT,
+            stmt->stmt, &count, NULL,
+            stmt->con->err
+        )
+    }
 
     SET_RETVAL(count)
 
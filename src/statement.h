@@ -49,6 +49,21 @@ boolean StatementPrepareInternal
     const otext  * sql
 );
 
+boolean StatementExecuteBegin
+(
+    OCI_Statement* stmt,
+    ub4          * mode,
+    ub4          * iters,
+    boolean      * cached
+);
+
+boolean StatementExecuteEnd
+(
+    OCI_Statement* stmt,
+    ub4            mode,
+    sword          ret
+);
+
 boolean StatementExecuteInternal
 (
     OCI_Statement* stmt,
@@ -159,6 +174,17 @@ boolean StatementIsRebindingAllowed
     OCI_Statement* stmt
 );
 
+boolean StatementSetBindDirtyTracking
+(
+    OCI_Statement *stmt,
+    boolean        value
+);
+
+boolean StatementGetBindDirtyTracking
+(
+    OCI_Statement *stmt
+);
+
 boolean StatementBindBoolean
 (
     OCI_Statement* stmt,
@@ -366,6 +392,30 @@ boolean StatementBindArrayOfTimestamps
     unsigned int    nbelem
 );
 
+boolean StatementBindArrayOfEpochs
+(
+    OCI_Statement* stmt,
+    const otext  * name,
+    big_int      * data,
+    unsigned int   unit,
+    unsigned int   nbelem
+);
+
+boolean StatementBindArrayOfTms
+(
+    OCI_Statement* stmt,
+    const otext  * name,
+    struct tm    * data,
+    unsigned int   nbelem
+);
+
+boolean StatementBindArrowBatch
+(
+    OCI_Statement            *stmt,
+    const struct ArrowSchema *schema,
+    const struct ArrowArray  *array
+);
+
 boolean StatementBindInterval
 (
     OCI_Statement* stmt,
@@ -477,6 +527,17 @@ boolean StatementBindLong
     unsigned int   size
 );
 
+boolean StatementBindStream
+(
+    OCI_Statement    * stmt,
+    const otext      * name,
+    unsigned int       type,
+    unsigned int       subtype,
+    unsigned int       len,
+    POCI_BIND_PRODUCER producer,
+    void             * ctx
+);
+
 boolean StatementRegisterNumber
 (
     OCI_Statement* stmt,
@@ -686,6 +747,28 @@ unsigned int StatementGetLongMode
     OCI_Statement* stmt
 );
 
+boolean StatementSetLobMode
+(
+    OCI_Statement* stmt,
+    unsigned int   mode
+);
+
+unsigned int StatementGetLobMode
+(
+    OCI_Statement* stmt
+);
+
+boolean StatementSetLobInlineSize
+(
+    OCI_Statement* stmt,
+    unsigned int   size
+);
+
+unsigned int StatementGetLobInlineSize
+(
+    OCI_Statement* stmt
+);
+
 OCI_Connection* StatementGetConnection
 (
     OCI_Statement* stmt
@@ -304,6 +304,95 @@ void StringTranslate
     memset(((char*) dst) + len * size_char_out, 0, size_char_out);
 }
 
+/* --------------------------------------------------------------------------------------------- *
+ * StringUTF8ToNative
+ * --------------------------------------------------------------------------------------------- */
+
+unsigned int StringUTF8ToNative
+(
+    const char  *src,
+    unsigned int size,
+    otext       *dst
+)
+{
+    const unsigned char *str = (const unsigned char *) src;
+
+    unsigned int i = 0;
+    unsigned int n = 0;
+
+    /* ANSI builds hand UTF-8 strings over as is */
+
+    if (sizeof(otext) == sizeof(char))
+    {
+        memcpy(dst, src, (size_t) size);
+
+        dst[size] = 0;
+
+        return size;
+    }
+
+    /* wide builds decode the code points, using surrogate pairs for 2 bytes wchar_t */
+
+    while (i < size)
+    {
+        unsigned int cp    = str[i++];
+        unsigned int extra = 0;
+        boolean      valid = TRUE;
+
+        if (cp >= 0xF8)
+        {
+            valid = FALSE;
+        }
+        else if (cp >= 0xF0)
+        {
+            cp   &= 0x07;
+            extra = 3;
+        }
+        else if (cp >= 0xE0)
+        {
+            cp   &= 0x0F;
+            extra = 2;
+        }
+        else if (cp >= 0xC0)
+        {
+            cp   &= 0x1F;
+            extra = 1;
+        }
+        else if (cp >= 0x80)
+        {
+            valid = FALSE;
+        }
+
+        for (; extra > 0 && i < size && 0x80 == (str[i] & 0xC0); extra--)
+        {
+            cp = (cp << 6) | (str[i++] & 0x3F);
+        }
+
+        /* truncated or invalid sequences are replaced */
+
+        if (!valid || extra > 0 || cp > 0x10FFFF)
+        {
+            cp = OTEXT('?');
+        }
+
+        if (sizeof(otext) == sizeof(short) && cp > 0xFFFF)
+        {
+            cp -= 0x10000;
+
+            dst[n++] = (otext) (0xD800 + (cp >> 10));
+            dst[n++] = (otext) (0xDC00 + (cp & 0x3FF));
+        }
+        else
+        {
+            dst[n++] = (otext) cp;
+        }
+    }
+
+    dst[n] = 0;
+
+    return n;
+}
+
 /* --------------------------------------------------------------------------------------------- *
  * StringGetDBString
  * --------------------------------------------------------------------------------------------- */
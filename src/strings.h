@@ -52,6 +52,13 @@ void StringTranslate
     size_t size_char_out
 );
 
+unsigned int StringUTF8ToNative
+(
+    const char * src,
+    unsigned int size,
+    otext      * dst
+);
+
 #define StringAnsiToNative(s, d, l) \
     StringTranslate( (void *) (s), (void *) (d), l, sizeof(char),   sizeof(otext) )
 
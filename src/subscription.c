@@ -25,6 +25,7 @@
 #include "list.h"
 #include "macros.h"
 #include "memory.h"
+#include "resultcache.h"
 #include "statement.h"
 #include "strings.h"
 
@@ -47,6 +48,10 @@ boolean SubscriptionDispose
 
     CHECK_PTR(OCI_IPC_NOTIFY, sub)
 
+    /* result caches cannot be invalidated by this subscription anymore */
+
+    ResultCacheDetachSubscription(sub);
+
 #if OCI_VERSION_COMPILE >= OCI_10_2
 
     /* unregister the subscription if connection still alive */
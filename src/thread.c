@@ -23,6 +23,25 @@
 #include "macros.h"
 #include "memory.h"
 
+#ifndef _WINDOWS
+#include <pthread.h>
+#endif
+
+/* OCI threads only provide mutexes that must be released by their owner.
+   Events waking up worker threads rely on the platform primitives */
+
+struct OCI_ThreadEvent
+{
+#ifdef _WINDOWS
+    HANDLE          handle;     /* auto reset event */
+#else
+    pthread_mutex_t mutex;      /* mutex protecting the event state */
+    pthread_cond_t  cond;       /* condition signaled when the event is set */
+    boolean         signaled;   /* event state */
+    boolean         ready;      /* mutex and condition initialized ? */
+#endif
+};
+
 /* --------------------------------------------------------------------------------------------- *
  * ThreadProc
  * --------------------------------------------------------------------------------------------- */
@@ -235,3 +254,148 @@ boolean ThreadJoin
 
     EXIT_FUNC()
 }
+
+/* --------------------------------------------------------------------------------------------- *
+ * ThreadEventCreate
+ * --------------------------------------------------------------------------------------------- */
+
+OCI_ThreadEvent * ThreadEventCreate
+(
+    void
+)
+{
+    ENTER_FUNC
+    (
+        /* returns */ OCI_ThreadEvent*, NULL,
+        /* context */ OCI_IPC_VOID, &Env
+    )
+
+    OCI_ThreadEvent *evt = NULL;
+
+    CHECK_INITIALIZED()
+    CHECK_THREAD_ENABLED()
+
+    ALLOC_DATA(OCI_IPC_THREAD, evt, 1)
+
+#ifdef _WINDOWS
+
+    evt->handle = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    CHECK_NULL(evt->handle)
+
+#else
+
+    CHECK(0 == pthread_mutex_init(&evt->mutex, NULL))
+
+    if (0 != pthread_cond_init(&evt->cond, NULL))
+    {
+        pthread_mutex_destroy(&evt->mutex);
+
+        CHECK(FALSE)
+    }
+
+    evt->ready = TRUE;
+
+#endif
+
+    CLEANUP_AND_EXIT_FUNC
+    (
+        if (FAILURE)
+        {
+            ThreadEventFree(evt);
+            evt = NULL;
+        }
+
+        SET_RETVAL(evt)
+    )
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ThreadEventFree
+ * --------------------------------------------------------------------------------------------- */
+
+void ThreadEventFree
+(
+    OCI_ThreadEvent *evt
+)
+{
+    if (NULL == evt)
+    {
+        return;
+    }
+
+#ifdef _WINDOWS
+
+    if (NULL != evt->handle)
+    {
+        CloseHandle(evt->handle);
+    }
+
+#else
+
+    if (evt->ready)
+    {
+        pthread_cond_destroy(&evt->cond);
+        pthread_mutex_destroy(&evt->mutex);
+    }
+
+#endif
+
+    MemoryFree(evt);
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ThreadEventSet
+ * --------------------------------------------------------------------------------------------- */
+
+void ThreadEventSet
+(
+    OCI_ThreadEvent *evt
+)
+{
+#ifdef _WINDOWS
+
+    SetEvent(evt->handle);
+
+#else
+
+    pthread_mutex_lock(&evt->mutex);
+
+    evt->signaled = TRUE;
+
+    pthread_cond_signal(&evt->cond);
+    pthread_mutex_unlock(&evt->mutex);
+
+#endif
+}
+
+/* --------------------------------------------------------------------------------------------- *
+ * ThreadEventWait
+ * --------------------------------------------------------------------------------------------- */
+
+void ThreadEventWait
+(
+    OCI_ThreadEvent *evt
+)
+{
+    /* the event is reset when a waiting thread is released */
+
+#ifdef _WINDOWS
+
+    WaitForSingleObject(evt->handle, INFINITE);
+
+#else
+
+    pthread_mutex_lock(&evt->mutex);
+
+    while (!evt->signaled)
+    {
+        pthread_cond_wait(&evt->cond, &evt->mutex);
+    }
+
+    evt->signaled = FALSE;
+
+    pthread_mutex_unlock(&evt->mutex);
+
+#endif
+}
@@ -45,4 +45,24 @@ boolean ThreadJoin
     OCI_Thread* thread
 );
 
+OCI_ThreadEvent * ThreadEventCreate
+(
+    void
+);
+
+void ThreadEventFree
+(
+    OCI_ThreadEvent *evt
+);
+
+void ThreadEventSet
+(
+    OCI_ThreadEvent *evt
+);
+
+void ThreadEventWait
+(
+    OCI_ThreadEvent *evt
+);
+
 #endif /* OCILIB_THREAD_H_INCLUDED */
@@ -171,6 +171,10 @@ boolean TransactionStart
 
     CHECK_PTR(OCI_IPC_TRANSACTION, trans)
 
+    CHECK_NO_ASYNC_CALL(trans->con)
+
+    trans->con->server_calls++;
+
     CHECK_OCI
     (
         trans->con->err,
@@ -216,6 +220,10 @@ boolean TransactionStop
 
     if (!trans->local)
     {
+        CHECK_NO_ASYNC_CALL(trans->con)
+
+        trans->con->server_calls++;
+
         CHECK_OCI
         (
             trans->con->err,
@@ -247,6 +255,10 @@ boolean TransactionResume
 
     CHECK_PTR(OCI_IPC_TRANSACTION, trans)
 
+    CHECK_NO_ASYNC_CALL(trans->con)
+
+    trans->con->server_calls++;
+
     CHECK_OCI
     (
         trans->con->err,
@@ -277,6 +289,10 @@ boolean TransactionPrepare
 
     CHECK_PTR(OCI_IPC_TRANSACTION, trans)
 
+    CHECK_NO_ASYNC_CALL(trans->con)
+
+    trans->con->server_calls++;
+
     CHECK_OCI
     (
         trans->con->err,
@@ -307,6 +323,10 @@ boolean TransactionForget
 
     CHECK_PTR(OCI_IPC_TRANSACTION, trans)
 
+    CHECK_NO_ASYNC_CALL(trans->con)
+
+    trans->con->server_calls++;
+
     CHECK_OCI
     (
         trans->con->err,
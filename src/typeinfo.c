@@ -245,6 +245,10 @@ OCI_TypeInfo * TypeInfoGet
 
         /* describe call */
 
+        CHECK_NO_ASYNC_CALL(con)
+
+        con->server_calls++;
+
         CHECK_OCI
         (
             con->err,
@@ -166,6 +166,13 @@ struct OCI_Thread
     POCI_THREAD      proc;      /* thread routine */
 };
 
+/*
+ * Thread event : auto reset event waking up worker threads, defined in thread.c
+ *
+ */
+
+typedef struct OCI_ThreadEvent OCI_ThreadEvent;
+
 /*
  * Thread key object
  *
@@ -202,6 +209,7 @@ struct OCI_Environment
     unsigned int    version_compile;              /* OCI version used at compile time */
     unsigned int    version_runtime;              /* OCI version used at runtime */
     boolean         use_lob_ub8;                  /* use 64 bits integers for lobs ? */
+    boolean         use_lob_array;                /* use Oracle 10gR2 lob array API ? */
     boolean         use_xa;                        /* is xa enabled */
     boolean         use_scrollable_cursors;       /* use Oracle 9i fetch API */
     ub4             env_mode;                     /* default environment mode */
@@ -251,6 +259,7 @@ struct OCI_Pool
     ub4       incr;             /* increment step of objects */
     ub4       htype;            /* handle type of pool : connection / session */
     ub4       cache_size;       /* statement cache size */
+    struct OCI_ResultCache *rcache; /* client side result cache shared by pooled connections */
 };
 
 /*
@@ -292,6 +301,14 @@ struct OCI_Connection
     otext            *domain_name;  /* server domain name */
     OCI_Timestamp    *inst_startup; /* instance startup timestamp */
     otext            *formats[OCI_FMT_COUNT];  /* string conversion default formats */
+    struct OCI_ResultCache *rcache; /* client side result cache */
+    struct OCI_PreparedCache *pcache; /* prepared statement cache */
+    boolean           commit_exec;  /* commit performed by execute calls in auto commit mode ? */
+    ub4               server_calls; /* number of OCI calls made to the server */
+    struct OCI_Statement *async_stmt; /* statement owning the pending non blocking call */
+    boolean           fmt_binds;    /* formatted calls bind values instead of inlining them ? */
+    struct OCI_Profiler *profiler;  /* statement profiler */
+    struct OCI_DescribeCache *dcache; /* select list describe cache */
 };
 
 /*
@@ -385,6 +402,14 @@ struct OCI_Bind
     ub1            csfrm;        /* charset form */
     ub1            direction;    /* in, out or in/out bind */
     ub1            alloc_mode;   /* allocation mode : internal or external */
+    POCI_BIND_PRODUCER producer; /* value producer for streaming binds */
+    void          *producer_ctx; /* value producer user context */
+    ub4            failed_iter;  /* iteration for which the producer failed (0 if none) */
+    ub4            dirty_lo;     /* first element modified since the last execution */
+    ub4            dirty_hi;     /* element following the last modified one */
+    boolean        ext_inds;     /* indicators array provided by the program ? */
+    ub4            nb_descs;     /* descriptors allocated for native timestamp binds */
+    void          *ext_buffer;   /* values copied from Arrow arrays, owned by the bind */
 }
 ;
 
@@ -403,6 +428,149 @@ struct OCI_Define
 
 typedef struct OCI_Define OCI_Define;
 
+/*
+ * OCI_ResultCacheEntry : Internal result cache entry (one query + bind values)
+ *
+ */
+
+struct OCI_ResultCacheEntry
+{
+    struct OCI_ResultCacheEntry *prev;       /* previous entry in LRU order */
+    struct OCI_ResultCacheEntry *next;       /* next entry in LRU order */
+    struct OCI_ResultCacheEntry *chain;      /* next entry in the same hash bucket */
+    struct OCI_ResultCache      *cache;      /* owner cache */
+    ub1                         *key;        /* lookup key (SQL text and bind values) */
+    unsigned int                 key_size;   /* lookup key size */
+    unsigned int                 hash;       /* lookup key hash value */
+    otext                       *sql;        /* SQL text used for invalidation */
+    otext                      **deps;       /* tables registered for invalidation */
+    ub4                          nb_deps;    /* number of registered tables */
+    OCI_Column                  *cols;       /* columns description */
+    OCI_Buffer                  *bufs;       /* columns data */
+    ub4                          nb_cols;    /* number of columns */
+    ub4                          nb_rows;    /* number of rows */
+    ub4                          allocated;  /* number of allocated rows */
+    size_t                       size;       /* memory used by the entry */
+    time_t                       created;    /* creation time */
+    unsigned int                 generation; /* cache generation when the entry was started */
+};
+
+typedef struct OCI_ResultCacheEntry OCI_ResultCacheEntry;
+
+/*
+ * OCI_ResultCache : Internal client side result cache
+ *
+ */
+
+struct OCI_ResultCache
+{
+    OCI_ResultCacheEntry **buckets;     /* hash table of entries */
+    unsigned int           nb_buckets;  /* number of hash buckets */
+    OCI_ResultCacheEntry  *head;        /* most recently used entry */
+    OCI_ResultCacheEntry  *tail;        /* least recently used entry */
+    unsigned int           count;       /* number of entries */
+    unsigned int           max_entries; /* maximum number of entries */
+    size_t                 size;        /* memory used by entries */
+    size_t                 max_size;    /* maximum memory used by entries (0 for no limit) */
+    unsigned int           ttl;         /* entries time to live in seconds (0 for no limit) */
+    unsigned int           generation;  /* incremented on each invalidation */
+    OCI_Subscription      *sub;         /* subscription used for invalidation */
+    OCI_Mutex             *mutex;       /* mutex for multi threaded access */
+    unsigned int           hits;        /* number of executions served from the cache */
+    unsigned int           misses;      /* number of executions sent to the server */
+};
+
+typedef struct OCI_ResultCache OCI_ResultCache;
+
+/*
+ * OCI_PreparedCache : Internal per connection prepared statement cache
+ *
+ */
+
+struct OCI_PreparedCache
+{
+    struct OCI_Statement **buckets; /* hash table of idle statements */
+    unsigned int          nb_buckets; /* number of hash buckets */
+    struct OCI_Statement *head;     /* most recently released statement */
+    struct OCI_Statement *tail;     /* least recently released statement */
+    unsigned int          count;    /* number of idle statements */
+    unsigned int          max_size; /* maximum number of idle statements */
+    unsigned int          hits;     /* number of statements served from the cache */
+    unsigned int          misses;   /* number of statements prepared on a cache miss */
+};
+
+typedef struct OCI_PreparedCache OCI_PreparedCache;
+
+/*
+ * OCI_ProfileEntry : Internal statement profiler entry (one SQL text)
+ *
+ */
+
+struct OCI_ProfileEntry
+{
+    struct OCI_ProfileEntry *next;    /* next entry in creation order */
+    otext                   *sql;     /* SQL text */
+    otext                   *sql_id;  /* SQL identifier if retrieved */
+    unsigned int             hash;    /* SQL text hash value */
+    big_uint                 rows;    /* rows processed */
+    big_uint                 bytes;   /* bytes fetched */
+    OCI_ProfilePhase         phases[OCI_PROFILE_PHASES]; /* per phase statistics */
+};
+
+typedef struct OCI_ProfileEntry OCI_ProfileEntry;
+
+/*
+ * OCI_Profiler : Internal per connection statement profiler
+ *
+ */
+
+struct OCI_Profiler
+{
+    struct OCI_ProfileEntry *head;    /* first profiled SQL text */
+    struct OCI_ProfileEntry *tail;    /* last profiled SQL text */
+    unsigned int             count;   /* number of entries */
+    boolean                  enabled; /* statistics being collected ? */
+};
+
+typedef struct OCI_Profiler OCI_Profiler;
+
+/*
+ * OCI_DescribeEntry : Internal describe cache entry (one query select list)
+ *
+ */
+
+struct OCI_DescribeEntry
+{
+    struct OCI_DescribeEntry *prev;      /* previous entry in LRU order */
+    struct OCI_DescribeEntry *next;      /* next entry in LRU order */
+    otext                    *sql;       /* SQL text */
+    unsigned int              hash;      /* SQL text hash value */
+    ub1                       long_mode; /* long mode used for mapping the columns */
+    ub1                       lob_mode;  /* lob mode used for mapping the columns */
+    ub4                       lob_size;  /* lob inline size used for mapping the columns */
+    OCI_Column               *cols;      /* described and mapped columns */
+    ub4                       nb_cols;   /* number of columns */
+};
+
+typedef struct OCI_DescribeEntry OCI_DescribeEntry;
+
+/*
+ * OCI_DescribeCache : Internal per connection select list describe cache
+ *
+ */
+
+struct OCI_DescribeCache
+{
+    struct OCI_DescribeEntry *head;     /* most recently used entry */
+    struct OCI_DescribeEntry *tail;     /* least recently used entry */
+    unsigned int              count;    /* number of entries */
+    unsigned int              max_size; /* maximum number of entries */
+    unsigned int              hits;     /* number of select lists served from the cache */
+    unsigned int              misses;   /* number of select lists described by OCI */
+};
+
+typedef struct OCI_DescribeCache OCI_DescribeCache;
+
 /*
  * Resultset object
  *
@@ -422,6 +590,7 @@ struct OCI_Resultset
     boolean        bof;             /* beginning of resultset reached ?  */
     ub4            fetch_size;      /* internal array size */
     sword          fetch_status;    /* internal fetch status */
+    boolean        from_cache;      /* resultset content served from the result cache ? */
 };
 
 /*
@@ -460,6 +629,7 @@ struct OCI_Statement
     ub2              allocated_ubinds;  /* number of allocated user binds */
     ub2              allocated_rbinds;  /* number of allocated register binds */
     boolean          bind_reuse;        /* rebind data allowed ? */
+    boolean          bind_tracking;     /* marshal only binds modified since the last execution ? */
     unsigned int     bind_mode;         /* type of binding */
     unsigned int     bind_alloc_mode;   /* type of bind allocation */
     ub4              exec_mode;         /* type of execution */
@@ -468,6 +638,8 @@ struct OCI_Statement
     ub4              prefetch_mem;      /* pre-fetch memory */
     ub4              long_size;         /* default size for LONG columns */
     ub1              long_mode;         /* LONG datatype handling mode */
+    ub4              lob_inline_size;   /* maximum size of inlined LOB values */
+    ub1              lob_mode;          /* LOB datatype handling mode */
     ub1              status;            /* statement status */
     ub2              type;              /* type of SQL statement */
     ub4              nb_iters;          /* current number of iterations for execution */
@@ -479,6 +651,22 @@ struct OCI_Statement
     boolean          bind_array;        /* has array binds ? */
     OCI_BatchErrors *batch;             /* error handling for array DML */
     ub2              err_pos;           /* error position in sql statement */
+    OCI_ResultCacheEntry *rc_pending;   /* result cache entry being filled by fetches */
+    struct OCI_Statement *pc_prev;      /* previous idle statement in the prepared cache */
+    struct OCI_Statement *pc_next;      /* next idle statement in the prepared cache */
+    struct OCI_Statement *pc_chain;     /* next idle statement in the same hash bucket */
+    unsigned int      pc_hash;          /* SQL text hash value for the prepared cache */
+    boolean           pc_idle;          /* statement is idle in the prepared cache ? */
+    otext            *pc_sign;          /* bind signature of the idle statement */
+    ub1               async_op;         /* pending non blocking operation */
+    ub1               async_status;     /* status of the last non blocking call */
+    ub4               async_mode;       /* execution mode of the pending non blocking call */
+    ub4               async_iters;      /* iterations of the pending non blocking execute */
+    OCI_Resultset    *async_rs;         /* resultset of the pending non blocking fetch */
+    boolean           async_result;     /* result of the last completed non blocking call */
+    big_uint          async_start;      /* profiling start time of the pending non blocking call */
+    ub1              *fmt_values;       /* storage of the values bound by formatted calls */
+    struct OCI_ProfileEntry *prof;      /* profiler entry of the current SQL text */
 };
 
 /*
@@ -495,6 +683,27 @@ struct OCI_Lob
     big_uint        offset;         /* current offset for R/W */
 };
 
+/*
+ * Lob streaming context
+ *
+ */
+
+typedef struct OCI_LobStream
+{
+    OCI_Lob        *lob;            /* streamed lob */
+    POCI_LOB_SINK   sink;           /* user sink for reads */
+    POCI_LOB_SOURCE source;         /* user source for writes */
+    void           *ctx;            /* user context */
+    ub1            *buffer;         /* piece buffers */
+    unsigned int    piece;          /* size of a piece sent to or received from OCI */
+    unsigned int    stride;         /* size allocated for each piece buffer */
+    unsigned int    index;          /* index of the piece buffer filled in advance */
+    unsigned int    pending;        /* size of the piece filled in advance */
+    big_uint        bytes;          /* number of bytes streamed */
+    big_uint        chars;          /* number of characters streamed */
+    boolean         stopped;        /* stream stopped by the user sink */
+} OCI_LobStream;
+
 /*
  * External Large object
  *
@@ -720,10 +929,60 @@ struct OCI_DirPathColumn
     ub1   *data;                  /* array of data */
     ub1   *flags;                 /* array of row flags */
     ub2    maxsize;               /* input max size */
+    ub1   *ext_data;              /* caller column vector used in place (zero copy) */
+    ub4   *ext_lens;              /* caller column vector lengths */
+    ub1   *ext_nulls;             /* caller column vector null bitmap */
+    ub4    ext_size;              /* size of a caller column vector element */
+    sb4   *ext_offs;              /* caller column vector offsets of variable size elements */
+    ub4    ext_bit;               /* bit of the first element in the caller null bitmap */
+    ub1    ext_valid;             /* caller bitmap marks valid elements instead of null ones */
+    otext *cvt_text;              /* values to convert on client side, as set by the caller */
+    ub1   *cvt_state;             /* client side conversion status of each row */
+    ub1    cvt_client;            /* are values converted on client side by DirPathConvert() ? */
 };
 
 typedef struct OCI_DirPathColumn OCI_DirPathColumn;
 
+/*
+ * Direct path stream slot used by pipelined loads
+ *
+ */
+
+struct OCI_DirPathSlot
+{
+    OCI_DirPath      *dp;           /* pointer to direct path object */
+    OCIDirPathStream *strm;         /* OCI DP stream handle */
+    OCIError        **errs;         /* OCI error handles used by the loading thread, one per error */
+    OCI_Thread       *thread;       /* thread loading the stream, NULL when idle */
+    ub4              *err_rows;     /* array of rows rejected by the load */
+    ub4               nb_err;       /* number of rows rejected by the load */
+    ub4               nb_loaded;    /* number of rows loaded from the stream */
+    unsigned int      res_load;     /* status of the load */
+    boolean           pending;      /* results of the load not reported yet ? */
+    big_uint          bytes;        /* size of the stream */
+    big_uint          elapsed;      /* duration of the load */
+};
+
+typedef struct OCI_DirPathSlot OCI_DirPathSlot;
+
+/*
+ * Direct path client side conversion task
+ *
+ */
+
+struct OCI_DirPathTask
+{
+    OCI_DirPath     *dp;          /* pointer to direct path object */
+    OCI_Thread      *thread;      /* worker thread running the task, NULL for the calling thread */
+    OCI_ThreadEvent *start;       /* event waking up the worker for a new range */
+    OCI_ThreadEvent *done;        /* event set by the worker once the range is converted */
+    boolean          stop;        /* request for the worker to end */
+    ub4              row_from;    /* first row to convert */
+    ub4              row_to;      /* row following the last row to convert */
+};
+
+typedef struct OCI_DirPathTask OCI_DirPathTask;
+
 /*
  * Oracle Direct Path column object
  *
@@ -753,6 +1012,129 @@ struct OCI_DirPath
     unsigned int        res_load;       /* status of the last load */
     ub4                *err_rows;       /* array of err rows index */
     ub2                *err_cols;       /* array of err col index */
+    OCI_DirPathSlot     slots[OCI_DIRPATH_SLOTS]; /* streams used in pipelined mode */
+    ub2                 idx_slot;       /* index of the slot currently filled */
+    boolean             pipelined;      /* are loads performed in background ? */
+    ub4                 nb_rejected;    /* number of records rejected by the last file load */
+    ub4                 nb_threads;     /* number of threads converting values on client side */
+    OCI_DirPathTask    *tasks;          /* client side conversion tasks */
+    OCI_DirPathStats    stats;          /* throughput and timing statistics */
+    big_uint            fill_start;     /* time the current batch started to be set, 0 if converted */
+    POCI_DIRPATH_PROGRESS progress;     /* progress callback */
+    void               *progress_ctx;   /* progress callback user context */
+    big_uint            progress_step;  /* minimum delay between progress calls in nanoseconds */
+    big_uint            progress_last;  /* time of the last progress call */
+};
+
+/*
+ * OCI_DirPathFile : Internal delimited file load context
+ *
+ */
+
+struct OCI_DirPathFile
+{
+    OCI_DirPath *dp;          /* direct path handle */
+    FILE        *bad;         /* file receiving rejected records */
+    FILE        *log;         /* file receiving rejection reasons */
+    char         delim;       /* fields delimiter */
+    char         quote;       /* fields enclosing character */
+    char        *buf;         /* read buffer */
+    size_t       buf_size;    /* read buffer size */
+    char       **recs;        /* records of the current batch */
+    ub4         *lens;        /* sizes of the records of the current batch */
+    ub4         *nums;        /* numbers of the records of the current batch */
+    ub4          nb_recs;     /* number of records of the current batch */
+    ub4         *arr_recs;    /* batch record set for each column array row */
+    ub1         *rejected;    /* column array rows rejected by the conversion */
+    ub1         *dropped;     /* batch records rejected before the conversion */
+    ub2         *map;         /* column index for each field (0 when ignored) */
+    ub4          nb_map;      /* number of mapped fields */
+    ub4          map_size;    /* number of allocated mapped fields */
+    ub1         *set;         /* columns set for the current record */
+    char        *field;       /* unquoted field buffer */
+    ub4          field_size;  /* unquoted field buffer size */
+    otext       *value;       /* field value converted to otext */
+    ub4          value_size;  /* field value buffer size */
+};
+
+typedef struct OCI_DirPathFile OCI_DirPathFile;
+
+/*
+ * OCI_BatcherColumn : Internal batcher column object
+ *
+ */
+
+struct OCI_BatcherColumn
+{
+    unsigned int type;     /* OCILIB datatype */
+    unsigned int subtype;  /* OCILIB numeric subtype */
+    unsigned int len;      /* maximum length for strings */
+    size_t       size;     /* size of an array element */
+    void        *data;     /* array of values */
+    OCI_Bind    *bnd;      /* array bind */
+    boolean      set;      /* value provided for the current row ? */
+};
+
+typedef struct OCI_BatcherColumn OCI_BatcherColumn;
+
+/*
+ * Array DML batcher object
+ *
+ */
+
+struct OCI_Batcher
+{
+    OCI_Connection     *con;        /* pointer to connection object */
+    OCI_Statement      *stmt;       /* DML statement */
+    OCI_BatcherColumn  *cols;       /* array of column info */
+    POCI_BATCHER_ERROR  handler;    /* rejected rows callback */
+    ub2                 nb_cols;    /* number of columns */
+    ub4                 max_rows;   /* maximum number of buffered rows */
+    size_t              max_bytes;  /* maximum number of buffered bytes (0 for no limit) */
+    unsigned int        max_delay;  /* maximum buffering delay in seconds (0 for no limit) */
+    ub4                 nb_rows;    /* number of buffered rows */
+    size_t              nb_bytes;   /* number of buffered bytes */
+    time_t              started;    /* time of the first buffered row */
+    ub4                 nb_sent;    /* number of rows sent so far */
+    ub4                 nb_errors;  /* number of rows rejected so far */
+};
+
+/*
+ * OCI_DirPathWorker : Internal parallel direct path loader context
+ *
+ */
+
+struct OCI_DirPathWorker
+{
+    OCI_DirPathLoader *ldr;      /* parent loader */
+    OCI_DirPath       *dp;       /* direct path context of the worker */
+    OCI_Thread        *thread;   /* thread loading the current batch */
+    ub1               *data;     /* buffered rows values */
+    ub4               *lens;     /* buffered values sizes */
+    ub1               *nulls;    /* buffered values null flags */
+    ub4                nb_rows;  /* number of buffered rows */
+    ub4                nb_err;   /* number of rows rejected so far */
+    boolean            failed;   /* has a batch failed ? */
+};
+
+typedef struct OCI_DirPathWorker OCI_DirPathWorker;
+
+/*
+ * Parallel direct path loader object
+ *
+ */
+
+struct OCI_DirPathLoader
+{
+    OCI_Connection     *con;         /* connection of the first context */
+    OCI_DirPathWorker  *workers;     /* array of contexts */
+    ub4                 nb_workers;  /* number of contexts */
+    ub4                 idx_worker;  /* context receiving rows */
+    ub2                 nb_cols;     /* number of columns */
+    ub4                 nb_rows;     /* number of rows of a batch */
+    ub4                *offsets;     /* offset of the columns in a buffered row */
+    ub4                 row_size;    /* size of a buffered row */
+    ub1                 status;      /* loader status (OCI_DPS_XXX) */
 };
 
 /*
@@ -155,3 +155,573 @@ TEST(TestArray, InsertInternalArray)
 
     ExecDML(OTEXT("drop table TestInternalArrayInsertArray"));
 }
+
+static unsigned int BatcherRejectedRow = 0;
+
+static void BatcherErrorHandler(OCI_Batcher *, OCI_Error *, unsigned int row)
+{
+    BatcherRejectedRow = row;
+}
+
+TEST(TestArray, InsertBatcher)
+{
+    ExecDML(OTEXT("create table TestArrayInsertBatcher(code int NOT NULL, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestArrayInsertBatcher"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto bat = OCI_BatcherCreate(conn, OTEXT("insert into TestArrayInsertBatcher values(:i, :s)"), 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, bat);
+
+    ASSERT_TRUE(OCI_BatcherSetColumn(bat, 1, OTEXT(":i"), OCI_CDT_NUMERIC, OCI_NUM_INT, 0));
+    ASSERT_TRUE(OCI_BatcherSetColumn(bat, 2, OTEXT(":s"), OCI_CDT_TEXT, 0, STRING_SIZE));
+    ASSERT_TRUE(OCI_BatcherSetErrorHandler(bat, BatcherErrorHandler));
+
+    otext name[STRING_SIZE + 1];
+
+    for (int i = 0; i < ARRAY_SIZE - 1; i++)
+    {
+        osprintf(name, STRING_SIZE, OTEXT("Name %d"), i + 1);
+
+        if (i != 2)
+        {
+            ASSERT_TRUE(OCI_BatcherSetInt(bat, 1, i + 1));
+        }
+
+        ASSERT_TRUE(OCI_BatcherSetString(bat, 2, name));
+        ASSERT_EQ(OCI_BRS_BUFFERED, OCI_BatcherAddRow(bat));
+    }
+
+    ASSERT_EQ(ARRAY_SIZE - 1, OCI_BatcherGetPendingRows(bat));
+
+    // Row 3 has a null code and must be rejected
+    ASSERT_FALSE(OCI_BatcherFlush(bat));
+    ASSERT_EQ(3, BatcherRejectedRow);
+    ASSERT_EQ(1, OCI_BatcherGetErrorCount(bat));
+    ASSERT_EQ(ARRAY_SIZE - 1, OCI_BatcherGetProcessedRows(bat));
+    ASSERT_EQ(0, OCI_BatcherGetPendingRows(bat));
+
+    ASSERT_TRUE(OCI_BatcherFree(bat));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertBatcher"));
+}
+
+TEST(TestArray, InsertBatcherAutoFlush)
+{
+    ExecDML(OTEXT("create table TestArrayInsertBatcherAutoFlush(code int NOT NULL)"));
+    ExecDML(OTEXT("truncate table TestArrayInsertBatcherAutoFlush"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto bat = OCI_BatcherCreate(conn, OTEXT("insert into TestArrayInsertBatcherAutoFlush values(:i)"), 1, 2);
+    ASSERT_NE(nullptr, bat);
+
+    ASSERT_TRUE(OCI_BatcherSetColumn(bat, 1, OTEXT(":i"), OCI_CDT_NUMERIC, OCI_NUM_INT, 0));
+
+    // Reaching the maximum number of rows sends them
+    ASSERT_TRUE(OCI_BatcherSetInt(bat, 1, 1));
+    ASSERT_EQ(OCI_BRS_BUFFERED, OCI_BatcherAddRow(bat));
+    ASSERT_TRUE(OCI_BatcherSetInt(bat, 1, 2));
+    ASSERT_EQ(OCI_BRS_FLUSHED, OCI_BatcherAddRow(bat));
+    ASSERT_EQ(0, OCI_BatcherGetPendingRows(bat));
+
+    // A rejected row is reported by the status while the row itself is appended
+    ASSERT_EQ(OCI_BRS_BUFFERED, OCI_BatcherAddRow(bat));
+    ASSERT_TRUE(OCI_BatcherSetInt(bat, 1, 4));
+    ASSERT_EQ(OCI_BRS_REJECTED, OCI_BatcherAddRow(bat));
+    ASSERT_EQ(1, OCI_BatcherGetErrorCount(bat));
+    ASSERT_EQ(4, OCI_BatcherGetProcessedRows(bat));
+
+    // Idle rows are sent once the maximum delay is elapsed
+    ASSERT_TRUE(OCI_BatcherSetFlushLimits(bat, 0, 1));
+    ASSERT_TRUE(OCI_BatcherSetInt(bat, 1, 5));
+    ASSERT_EQ(OCI_BRS_BUFFERED, OCI_BatcherAddRow(bat));
+    ASSERT_TRUE(OCI_BatcherCheckDelay(bat));
+    ASSERT_EQ(1, OCI_BatcherGetPendingRows(bat));
+
+    Sleep(2000);
+
+    ASSERT_TRUE(OCI_BatcherCheckDelay(bat));
+    ASSERT_EQ(0, OCI_BatcherGetPendingRows(bat));
+    ASSERT_EQ(5, OCI_BatcherGetProcessedRows(bat));
+
+    ASSERT_TRUE(OCI_BatcherFree(bat));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertBatcherAutoFlush"));
+}
+
+TEST(TestArray, InsertBatcherSingleRow)
+{
+    ExecDML(OTEXT("create table TestArrayInsertBatcherSingleRow(code number(10) NOT NULL)"));
+    ExecDML(OTEXT("truncate table TestArrayInsertBatcherSingleRow"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_CONTEXT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto bat = OCI_BatcherCreate(conn, OTEXT("insert into TestArrayInsertBatcherSingleRow values(:i)"), 1, 1);
+    ASSERT_NE(nullptr, bat);
+
+    ASSERT_TRUE(OCI_BatcherSetColumn(bat, 1, OTEXT(":i"), OCI_CDT_NUMERIC, OCI_NUM_INT, 0));
+    ASSERT_TRUE(OCI_BatcherSetErrorHandler(bat, BatcherErrorHandler));
+
+    // Values that do not fit in an int column are rejected
+    ASSERT_FALSE(OCI_BatcherSetBigInt(bat, 1, static_cast<big_int>(INT_MAX) + 1));
+    ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+    ASSERT_FALSE(OCI_BatcherSetBigInt(bat, 1, static_cast<big_int>(INT_MIN) - 1));
+    ASSERT_EQ(OCI_ERR_MIN_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    ASSERT_TRUE(OCI_BatcherSetBigInt(bat, 1, 1));
+    ASSERT_EQ(OCI_BRS_FLUSHED, OCI_BatcherAddRow(bat));
+
+    // A rejected single row flush is reported and the row is discarded
+    BatcherRejectedRow = 0;
+
+    ASSERT_EQ(OCI_BRS_REJECTED, OCI_BatcherAddRow(bat));
+    ASSERT_EQ(2, BatcherRejectedRow);
+    ASSERT_EQ(1, OCI_BatcherGetErrorCount(bat));
+    ASSERT_EQ(0, OCI_BatcherGetPendingRows(bat));
+
+    ASSERT_TRUE(OCI_BatcherSetInt(bat, 1, 3));
+    ASSERT_EQ(OCI_BRS_FLUSHED, OCI_BatcherAddRow(bat));
+    ASSERT_EQ(3, OCI_BatcherGetProcessedRows(bat));
+
+    ASSERT_TRUE(OCI_BatcherFree(bat));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertBatcherSingleRow"));
+}
+
+static int StreamCodes[ARRAY_SIZE];
+
+static boolean StreamCodeProducer(OCI_Bind *, unsigned int iter, void **data, unsigned int *, void *)
+{
+    StreamCodes[iter - 1] = static_cast<int>(iter) * 10;
+
+    *data = &StreamCodes[iter - 1];
+
+    return TRUE;
+}
+
+static boolean StreamNameProducer(OCI_Bind *, unsigned int iter, void **data, unsigned int *size, void *ctx)
+{
+    const auto name = static_cast<otext*>(ctx);
+
+    osprintf(name, STRING_SIZE, OTEXT("Name %d"), iter);
+
+    *data = iter == 2 ? nullptr : name;
+    *size = 0;
+
+    return TRUE;
+}
+
+TEST(TestArray, InsertStreamBinds)
+{
+    ExecDML(OTEXT("create table TestArrayInsertStream(code int, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestArrayInsertStream"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    otext name[STRING_SIZE + 1];
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestArrayInsertStream values(:i, :s)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_BindStream(stmt, OTEXT(":i"), OCI_CDT_NUMERIC, OCI_NUM_INT, 0, StreamCodeProducer, nullptr));
+    ASSERT_TRUE(OCI_BindStream(stmt, OTEXT(":s"), OCI_CDT_TEXT, 0, STRING_SIZE, StreamNameProducer, name));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(ARRAY_SIZE, OCI_GetAffectedRows(stmt));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), count(name), sum(code) from TestArrayInsertStream")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ARRAY_SIZE, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(ARRAY_SIZE - 1, OCI_GetInt(rslt, 2));
+    ASSERT_EQ(5 * ARRAY_SIZE * (ARRAY_SIZE + 1), OCI_GetInt(rslt, 3));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertStream"));
+}
+
+static boolean StreamFailingProducer(OCI_Bind *, unsigned int iter, void **data, unsigned int *, void *)
+{
+    StreamCodes[iter - 1] = static_cast<int>(iter);
+
+    *data = &StreamCodes[iter - 1];
+
+    return iter < 3;
+}
+
+TEST(TestArray, InsertStreamBindsProducerFailure)
+{
+    ExecDML(OTEXT("create table TestArrayInsertStreamFailure(code int)"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_CONTEXT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestArrayInsertStreamFailure values(:i)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_BindStream(stmt, OTEXT(":i"), OCI_CDT_NUMERIC, OCI_NUM_INT, 0, StreamFailingProducer, nullptr));
+
+    // Streaming binds do not hold per position values
+    const auto bnd = OCI_GetBind(stmt, 1);
+    ASSERT_NE(nullptr, bnd);
+    ASSERT_FALSE(OCI_BindSetNullAtPos(bnd, 1));
+    ASSERT_EQ(OCI_ERR_NOT_COMPATIBLE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    ASSERT_FALSE(OCI_Execute(stmt));
+
+    const auto err = OCI_GetLastError();
+    ASSERT_NE(nullptr, err);
+    ASSERT_EQ(OCI_ERR_BIND_PRODUCER, OCI_ErrorGetInternalCode(err));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertStreamFailure"));
+}
+
+TEST(TestArray, InsertDirtyTracking)
+{
+    ExecDML(OTEXT("create table TestArrayInsertDirty(code int, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestArrayInsertDirty"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int codes[ARRAY_SIZE];
+    otext names[ARRAY_SIZE][STRING_SIZE + 1];
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+        ostrcpy(names[i], OTEXT("name"));
+    }
+
+    ASSERT_FALSE(OCI_GetBindDirtyTracking(stmt));
+    ASSERT_TRUE(OCI_SetBindDirtyTracking(stmt, TRUE));
+    ASSERT_TRUE(OCI_GetBindDirtyTracking(stmt));
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestArrayInsertDirty values(:i, :s)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":i"), codes, 0));
+    ASSERT_TRUE(OCI_BindArrayOfStrings(stmt, OTEXT(":s"), reinterpret_cast<otext*>(names), STRING_SIZE, 0));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    ostrcpy(names[1], OTEXT("changed"));
+    ASSERT_TRUE(OCI_BindSetDirtyAtPos(OCI_GetBind2(stmt, OTEXT(":s")), 2));
+    ASSERT_TRUE(OCI_BindSetNullAtPos(OCI_GetBind2(stmt, OTEXT(":s")), 3));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), count(name), count(distinct name) from TestArrayInsertDirty")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(2 * ARRAY_SIZE, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(2 * ARRAY_SIZE - 1, OCI_GetInt(rslt, 2));
+    ASSERT_EQ(2, OCI_GetInt(rslt, 3));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertDirty"));
+}
+
+TEST(TestArray, InsertBulkIndicators)
+{
+    ExecDML(OTEXT("create table TestArrayInsertInds(code int, name varchar2(50))"));
+    ExecDML(OTEXT("truncate table TestArrayInsertInds"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int codes[ARRAY_SIZE];
+    otext names[ARRAY_SIZE][STRING_SIZE + 1];
+    short inds[ARRAY_SIZE];
+    unsigned char bitmap[(ARRAY_SIZE + 7) / 8] = {};
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+        inds[i] = i % 2 ? -1 : 0;
+        ostrcpy(names[i], OTEXT("name"));
+    }
+
+    bitmap[0] = 0x01;
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestArrayInsertInds values(:i, :s)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":i"), codes, 0));
+    ASSERT_TRUE(OCI_BindArrayOfStrings(stmt, OTEXT(":s"), reinterpret_cast<otext*>(names), STRING_SIZE, 0));
+
+    const auto bindCode = OCI_GetBind2(stmt, OTEXT(":i"));
+    const auto bindName = OCI_GetBind2(stmt, OTEXT(":s"));
+
+    ASSERT_TRUE(OCI_BindSetNullBitmap(bindCode, bitmap, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_BindIsNullAtPos(bindCode, 1));
+    ASSERT_FALSE(OCI_BindIsNullAtPos(bindCode, 2));
+
+    ASSERT_TRUE(OCI_BindSetIndicators(bindName, inds, ARRAY_SIZE));
+    ASSERT_FALSE(OCI_BindIsNullAtPos(bindName, 1));
+    ASSERT_TRUE(OCI_BindIsNullAtPos(bindName, 2));
+
+    short copy[ARRAY_SIZE];
+    ASSERT_TRUE(OCI_BindGetIndicators(bindName, copy, ARRAY_SIZE));
+    ASSERT_EQ(-1, copy[1]);
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        inds[i] = 0;
+    }
+
+    ASSERT_TRUE(OCI_BindSetIndicatorArray(bindCode, inds));
+    inds[0] = -1;
+    inds[1] = -1;
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), count(code), count(name) from TestArrayInsertInds")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(2 * ARRAY_SIZE, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(2 * ARRAY_SIZE - 3, OCI_GetInt(rslt, 2));
+    ASSERT_EQ(2 * (ARRAY_SIZE - ARRAY_SIZE / 2), OCI_GetInt(rslt, 3));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertInds"));
+}
+
+TEST(TestArray, InsertBulkDataSizes)
+{
+    ExecDML(OTEXT("create table TestArrayInsertSizes(code int, data raw(20))"));
+    ExecDML(OTEXT("truncate table TestArrayInsertSizes"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int codes[ARRAY_SIZE];
+    unsigned char raws[ARRAY_SIZE][STRING_SIZE];
+    unsigned int sizes[ARRAY_SIZE];
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+        sizes[i] = i;
+        memset(raws[i], 'A' + i, STRING_SIZE);
+    }
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestArrayInsertSizes values(:i, :r)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":i"), codes, 0));
+    ASSERT_TRUE(OCI_BindArrayOfRaws(stmt, OTEXT(":r"), raws, STRING_SIZE, 0));
+
+    const auto bind = OCI_GetBind2(stmt, OTEXT(":r"));
+
+    ASSERT_FALSE(OCI_BindSetDataSizes(bind, sizes, ARRAY_SIZE + 1));
+    ASSERT_TRUE(OCI_BindSetDataSizes(bind, sizes, ARRAY_SIZE));
+
+    unsigned int copy[ARRAY_SIZE] = {};
+    ASSERT_TRUE(OCI_BindGetDataSizes(bind, copy, ARRAY_SIZE));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        ASSERT_EQ(sizes[i], copy[i]);
+    }
+
+    ASSERT_EQ(3u, OCI_BindGetDataSizeAtPos(bind, 4));
+
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(ARRAY_SIZE, OCI_GetAffectedRows(stmt));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(data), sum(utl_raw.length(data)) from TestArrayInsertSizes")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ARRAY_SIZE - 1, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(ARRAY_SIZE * (ARRAY_SIZE - 1) / 2, OCI_GetInt(rslt, 2));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertSizes"));
+}
+
+TEST(TestArray, InsertEpochs)
+{
+    ExecDML(OTEXT("create table TestArrayInsertEpochs(code int, value_date date, value_tmsp timestamp)"));
+    ExecDML(OTEXT("truncate table TestArrayInsertEpochs"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int codes[ARRAY_SIZE];
+    big_int dates[ARRAY_SIZE];
+    big_int tmsps[ARRAY_SIZE];
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+        dates[i] = 1700000000LL + i * 86400;
+        tmsps[i] = dates[i] * 1000000 + 123456;
+    }
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestArrayInsertEpochs values(:i, :d, :t)")));
+    ASSERT_TRUE(OCI_BindArraySetSize(stmt, ARRAY_SIZE));
+    ASSERT_TRUE(OCI_BindArrayOfInts(stmt, OTEXT(":i"), codes, 0));
+    ASSERT_TRUE(OCI_BindArrayOfEpochs(stmt, OTEXT(":d"), dates, OCI_DTM_EPOCH, 0));
+    ASSERT_TRUE(OCI_BindArrayOfEpochs(stmt, OTEXT(":t"), tmsps, OCI_DTM_EPOCH_MICRO, 0));
+    ASSERT_EQ(OCI_DTM_EPOCH_MICRO, OCI_BindGetSubtype(OCI_GetBind2(stmt, OTEXT(":t"))));
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(ARRAY_SIZE, OCI_GetAffectedRows(stmt));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select value_date, value_tmsp from TestArrayInsertEpochs order by code")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+
+    ASSERT_EQ(1700000000LL, OCI_GetEpoch(rslt, 1, OCI_DTM_EPOCH));
+    ASSERT_EQ(1700000000123456LL, OCI_GetEpoch(rslt, 2, OCI_DTM_EPOCH_MICRO));
+
+    struct tm value;
+    ASSERT_TRUE(OCI_GetTm(rslt, 1, &value));
+    ASSERT_EQ(123, value.tm_year);
+    ASSERT_EQ(10, value.tm_mon);
+    ASSERT_EQ(14, value.tm_mday);
+    ASSERT_EQ(22, value.tm_hour);
+    ASSERT_EQ(13, value.tm_min);
+    ASSERT_EQ(20, value.tm_sec);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertEpochs"));
+}
+
+TEST(TestArray, InsertArrowBatch)
+{
+    ExecDML(OTEXT("create table TestArrayInsertArrow(code int, name varchar2(20), created timestamp)"));
+    ExecDML(OTEXT("truncate table TestArrayInsertArrow"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    int codes[ARRAY_SIZE];
+    int64_t created[ARRAY_SIZE];
+    int32_t offsets[ARRAY_SIZE + 1];
+    char names[ARRAY_SIZE * 8];
+    unsigned char valid[2] = { 0xFD, 0xFF };
+
+    offsets[0] = 0;
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+        created[i] = (1700000000LL + i) * 1000000 + 123456;
+        offsets[i + 1] = offsets[i] + sprintf(names + offsets[i], "name%d", i + 1);
+    }
+
+    const void* code_buffers[] = { nullptr, codes };
+    const void* name_buffers[] = { valid, offsets, names };
+    const void* created_buffers[] = { nullptr, created };
+    const void* batch_buffers[] = { nullptr };
+
+    ArrowSchema code_schema = { "i", "code", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema name_schema = { "u", "name", nullptr, ARROW_FLAG_NULLABLE, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema created_schema = { "tsu:", "created", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema* schema_children[] = { &code_schema, &name_schema, &created_schema };
+    ArrowSchema schema = { "+s", "", nullptr, 0, 3, schema_children, nullptr, nullptr, nullptr };
+
+    ArrowArray code_array = { ARRAY_SIZE, 0, 0, 2, 0, code_buffers, nullptr, nullptr, nullptr, nullptr };
+    ArrowArray name_array = { ARRAY_SIZE, 1, 0, 3, 0, name_buffers, nullptr, nullptr, nullptr, nullptr };
+    ArrowArray created_array = { ARRAY_SIZE, 0, 0, 2, 0, created_buffers, nullptr, nullptr, nullptr, nullptr };
+    ArrowArray* array_children[] = { &code_array, &name_array, &created_array };
+    ArrowArray array = { ARRAY_SIZE, 0, 0, 1, 3, batch_buffers, array_children, nullptr,
+                         [](ArrowArray* arr) { arr->release = nullptr; }, nullptr };
+
+    /* the batch is bound in place whatever the bind allocation mode */
+
+    ASSERT_TRUE(OCI_SetBindAllocation(stmt, OCI_BAM_INTERNAL));
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("insert into TestArrayInsertArrow values(:code, :name, :created)")));
+    ASSERT_TRUE(OCI_BindArrowBatch(stmt, &schema, &array));
+    ASSERT_EQ(ARRAY_SIZE, OCI_BindArrayGetSize(stmt));
+    ASSERT_EQ(OCI_BAM_INTERNAL, OCI_GetBindAllocation(stmt));
+    ASSERT_TRUE(OCI_Execute(stmt));
+    ASSERT_EQ(ARRAY_SIZE, OCI_GetAffectedRows(stmt));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select code, name, created from TestArrayInsertArrow order by code")));
+    const auto rslt = OCI_GetResultset(stmt);
+
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(1, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(ostring(OTEXT("name1")), OCI_GetString(rslt, 2));
+    ASSERT_EQ(1700000000123456LL, OCI_GetEpoch(rslt, 3, OCI_DTM_EPOCH_MICRO));
+
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(2, OCI_GetInt(rslt, 1));
+    ASSERT_TRUE(OCI_IsNull(rslt, 2));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestArrayInsertArrow"));
+}
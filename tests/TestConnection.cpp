@@ -92,4 +92,593 @@ TEST(TestConnection, Abort)
     ASSERT_TRUE(OCI_StatementFree(stmt));
     ASSERT_TRUE(OCI_ConnectionFree(conn));
     ASSERT_TRUE(OCI_Cleanup());
-}
\ No newline at end of file
+}
+
+TEST(TestConnection, ServerCalls)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    const auto calls = OCI_GetServerCalls(conn);
+    ASSERT_LT(0, calls);
+
+    ASSERT_TRUE(OCI_Ping(conn));
+    ASSERT_EQ(calls + 1, OCI_GetServerCalls(conn));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select 1 from dual")));
+    ASSERT_EQ(calls + 2, OCI_GetServerCalls(conn));
+
+    ASSERT_TRUE(OCI_Commit(conn));
+    ASSERT_EQ(calls + 3, OCI_GetServerCalls(conn));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+static int SelectCount(OCI_Connection *conn, const otext *sql)
+{
+    int count = 0;
+
+    const auto stmt = OCI_StatementCreate(conn);
+    OCI_ExecuteStmt(stmt, sql);
+
+    const auto rslt = OCI_GetResultset(stmt);
+
+    while (OCI_FetchNext(rslt))
+    {
+        count++;
+    }
+
+    OCI_StatementFree(stmt);
+
+    return count;
+}
+
+static void ResultCacheNotify(OCI_Event *)
+{
+}
+
+TEST(TestConnection, ResultCache)
+{
+    ExecDML(OTEXT("create table TestResultCache(code int)"));
+    ExecDML(OTEXT("insert into TestResultCache values(1)"));
+    ExecDML(OTEXT("insert into TestResultCache values(2)"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_TRUE(OCI_SetResultCache(conn, 10, 0, 0));
+
+    ASSERT_EQ(2, SelectCount(conn, OTEXT("select code from TestResultCache")));
+    ASSERT_EQ(2, SelectCount(conn, OTEXT("select code from TestResultCache")));
+
+    ASSERT_EQ(1, OCI_GetResultCacheHits(conn));
+    ASSERT_EQ(1, OCI_GetResultCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_ClearResultCache(conn));
+
+    ASSERT_EQ(2, SelectCount(conn, OTEXT("select code from TestResultCache")));
+    ASSERT_EQ(2, OCI_GetResultCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_SetResultCache(conn, 0, 0, 0));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestResultCache"));
+}
+
+TEST(TestConnection, ResultCacheInvalidation)
+{
+    ExecDML(OTEXT("create table TestResultCacheModified(code int)"));
+    ExecDML(OTEXT("create table TestResultCacheUnchanged(code int)"));
+    ExecDML(OTEXT("create view TestResultCacheView as select code from TestResultCacheModified"));
+    ExecDML(OTEXT("insert into TestResultCacheModified values(1)"));
+    ExecDML(OTEXT("insert into TestResultCacheUnchanged values(1)"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_THREADED | OCI_ENV_EVENTS));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto sub = OCI_SubscriptionRegister(conn, OTEXT("TestResultCacheInvalidation"), OCI_CNT_OBJECTS, ResultCacheNotify, 0, 0);
+    ASSERT_NE(nullptr, sub);
+
+    ASSERT_TRUE(OCI_SetResultCache(conn, 10, 0, 0));
+    ASSERT_TRUE(OCI_SetResultCacheSubscription(conn, sub));
+
+    ASSERT_EQ(1, SelectCount(conn, OTEXT("select code from TestResultCacheModified")));
+    ASSERT_EQ(1, SelectCount(conn, OTEXT("select code from TestResultCacheUnchanged")));
+    ASSERT_EQ(1, SelectCount(conn, OTEXT("select code from TestResultCacheView")));
+    ASSERT_EQ(3, OCI_GetResultCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_Immediate(conn, OTEXT("insert into TestResultCacheModified values(2)")));
+    ASSERT_TRUE(OCI_Commit(conn));
+
+    Sleep(2000);
+
+    /* only the queries depending on the modified table are invalidated */
+
+    ASSERT_EQ(1, SelectCount(conn, OTEXT("select code from TestResultCacheUnchanged")));
+    ASSERT_EQ(1, OCI_GetResultCacheHits(conn));
+
+    ASSERT_EQ(2, SelectCount(conn, OTEXT("select code from TestResultCacheModified")));
+    ASSERT_EQ(2, SelectCount(conn, OTEXT("select code from TestResultCacheView")));
+    ASSERT_EQ(5, OCI_GetResultCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_SetResultCacheSubscription(conn, nullptr));
+    ASSERT_TRUE(OCI_SubscriptionUnregister(sub));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop view TestResultCacheView"));
+    ExecDML(OTEXT("drop table TestResultCacheModified"));
+    ExecDML(OTEXT("drop table TestResultCacheUnchanged"));
+}
+
+TEST(TestConnection, PreparedStatementCache)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 2));
+    ASSERT_EQ(2, OCI_GetPreparedCacheSize(conn));
+
+    int value = 0;
+
+    auto stmt = OCI_StatementAcquire(conn, OTEXT("select :value from dual"), OTEXT(":value %i"));
+    ASSERT_NE(nullptr, stmt);
+    ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":value"), &value));
+    ASSERT_TRUE(OCI_StatementRelease(stmt));
+
+    const auto cached = OCI_StatementAcquire(conn, OTEXT("select :value from dual"), OTEXT(":value %i"));
+    ASSERT_EQ(stmt, cached);
+    ASSERT_EQ(1, OCI_GetBindCount(cached));
+
+    value = 42;
+
+    ASSERT_TRUE(OCI_Execute(cached));
+
+    const auto rslt = OCI_GetResultset(cached);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(42, OCI_GetInt(rslt, 1));
+
+    ASSERT_TRUE(OCI_StatementRelease(cached));
+
+    ASSERT_EQ(1, OCI_GetPreparedCacheHits(conn));
+    ASSERT_EQ(1, OCI_GetPreparedCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, PreparedStatementCacheLookup)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 32));
+
+    OCI_Statement* stmts[32];
+
+    for (int i = 0; i < 32; i++)
+    {
+        const ostring sql = OTEXT("select ") + TO_STRING(i) + OTEXT(" from dual");
+
+        stmts[i] = OCI_StatementAcquire(conn, sql.data(), nullptr);
+        ASSERT_NE(nullptr, stmts[i]);
+    }
+
+    for (int i = 0; i < 32; i++)
+    {
+        ASSERT_TRUE(OCI_StatementRelease(stmts[i]));
+    }
+
+    for (int i = 31; i >= 0; i--)
+    {
+        const ostring sql = OTEXT("select ") + TO_STRING(i) + OTEXT(" from dual");
+
+        ASSERT_EQ(stmts[i], OCI_StatementAcquire(conn, sql.data(), nullptr));
+        ASSERT_TRUE(OCI_StatementRelease(stmts[i]));
+    }
+
+    /* shrinking the cache frees the least recently released statements */
+
+    ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 4));
+
+    const auto stmt = OCI_StatementAcquire(conn, OTEXT("select 0 from dual"), nullptr);
+    ASSERT_EQ(stmts[0], stmt);
+    ASSERT_TRUE(OCI_StatementRelease(stmt));
+
+    ASSERT_EQ(33, OCI_GetPreparedCacheHits(conn));
+    ASSERT_EQ(32, OCI_GetPreparedCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, PreparedStatementCacheBindSignature)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_TRUE(OCI_SetPreparedCacheSize(conn, 4));
+
+    int value = 0;
+
+    const auto stmt = OCI_StatementAcquire(conn, OTEXT("select :value from dual"), OTEXT(":value %i"));
+    ASSERT_NE(nullptr, stmt);
+    ASSERT_TRUE(OCI_BindInt(stmt, OTEXT(":value"), &value));
+    ASSERT_TRUE(OCI_StatementRelease(stmt));
+
+    /* another bind type or array size is a cache miss */
+
+    const auto other = OCI_StatementAcquire(conn, OTEXT("select :value from dual"), OTEXT(":value %s"));
+    ASSERT_NE(nullptr, other);
+    ASSERT_NE(stmt, other);
+    ASSERT_EQ(0, OCI_GetBindCount(other));
+    ASSERT_TRUE(OCI_StatementFree(other));
+
+    const auto array = OCI_StatementAcquire(conn, OTEXT("select :value from dual"), OTEXT("[10] :value %i"));
+    ASSERT_NE(nullptr, array);
+    ASSERT_NE(stmt, array);
+    ASSERT_TRUE(OCI_StatementFree(array));
+
+    /* the signature is normalized before the lookup */
+
+    ASSERT_EQ(stmt, OCI_StatementAcquire(conn, OTEXT("select :value from dual"), OTEXT("[1]  :VALUE   %i ")));
+    ASSERT_TRUE(OCI_StatementRelease(stmt));
+
+    ASSERT_EQ(nullptr, OCI_StatementAcquire(conn, OTEXT("select :value from dual"), OTEXT(":value")));
+
+    ASSERT_EQ(1, OCI_GetPreparedCacheHits(conn));
+    ASSERT_EQ(3, OCI_GetPreparedCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, AsyncExecuteAndFetch)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level from dual connect by level <= 3")));
+    ASSERT_TRUE(OCI_ExecuteAsync(stmt));
+
+    unsigned int status = OCI_ASYNC_PENDING;
+
+    while (OCI_ASYNC_PENDING == (status = OCI_AsyncPoll(stmt)))
+    {
+    }
+
+    ASSERT_EQ(OCI_ASYNC_DONE, status);
+    ASSERT_TRUE(OCI_AsyncGetResult(stmt));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+
+    int rows = 0;
+
+    while (true)
+    {
+        ASSERT_TRUE(OCI_FetchAsync(rslt));
+
+        while (OCI_ASYNC_PENDING == (status = OCI_AsyncPoll(stmt)))
+        {
+        }
+
+        ASSERT_EQ(OCI_ASYNC_DONE, status);
+
+        if (!OCI_AsyncGetResult(stmt))
+        {
+            break;
+        }
+
+        ASSERT_EQ(++rows, OCI_GetInt(rslt, 1));
+    }
+
+    ASSERT_EQ(3, rows);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, AsyncPendingCallGuard)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_CONTEXT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    const auto other = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, other);
+
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("begin dbms_lock.sleep(2); end;")));
+    ASSERT_TRUE(OCI_ExecuteAsync(stmt));
+    ASSERT_EQ(OCI_ASYNC_PENDING, OCI_AsyncPoll(stmt));
+
+    // Blocking calls are rejected while the non blocking call is pending
+    ASSERT_FALSE(OCI_ExecuteStmt(other, OTEXT("select 1 from dual")));
+    ASSERT_EQ(OCI_ERR_ASYNC_PENDING, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    ASSERT_FALSE(OCI_Commit(conn));
+    ASSERT_EQ(OCI_ERR_ASYNC_PENDING, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    unsigned int status = OCI_ASYNC_PENDING;
+
+    while (OCI_ASYNC_PENDING == (status = OCI_AsyncPoll(stmt)))
+    {
+    }
+
+    ASSERT_EQ(OCI_ASYNC_DONE, status);
+    ASSERT_TRUE(OCI_ExecuteStmt(other, OTEXT("select 1 from dual")));
+
+    ASSERT_TRUE(OCI_StatementFree(other));
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, AsyncProfiling)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_TRUE(OCI_SetProfiling(conn, TRUE));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, 2));
+    ASSERT_TRUE(OCI_Prepare(stmt, OTEXT("select level from dual connect by level <= 3")));
+    ASSERT_TRUE(OCI_ExecuteAsync(stmt));
+
+    while (OCI_ASYNC_PENDING == OCI_AsyncPoll(stmt))
+    {
+    }
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_NE(nullptr, rslt);
+
+    do
+    {
+        ASSERT_TRUE(OCI_FetchAsync(rslt));
+
+        while (OCI_ASYNC_PENDING == OCI_AsyncPoll(stmt))
+        {
+        }
+    }
+    while (OCI_AsyncGetResult(stmt));
+
+    ASSERT_EQ(1, OCI_GetProfileCount(conn));
+
+    OCI_ProfileInfo info;
+    ASSERT_TRUE(OCI_GetProfileInfo(conn, 1, &info));
+    ASSERT_EQ(1, info.phases[OCI_PROFILE_EXECUTE].count);
+    ASSERT_LE(2, info.phases[OCI_PROFILE_FETCH].count);
+    ASSERT_EQ(3, info.rows);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, FormatBinding)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_FALSE(OCI_GetFormatBinding(conn));
+    ASSERT_TRUE(OCI_SetFormatBinding(conn, TRUE));
+    ASSERT_TRUE(OCI_GetFormatBinding(conn));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmtFmt(stmt, OTEXT("select %i + %g, %s, nvl(%s, 'null') from %m"), 1, 2.5, OTEXT("it's"), nullptr, OTEXT("dual")));
+    ASSERT_EQ(ostring(OTEXT("select :1 + :2, :3, nvl(:4, 'null') from dual")), ostring(OCI_GetSql(stmt)));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(3.5, OCI_GetDouble(rslt, 1));
+    ASSERT_EQ(ostring(OTEXT("it's")), ostring(OCI_GetString(rslt, 2)));
+    ASSERT_EQ(ostring(OTEXT("null")), ostring(OCI_GetString(rslt, 3)));
+
+    int value = 0;
+    ASSERT_TRUE(OCI_ImmediateFmt(conn, OTEXT("select %li * 2 from dual"), (big_int) 21, OCI_ARG_INT, &value));
+    ASSERT_EQ(42, value);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, FormatBindingDdl)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_TRUE(OCI_SetFormatBinding(conn, TRUE));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmtFmt(stmt, OTEXT("create table %m(code number(%i) default %i)"), OTEXT("TestFormatBindingDdl"), 5, 7));
+    ASSERT_EQ(ostring(OTEXT("create table TestFormatBindingDdl(code number(5) default 7)")), ostring(OCI_GetSql(stmt)));
+
+    ASSERT_TRUE(OCI_ImmediateFmt(conn, OTEXT("  COMMENT on table %m is %s"), OTEXT("TestFormatBindingDdl"), OTEXT("formatted")));
+
+    ASSERT_TRUE(OCI_ExecuteStmtFmt(stmt, OTEXT("insert into %m values(%i)"), OTEXT("TestFormatBindingDdl"), 1));
+    ASSERT_EQ(ostring(OTEXT("insert into TestFormatBindingDdl values(:1)")), ostring(OCI_GetSql(stmt)));
+
+    ASSERT_TRUE(OCI_ExecuteStmtFmt(stmt, OTEXT("drop table %m"), OTEXT("TestFormatBindingDdl")));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, StatementProfiling)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_FALSE(OCI_GetProfiling(conn));
+    ASSERT_TRUE(OCI_SetProfiling(conn, TRUE));
+    ASSERT_TRUE(OCI_GetProfiling(conn));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_SetFetchSize(stmt, 2));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select level from dual connect by level <= 5")));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    while (OCI_FetchNext(rslt))
+    {
+    }
+
+    ASSERT_TRUE(OCI_SetProfiling(conn, FALSE));
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select 1 from dual")));
+
+    ASSERT_EQ(1, OCI_GetProfileCount(conn));
+
+    OCI_ProfileInfo info;
+    ASSERT_TRUE(OCI_GetProfileInfo(conn, 1, &info));
+    ASSERT_EQ(ostring(OTEXT("select level from dual connect by level <= 5")), ostring(info.sql));
+    ASSERT_EQ(1, info.phases[OCI_PROFILE_PREPARE].count);
+    ASSERT_EQ(1, info.phases[OCI_PROFILE_EXECUTE].count);
+    ASSERT_LE(3, info.phases[OCI_PROFILE_FETCH].count);
+    ASSERT_EQ(5, info.rows);
+
+    unsigned int size = 0;
+    ASSERT_TRUE(OCI_ProfilesToJson(conn, &size, nullptr));
+    ASSERT_GT(size, 0);
+
+    std::vector<otext> json(size + 1);
+    ASSERT_TRUE(OCI_ProfilesToJson(conn, &size, json.data()));
+    ASSERT_EQ(otext('{'), json[0]);
+
+    ASSERT_TRUE(OCI_ClearProfiles(conn));
+    ASSERT_EQ(0, OCI_GetProfileCount(conn));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, DescribeCache)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    ASSERT_TRUE(OCI_SetDescribeCacheSize(conn, 4));
+    ASSERT_EQ(4, OCI_GetDescribeCacheSize(conn));
+
+    for (int i = 0; i < 3; i++)
+    {
+        const auto stmt = OCI_StatementCreate(conn);
+        ASSERT_NE(nullptr, stmt);
+
+        ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select 1 as num, 'abc' as str from dual")));
+
+        const auto rslt = OCI_GetResultset(stmt);
+        ASSERT_EQ(2, OCI_GetColumnCount(rslt));
+        ASSERT_EQ(ostring(OTEXT("STR")), ostring(OCI_ColumnGetName(OCI_GetColumn(rslt, 2))));
+        ASSERT_TRUE(OCI_FetchNext(rslt));
+        ASSERT_EQ(1, OCI_GetInt(rslt, 1));
+        ASSERT_EQ(ostring(OTEXT("abc")), ostring(OCI_GetString(rslt, 2)));
+
+        ASSERT_TRUE(OCI_StatementFree(stmt));
+    }
+
+    ASSERT_EQ(2, OCI_GetDescribeCacheHits(conn));
+    ASSERT_EQ(1, OCI_GetDescribeCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_ClearDescribeCache(conn));
+    ASSERT_TRUE(OCI_SetDescribeCacheSize(conn, 0));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST(TestConnection, DescribeCacheAlteredTable)
+{
+    ExecDML(OTEXT("create table TestDescribeCacheAltered(code number(5), name varchar2(5))"));
+    ExecDML(OTEXT("truncate table TestDescribeCacheAltered"));
+    ExecDML(OTEXT("insert into TestDescribeCacheAltered values(1, 'abc')"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto other = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, other);
+
+    ASSERT_TRUE(OCI_SetDescribeCacheSize(conn, 4));
+
+    auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select code, name from TestDescribeCacheAltered")));
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+
+    /* altered by another connection : the describe cache of 'conn' is not cleared */
+
+    ASSERT_TRUE(OCI_Immediate(other, OTEXT("alter table TestDescribeCacheAltered modify name varchar2(50)")));
+    ASSERT_TRUE(OCI_Immediate(other, OTEXT("update TestDescribeCacheAltered set name = 'a much longer name'")));
+    ASSERT_TRUE(OCI_Commit(other));
+
+    stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select code, name from TestDescribeCacheAltered")));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ostring(OTEXT("a much longer name")), ostring(OCI_GetString(rslt, 2)));
+
+    ASSERT_EQ(0, OCI_GetDescribeCacheHits(conn));
+    ASSERT_EQ(2, OCI_GetDescribeCacheMisses(conn));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(other));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDescribeCacheAltered"));
+}
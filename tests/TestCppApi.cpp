@@ -0,0 +1,273 @@
+#include "ocilib_tests.h"
+
+#include "../include/ocilib.hpp"
+
+using namespace ocilib;
+
+TEST(TestCppApi, ResultsetRowIterator)
+{
+    Environment::Initialize();
+
+    Connection conn(DBS, USR, PWD);
+    Statement stmt(conn);
+
+    stmt.Execute(OTEXT("select level from dual connect by level <= 5"));
+
+    auto rs = stmt.GetResultset();
+
+    int count = 0;
+
+    for (auto& row : rs)
+    {
+        ASSERT_EQ(++count, row.Get<int>(1));
+    }
+
+    ASSERT_EQ(5, count);
+
+    Environment::Cleanup();
+}
+
+#ifdef OCILIBPP_HAS_STRING_VIEW
+
+TEST(TestCppApi, ResultsetStringView)
+{
+    Environment::Initialize();
+
+    Connection conn(DBS, USR, PWD);
+    Statement stmt(conn);
+
+    stmt.Execute(OTEXT("select 'abc', cast(null as varchar2(10)) from dual"));
+
+    auto rs = stmt.GetResultset();
+
+    ASSERT_TRUE(rs.Next());
+    ASSERT_EQ(ostring_view(OTEXT("abc")), rs.Get<ostring_view>(1));
+    ASSERT_TRUE(rs.Get<ostring_view>(2).empty());
+    ASSERT_THROW(rs.Get<ostring_view>(3), Exception);
+
+    Environment::Cleanup();
+}
+
+#endif
+
+#ifdef OCILIBPP_HAS_SPAN
+
+TEST(TestCppApi, ResultsetRawView)
+{
+    Environment::Initialize();
+
+    Connection conn(DBS, USR, PWD);
+    Statement stmt(conn);
+
+    stmt.Execute(OTEXT("select hextoraw('010203') from dual"));
+
+    auto rs = stmt.GetResultset();
+
+    ASSERT_TRUE(rs.Next());
+
+    auto value = rs.Get<RawView>(1);
+
+    ASSERT_EQ(3, value.size());
+    ASSERT_EQ(1, value[0]);
+    ASSERT_EQ(3, value[2]);
+
+    Environment::Cleanup();
+}
+
+#endif
+
+#ifdef OCILIBPP_HAS_VARIADIC
+
+TEST(TestCppApi, ResultsetRowTuple)
+{
+    Environment::Initialize();
+
+    Connection conn(DBS, USR, PWD);
+    Statement stmt(conn);
+
+    stmt.Execute(OTEXT("select 1, 2.5, 'label' from dual"));
+
+    auto rs = stmt.GetResultset();
+
+    ASSERT_TRUE(rs.Next());
+
+    auto row = rs.Row<int, double, ostring>();
+
+    ASSERT_EQ(1, std::get<0>(row));
+    ASSERT_EQ(2.5, std::get<1>(row));
+    ASSERT_EQ(ostring(OTEXT("label")), std::get<2>(row));
+
+    Environment::Cleanup();
+}
+
+#endif
+
+static unsigned int BatcherRejectedRow = 0;
+
+static void BatcherErrorHandler(Batcher&, const Exception&, unsigned int row)
+{
+    BatcherRejectedRow = row;
+}
+
+TEST(TestCppApi, BatcherInsert)
+{
+    ExecDML(OTEXT("create table TestCppApiBatcher(code int NOT NULL, name varchar2(20))"));
+    ExecDML(OTEXT("truncate table TestCppApiBatcher"));
+
+    Environment::Initialize();
+
+    Connection conn(DBS, USR, PWD);
+
+    Batcher batcher(conn, OTEXT("insert into TestCppApiBatcher values(:i, :s)"), 2, 2);
+
+    batcher.SetColumn(1, OTEXT(":i"), TypeNumeric, NumericInt);
+    batcher.SetColumn(2, OTEXT(":s"), TypeString, NumericDouble, 20);
+    batcher.SetErrorHandler(BatcherErrorHandler);
+
+    batcher.Set(1, 1);
+    batcher.Set(2, ostring(OTEXT("Name 1")));
+    ASSERT_EQ(Batcher::RowBuffered, batcher.AddRow());
+
+    batcher.Set(1, 2);
+    ASSERT_EQ(Batcher::RowFlushed, batcher.AddRow());
+
+    batcher.Set(2, ostring(OTEXT("Name 3")));
+    ASSERT_EQ(Batcher::RowBuffered, batcher.AddRow());
+
+    batcher.Set(1, 4);
+    ASSERT_EQ(Batcher::RowRejected, batcher.AddRow());
+
+    ASSERT_EQ(3u, BatcherRejectedRow);
+    ASSERT_EQ(1u, batcher.GetErrorCount());
+    ASSERT_EQ(4u, batcher.GetProcessedRows());
+    ASSERT_EQ(0u, batcher.GetPendingRows());
+
+    batcher.Set(1, 5);
+    ASSERT_EQ(Batcher::RowBuffered, batcher.AddRow());
+    batcher.Flush();
+
+    conn.Commit();
+
+    Statement stmt(conn);
+    stmt.Execute(OTEXT("select count(*) from TestCppApiBatcher"));
+
+    auto rs = stmt.GetResultset();
+    ASSERT_TRUE(rs.Next());
+    ASSERT_EQ(4, rs.Get<int>(1));
+
+    Environment::Cleanup();
+
+    ExecDML(OTEXT("drop table TestCppApiBatcher"));
+}
+
+TEST(TestCppApi, BindStringVector)
+{
+    ExecDML(OTEXT("create table TestCppApiStrings(code int, name varchar2(20))"));
+    ExecDML(OTEXT("truncate table TestCppApiStrings"));
+
+    Environment::Initialize();
+
+    Connection conn(DBS, USR, PWD);
+    Statement stmt(conn);
+
+    std::vector<int> codes{ 1, 2, 3 };
+    std::vector<ostring> names{ OTEXT("a"), OTEXT("bb"), OTEXT("ccc") };
+
+    stmt.Prepare(OTEXT("insert into TestCppApiStrings values(:i, :s)"));
+    stmt.SetBindArraySize(3);
+    stmt.Bind(OTEXT(":i"), codes, BindInfo::In);
+    stmt.Bind(OTEXT(":s"), names, 20, BindInfo::In);
+    stmt.ExecutePrepared();
+    ASSERT_EQ(3u, stmt.GetAffectedRows());
+
+    codes = { 4, 5, 6 };
+    names = { OTEXT("dddd"), OTEXT("eeeee"), OTEXT("ffffff") };
+
+    stmt.ExecutePrepared();
+    ASSERT_EQ(3u, stmt.GetAffectedRows());
+
+    std::vector<ostring> values(6);
+
+    stmt.Prepare(OTEXT("begin for i in 1..6 loop select name into :v(i) from TestCppApiStrings where code = i; end loop; end;"));
+    stmt.Bind(OTEXT(":v"), values, 20, BindInfo::Out, BindInfo::AsPlSqlTable);
+    stmt.ExecutePrepared();
+
+    ASSERT_EQ(ostring(OTEXT("a")), values[0]);
+    ASSERT_EQ(ostring(OTEXT("ccc")), values[2]);
+    ASSERT_EQ(ostring(OTEXT("dddd")), values[3]);
+    ASSERT_EQ(ostring(OTEXT("ffffff")), values[5]);
+
+    Environment::Cleanup();
+
+    ExecDML(OTEXT("drop table TestCppApiStrings"));
+}
+
+TEST(TestCppApi, BindDirectArray)
+{
+    ExecDML(OTEXT("create table TestCppApiDirect(code int)"));
+    ExecDML(OTEXT("truncate table TestCppApiDirect"));
+
+    Environment::Initialize();
+
+    Connection conn(DBS, USR, PWD);
+    Statement stmt(conn);
+
+    std::vector<int> codes(ARRAY_SIZE);
+
+    stmt.Prepare(OTEXT("insert into TestCppApiDirect values(:i)"));
+    stmt.SetBindArraySize(ARRAY_SIZE);
+    stmt.Bind(OTEXT(":i"), codes, BindInfo::In, BindInfo::AsDirectArray);
+
+    OCI_Bind* bind = stmt.GetBind(OTEXT(":i"));
+    ASSERT_EQ(static_cast<void*>(codes.data()), OCI_BindGetData(bind));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+    }
+
+    stmt.ExecutePrepared();
+    ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE), stmt.GetAffectedRows());
+
+    stmt.Execute(OTEXT("select sum(code) from TestCppApiDirect"));
+
+    auto rs = stmt.GetResultset();
+    ASSERT_TRUE(rs.Next());
+    ASSERT_EQ(ARRAY_SIZE * (ARRAY_SIZE + 1) / 2, rs.Get<int>(1));
+
+    std::vector<int> values(ARRAY_SIZE);
+    std::vector<int> results(ARRAY_SIZE);
+
+    stmt.Prepare(OTEXT("begin :o := :i * 10; end;"));
+    stmt.SetBindArraySize(ARRAY_SIZE);
+    stmt.Bind(OTEXT(":i"), values, BindInfo::In, BindInfo::AsDirectArray);
+    stmt.Bind(OTEXT(":o"), results, BindInfo::Out, BindInfo::AsDirectArray);
+
+    bind = stmt.GetBind(OTEXT(":o"));
+    ASSERT_EQ(static_cast<void*>(results.data()), OCI_BindGetData(bind));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        values[i] = i;
+    }
+
+    stmt.ExecutePrepared();
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        ASSERT_EQ(i * 10, results[i]);
+    }
+
+    std::vector<int> small(ARRAY_SIZE - 1);
+
+    stmt.Prepare(OTEXT("insert into TestCppApiDirect values(:i)"));
+    stmt.SetBindArraySize(ARRAY_SIZE);
+    stmt.Bind(OTEXT(":i"), small, BindInfo::In, BindInfo::AsDirectArray);
+
+    bind = stmt.GetBind(OTEXT(":i"));
+    ASSERT_NE(static_cast<void*>(small.data()), OCI_BindGetData(bind));
+
+    Environment::Cleanup();
+
+    ExecDML(OTEXT("drop table TestCppApiDirect"));
+}
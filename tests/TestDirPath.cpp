@@ -0,0 +1,908 @@
+#include "ocilib_tests.h"
+
+#include <thread>
+
+static unsigned int DirPathErrorCount = 0;
+
+static void CountDirPathErrors(OCI_Error* err)
+{
+    if (OCI_ERR_ORACLE == OCI_ErrorGetType(err))
+    {
+        DirPathErrorCount++;
+    }
+}
+
+static void SetDirPathRow(OCI_DirPath* dp, unsigned int row, int code, const otext* name)
+{
+    otext value[STRING_SIZE + 1];
+
+    osprintf(value, STRING_SIZE, OTEXT("%d"), code);
+
+    ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 1, value, static_cast<unsigned int>(ostrlen(value)), TRUE));
+
+    if (name)
+    {
+        ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 2, const_cast<otext*>(name), static_cast<unsigned int>(ostrlen(name)), TRUE));
+    }
+    else
+    {
+        ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 2, nullptr, 0, TRUE));
+    }
+}
+
+TEST(TestDirPath, PipelinedLoad)
+{
+    ExecDML(OTEXT("create table TestDirPathPipelined(code number, name varchar2(20))"));
+    ExecDML(OTEXT("truncate table TestDirPathPipelined"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathPipelined"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    const auto dp = OCI_DirPathCreate(tif, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("NAME"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetPipelined(dp, TRUE));
+    ASSERT_TRUE(OCI_DirPathGetPipelined(dp));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    const int batches = 3;
+
+    for (int batch = 0; batch < batches; batch++)
+    {
+        ASSERT_TRUE(OCI_DirPathReset(dp));
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            SetDirPathRow(dp, i + 1, batch * ARRAY_SIZE + i + 1, OTEXT("name"));
+        }
+
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+    }
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+    ASSERT_EQ(static_cast<unsigned int>(batches * ARRAY_SIZE), OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), sum(code) from TestDirPathPipelined")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(batches * ARRAY_SIZE, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(batches * ARRAY_SIZE * (batches * ARRAY_SIZE + 1) / 2, OCI_GetInt(rslt, 2));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathPipelined"));
+}
+
+TEST(TestDirPath, PipelinedLoadErrors)
+{
+    ExecDML(OTEXT("create table TestDirPathPipelinedErr(code number, name varchar2(20) not null)"));
+    ExecDML(OTEXT("truncate table TestDirPathPipelinedErr"));
+
+    DirPathErrorCount = 0;
+
+    ASSERT_TRUE(OCI_Initialize(CountDirPathErrors, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathPipelinedErr"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    const auto dp = OCI_DirPathCreate(tif, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("NAME"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetPipelined(dp, TRUE));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    /* the first batch has two rows rejected by the load */
+
+    ASSERT_TRUE(OCI_DirPathReset(dp));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        SetDirPathRow(dp, i + 1, i + 1, (i == 2 || i == 5) ? nullptr : OTEXT("name"));
+    }
+
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+
+    /* loading the second batch collects the first one */
+
+    ASSERT_TRUE(OCI_DirPathReset(dp));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        SetDirPathRow(dp, i + 1, ARRAY_SIZE + i + 1, OTEXT("name"));
+    }
+
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+
+    ASSERT_EQ(3u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(6u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(0u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(2u, DirPathErrorCount);
+    ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE - 2), OCI_DirPathGetAffectedRows(dp));
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+    ASSERT_EQ(static_cast<unsigned int>(2 * ARRAY_SIZE - 2), OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathPipelinedErr"));
+}
+
+TEST(TestDirPath, ParallelLoader)
+{
+    ExecDML(OTEXT("create table TestDirPathLoader(code number, name varchar2(20))"));
+    ExecDML(OTEXT("truncate table TestDirPathLoader"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED | OCI_ENV_CONTEXT));
+
+    OCI_Connection* cons[2] =
+    {
+        OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT),
+        OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT)
+    };
+
+    ASSERT_NE(nullptr, cons[0]);
+    ASSERT_NE(nullptr, cons[1]);
+
+    const auto ldr = OCI_DirPathLoaderCreate(cons, 2, OTEXT("TestDirPathLoader"), nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, ldr);
+    ASSERT_EQ(2u, OCI_DirPathLoaderGetContextCount(ldr));
+
+    ASSERT_TRUE(OCI_DirPathLoaderSetColumn(ldr, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathLoaderSetColumn(ldr, 2, OTEXT("NAME"), 4, nullptr));
+    ASSERT_TRUE(OCI_DirPathLoaderPrepare(ldr));
+
+    const int count = 2 * ARRAY_SIZE + 5;
+
+    for (int i = 0; i < count; i++)
+    {
+        otext code[STRING_SIZE + 1];
+        otext name[] = OTEXT("name");
+
+        osprintf(code, STRING_SIZE, OTEXT("%d"), i + 1);
+
+        void* values[2] = { code, name };
+        unsigned int sizes[2] = { static_cast<unsigned int>(ostrlen(code)), 4 };
+
+        ASSERT_TRUE(OCI_DirPathLoaderAddRow(ldr, static_cast<unsigned int>(i % 3), values, sizes));
+    }
+
+    /* invalid target and value longer than its column are rejected */
+
+    otext code[] = OTEXT("0");
+    otext name[] = OTEXT("too long");
+
+    void* values[2] = { code, name };
+    unsigned int sizes[2] = { 1, 4 };
+
+    ASSERT_FALSE(OCI_DirPathLoaderAddRow(ldr, 3, values, sizes));
+    ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    sizes[1] = static_cast<unsigned int>(ostrlen(name));
+
+    ASSERT_FALSE(OCI_DirPathLoaderAddRow(ldr, 0, values, sizes));
+    ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    ASSERT_TRUE(OCI_DirPathLoaderFinish(ldr));
+    ASSERT_EQ(static_cast<unsigned int>(count), OCI_DirPathLoaderGetRowCount(ldr));
+    ASSERT_EQ(0u, OCI_DirPathLoaderGetErrorCount(ldr));
+
+    ASSERT_TRUE(OCI_DirPathLoaderFree(ldr));
+
+    const auto stmt = OCI_StatementCreate(cons[0]);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), sum(code) from TestDirPathLoader")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(count, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(count * (count + 1) / 2, OCI_GetInt(rslt, 2));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(cons[0]));
+    ASSERT_TRUE(OCI_ConnectionFree(cons[1]));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathLoader"));
+}
+
+static void SetDirPathVectors(OCI_DirPath* dp, otext names[][STRING_SIZE + 1], unsigned int* name_lens,
+                              unsigned char* name_nulls, unsigned char raws[][8], unsigned int* raw_lens)
+{
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        otext code[STRING_SIZE + 1];
+
+        osprintf(code, STRING_SIZE, OTEXT("%d"), i + 1);
+
+        ASSERT_TRUE(OCI_DirPathSetEntry(dp, i + 1, 1, code, static_cast<unsigned int>(ostrlen(code)), TRUE));
+    }
+
+    ASSERT_TRUE(OCI_DirPathSetColumnData(dp, 2, names, (STRING_SIZE + 1) * sizeof(otext), name_lens, name_nulls));
+    ASSERT_TRUE(OCI_DirPathSetColumnData(dp, 3, raws, 8, raw_lens, nullptr));
+}
+
+TEST(TestDirPath, ColumnDataVectors)
+{
+    ExecDML(OTEXT("create table TestDirPathVectors(code number, name varchar2(20), data raw(4))"));
+    ExecDML(OTEXT("truncate table TestDirPathVectors"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_CONTEXT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathVectors"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    otext names[ARRAY_SIZE][STRING_SIZE + 1];
+    unsigned int name_lens[ARRAY_SIZE];
+    unsigned char name_nulls[(ARRAY_SIZE + 7) / 8] = { 0 };
+    unsigned char raws[ARRAY_SIZE][8];
+    unsigned int raw_lens[ARRAY_SIZE];
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        osprintf(names[i], STRING_SIZE, OTEXT("name %d"), i + 1);
+
+        name_lens[i] = static_cast<unsigned int>(ostrlen(names[i]));
+        raw_lens[i]  = 4;
+
+        memset(raws[i], i + 1, sizeof(raws[i]));
+    }
+
+    /* the fourth name is null and the seventh raw value is too long for its column */
+
+    name_nulls[3 / 8] |= 1 << (3 % 8);
+    raw_lens[6] = 6;
+
+    for (unsigned int mode : { OCI_DCM_DEFAULT, OCI_DCM_FORCE })
+    {
+        const auto dp = OCI_DirPathCreate(tif, nullptr, 3, ARRAY_SIZE);
+        ASSERT_NE(nullptr, dp);
+
+        ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+        ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("NAME"), STRING_SIZE, nullptr));
+        ASSERT_TRUE(OCI_DirPathSetColumn(dp, 3, OTEXT("DATA"), 4, nullptr));
+        ASSERT_TRUE(OCI_DirPathSetConvertMode(dp, mode));
+        ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+        ASSERT_TRUE(OCI_DirPathReset(dp));
+        SetDirPathVectors(dp, names, name_lens, name_nulls, raws, raw_lens);
+
+        if (OCI_DCM_DEFAULT == mode)
+        {
+            /* the conversion fails and the value can be fixed in place */
+
+            ASSERT_EQ(OCI_DPR_ERROR, OCI_DirPathConvert(dp));
+            ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+            raw_lens[6] = 4;
+
+            ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+            ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+            ASSERT_EQ(0u, OCI_DirPathGetErrorRow(dp));
+
+            raw_lens[6] = 6;
+        }
+        else
+        {
+            /* the row is rejected instead of being loaded with a truncated value */
+
+            ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+            ASSERT_EQ(7u, OCI_DirPathGetErrorRow(dp));
+            ASSERT_EQ(0u, OCI_DirPathGetErrorRow(dp));
+            ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+            ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE - 1), OCI_DirPathGetAffectedRows(dp));
+        }
+
+        ASSERT_TRUE(OCI_DirPathFinish(dp));
+        ASSERT_TRUE(OCI_DirPathFree(dp));
+    }
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), count(name), sum(length(name)), max(length(data)) from TestDirPathVectors")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(2 * ARRAY_SIZE - 1, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(2 * ARRAY_SIZE - 3, OCI_GetInt(rslt, 2));
+    ASSERT_EQ(104, OCI_GetInt(rslt, 3));
+    ASSERT_EQ(4, OCI_GetInt(rslt, 4));
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*) from TestDirPathVectors where code = 7")));
+    const auto rslt2 = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt2));
+    ASSERT_EQ(1, OCI_GetInt(rslt2, 1));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathVectors"));
+}
+
+TEST(TestDirPath, LoadErrorRowInSecondBatch)
+{
+    ExecDML(OTEXT("create table TestDirPathBatchErr(code number, name varchar2(20) not null)"));
+    ExecDML(OTEXT("truncate table TestDirPathBatchErr"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathBatchErr"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    const auto dp = OCI_DirPathCreate(tif, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("NAME"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    for (int batch = 0; batch < 2; batch++)
+    {
+        ASSERT_TRUE(OCI_DirPathReset(dp));
+
+        for (int i = 0; i < ARRAY_SIZE; i++)
+        {
+            SetDirPathRow(dp, i + 1, batch * ARRAY_SIZE + i + 1, (batch == 1 && i == 3) ? nullptr : OTEXT("name"));
+        }
+
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+    }
+
+    /* the erred row index is relative to the batch, not to the whole load */
+
+    ASSERT_EQ(4u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(0u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE - 1), OCI_DirPathGetAffectedRows(dp));
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+    ASSERT_EQ(static_cast<unsigned int>(2 * ARRAY_SIZE - 1), OCI_DirPathGetRowCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathBatchErr"));
+}
+
+TEST(TestDirPath, LoadFileRejections)
+{
+    ExecDML(OTEXT("create table TestDirPathFile(code number, name varchar2(300) not null)"));
+    ExecDML(OTEXT("truncate table TestDirPathFile"));
+
+    /* records 3 and 23 are too long, record 5 cannot be converted
+       and record 14 is rejected by the server in the second batch */
+
+    const int count = 25;
+
+    FILE* file = fopen("TestDirPathFile.csv", "wb");
+    ASSERT_NE(nullptr, file);
+
+    fputs("CODE,NAME\n", file);
+
+    for (int i = 1; i <= count; i++)
+    {
+        const std::string name(i == 3 || i == 23 ? 301 : 250, 'x');
+
+        if (i == 5)
+        {
+            fputs("abc,x\n", file);
+        }
+        else if (i == 14)
+        {
+            fputs("14,\n", file);
+        }
+        else
+        {
+            fprintf(file, "%d,%s\n", i, name.c_str());
+        }
+    }
+
+    fclose(file);
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathFile"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    const auto dp = OCI_DirPathCreate(tif, nullptr, 2, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    /* a small stream buffer makes the batches be loaded in several passes */
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("NAME"), 300, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetBufferSize(dp, 2048));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    ASSERT_TRUE(OCI_DirPathLoadFile(dp, OTEXT("TestDirPathFile.csv"), OTEXT("TestDirPathFile.bad"),
+                                    nullptr, OTEXT(','), 0, OCI_DLF_HEADER));
+
+    ASSERT_EQ(4u, OCI_DirPathGetRejectedCount(dp));
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+    ASSERT_EQ(static_cast<unsigned int>(count - 4), OCI_DirPathGetRowCount(dp));
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    /* each rejected record is written once to the bad file */
+
+    std::vector<std::string> rejected;
+    char line[512];
+
+    file = fopen("TestDirPathFile.bad", "rb");
+    ASSERT_NE(nullptr, file);
+
+    while (fgets(line, sizeof(line), file))
+    {
+        rejected.emplace_back(line, strcspn(line, ","));
+    }
+
+    fclose(file);
+
+    ASSERT_EQ((std::vector<std::string>{ "3", "5", "14", "23" }), rejected);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), sum(code) from TestDirPathFile")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(count - 4, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(count * (count + 1) / 2 - (3 + 5 + 14 + 23), OCI_GetInt(rslt, 2));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    remove("TestDirPathFile.csv");
+    remove("TestDirPathFile.bad");
+
+    ExecDML(OTEXT("drop table TestDirPathFile"));
+}
+
+TEST(TestDirPath, ArrowBatch)
+{
+    ExecDML(OTEXT("create table TestDirPathArrow(code number, name varchar2(10), data raw(4))"));
+    ExecDML(OTEXT("truncate table TestDirPathArrow"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_CONTEXT));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathArrow"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    const auto dp = OCI_DirPathCreate(tif, nullptr, 3, ARRAY_SIZE);
+    ASSERT_NE(nullptr, dp);
+
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("NAME"), 10, nullptr));
+    ASSERT_TRUE(OCI_DirPathSetColumn(dp, 3, OTEXT("DATA"), 4, nullptr));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    int codes[ARRAY_SIZE];
+    int32_t name_offsets[ARRAY_SIZE + 1];
+    int32_t data_offsets[ARRAY_SIZE + 1];
+    char names[ARRAY_SIZE * 16];
+    unsigned char data[ARRAY_SIZE * 4];
+    unsigned char valid[2] = { 0xFB, 0xFF };
+
+    name_offsets[0] = 0;
+    data_offsets[0] = 0;
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        codes[i] = i + 1;
+        name_offsets[i + 1] = name_offsets[i] + sprintf(names + name_offsets[i], "name%d", i + 1);
+        data_offsets[i + 1] = data_offsets[i] + 4;
+
+        memset(data + i * 4, i + 1, 4);
+    }
+
+    const void* code_buffers[] = { nullptr, codes };
+    const void* name_buffers[] = { valid, name_offsets, names };
+    const void* data_buffers[] = { nullptr, data_offsets, data };
+    const void* batch_buffers[] = { nullptr };
+
+    ArrowSchema code_schema = { "i", "code", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema name_schema = { "u", "name", nullptr, ARROW_FLAG_NULLABLE, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema data_schema = { "z", "data", nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr };
+    ArrowSchema* schema_children[] = { &code_schema, &name_schema, &data_schema };
+    ArrowSchema schema = { "+s", "", nullptr, 0, 3, schema_children, nullptr, nullptr, nullptr };
+
+    ArrowArray code_array = { ARRAY_SIZE, 0, 0, 2, 0, code_buffers, nullptr, nullptr, nullptr, nullptr };
+    ArrowArray name_array = { ARRAY_SIZE, 1, 0, 3, 0, name_buffers, nullptr, nullptr, nullptr, nullptr };
+    ArrowArray data_array = { ARRAY_SIZE, 0, 0, 3, 0, data_buffers, nullptr, nullptr, nullptr, nullptr };
+    ArrowArray* array_children[] = { &code_array, &name_array, &data_array };
+    ArrowArray array = { ARRAY_SIZE, 0, 0, 1, 3, batch_buffers, array_children, nullptr,
+                         [](ArrowArray* arr) { arr->release = nullptr; }, nullptr };
+
+    /* over long values are not truncated */
+
+    data_offsets[ARRAY_SIZE] = data_offsets[ARRAY_SIZE - 1] + 5;
+
+    ASSERT_TRUE(OCI_DirPathReset(dp));
+    ASSERT_FALSE(OCI_DirPathSetArrowBatch(dp, &schema, &array));
+    ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    data_offsets[ARRAY_SIZE] = data_offsets[ARRAY_SIZE - 1] + 4;
+    name_offsets[1] = name_offsets[0] + 11;
+
+    ASSERT_FALSE(OCI_DirPathSetArrowBatch(dp, &schema, &array));
+    ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    name_offsets[1] = name_offsets[0] + 5;
+
+    ASSERT_TRUE(OCI_DirPathSetArrowBatch(dp, &schema, &array));
+    ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE), OCI_DirPathGetCurrentRows(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+    ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE), OCI_DirPathGetRowCount(dp));
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select code, name, data from TestDirPathArrow order by code")));
+    const auto rslt = OCI_GetResultset(stmt);
+
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(1, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(ostring(OTEXT("name1")), OCI_GetString(rslt, 2));
+    ASSERT_EQ(ostring(OTEXT("01010101")), OCI_GetString(rslt, 3));
+
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(3, OCI_GetInt(rslt, 1));
+    ASSERT_TRUE(OCI_IsNull(rslt, 2));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathArrow"));
+}
+
+static const otext* DirPathNumberFormat = OTEXT("999999999999999999999999999999999999999999999.9999999999");
+static const otext* DirPathDateFormat   = OTEXT("YYYY-MM-DD HH24:MI:SS");
+
+static OCI_DirPath* CreateConvertDirPath(OCI_TypeInfo* tif, unsigned int nb_rows, unsigned int mode)
+{
+    const auto dp = OCI_DirPathCreate(tif, nullptr, 5, nb_rows);
+
+    if (dp)
+    {
+        OCI_DirPathSetConvertThreads(dp, 2);
+        OCI_DirPathSetConvertMode(dp, mode);
+
+        OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr);
+        OCI_DirPathSetColumn(dp, 2, OTEXT("NUM"), 60, DirPathNumberFormat);
+        OCI_DirPathSetColumn(dp, 3, OTEXT("NUM_TXT"), 60, nullptr);
+        OCI_DirPathSetColumn(dp, 4, OTEXT("DT"), 19, DirPathDateFormat);
+        OCI_DirPathSetColumn(dp, 5, OTEXT("DT_TXT"), 19, nullptr);
+    }
+
+    return dp;
+}
+
+static void SetConvertRow(OCI_DirPath* dp, unsigned int row, int code, const otext* num, const otext* date)
+{
+    otext value[STRING_SIZE + 1];
+
+    osprintf(value, STRING_SIZE, OTEXT("%d"), code);
+
+    const unsigned int num_len  = static_cast<unsigned int>(ostrlen(num));
+    const unsigned int date_len = static_cast<unsigned int>(ostrlen(date));
+
+    ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 1, value, static_cast<unsigned int>(ostrlen(value)), TRUE));
+    ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 2, const_cast<otext*>(num), num_len, TRUE));
+    ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 3, const_cast<otext*>(num), num_len, TRUE));
+    ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 4, const_cast<otext*>(date), date_len, TRUE));
+    ASSERT_TRUE(OCI_DirPathSetEntry(dp, row, 5, const_cast<otext*>(date), date_len, TRUE));
+}
+
+TEST(TestDirPath, ClientConversionMatchesOci)
+{
+    ExecDML(OTEXT("create table TestDirPathConvert(code number, num number, num_txt varchar2(60), dt date, dt_txt varchar2(19))"));
+    ExecDML(OTEXT("truncate table TestDirPathConvert"));
+
+    /* values converted in C are compared with the conversion of the same strings by the server */
+
+    const otext* numbers[] =
+    {
+        OTEXT("0"),
+        OTEXT("-0"),
+        OTEXT("7"),
+        OTEXT("-7"),
+        OTEXT("007"),
+        OTEXT("-000.500"),
+        OTEXT("0000123.4500"),
+        OTEXT("-0.001"),
+        OTEXT("0.0000000001"),
+        OTEXT(".5"),
+        OTEXT("5."),
+        OTEXT("1234567890123456789012345678901234567890"),
+        OTEXT("-1234567890123456789012345678901234567890"),
+        OTEXT("12345678901234567890123456789012345678901"),
+        OTEXT("99999999999999999999999999999999999999999"),
+        OTEXT("100000000000000000000000000000000000000000"),
+        OTEXT("1234567890123456789012345678901234567.891")
+    };
+
+    const otext* dates[] =
+    {
+        OTEXT("2024-02-29 23:59:59"),
+        OTEXT("2000-02-29 00:00:00"),
+        OTEXT("1900-02-28 12:30:45"),
+        OTEXT("1582-10-04 08:00:00"),
+        OTEXT("1583-01-01 00:00:00"),
+        OTEXT("0001-01-01 00:00:00"),
+        OTEXT("9999-12-31 23:59:59")
+    };
+
+    const unsigned int count     = sizeof(numbers) / sizeof(numbers[0]);
+    const unsigned int nb_dates  = sizeof(dates) / sizeof(dates[0]);
+
+    ASSERT_TRUE(OCI_Initialize(CountDirPathErrors, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    DirPathErrorCount = 0;
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathConvert"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    const auto dp = CreateConvertDirPath(tif, count, OCI_DCM_DEFAULT);
+    ASSERT_NE(nullptr, dp);
+    ASSERT_EQ(2u, OCI_DirPathGetConvertThreads(dp));
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+    /* converting twice reuses the workers started by OCI_DirPathPrepare() */
+
+    for (int batch = 0; batch < 2; batch++)
+    {
+        ASSERT_TRUE(OCI_DirPathReset(dp));
+
+        for (unsigned int i = 0; i < count; i++)
+        {
+            SetConvertRow(dp, i + 1, static_cast<int>(batch * count + i + 1), numbers[i], dates[i % nb_dates]);
+        }
+
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+        ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+        ASSERT_EQ(0u, OCI_DirPathGetErrorRow(dp));
+    }
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+    ASSERT_EQ(2 * count, OCI_DirPathGetRowCount(dp));
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmtFmt(stmt, OTEXT("select count(*), ")
+                                         OTEXT("sum(case when num = to_number(num_txt, %s) then 1 else 0 end), ")
+                                         OTEXT("sum(case when dt = to_date(dt_txt, %s) then 1 else 0 end) ")
+                                         OTEXT("from TestDirPathConvert"),
+                                   DirPathNumberFormat, DirPathDateFormat));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(static_cast<int>(2 * count), OCI_GetInt(rslt, 1));
+    ASSERT_EQ(static_cast<int>(2 * count), OCI_GetInt(rslt, 2));
+    ASSERT_EQ(static_cast<int>(2 * count), OCI_GetInt(rslt, 3));
+
+    ASSERT_EQ(0u, DirPathErrorCount);
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathConvert"));
+}
+
+TEST(TestDirPath, ClientConversionForceMode)
+{
+    ExecDML(OTEXT("create table TestDirPathConvertForce(code number, num number, num_txt varchar2(60), dt date, dt_txt varchar2(19))"));
+    ExecDML(OTEXT("truncate table TestDirPathConvertForce"));
+
+    ASSERT_TRUE(OCI_Initialize(CountDirPathErrors, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    DirPathErrorCount = 0;
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathConvertForce"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    const auto dp = CreateConvertDirPath(tif, ARRAY_SIZE, OCI_DCM_FORCE);
+    ASSERT_NE(nullptr, dp);
+    ASSERT_TRUE(OCI_DirPathPrepare(dp));
+    ASSERT_TRUE(OCI_DirPathReset(dp));
+
+    /* values rejected in C and by OCI are reported as erred rows without raising errors */
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        const otext* num  = (i == 5) ? OTEXT("1E5") : OTEXT("-42.5");
+        const otext* date = (i == 2) ? OTEXT("2023-02-29 00:00:00") : OTEXT("2024-02-29 10:20:30");
+
+        SetConvertRow(dp, i + 1, i + 1, num, date);
+    }
+
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathConvert(dp));
+    ASSERT_EQ(3u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(6u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(0u, OCI_DirPathGetErrorRow(dp));
+    ASSERT_EQ(OCI_DPR_COMPLETE, OCI_DirPathLoad(dp));
+    ASSERT_EQ(static_cast<unsigned int>(ARRAY_SIZE - 2), OCI_DirPathGetAffectedRows(dp));
+
+    ASSERT_TRUE(OCI_DirPathFinish(dp));
+    ASSERT_TRUE(OCI_DirPathFree(dp));
+
+    ASSERT_EQ(0u, DirPathErrorCount);
+
+    const auto stmt = OCI_StatementCreate(conn);
+    ASSERT_NE(nullptr, stmt);
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, OTEXT("select count(*), sum(code), min(num), max(dt - date '2024-02-29') from TestDirPathConvertForce")));
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+    ASSERT_EQ(ARRAY_SIZE - 2, OCI_GetInt(rslt, 1));
+    ASSERT_EQ(ARRAY_SIZE * (ARRAY_SIZE + 1) / 2 - 3 - 6, OCI_GetInt(rslt, 2));
+    ASSERT_EQ(-42.5, OCI_GetDouble(rslt, 3));
+    ASSERT_LT(0.0, OCI_GetDouble(rslt, 4));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathConvertForce"));
+}
+
+struct DirPathProgress
+{
+    std::thread::id thread;
+    unsigned int calls;
+    bool other_thread;
+    OCI_DirPathStats last;
+};
+
+static void DirPathProgressHandler(OCI_DirPath*, const OCI_DirPathStats* stats, void* ctx)
+{
+    auto progress = static_cast<DirPathProgress*>(ctx);
+
+    progress->calls++;
+    progress->other_thread |= (std::this_thread::get_id() != progress->thread);
+    progress->last = *stats;
+}
+
+TEST(TestDirPath, StatsAndProgress)
+{
+    ExecDML(OTEXT("create table TestDirPathStats(code number, name varchar2(20) not null)"));
+
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_THREADED));
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    ASSERT_NE(nullptr, conn);
+
+    const auto tif = OCI_TypeInfoGet(conn, OTEXT("TestDirPathStats"), OCI_TIF_TABLE);
+    ASSERT_NE(nullptr, tif);
+
+    for (bool pipelined : { false, true })
+    {
+        ExecDML(OTEXT("truncate table TestDirPathStats"));
+
+        DirPathProgress progress{ std::this_thread::get_id(), 0, false, {} };
+
+        const auto dp = OCI_DirPathCreate(tif, nullptr, 2, ARRAY_SIZE);
+        ASSERT_NE(nullptr, dp);
+
+        ASSERT_TRUE(OCI_DirPathSetColumn(dp, 1, OTEXT("CODE"), STRING_SIZE, nullptr));
+        ASSERT_TRUE(OCI_DirPathSetColumn(dp, 2, OTEXT("NAME"), STRING_SIZE, nullptr));
+        ASSERT_TRUE(OCI_DirPathSetConvertMode(dp, OCI_DCM_FORCE));
+        ASSERT_TRUE(OCI_DirPathSetPipelined(dp, pipelined));
+        ASSERT_TRUE(OCI_DirPathSetProgressHandler(dp, DirPathProgressHandler, 0, &progress));
+        ASSERT_TRUE(OCI_DirPathPrepare(dp));
+
+        /* the second batch has a value rejected by the conversion
+           and the third one a row rejected by the load */
+
+        for (int batch = 0; batch < 3; batch++)
+        {
+            ASSERT_TRUE(OCI_DirPathReset(dp));
+
+            for (int i = 0; i < ARRAY_SIZE; i++)
+            {
+                SetDirPathRow(dp, i + 1, batch * ARRAY_SIZE + i + 1, (batch == 2 && i == 4) ? nullptr : OTEXT("name"));
+            }
+
+            if (batch == 1)
+            {
+                otext code[] = OTEXT("abc");
+
+                ASSERT_TRUE(OCI_DirPathSetEntry(dp, 6, 1, code, 3, TRUE));
+            }
+
+            OCI_DirPathConvert(dp);
+            OCI_DirPathLoad(dp);
+        }
+
+        ASSERT_TRUE(OCI_DirPathFinish(dp));
+
+        OCI_DirPathStats stats;
+
+        ASSERT_TRUE(OCI_DirPathGetStats(dp, &stats));
+
+        ASSERT_EQ(3u, stats.conversions);
+        ASSERT_EQ(static_cast<big_uint>(3 * ARRAY_SIZE - 1), stats.rows_converted);
+        ASSERT_EQ(static_cast<big_uint>(3 * ARRAY_SIZE - 2), stats.rows_loaded);
+        ASSERT_EQ(3u, stats.streams);
+        ASSERT_LT(0u, stats.bytes);
+        ASSERT_EQ(1u, stats.conversion_errors);
+        ASSERT_EQ(1u, stats.load_errors);
+        ASSERT_EQ(0u, stats.stream_full);
+        ASSERT_EQ(1u, stats.retries);
+        ASSERT_EQ(3u, stats.phases[OCI_DPP_FILL].count);
+        ASSERT_EQ(0u, stats.phases[OCI_DPP_VALUES].count);
+        ASSERT_EQ(3u, stats.phases[OCI_DPP_LOAD].count);
+
+        /* every load and the final statistics are reported on the calling thread */
+
+        ASSERT_EQ(4u, progress.calls);
+        ASSERT_FALSE(progress.other_thread);
+        ASSERT_EQ(stats.rows_loaded, progress.last.rows_loaded);
+        ASSERT_EQ(stats.load_errors, progress.last.load_errors);
+
+        ASSERT_TRUE(OCI_DirPathResetStats(dp));
+        ASSERT_TRUE(OCI_DirPathGetStats(dp, &stats));
+        ASSERT_EQ(0u, stats.conversions);
+        ASSERT_EQ(0u, stats.rows_loaded);
+        ASSERT_EQ(0u, stats.phases[OCI_DPP_LOAD].count);
+
+        ASSERT_TRUE(OCI_DirPathFree(dp));
+    }
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+
+    ExecDML(OTEXT("drop table TestDirPathStats"));
+}
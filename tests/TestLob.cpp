@@ -7,7 +7,7 @@ std::vector<unsigned int> LobTypes{ OCI_BLOB, OCI_CLOB, OCI_NCLOB };
 
 void* GetBufferData()
 {
-    static otext* buf = OTEXT("123456");
+    static otext buf[] = OTEXT("123456");
 
     return  static_cast<void*>(buf);
 }
@@ -68,6 +68,227 @@ TEST_P(TestLob, ArrayCreateAndFree)
     ASSERT_TRUE(OCI_Cleanup());
 }
 
+TEST_P(TestLob, ArrayWriteAndRead)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    auto type = GetParam();
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    const auto lobs = OCI_LobArrayCreate(conn, type, ARRAY_SIZE);
+    ASSERT_TRUE(nullptr != lobs);
+
+    unsigned int size = GetBufferSize(type);
+    unsigned char buffer_out[ARRAY_SIZE][1024] = {};
+    void* buffers_in[ARRAY_SIZE];
+    void* buffers_out[ARRAY_SIZE];
+    unsigned int char_counts[ARRAY_SIZE];
+    unsigned int byte_counts[ARRAY_SIZE];
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        buffers_in[i] = GetBufferData();
+        buffers_out[i] = buffer_out[i];
+        char_counts[i] = type == OCI_BLOB ? 0 : size;
+        byte_counts[i] = type == OCI_BLOB ? size : 0;
+    }
+
+    ASSERT_TRUE(OCI_LobArrayWrite(lobs, ARRAY_SIZE, buffers_in, char_counts, byte_counts));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        ASSERT_EQ(size, type == OCI_BLOB ? byte_counts[i] : char_counts[i]);
+        ASSERT_EQ(size, OCI_LobGetLength(lobs[i]));
+        ASSERT_TRUE(OCI_LobSeek(lobs[i], 0, OCI_SEEK_SET));
+
+        char_counts[i] = type == OCI_BLOB ? 0 : size;
+        byte_counts[i] = type == OCI_BLOB ? size : 0;
+    }
+
+    ASSERT_TRUE(OCI_LobArrayRead(lobs, ARRAY_SIZE, buffers_out, char_counts, byte_counts));
+
+    for (int i = 0; i < ARRAY_SIZE; i++)
+    {
+        ASSERT_EQ(size, type == OCI_BLOB ? byte_counts[i] : char_counts[i]);
+        ASSERT_EQ(size, OCI_LobGetOffset(lobs[i]));
+        ASSERT_EQ(0, memcmp(buffers_in[i], buffers_out[i], size));
+    }
+
+    ASSERT_TRUE(OCI_LobArrayFree(lobs));
+
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+struct LobStreamContext
+{
+    std::vector<unsigned char> data;
+    size_t offset;
+};
+
+static unsigned int LobStreamSource(OCI_Lob*, void* buffer, unsigned int size, void* ctx)
+{
+    auto stream = static_cast<LobStreamContext*>(ctx);
+    auto count = std::min(static_cast<size_t>(size), stream->data.size() - stream->offset);
+
+    memcpy(buffer, stream->data.data() + stream->offset, count);
+    stream->offset += count;
+
+    return static_cast<unsigned int>(count);
+}
+
+static boolean LobStreamSink(OCI_Lob*, const void* buffer, unsigned int size, void* ctx)
+{
+    auto stream = static_cast<LobStreamContext*>(ctx);
+    auto data = static_cast<const unsigned char*>(buffer);
+
+    stream->data.insert(stream->data.end(), data, data + size);
+
+    return TRUE;
+}
+
+TEST_P(TestLob, StreamWriteAndRead)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    auto type = GetParam();
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    const auto lob = OCI_LobCreate(conn, type);
+
+    LobStreamContext input{ {}, 0 };
+    LobStreamContext output{ {}, 0 };
+
+    const unsigned int count = 1024 * 1024;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        otext c = static_cast<otext>(OTEXT('a') + i % 26);
+        auto bytes = reinterpret_cast<unsigned char*>(&c);
+        input.data.insert(input.data.end(), bytes, bytes + sizeof(otext));
+    }
+
+    unsigned int size = type == OCI_BLOB ? count * sizeof(otext) : count;
+
+    ASSERT_TRUE(OCI_LobStreamWrite(lob, LobStreamSource, &input));
+    ASSERT_EQ(size, OCI_LobGetLength(lob));
+    ASSERT_EQ(size, OCI_LobGetOffset(lob));
+
+    ASSERT_TRUE(OCI_LobSeek(lob, 0, OCI_SEEK_SET));
+    ASSERT_TRUE(OCI_LobStreamRead(lob, 0, LobStreamSink, &output));
+    ASSERT_EQ(size, OCI_LobGetOffset(lob));
+    ASSERT_TRUE(input.data == output.data);
+
+    ASSERT_TRUE(OCI_LobFree(lob));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST_P(TestLob, FetchInline)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT));
+
+    auto type = GetParam();
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    const auto stmt = OCI_StatementCreate(conn);
+
+    ASSERT_EQ(OCI_LOB_LOCATOR, OCI_GetLobMode(stmt));
+    ASSERT_EQ(OCI_SIZE_LOB_INLINE, OCI_GetLobInlineSize(stmt));
+
+    ASSERT_TRUE(OCI_SetLobMode(stmt, OCI_LOB_INLINE));
+    ASSERT_TRUE(OCI_SetLobInlineSize(stmt, 100));
+    ASSERT_EQ(OCI_LOB_INLINE, OCI_GetLobMode(stmt));
+    ASSERT_EQ(100, OCI_GetLobInlineSize(stmt));
+
+    const otext* sql = type == OCI_BLOB ? OTEXT("select to_blob(hextoraw('313233343536')) from dual") :
+                       type == OCI_CLOB ? OTEXT("select to_clob('123456') from dual") :
+                                          OTEXT("select to_nclob('123456') from dual");
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, sql));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+
+    if (type == OCI_BLOB)
+    {
+        unsigned char buffer[10];
+
+        ASSERT_EQ(OCI_CDT_RAW, OCI_ColumnGetType(OCI_GetColumn(rslt, 1)));
+        ASSERT_EQ(6, OCI_GetRaw(rslt, 1, buffer, sizeof(buffer)));
+        ASSERT_EQ(0, memcmp(buffer, "123456", 6));
+    }
+    else
+    {
+        ASSERT_EQ(OCI_CDT_TEXT, OCI_ColumnGetType(OCI_GetColumn(rslt, 1)));
+        ASSERT_EQ(ostring(OTEXT("123456")), ostring(OCI_GetString(rslt, 1)));
+    }
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
+
+TEST_P(TestLob, FetchInlineTruncated)
+{
+    ASSERT_TRUE(OCI_Initialize(nullptr, HOME, OCI_ENV_DEFAULT | OCI_ENV_CONTEXT));
+
+    auto type = GetParam();
+
+    const auto conn = OCI_ConnectionCreate(DBS, USR, PWD, OCI_SESSION_DEFAULT);
+    const auto stmt = OCI_StatementCreate(conn);
+
+    /* fetch buffers lengths must fit in 16 bits */
+
+    ASSERT_FALSE(OCI_SetLobInlineSize(stmt, 70000));
+    ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+    ASSERT_EQ(OCI_SIZE_LOB_INLINE, OCI_GetLobInlineSize(stmt));
+
+    ASSERT_TRUE(OCI_SetLobMode(stmt, OCI_LOB_INLINE));
+    ASSERT_TRUE(OCI_SetLobInlineSize(stmt, 4));
+
+    /* the first value fits in the inline buffer, the second one is truncated by OCI */
+
+    const otext* sql = type == OCI_BLOB ? OTEXT("select to_blob(hextoraw(rpad('31', level * 6, '31'))) from dual connect by level <= 2") :
+                       type == OCI_CLOB ? OTEXT("select to_clob(rpad('1', level * 3, '1')) from dual connect by level <= 2") :
+                                          OTEXT("select to_nclob(rpad('1', level * 3, '1')) from dual connect by level <= 2");
+
+    ASSERT_TRUE(OCI_ExecuteStmt(stmt, sql));
+
+    const auto rslt = OCI_GetResultset(stmt);
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+
+    unsigned char buffer[10];
+
+    if (type == OCI_BLOB)
+    {
+        ASSERT_EQ(3, OCI_GetRaw(rslt, 1, buffer, sizeof(buffer)));
+        ASSERT_EQ(0, memcmp(buffer, "111", 3));
+    }
+    else
+    {
+        ASSERT_EQ(ostring(OTEXT("111")), ostring(OCI_GetString(rslt, 1)));
+    }
+
+    ASSERT_TRUE(OCI_FetchNext(rslt));
+
+    /* the truncated value is reported instead of being returned */
+
+    if (type == OCI_BLOB)
+    {
+        ASSERT_EQ(0, OCI_GetRaw(rslt, 1, buffer, sizeof(buffer)));
+    }
+    else
+    {
+        ASSERT_EQ(nullptr, OCI_GetString(rslt, 1));
+    }
+
+    ASSERT_EQ(OCI_ERR_MAX_VALUE, OCI_ErrorGetInternalCode(OCI_GetLastError()));
+
+    ASSERT_TRUE(OCI_StatementFree(stmt));
+    ASSERT_TRUE(OCI_ConnectionFree(conn));
+    ASSERT_TRUE(OCI_Cleanup());
+}
 
 TEST_P(TestLob, AssignEmpty)
 {